@@ -0,0 +1,27 @@
+#ifndef MESH_PACKED_VERTEX_H
+#define MESH_PACKED_VERTEX_H
+
+// Decoding of the meshes finalized with MeshConfiguration::VERTEX_PACKED:
+// position RGBA16_UNORM, normal RG16_SNORM (octahedral), uv RG16_FLOAT.
+// The decode scale and offset come from Mesh.GetPositionDecodeScale() and Mesh.GetPositionDecodeOffset()
+// in the scripts, they are (1,1,1) and (0,0,0) for unpacked meshes so DecodePackedPosition works on any mesh.
+
+// position = offset + scale * normalized position, over the bounding box of the mesh
+float4 DecodePackedPosition(float4 packedPosition, float3 decodeScale, float3 decodeOffset)
+{
+    return float4(decodeOffset + decodeScale * packedPosition.xyz, 1.0);
+}
+
+// inverse of the octahedral encoding of MeshData: the lower half of the octahedron is unfolded
+float3 DecodeOctahedralNormal(float2 packedNormal)
+{
+    float2 e = max(packedNormal, -1.0);
+    float3 n = float3(e, 1.0 - abs(e.x) - abs(e.y));
+    if (n.z < 0.0)
+    {
+        n.xy = (1.0 - abs(n.yx)) * float2(n.x >= 0.0 ? 1.0 : -1.0, n.y >= 0.0 ? 1.0 : -1.0);
+    }
+    return normalize(n);
+}
+
+#endif
@@ -19,7 +19,9 @@
 #include "Pegasus/Application/AppWindowComponentFactory.h"
 #include "Pegasus/Application/Components/EditorComponents.h"
 #include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/WorkerPool.h"
 #include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/NodeDataCache.h"
 #include "Pegasus/Memory/MemoryManager.h"
 #include "Pegasus/Render/IDevice.h"
 #include "Pegasus/Render/ShaderFactory.h"
@@ -48,6 +50,9 @@
 namespace Pegasus {
 namespace App {
 
+//! Cache file of the generated node data, relative to the root of the IO manager
+static const char* NODE_DATA_CACHE_FILE = "NodeDataCache.pgc";
+
 //----------------------------------------------------------------------------------------
 
 Application::Application(const ApplicationConfig& config)
@@ -90,6 +95,8 @@ Application::Application(const ApplicationConfig& config)
     // Set up the time system
     Core::InitializePegasusTime();
 
+    // Set up the worker threads, used by the graph evaluation
+    Core::WorkerPool::CreateInstance(coreAlloc);
 
     // Set up window manager
     mWindowManager = PG_NEW(windowAlloc, -1, "AppWindowManager", Alloc::PG_MEM_PERM) AppWindowManager(windowAlloc);
@@ -189,6 +196,7 @@ Application::~Application()
     PG_DELETE(nodeAlloc, mBsReflectionInfo);
 #endif
     PG_DELETE(coreAlloc, mIoManager);
+    Core::WorkerPool::DestroyInstance();
     
     //Kill device and context
     PG_DELETE(renderAlloc, mRenderContext);
@@ -217,6 +225,11 @@ void Application::Load()
     // (since the default render target belongs to the window) should use the main application context
     mRenderContext->Bind();
 
+    // Data generated during the previous run, read when the graphs are first evaluated
+    if (mConfig.mUseNodeDataCacheFile)
+    {
+        mNodeManager->GetDataCache()->Load(mIoManager, NODE_DATA_CACHE_FILE);
+    }
 
     mRenderSystemManager->AddInternalSystems();
     RegisterCustomRenderSystems(mRenderSystemManager);
@@ -287,6 +300,11 @@ void Application::Unload()
 
     // Destroy all the systems this app might have
     mRenderSystemManager->DestroyAllSystems();
+
+    if (mConfig.mUseNodeDataCacheFile)
+    {
+        mNodeManager->GetDataCache()->Save(mIoManager, NODE_DATA_CACHE_FILE);
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -350,8 +350,8 @@ void GridComponent::Load(Core::IApplicationContext* appContext)
         PG_ASSERT(4*i+3 < vertexCount);
     }
 
-    unsigned short * idx = meshData->GetIndexBuffer();
-    for (unsigned short l = 0; l < (short)vertexCount; ++l)
+    unsigned int * idx = meshData->GetIndexBuffer();
+    for (unsigned int l = 0; l < (unsigned int)vertexCount; ++l)
     {
         idx[l] = l;
     }
@@ -379,7 +379,7 @@ void GridComponent::Load(Core::IApplicationContext* appContext)
     reticleMeshData->PushVertex(Vertex(Vec4(0.0f,0.0f,0.0f,1.0f), zColor),0);
     reticleMeshData->PushVertex(Vertex(Vec4(0.0f,0.0f,1.0f,1.0f), zColor),0);
 
-    for (unsigned short i = 0; i < 6; ++i) reticleMeshData->PushIndex(i);
+    for (unsigned int i = 0; i < 6; ++i) reticleMeshData->PushIndex(i);
 
     mReticle->SetGeneratorInput(mReticleGenerator);
 
@@ -150,7 +150,7 @@ namespace Application
 
     
     RenderCollectionFactory::RenderCollectionFactory(Core::IApplicationContext* context, Alloc::IAllocator* alloc)
-        :mAlloc(alloc), mPropLayoutEntries(alloc), mContext(context)
+        :mPropLayoutEntries(alloc), mPropLayoutIndices(alloc), mAlloc(alloc), mContext(context)
     {
     }
 
@@ -160,6 +160,11 @@ namespace Application
 
     void RenderCollectionFactory::RegisterProperties(const BlockScript::ClassTypeDesc& classDesc)
     {
+        //the first layout registered for a class is the one found, as with the former linear search
+        if (!mPropLayoutIndices.Contains(classDesc.classTypeName))
+        {
+            mPropLayoutIndices.Insert(classDesc.classTypeName, mPropLayoutEntries.GetSize());
+        }
         RenderCollectionFactory::PropEntries& entry = mPropLayoutEntries.PushEmpty();
         entry.mName = classDesc.classTypeName;
         for (int i = 0; i < classDesc.propertyCount; ++i)
@@ -180,15 +185,8 @@ namespace Application
 
     const RenderCollectionFactory::PropEntries* RenderCollectionFactory::FindNodeLayoutEntry(const char* nodeTypeName) const
     {
-        for (unsigned int i = 0; i < mPropLayoutEntries.GetSize(); ++i)
-        {
-            const RenderCollectionFactory::PropEntries& entry = mPropLayoutEntries[i];
-            if (!Utils::Strcmp(nodeTypeName, entry.mName))
-            {
-                return &entry;
-            }
-        }
-        return nullptr;
+        const unsigned int* index = mPropLayoutIndices.Find(nodeTypeName);
+        return index != nullptr ? &mPropLayoutEntries[*index] : nullptr;
     }
 
     class RenderCollectionImpl
@@ -393,6 +391,9 @@ namespace Application
 
     void RenderCollection::UpdateAll()
     {
+        // Nodes shared by several resources are updated once
+        Graph::EvaluationPass evaluationPass;
+
         #define RES_PROCESS(type, instance, metaname, hasProperties, canUpdate) \
             Updater<type,canUpdate>::TemplateUpdateAll(mImpl->instance);
         #include "../Source/Pegasus/Application/RenderResources.inl"
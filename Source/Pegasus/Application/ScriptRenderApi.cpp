@@ -64,6 +64,13 @@ void MeshOperator_AddOperatorInput(FunCallbackContext& context);
 void MeshOperator_AddGeneratorInput(FunCallbackContext& context);
 void Mesh_SetGeneratorInput(FunCallbackContext& context);
 void Mesh_SetOperatorInput(FunCallbackContext& context);
+void Mesh_GetBoundingBoxMin(FunCallbackContext& context);
+void Mesh_GetBoundingBoxMax(FunCallbackContext& context);
+void Mesh_GetBoundingSphere(FunCallbackContext& context);
+void Mesh_IsVisible(FunCallbackContext& context);
+void Mesh_IsPacked(FunCallbackContext& context);
+void Mesh_GetPositionDecodeScale(FunCallbackContext& context);
+void Mesh_GetPositionDecodeOffset(FunCallbackContext& context);
 
 /////Texture Methods/////////////////////////////////////////
 void TextureOperator_AddOperatorInput(FunCallbackContext& context);
@@ -119,6 +126,7 @@ void Render_SetPixelSampler(FunCallbackContext& context);
 void Render_SetVertexSampler(FunCallbackContext& context);
 void Render_SetDepthClearValue(FunCallbackContext& context);
 void Render_Draw(FunCallbackContext& context);
+void Render_DrawLod(FunCallbackContext& context);
 void Render_DrawInstanced(FunCallbackContext& context);
 void Render_Dispatch(FunCallbackContext& context);
 void Render_CreateRenderTarget(FunCallbackContext& context);
@@ -159,6 +167,91 @@ void Templated_GlobalCache_PrototypeRegisterGenericResource(FunCallbackContext&
     GlobalCache_Register<Application::GenericResource,isWindowIdUsed>(context);
 }
 
+//! Get the updated data of a mesh, generated if needed, to read its bounds or its vertex format
+//! \param context the context of the mesh method, the mesh being the first argument
+//! \param stream the stream of the arguments, the mesh being read from it
+//! \return the mesh data, nullptr for an invalid mesh
+static Mesh::MeshDataReturn GetMeshDataArgument(FunCallbackContext& context, FunParamStream& stream)
+{
+    RenderCollection* collection = GetContainer(context.GetVmState());
+    RenderCollection::CollectionHandle& meshHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
+    if (meshHandle == RenderCollection::INVALID_HANDLE)
+    {
+        PG_LOG('ERR_', "Invalid mesh, its data cannot be read");
+        return nullptr;
+    }
+    Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(collection, meshHandle);
+    return mesh->GetUpdatedMeshData();
+}
+
+void Mesh_GetBoundingBoxMin(FunCallbackContext& context)
+{
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    stream.SubmitReturn<Math::Vec3>(meshData != nullptr ? meshData->GetBoundingBox().GetMin() : Math::POINT3_ORIGIN);
+}
+
+void Mesh_GetBoundingBoxMax(FunCallbackContext& context)
+{
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    stream.SubmitReturn<Math::Vec3>(meshData != nullptr ? meshData->GetBoundingBox().GetMax() : Math::POINT3_ORIGIN);
+}
+
+void Mesh_GetBoundingSphere(FunCallbackContext& context)
+{
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    Math::Vec4 sphere(0.0f, 0.0f, 0.0f, 0.0f);
+    if (meshData != nullptr)
+    {
+        const Math::Point3 & center = meshData->GetBoundingSphere().GetCenter();
+        sphere = Math::Vec4(center.x, center.y, center.z, meshData->GetBoundingSphere().GetRadius());
+    }
+    stream.SubmitReturn<Math::Vec4>(sphere);
+}
+
+void Mesh_IsVisible(FunCallbackContext& context)
+{
+    // Only the box is tested, the draw being skipped when it is fully outside one plane of the clip space.
+    // Meshes without bounds (such as the ones generated on the GPU) are always visible
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    Math::Mat44& worldViewProj = stream.NextArgument<Math::Mat44>();
+    int retVal = 0;
+    if (meshData != nullptr && !meshData->AreBoundsValid())
+    {
+        retVal = 1;
+    }
+    else if (meshData != nullptr)
+    {
+        retVal = meshData->GetBoundingBox().IsOutsideClipSpace(worldViewProj) ? 0 : 1;
+    }
+    stream.SubmitReturn(retVal);
+}
+
+void Mesh_IsPacked(FunCallbackContext& context)
+{
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    stream.SubmitReturn(meshData != nullptr && meshData->IsPacked() ? 1 : 0);
+}
+
+void Mesh_GetPositionDecodeScale(FunCallbackContext& context)
+{
+    // Unpacked positions are not scaled, so the shaders can decode the positions of any mesh
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    stream.SubmitReturn<Math::Vec3>(meshData != nullptr && meshData->IsPacked() ? meshData->GetPositionDecodeScale() : Math::Vec3(1.0f, 1.0f, 1.0f));
+}
+
+void Mesh_GetPositionDecodeOffset(FunCallbackContext& context)
+{
+    FunParamStream stream(context);
+    Mesh::MeshDataRef meshData = GetMeshDataArgument(context, stream);
+    stream.SubmitReturn<Math::Vec3>(meshData != nullptr && meshData->IsPacked() ? meshData->GetPositionDecodeOffset() : Math::Vec3(0.0f, 0.0f, 0.0f));
+}
+
 template<bool isWindowIdUsed=false>
 void Templated_GlobalCache_PrototypeFindGenericResource(FunCallbackContext& context)
 {
@@ -682,9 +775,16 @@ static void RegisterNodes(BlockLib* lib, Core::IApplicationContext* context)
             "Mesh",
             {
                 { "SetGeneratorInput", "int", {"Mesh", "MeshGenerator", nullptr}, {"this", "meshGenerator", nullptr}, Mesh_SetGeneratorInput },
-                { "SetOperatorInput", "int", {"Mesh", "MeshOperator", nullptr}, {"this", "meshOperator", nullptr}, Mesh_SetOperatorInput }
+                { "SetOperatorInput", "int", {"Mesh", "MeshOperator", nullptr}, {"this", "meshOperator", nullptr}, Mesh_SetOperatorInput },
+                { "GetBoundingBoxMin", "float3", {"Mesh", nullptr}, {"this", nullptr}, Mesh_GetBoundingBoxMin },
+                { "GetBoundingBoxMax", "float3", {"Mesh", nullptr}, {"this", nullptr}, Mesh_GetBoundingBoxMax },
+                { "GetBoundingSphere", "float4", {"Mesh", nullptr}, {"this", nullptr}, Mesh_GetBoundingSphere },
+                { "IsVisible", "int", {"Mesh", "float4x4", nullptr}, {"this", "worldViewProj", nullptr}, Mesh_IsVisible },
+                { "IsPacked", "int", {"Mesh", nullptr}, {"this", nullptr}, Mesh_IsPacked },
+                { "GetPositionDecodeScale", "float3", {"Mesh", nullptr}, {"this", nullptr}, Mesh_GetPositionDecodeScale },
+                { "GetPositionDecodeOffset", "float3", {"Mesh", nullptr}, {"this", nullptr}, Mesh_GetPositionDecodeOffset }
             },
-            2,
+            9,
             nullptr, 0, nullptr
         },
         {
@@ -1108,6 +1208,13 @@ static void RegisterFunctions(BlockLib* lib)
             { nullptr },
             Render_Draw
         },
+        {
+            "DrawLod",
+            "int",
+            { "int", nullptr },
+            { "lod", nullptr },
+            Render_DrawLod
+        },
         {
             "DrawInstanced",
             "int",
@@ -2200,6 +2307,17 @@ void Render_Draw(FunCallbackContext& context)
     Render::Draw();
 }
 
+void Render_DrawLod(FunCallbackContext& context)
+{
+#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
+    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    CHECK_PERMISSIONS(renderCollection, "Draw", PERMISSIONS_RENDER_API_CALL);
+#endif
+    FunParamStream stream(context);
+    int lod = stream.NextArgument<int>();
+    Render::DrawLod((unsigned int)lod);
+}
+
 void Render_DrawInstanced(FunCallbackContext& context)
 {
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
@@ -40,7 +40,12 @@ Pegasus::AssetLib::AssetLib::AssetLib(Alloc::IAllocator* allocator, Io::IOManage
   mIoMgr(mgr),
   mAllocator(allocator),
   mAssets(allocator),
+  mAssetsByPath(allocator),
   mFactories(allocator)
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+  ,mPrefetcher(allocator)
+  ,mPrefetches(allocator)
+#endif
 #if PEGASUS_ENABLE_PROXIES
   ,mProxy(this)
 #endif
@@ -89,8 +94,56 @@ static bool PathsAreEqual(const char* str1, const char* str2)
     return eq && *str1 == *str2;
 }
 
+//hash of a path, equal for paths that PathsAreEqual considers equal
+static unsigned int HashAssetPath(const char* path)
+{
+    unsigned int hash = Utils::FNV1A_OFFSET_BASIS;
+    for (; *path != '\0'; ++path)
+    {
+        hash = (hash ^ static_cast<unsigned char>(toBrac(toLow(*path)))) * Utils::FNV1A_PRIME;
+    }
+    return hash;
+}
+
+//true if the assets of an extension are structured. Unknown extensions are assumed structured
+static bool IsStructuredExtension(const char* extension)
+{
+    const Pegasus::PegasusAssetTypeDesc* const* desc = Pegasus::GetAllAssetTypesDescs();
+    while (*desc != nullptr)
+    {
+        if (!Utils::Stricmp(extension,(*desc)->mExtension))
+        {
+            return (*desc)->mIsStructured;
+        }
+        ++desc;
+    }
+    return true;
+}
+
+unsigned int Pegasus::AssetLib::AssetPathKeyTraits::Hash(const char* path)
+{
+    return HashAssetPath(path);
+}
+
+bool Pegasus::AssetLib::AssetPathKeyTraits::Equal(const char* path1, const char* path2)
+{
+    return PathsAreEqual(path1, path2);
+}
+
 Pegasus::AssetLib::AssetLib::~AssetLib()
 {
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+    //release the files prefetched but never used
+    for (unsigned int slot = 0; slot < mPrefetches.GetSlotCount(); ++slot)
+    {
+        if (mPrefetches.IsSlotUsed(slot))
+        {
+            mPrefetcher.Cancel(mPrefetches.GetSlotValue(slot));
+        }
+    }
+    mPrefetches.Clear();
+#endif
+
     for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
     {      
         PG_DELETE(mAllocator, mAssets[i]);
@@ -160,25 +213,23 @@ extern void Bison_AssetScriptParse(const Io::FileBuffer* fileBuffer, AssetBuilde
 Io::IoError Pegasus::AssetLib::AssetLib::LoadAsset(const char* path, bool isStructured, Pegasus::AssetLib::Asset** assetOut)
 {
     //try to find it first
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    Asset** found = mAssetsByPath.Find(path);
+    if (found != nullptr)
     {
-        if (PathsAreEqual(mAssets[i]->GetPath(), path))
+        if (isStructured != ((*found)->GetFormat() == Pegasus::AssetLib::Asset::FMT_STRUCTURED))
         {
-            if (isStructured != (mAssets[i]->GetFormat() == Pegasus::AssetLib::Asset::FMT_STRUCTURED))
-            {
-                *assetOut = nullptr;
-                return Io::ERR_READING_FILE;
-            }
-            *assetOut = mAssets[i];
+            *assetOut = nullptr;
+            return Io::ERR_READING_FILE;
+        }
+        *assetOut = *found;
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
-            //asset is referenced on this cateogry
-            if (mCurrentCategory != nullptr)
-            {
-                mCurrentCategory->RegisterAsset(*assetOut);
-            }
-#endif
-            return Io::ERR_NONE;
+        //asset is referenced on this cateogry
+        if (mCurrentCategory != nullptr)
+        {
+            mCurrentCategory->RegisterAsset(*assetOut);
         }
+#endif
+        return Io::ERR_NONE;
     }
 
     //not found? lets build it from a file..
@@ -188,6 +239,7 @@ Io::IoError Pegasus::AssetLib::AssetLib::LoadAsset(const char* path, bool isStru
     if (*assetOut != nullptr)
     {
         mAssets.PushEmpty() = *assetOut;
+        mAssetsByPath.Insert((*assetOut)->GetPath(), *assetOut);
     }
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     if (err == Io::ERR_NONE && mCurrentCategory != nullptr)
@@ -214,7 +266,17 @@ Io::IoError Pegasus::AssetLib::AssetLib::InternalBuildAsset(Asset** assetOut, bo
     isStructured = isPreallocated ? (*assetOut)->GetFormat() == Asset::FMT_STRUCTURED : isStructured;
 
     Io::FileBuffer fileBuffer;
-    Io::IoError err = mIoMgr->OpenFileToBuffer(path, fileBuffer, true, mAllocator); //open the raw file first
+    //open the raw file first. Structured assets map the file rather than copying it and release
+    //the view once parsed. Raw assets keep their buffer and can be saved back to the same file,
+    //which cannot be rewritten while it is mapped, so they own a copy
+    Io::IoError err = Io::ERR_NONE;
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+    if (!TakePrefetchedAsset(path, fileBuffer, err))
+#endif
+    {
+        err = isStructured ? mIoMgr->MapFileToBuffer(path, fileBuffer, mAllocator)
+                           : mIoMgr->OpenFileToBuffer(path, fileBuffer, true, mAllocator);
+    }
 
     if (err == Io::ERR_NONE)
     {
@@ -243,6 +305,9 @@ Io::IoError Pegasus::AssetLib::AssetLib::InternalBuildAsset(Asset** assetOut, bo
         }
         else
         {
+            //raw files are prefetched without mapping, this only copies a mapped file
+            //when a raw asset is loaded from a path whose extension is registered as structured
+            fileBuffer.DetachMappedView();
             (*assetOut)->SetFileBuffer(fileBuffer);
             fileBuffer.ForgetBuffer(); //forget this buffer, so we dont destroy it twice.
         }
@@ -262,6 +327,7 @@ void Pegasus::AssetLib::AssetLib::UnloadAsset(Asset* asset)
             {
                 asset->GetRuntimeData()->mAsset = nullptr;
             }
+            mAssetsByPath.Remove(asset->GetPath());
             mAssets.Delete(i);
             PG_DELETE(mAllocator, asset);
             return;
@@ -277,6 +343,18 @@ void Pegasus::AssetLib::AssetLib::ResolvePendingChildAssets(Asset* asset)
     Pegasus::Utils::Vector<AssetBuilder::ObjectChildAssetRequest> objectRequest = mBuilder.mObjectChildAssetQueue;
     Pegasus::Utils::Vector<AssetBuilder::ArrayChildAssetRequest> arrayRequests = mBuilder.mArrayChildAssetQueue;
 
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+    //start reading all the children on the IO workers, they get parsed one by one below while the next ones load
+    for (unsigned i = 0; i < objectRequest.GetSize(); ++i)
+    {
+        PrefetchAsset(objectRequest[i].assetPath);
+    }
+    for (unsigned i = 0; i < arrayRequests.GetSize(); ++i)
+    {
+        PrefetchAsset(arrayRequests[i].assetPath);
+    }
+#endif
+
     for (unsigned i = 0; i < objectRequest.GetSize(); ++i)
     {
 
@@ -299,25 +377,94 @@ void Pegasus::AssetLib::AssetLib::ResolvePendingChildAssets(Asset* asset)
             request.array->PushElement(el);
         }
     }
+
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+    //children that failed before reaching the file system leave their prefetch behind
+    for (unsigned i = 0; i < objectRequest.GetSize(); ++i)
+    {
+        CancelPrefetch(objectRequest[i].assetPath);
+    }
+    for (unsigned i = 0; i < arrayRequests.GetSize(); ++i)
+    {
+        CancelPrefetch(arrayRequests[i].assetPath);
+    }
+#endif
+}
+
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+void Pegasus::AssetLib::AssetLib::PrefetchAsset(const char* path)
+{
+    const unsigned int key = HashAssetPath(path);
+    if (mPrefetches.Contains(key) || mAssetsByPath.Contains(path))
+    {
+        return; //already prefetched or loaded, nothing to read
+    }
+
+    const char* extension = Utils::Strrchr(path, '.');
+    if (extension == nullptr || extension[1] == '\0')
+    {
+        return; //LoadObject refuses it
+    }
+
+    //structured assets are parsed then released, so their file is mapped rather than copied.
+    //raw assets keep their buffer and can save it back to the file, so they are read
+    const Io::AsyncLoadMode loadMode = IsStructuredExtension(extension + 1) ? Io::ASYNC_LOAD_MAP : Io::ASYNC_LOAD_READ;
+    const Io::AsyncHandle handle = mPrefetcher.Submit(mIoMgr, path, loadMode, Io::ASYNC_PRIORITY_NORMAL);
+    if (handle != Io::ASYNC_INVALID_HANDLE)
+    {
+        mPrefetches.Insert(key, handle);
+    }
 }
 
+void Pegasus::AssetLib::AssetLib::CancelPrefetch(const char* path)
+{
+    const unsigned int key = HashAssetPath(path);
+    Io::AsyncHandle* found = mPrefetches.Find(key);
+    if (found != nullptr)
+    {
+        mPrefetcher.Cancel(*found);
+        mPrefetches.Remove(key);
+    }
+}
+
+bool Pegasus::AssetLib::AssetLib::TakePrefetchedAsset(const char* path, Io::FileBuffer& fileBuffer, Io::IoError& err)
+{
+    const unsigned int key = HashAssetPath(path);
+    Io::AsyncHandle* found = mPrefetches.Find(key);
+    if (found == nullptr)
+    {
+        return false;
+    }
+
+    const Io::AsyncHandle handle = *found;
+    mPrefetches.Remove(key);
+    if (!PathsAreEqual(mPrefetcher.GetPath(handle), path))
+    {
+        //hash collision, this is another file
+        mPrefetcher.Cancel(handle);
+        return false;
+    }
+
+    err = mPrefetcher.Wait(handle, fileBuffer);
+    return true;
+}
+#endif
+
 Asset* Pegasus::AssetLib::AssetLib::CreateAsset(const char* path, bool isStructured)
 {
     Asset* asset = nullptr;
     //try to find it first
-    for (unsigned int i = 0; i < mAssets.GetSize(); ++i)
+    if (mAssetsByPath.Contains(path))
     {
-        if (PathsAreEqual(mAssets[i]->GetPath(), path))
-        {
-            PG_LOG('ERR_', "Attempting to create an asset that already exists on cache!");
-            return nullptr;  //Cant allow to override this asset
-        }
+        PG_LOG('ERR_', "Attempting to create an asset that already exists on cache!");
+        return nullptr;  //Cant allow to override this asset
     }
 
     // structured means its a json file. non structured means it does not get parsed and the file gets raw'd
     asset = PG_NEW(mAllocator, -1, "Asset", Alloc::PG_MEM_TEMP) Asset(mAllocator, this, isStructured ? Asset::FMT_STRUCTURED : Asset::FMT_RAW);
     asset->SetPath(path);
     mAssets.PushEmpty() = asset;
+    mAssetsByPath.Insert(asset->GetPath(), asset);
 
     if (!isStructured)
     {
@@ -371,8 +518,6 @@ RuntimeAssetObjectRef Pegasus::AssetLib::AssetLib::LoadObject(const char* path)
     
     Pegasus::AssetLib::Asset* asset = nullptr;
 
-    bool isStructured = true; //assume is structured.
-
     const char* extension = Utils::Strrchr(path, '.');
     if (extension == nullptr || extension[0] == '\0')
     {
@@ -383,16 +528,7 @@ RuntimeAssetObjectRef Pegasus::AssetLib::AssetLib::LoadObject(const char* path)
     ++extension; //skip the . character
 
     //find out if its structured or not.
-    const Pegasus::PegasusAssetTypeDesc* const* desc = GetAllAssetTypesDescs();
-    while (*desc != nullptr)
-    {
-        if (!Utils::Stricmp(extension,(*desc)->mExtension))
-        {
-            isStructured = (*desc)->mIsStructured;
-            break;
-        }
-        ++desc;
-    }
+    const bool isStructured = IsStructuredExtension(extension);
     
     if (Io::ERR_NONE == LoadAsset(path, isStructured, &asset))
     {
@@ -0,0 +1,432 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AsyncLoader.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Asynchronous file loading, on a pool of IO worker threads
+
+#include "Pegasus/Core/AsyncLoader.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Utils/String.h"
+
+namespace Pegasus {
+namespace Io {
+
+//! Slot index marking the end of a list
+static const unsigned int INVALID_SLOT = 0xFFFFFFFF;
+
+//! Number of bits of a handle used by the slot index, the others contain the generation
+static const unsigned int HANDLE_SLOT_BITS = 16;
+static const unsigned int HANDLE_SLOT_MASK = (1u << HANDLE_SLOT_BITS) - 1;
+
+static_assert(AsyncLoader::MAX_REQUESTS <= HANDLE_SLOT_MASK, "Too many requests for the handle encoding");
+
+//----------------------------------------------------------------------------------------
+
+AsyncLoader::AsyncLoader(Alloc::IAllocator* alloc, unsigned int workerCount)
+:   mAlloc(alloc),
+    mRequests(nullptr),
+    mFreeSlotCount(0),
+    mQueuedCount(0),
+    mWorkers(nullptr),
+    mWorkerCount(workerCount > 0 ? workerCount : DEFAULT_WORKER_COUNT),
+    mShutdown(false),
+    mPaused(false)
+{
+    mRequests = PG_NEW_ARRAY(mAlloc, -1, "AsyncLoader Requests", Alloc::PG_MEM_PERM, Request, MAX_REQUESTS);
+    for (unsigned int slot = 0; slot < MAX_REQUESTS; ++slot)
+    {
+        Request& request = mRequests[slot];
+        request.mPath[0] = '\0';
+        request.mIoMgr = nullptr;
+        request.mError = ERR_NONE;
+        request.mCallback = nullptr;
+        request.mUserData = nullptr;
+        request.mGeneration = 0;
+        request.mState = STATE_FREE;
+        request.mPriority = ASYNC_PRIORITY_NORMAL;
+        request.mLoadMode = ASYNC_LOAD_READ;
+        request.mPrev = INVALID_SLOT;
+        request.mNext = INVALID_SLOT;
+        request.mInCompletedList = false;
+
+        // Lowest slots are popped first
+        mFreeSlots[MAX_REQUESTS - 1 - slot] = slot;
+    }
+    mFreeSlotCount = MAX_REQUESTS;
+
+    for (unsigned int p = 0; p < ASYNC_PRIORITY_COUNT; ++p)
+    {
+        mQueues[p].mHead = mQueues[p].mTail = INVALID_SLOT;
+    }
+    mCompletedList.mHead = mCompletedList.mTail = INVALID_SLOT;
+
+    mWorkers = PG_NEW_ARRAY(mAlloc, -1, "AsyncLoader Workers", Alloc::PG_MEM_PERM, Core::Thread, mWorkerCount);
+    for (unsigned int w = 0; w < mWorkerCount; ++w)
+    {
+        mWorkers[w].Start(WorkerEntryPoint, this, "Pegasus IO worker");
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+AsyncLoader::~AsyncLoader()
+{
+    mMutex.Lock();
+    mShutdown = true;
+    mWorkAvailable.Broadcast();
+    mMutex.Unlock();
+
+    for (unsigned int w = 0; w < mWorkerCount; ++w)
+    {
+        mWorkers[w].Join();
+    }
+    PG_DELETE_ARRAY(mAlloc, mWorkers);
+
+    // Buffers of unclaimed requests are destroyed with the slots
+    if (mFreeSlotCount != MAX_REQUESTS)
+    {
+        PG_LOG('FILE', "%u asynchronous requests were never claimed", MAX_REQUESTS - mFreeSlotCount);
+    }
+    PG_DELETE_ARRAY(mAlloc, mRequests);
+}
+
+//----------------------------------------------------------------------------------------
+
+AsyncHandle AsyncLoader::Submit(IOManager* ioMgr, const char* relativePath, AsyncLoadMode loadMode, AsyncPriority priority,
+                                AsyncCallback callback, void* userData)
+{
+    PG_ASSERT(ioMgr != nullptr && relativePath != nullptr);
+    PG_ASSERT(priority < ASYNC_PRIORITY_COUNT);
+    PG_ASSERTSTR(Utils::Strlen(relativePath) < IOManager::MAX_FILEPATH_LENGTH, "Path of an asynchronous request is too long");
+
+    Core::ScopedLock lock(mMutex);
+    if (mFreeSlotCount == 0)
+    {
+        PG_LOG('FILE', "Too many asynchronous requests, \"%s\" has to be loaded synchronously", relativePath);
+        return ASYNC_INVALID_HANDLE;
+    }
+
+    const unsigned int slot = mFreeSlots[--mFreeSlotCount];
+    Request& request = mRequests[slot];
+    request.mPath[0] = '\0';
+    Utils::Strcat(request.mPath, relativePath);
+    request.mPath[IOManager::MAX_FILEPATH_LENGTH - 1] = '\0';
+    request.mIoMgr = ioMgr;
+    request.mError = ERR_NONE;
+    request.mCallback = callback;
+    request.mUserData = userData;
+    request.mState = STATE_QUEUED;
+    request.mPriority = priority;
+    request.mLoadMode = loadMode;
+    request.mInCompletedList = false;
+
+    PushBack(mQueues[priority], slot);
+    ++mQueuedCount;
+    mWorkAvailable.Signal();
+
+    return slot | (request.mGeneration << HANDLE_SLOT_BITS);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool AsyncLoader::IsComplete(AsyncHandle handle)
+{
+    Core::ScopedLock lock(mMutex);
+    return mRequests[GetSlot(handle)].mState == STATE_DONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError AsyncLoader::Wait(AsyncHandle handle, FileBuffer& outputBuffer)
+{
+    PG_ASSERTSTR(outputBuffer.GetBuffer() == nullptr, "The output buffer of an asynchronous request must be empty");
+
+    mMutex.Lock();
+    const unsigned int slot = GetSlot(handle);
+    Request& request = mRequests[slot];
+
+    // Still queued, no need to wait for a worker, load it right away
+    if (request.mState == STATE_QUEUED)
+    {
+        Unlink(mQueues[request.mPriority], slot);
+        --mQueuedCount;
+        request.mState = STATE_LOADING;
+        mMutex.Unlock();
+
+        LoadRequest(request);
+
+        mMutex.Lock();
+        request.mState = STATE_DONE;
+    }
+
+    while (request.mState == STATE_LOADING)
+    {
+        mRequestCompleted.Wait(mMutex);
+    }
+    PG_ASSERTSTR(request.mState == STATE_DONE, "Waiting on a canceled asynchronous request");
+
+    // Transfer the ownership of the buffer
+    outputBuffer = request.mBuffer;
+    request.mBuffer.ForgetBuffer();
+    const IoError error = request.mError;
+
+    FreeSlot(slot);
+    mMutex.Unlock();
+    return error;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::Cancel(AsyncHandle handle)
+{
+    Core::ScopedLock lock(mMutex);
+    const unsigned int slot = GetSlot(handle);
+    Request& request = mRequests[slot];
+    switch (request.mState)
+    {
+    case STATE_QUEUED:
+        Unlink(mQueues[request.mPriority], slot);
+        --mQueuedCount;
+        FreeSlot(slot);
+        break;
+
+    case STATE_LOADING:
+        // The worker frees the slot once the load ends
+        request.mState = STATE_CANCELED;
+        break;
+
+    case STATE_DONE:
+        request.mBuffer.DestroyBuffer();
+        FreeSlot(slot);
+        break;
+
+    default:
+        PG_FAILSTR("Canceling an asynchronous request twice");
+        break;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::SetPaused(bool paused)
+{
+    Core::ScopedLock lock(mMutex);
+    mPaused = paused;
+    if (!paused)
+    {
+        mWorkAvailable.Broadcast();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int AsyncLoader::GetQueuedCount() const
+{
+    Core::ScopedLock lock(mMutex);
+    return mQueuedCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int AsyncLoader::DispatchCallbacks()
+{
+    unsigned int callbackCount = 0;
+    mMutex.Lock();
+    while (mCompletedList.mHead != INVALID_SLOT)
+    {
+        const unsigned int slot = mCompletedList.mHead;
+        Request& request = mRequests[slot];
+        Unlink(mCompletedList, slot);
+        request.mInCompletedList = false;
+
+        const AsyncHandle handle = slot | (request.mGeneration << HANDLE_SLOT_BITS);
+        const AsyncCallback callback = request.mCallback;
+        const IoError error = request.mError;
+        void* userData = request.mUserData;
+
+        // The callback claims the request, the lock cannot be held
+        mMutex.Unlock();
+        callback(handle, error, userData);
+        ++callbackCount;
+        mMutex.Lock();
+    }
+    mMutex.Unlock();
+    return callbackCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+const char* AsyncLoader::GetPath(AsyncHandle handle) const
+{
+    Core::ScopedLock lock(mMutex);
+    return mRequests[GetSlot(handle)].mPath;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::WorkerEntryPoint(void* userData)
+{
+    static_cast<AsyncLoader*>(userData)->WorkerLoop();
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::WorkerLoop()
+{
+    unsigned int batch[MAX_BATCH_SIZE];
+
+    mMutex.Lock();
+    for (;;)
+    {
+        while (!mShutdown && (mQueuedCount == 0 || mPaused))
+        {
+            mWorkAvailable.Wait(mMutex);
+        }
+        if (mShutdown)
+        {
+            break;
+        }
+
+        // Take a share of the queue, so the other workers still get some of it,
+        // highest priorities first
+        unsigned int batchSize = mQueuedCount / mWorkerCount;
+        batchSize = batchSize < 1 ? 1 : (batchSize > MAX_BATCH_SIZE ? MAX_BATCH_SIZE : batchSize);
+        unsigned int batchCount = 0;
+        for (unsigned int p = 0; p < ASYNC_PRIORITY_COUNT && batchCount < batchSize; ++p)
+        {
+            while (mQueues[p].mHead != INVALID_SLOT && batchCount < batchSize)
+            {
+                const unsigned int slot = mQueues[p].mHead;
+                Unlink(mQueues[p], slot);
+                mRequests[slot].mState = STATE_LOADING;
+                batch[batchCount++] = slot;
+            }
+        }
+        mQueuedCount -= batchCount;
+        mMutex.Unlock();
+
+        for (unsigned int b = 0; b < batchCount; ++b)
+        {
+            LoadRequest(mRequests[batch[b]]);
+        }
+
+        // Publish the whole batch at once
+        mMutex.Lock();
+        for (unsigned int b = 0; b < batchCount; ++b)
+        {
+            CompleteRequest(batch[b]);
+        }
+        mRequestCompleted.Broadcast();
+    }
+    mMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::LoadRequest(Request& request)
+{
+    request.mError = request.mLoadMode == ASYNC_LOAD_MAP
+                   ? request.mIoMgr->MapFileToBuffer(request.mPath, request.mBuffer, mAlloc)
+                   : request.mIoMgr->OpenFileToBuffer(request.mPath, request.mBuffer, true, mAlloc);
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::CompleteRequest(unsigned int slot)
+{
+    Request& request = mRequests[slot];
+    if (request.mState == STATE_CANCELED)
+    {
+        request.mBuffer.DestroyBuffer();
+        FreeSlot(slot);
+        return;
+    }
+
+    request.mState = STATE_DONE;
+    if (request.mCallback != nullptr)
+    {
+        PushBack(mCompletedList, slot);
+        request.mInCompletedList = true;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int AsyncLoader::GetSlot(AsyncHandle handle) const
+{
+    const unsigned int slot = handle & HANDLE_SLOT_MASK;
+    PG_ASSERTSTR(handle != ASYNC_INVALID_HANDLE && slot < MAX_REQUESTS, "Invalid asynchronous request handle");
+    PG_ASSERTSTR(mRequests[slot].mState != STATE_FREE && (handle >> HANDLE_SLOT_BITS) == mRequests[slot].mGeneration,
+                 "Stale asynchronous request handle, the request has already been claimed");
+    return slot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::FreeSlot(unsigned int slot)
+{
+    Request& request = mRequests[slot];
+    if (request.mInCompletedList)
+    {
+        Unlink(mCompletedList, slot);
+        request.mInCompletedList = false;
+    }
+    request.mState = STATE_FREE;
+    request.mCallback = nullptr;
+    request.mUserData = nullptr;
+    request.mGeneration = (request.mGeneration + 1) & (0xFFFFFFFF >> HANDLE_SLOT_BITS);
+    mFreeSlots[mFreeSlotCount++] = slot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::PushBack(RequestList& list, unsigned int slot)
+{
+    Request& request = mRequests[slot];
+    request.mPrev = list.mTail;
+    request.mNext = INVALID_SLOT;
+    if (list.mTail != INVALID_SLOT)
+    {
+        mRequests[list.mTail].mNext = slot;
+    }
+    else
+    {
+        list.mHead = slot;
+    }
+    list.mTail = slot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void AsyncLoader::Unlink(RequestList& list, unsigned int slot)
+{
+    Request& request = mRequests[slot];
+    if (request.mPrev != INVALID_SLOT)
+    {
+        mRequests[request.mPrev].mNext = request.mNext;
+    }
+    else
+    {
+        list.mHead = request.mNext;
+    }
+    if (request.mNext != INVALID_SLOT)
+    {
+        mRequests[request.mNext].mPrev = request.mPrev;
+    }
+    else
+    {
+        list.mTail = request.mPrev;
+    }
+    request.mPrev = request.mNext = INVALID_SLOT;
+}
+
+
+} // namespace Io
+} // namespace Pegasus
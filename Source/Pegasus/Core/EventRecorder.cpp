@@ -0,0 +1,116 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   EventRecorder.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Recording of the events dispatched by worker threads, to replay them on the main thread
+
+#include "Pegasus/Core/EventRecorder.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Allocator/Alloc.h"
+
+#if PEGASUS_USE_EVENTS
+
+namespace Pegasus {
+namespace Core {
+
+//! Recorder of each thread, nullptr when the thread dispatches its events directly
+static thread_local IEventRecorder* sThreadEventRecorder = nullptr;
+
+//----------------------------------------------------------------------------------------
+
+IEventRecorder* GetThreadEventRecorder()
+{
+    return sThreadEventRecorder;
+}
+
+//----------------------------------------------------------------------------------------
+
+IEventRecorder* SetThreadEventRecorder(IEventRecorder* recorder)
+{
+    IEventRecorder* previous = sThreadEventRecorder;
+    sThreadEventRecorder = recorder;
+    return previous;
+}
+
+//----------------------------------------------------------------------------------------
+
+EventRecorder::EventRecorder(Alloc::IAllocator* alloc)
+:   mAlloc(alloc),
+    mHead(nullptr),
+    mTail(nullptr)
+{
+    PG_ASSERTSTR(alloc != nullptr, "Invalid allocator given to an event recorder");
+}
+
+//----------------------------------------------------------------------------------------
+
+EventRecorder::~EventRecorder()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void* EventRecorder::AllocateEvent(unsigned int size)
+{
+    return mAlloc->Alloc(size, Alloc::PG_MEM_TEMP, -1, "Recorded event", __FILE__, __LINE__);
+}
+
+//----------------------------------------------------------------------------------------
+
+void EventRecorder::RecordEvent(RecordedEvent* e)
+{
+    PG_ASSERT(e != nullptr && e->mNext == nullptr);
+    if (mTail != nullptr)
+    {
+        mTail->mNext = e;
+    }
+    else
+    {
+        mHead = e;
+    }
+    mTail = e;
+}
+
+//----------------------------------------------------------------------------------------
+
+void EventRecorder::DispatchEvents()
+{
+    // The list is detached first, a listener can dispatch events recorded again
+    RecordedEvent* e = mHead;
+    mHead = nullptr;
+    mTail = nullptr;
+    while (e != nullptr)
+    {
+        RecordedEvent* next = e->mNext;
+        e->Dispatch();
+        PG_DELETE(mAlloc, e);
+        e = next;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void EventRecorder::Clear()
+{
+    RecordedEvent* e = mHead;
+    mHead = nullptr;
+    mTail = nullptr;
+    while (e != nullptr)
+    {
+        RecordedEvent* next = e->mNext;
+        PG_DELETE(mAlloc, e);
+        e = next;
+    }
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_USE_EVENTS
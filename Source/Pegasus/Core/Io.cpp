@@ -16,137 +16,27 @@
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Allocator/Alloc.h"
 #include "Pegasus/Utils/String.h"
-#include "stdio.h" //using the windows libraries to produce file IO
-#if PEGASUS_USE_NATIVE_IO_CALLS
-#if PEGASUS_PLATFORM_WINDOWS
-#include <windows.h>
-#endif
-#endif
+#include "Pegasus/Utils/Memcpy.h"
+#include "stdio.h"
+#include "../Source/Pegasus/Core/Platform/IoNative.h"
 
 namespace Pegasus {
 namespace Io {
 
-//implementation using native windows api calls
-#if PEGASUS_USE_NATIVE_IO_CALLS
-namespace internal
-{
-#if PEGASUS_PLATFORM_WINDOWS
-
-Pegasus::Io::IoError NativeOpenFileToBuffer(const char* path, Pegasus::Io::FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
-{
-    // Load the file
-    HANDLE fileHandle = CreateFile(
-        path,
-        GENERIC_READ,
-        FILE_SHARE_READ,
-        NULL, //win32 security attributes
-        OPEN_EXISTING,
-        FILE_ATTRIBUTE_NORMAL,
-        NULL //offset structures
-    );
-    if (fileHandle != INVALID_HANDLE_VALUE)
-    {
-        LARGE_INTEGER fileSize;
-        fileSize.LowPart = 0;
-        fileSize.HighPart = 0;
-        GetFileSizeEx(fileHandle, &fileSize);
-        if (fileSize.HighPart != 0)
-        {
-            //pegasus does not support files that are bigger than 4 gb!
-            PG_FAILSTR("Pegasus does not support files bigger than 4 gb!");
-            CloseHandle(fileHandle);
-            return Pegasus::Io::ERR_FILE_SIZE_TOO_BIG;
-        }
-        else
-        {
-            if (allocateBuffer)
-            {
-                outputBuffer.OwnBuffer(
-                    alloc,
-                    PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize.LowPart),
-                    fileSize.LowPart
-                );
-            }
-            else if (outputBuffer.GetFileSize() > outputBuffer.GetBufferSize())
-            {
-                CloseHandle(fileHandle);
-                return Pegasus::Io::ERR_BUFFER_TOO_SMALL;
-            }
-
-            outputBuffer.SetFileSize(fileSize.LowPart);
-            DWORD bytesRead = 0;
-            ReadFile(fileHandle, outputBuffer.GetBuffer(), outputBuffer.GetFileSize(), &bytesRead, NULL); 
-            
-            PG_ASSERTSTR(bytesRead == outputBuffer.GetFileSize(), "bytes read do not match bytes requested, file %s", path);
-            CloseHandle(fileHandle);
-            if (allocateBuffer && GetLastError() != 0)
-            {
-                outputBuffer.DestroyBuffer();
-                return Pegasus::Io::ERR_READING_FILE;
-            }
-        }
-    }
-    else
-    {
-        PG_LOG('FILE', "File not found \"%s\"", path);
-
-        return Pegasus::Io::ERR_FILE_NOT_FOUND;
-    }
-    PG_LOG('FILE', "Successfully opened file \"%s\"", path);
-
-    return Pegasus::Io::ERR_NONE;
-}
-
-Pegasus::Io::IoError NativeSaveBufferToFile(const char* path, const Pegasus::Io::FileBuffer& outputBuffer)
-{
-    HANDLE fileHandle = CreateFile(
-                            path,
-                            GENERIC_WRITE,
-                            0,
-                            NULL,
-                            CREATE_ALWAYS,
-                            FILE_ATTRIBUTE_NORMAL,
-                            NULL
-                        );
-
-    if (fileHandle == INVALID_HANDLE_VALUE)
-    {
-        PG_LOG('FILE', "IO Error (CreateFile): %s", path);
-        return Pegasus::Io::ERR_OPENING_FILE;
-    }
-    
-    DWORD bytesWritten = 0;
-    BOOL res = WriteFile (
-        fileHandle,
-        outputBuffer.GetBuffer(),
-        outputBuffer.GetFileSize(),
-        &bytesWritten,
-        NULL
-    );
-    SetEndOfFile(fileHandle);
-    CloseHandle(fileHandle);
-    DWORD lastErr = GetLastError();
-    if (!res || (GetLastError() != 0 && GetLastError() != ERROR_ALREADY_EXISTS))
-    {
-        PG_LOG('FILE', "IO Error (WriteFile): %s", path);
-        return Pegasus::Io::ERR_WRITING_FILE;
-    }
-    PG_LOG('FILE', "Saved: %s", path);
-    return Pegasus::Io::ERR_NONE;
-}
-
-#else
+//native implementations live in Platform/Io_<platform>.cpp
+#if PEGASUS_USE_NATIVE_IO_CALLS && !PEGASUS_PLATFORM_WINDOWS && !PEGASUS_PLATFORM_LINUX
     #error No native implementation for IO functions in current platform!
-#endif //platform selection
-}// namespace internal
-#endif //PEGASUS_USE_NATIVE_CALLS
+#endif
 
 //----------------------------------------------------------------------------------------
 
 IOManager::IOManager(const char* rootPath)
 {
     // Configure the path
-    sprintf_s(mRootDirectory, MAX_FILEPATH_LENGTH, "%s", rootPath); // Hardcode imported for now
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(rootPath) < MAX_FILEPATH_LENGTH, "Root path is too long!");
+    mRootDirectory[0] = '\0';
+    Pegasus::Utils::Strcat(mRootDirectory, rootPath);
+    mRootDirectory[MAX_FILEPATH_LENGTH - 1] = '\0';
     PG_LOG('FILE', "Asset root set to \"%s\"", mRootDirectory);
 }
 
@@ -230,6 +120,27 @@ IoError IOManager::OpenFileToBuffer(const char* relativePath, FileBuffer& output
 
 //----------------------------------------------------------------------------------------
 
+IoError IOManager::MapFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, Alloc::IAllocator* alloc)
+{
+#if PEGASUS_USE_MAPPED_FILE_IO
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+
+    // Configure the path
+    pathBuffer[0] = '\0';
+    PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < MAX_FILEPATH_LENGTH, "Path str is too little! be prepared for some mem stomps!");
+    Pegasus::Utils::Strcat(pathBuffer, mRootDirectory);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+    Pegasus::Utils::Strcat(pathBuffer, relativePath);
+    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+
+    return internal::NativeMapFileToBuffer(pathBuffer, outputBuffer, alloc);
+#else
+    return OpenFileToBuffer(relativePath, outputBuffer, true, alloc);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
 
 Pegasus::Io::IoError Pegasus::Io::IOManager::SaveFileToBuffer(const char* relativePath, const Pegasus::Io::FileBuffer& inputBuffer)
 {
@@ -274,7 +185,8 @@ Pegasus::Io::FileBuffer::FileBuffer()
 :   mAllocator(nullptr),
     mBuffer(nullptr), 
     mFileSize(0), 
-    mBufferSize(0)
+    mBufferSize(0),
+    mIsMapped(false)
 {
 }
 
@@ -294,6 +206,35 @@ void Pegasus::Io::FileBuffer::OwnBuffer(Alloc::IAllocator* bufferAlloc, char * b
     mBuffer = buffer;
     mBufferSize = bufferSize;
     mFileSize = bufferSize;
+    mIsMapped = false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Pegasus::Io::FileBuffer::OwnMappedView(Alloc::IAllocator* bufferAlloc, char * view, int viewSize)
+{
+    PG_ASSERTSTR(mBuffer == nullptr, "Dangerous operation! please call ForgetBuffer or DestroyBuffer before Setting a new buffer");
+    mAllocator = bufferAlloc;
+    mBuffer = view;
+    mBufferSize = viewSize;
+    mFileSize = viewSize;
+    mIsMapped = true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Pegasus::Io::FileBuffer::DetachMappedView()
+{
+    if (mIsMapped)
+    {
+        PG_ASSERTSTR(mAllocator != nullptr, "A mapped view needs an allocator to be detached");
+        Alloc::IAllocator* alloc = mAllocator;
+        const int fileSize = mFileSize;
+        char * buffer = PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize);
+        Pegasus::Utils::Memcpy(buffer, mBuffer, fileSize);
+        DestroyBuffer();
+        OwnBuffer(alloc, buffer, fileSize);
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -304,18 +245,29 @@ void Pegasus::Io::FileBuffer::ForgetBuffer()
     mBuffer = nullptr;
     mBufferSize = 0;
     mFileSize = 0;
+    mIsMapped = false;
 }
 
 //----------------------------------------------------------------------------------------
 
 void Pegasus::Io::FileBuffer::DestroyBuffer()
 {
-    PG_DELETE_ARRAY(mAllocator, mBuffer);
+#if PEGASUS_USE_MAPPED_FILE_IO
+    if (mIsMapped)
+    {
+        internal::NativeUnmapFile(mBuffer, mBufferSize);
+    }
+    else
+#endif
+    {
+        PG_DELETE_ARRAY(mAllocator, mBuffer);
+    }
 
     mAllocator = nullptr;
     mBuffer = nullptr;
     mBufferSize = 0;
     mFileSize = 0;
+    mIsMapped = false;
 }
 
 //----------------------------------------------------------------------------------------
@@ -11,6 +11,7 @@
 
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Thread.h"
 
 #if PEGASUS_ENABLE_LOG
 
@@ -23,6 +24,9 @@ namespace Core {
 //! Maximum size of the buffer containing one log message
 static const size_t LOGARGS_BUFFER_SIZE = 1024; 
 
+//! Lock serializing the messages, logged from the main thread and the worker threads
+static Mutex sLogMutex;
+
 //----------------------------------------------------------------------------------------
 
 LogManager::LogManager()
@@ -59,6 +63,7 @@ void LogManager::Log(LogChannel logChannel, const char * msgStr, ...)
         // Handler defined. Call it.
 
         // Format the input string with the extra parameters if there are any
+        ScopedLock lock(sLogMutex);
         char * formattedString = nullptr;
         if (msgStr != nullptr)
         {
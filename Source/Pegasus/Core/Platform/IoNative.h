@@ -0,0 +1,57 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   IoNative.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Platform-specific file functions used by the IOManager.
+//!         Implemented in Io_Win32.cpp and Io_Linux.cpp
+
+#ifndef PEGASUS_CORE_IONATIVE_H
+#define PEGASUS_CORE_IONATIVE_H
+
+#include "Pegasus/Core/Io.h"
+
+#if PEGASUS_USE_NATIVE_IO_CALLS
+
+namespace Pegasus {
+namespace Io {
+namespace internal {
+
+//! Reads a whole file into a buffer
+//! \param path Full path to the file
+//! \param outputBuffer Output buffer, in which the loaded file is stored
+//! \param allocateBuffer Whether to allocate the buffer inside of outputBuffer, or use a pre-allocated one
+//! \param alloc Allocator to use when allocating the buffer
+//! \return Error code
+IoError NativeOpenFileToBuffer(const char* path, FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc);
+
+//! Writes a buffer into a file, replacing its content
+//! \param path Full path to the file
+//! \param inputBuffer Buffer to write
+//! \return Error code
+IoError NativeSaveBufferToFile(const char* path, const FileBuffer& inputBuffer);
+
+//! Maps a whole file in memory, copy-on-write, so the buffer can be read without any copy
+//! and modified without affecting the file
+//! \param path Full path to the file
+//! \param outputBuffer Output buffer, receiving the mapped view
+//! \param alloc Allocator to use if the view gets replaced by an allocated buffer later on
+//! \return Error code
+IoError NativeMapFileToBuffer(const char* path, FileBuffer& outputBuffer, Alloc::IAllocator* alloc);
+
+//! Unmaps a view created by NativeMapFileToBuffer
+//! \param view Address of the view
+//! \param viewSize Size of the view in bytes
+void NativeUnmapFile(char* view, int viewSize);
+
+}   // namespace internal
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_USE_NATIVE_IO_CALLS
+
+#endif  // PEGASUS_CORE_IONATIVE_H
@@ -0,0 +1,217 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Io_Linux.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  File loading, shortcuts for IO (POSIX implementation)
+
+#if PEGASUS_PLATFORM_LINUX
+#if PEGASUS_USE_NATIVE_IO_CALLS
+
+#include "../Source/Pegasus/Core/Platform/IoNative.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Allocator/Alloc.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Pegasus {
+namespace Io {
+namespace internal {
+
+//! Opens a file for reading and gets its size
+//! \param path Full path to the file
+//! \param fileSize Receives the size of the file
+//! \param errorOut Receives the error code
+//! \return File descriptor, -1 in case of error
+static int OpenForReading(const char* path, int& fileSize, IoError& errorOut)
+{
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        errorOut = ERR_FILE_NOT_FOUND;
+        return -1;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        PG_LOG('FILE', "IO Error (fstat): %s", path);
+        close(fd);
+        errorOut = ERR_OPENING_FILE;
+        return -1;
+    }
+
+    if (fileStat.st_size > 0x7FFFFFFF)
+    {
+        PG_FAILSTR("Pegasus does not support files bigger than 2 gb, file %s", path);
+        close(fd);
+        errorOut = ERR_FILE_SIZE_TOO_BIG;
+        return -1;
+    }
+
+    fileSize = static_cast<int>(fileStat.st_size);
+    errorOut = ERR_NONE;
+    return fd;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeOpenFileToBuffer(const char* path, FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
+{
+    int fileSize = 0;
+    IoError err = ERR_NONE;
+    const int fd = OpenForReading(path, fileSize, err);
+    if (fd < 0)
+    {
+        return err;
+    }
+
+    if (allocateBuffer)
+    {
+        outputBuffer.OwnBuffer(
+            alloc,
+            PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize),
+            fileSize
+        );
+    }
+    else if (fileSize > outputBuffer.GetBufferSize())
+    {
+        close(fd);
+        return ERR_BUFFER_TOO_SMALL;
+    }
+    outputBuffer.SetFileSize(fileSize);
+
+    // read() can return less than requested, loop until the whole file is in
+    int totalRead = 0;
+    while (totalRead < fileSize)
+    {
+        const ssize_t bytesRead = read(fd, outputBuffer.GetBuffer() + totalRead, fileSize - totalRead);
+        if (bytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesRead <= 0)
+        {
+            break;
+        }
+        totalRead += static_cast<int>(bytesRead);
+    }
+    close(fd);
+
+    if (totalRead != fileSize)
+    {
+        PG_LOG('FILE', "IO Error (read): %s", path);
+        if (allocateBuffer)
+        {
+            outputBuffer.DestroyBuffer();
+        }
+        return ERR_READING_FILE;
+    }
+
+    PG_LOG('FILE', "Successfully opened file \"%s\"", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeSaveBufferToFile(const char* path, const FileBuffer& inputBuffer)
+{
+    const int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+    {
+        PG_LOG('FILE', "IO Error (open): %s", path);
+        return ERR_OPENING_FILE;
+    }
+
+    const int fileSize = inputBuffer.GetFileSize();
+    int totalWritten = 0;
+    while (totalWritten < fileSize)
+    {
+        const ssize_t bytesWritten = write(fd, inputBuffer.GetBuffer() + totalWritten, fileSize - totalWritten);
+        if (bytesWritten < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (bytesWritten <= 0)
+        {
+            break;
+        }
+        totalWritten += static_cast<int>(bytesWritten);
+    }
+    close(fd);
+
+    if (totalWritten != fileSize)
+    {
+        PG_LOG('FILE', "IO Error (write): %s", path);
+        return ERR_WRITING_FILE;
+    }
+    PG_LOG('FILE', "Saved: %s", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeMapFileToBuffer(const char* path, FileBuffer& outputBuffer, Alloc::IAllocator* alloc)
+{
+    int fileSize = 0;
+    IoError err = ERR_NONE;
+    const int fd = OpenForReading(path, fileSize, err);
+    if (fd < 0)
+    {
+        return err;
+    }
+
+    // Empty files cannot be mapped, they get an empty allocated buffer
+    if (fileSize == 0)
+    {
+        close(fd);
+        return NativeOpenFileToBuffer(path, outputBuffer, true, alloc);
+    }
+
+    // Private mapping: pages are shared with the page cache until written to (copy-on-write),
+    // so the buffer can be edited in place without modifying the file
+    void* view = mmap(nullptr, static_cast<size_t>(fileSize), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+    // The mapping keeps its own reference on the file, the descriptor can be closed
+    close(fd);
+
+    if (view == MAP_FAILED)
+    {
+        PG_LOG('FILE', "IO Error (mmap): %s, falling back to a read", path);
+        return NativeOpenFileToBuffer(path, outputBuffer, true, alloc);
+    }
+
+    // Assets are parsed front to back
+    madvise(view, static_cast<size_t>(fileSize), MADV_SEQUENTIAL);
+
+    outputBuffer.OwnMappedView(alloc, static_cast<char*>(view), fileSize);
+    PG_LOG('FILE', "Successfully mapped file \"%s\"", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeUnmapFile(char* view, int viewSize)
+{
+    if (munmap(view, static_cast<size_t>(viewSize)) != 0)
+    {
+        PG_FAILSTR("Unable to unmap a file view of %d bytes", viewSize);
+    }
+}
+
+}   // namespace internal
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_USE_NATIVE_IO_CALLS
+#endif  // PEGASUS_PLATFORM_LINUX
@@ -0,0 +1,204 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Io_Win32.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  File loading, shortcuts for IO (Win32 implementation)
+
+#if PEGASUS_PLATFORM_WINDOWS
+#if PEGASUS_USE_NATIVE_IO_CALLS
+
+#include "../Source/Pegasus/Core/Platform/IoNative.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Allocator/Alloc.h"
+
+#include <windows.h>
+
+namespace Pegasus {
+namespace Io {
+namespace internal {
+
+IoError NativeOpenFileToBuffer(const char* path, FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
+{
+    // Load the file
+    HANDLE fileHandle = CreateFile(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL, //win32 security attributes
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        NULL //offset structures
+    );
+    if (fileHandle != INVALID_HANDLE_VALUE)
+    {
+        LARGE_INTEGER fileSize;
+        fileSize.LowPart = 0;
+        fileSize.HighPart = 0;
+        GetFileSizeEx(fileHandle, &fileSize);
+        if (fileSize.HighPart != 0)
+        {
+            //pegasus does not support files that are bigger than 4 gb!
+            PG_FAILSTR("Pegasus does not support files bigger than 4 gb!");
+            CloseHandle(fileHandle);
+            return ERR_FILE_SIZE_TOO_BIG;
+        }
+        else
+        {
+            if (allocateBuffer)
+            {
+                outputBuffer.OwnBuffer(
+                    alloc,
+                    PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize.LowPart),
+                    fileSize.LowPart
+                );
+            }
+            else if (outputBuffer.GetFileSize() > outputBuffer.GetBufferSize())
+            {
+                CloseHandle(fileHandle);
+                return ERR_BUFFER_TOO_SMALL;
+            }
+
+            outputBuffer.SetFileSize(fileSize.LowPart);
+            DWORD bytesRead = 0;
+            ReadFile(fileHandle, outputBuffer.GetBuffer(), outputBuffer.GetFileSize(), &bytesRead, NULL);
+
+            PG_ASSERTSTR(bytesRead == outputBuffer.GetFileSize(), "bytes read do not match bytes requested, file %s", path);
+            CloseHandle(fileHandle);
+            if (allocateBuffer && GetLastError() != 0)
+            {
+                outputBuffer.DestroyBuffer();
+                return ERR_READING_FILE;
+            }
+        }
+    }
+    else
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+
+        return ERR_FILE_NOT_FOUND;
+    }
+    PG_LOG('FILE', "Successfully opened file \"%s\"", path);
+
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeSaveBufferToFile(const char* path, const FileBuffer& outputBuffer)
+{
+    HANDLE fileHandle = CreateFile(
+                            path,
+                            GENERIC_WRITE,
+                            0,
+                            NULL,
+                            CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL
+                        );
+
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        PG_LOG('FILE', "IO Error (CreateFile): %s", path);
+        return ERR_OPENING_FILE;
+    }
+
+    DWORD bytesWritten = 0;
+    BOOL res = WriteFile (
+        fileHandle,
+        outputBuffer.GetBuffer(),
+        outputBuffer.GetFileSize(),
+        &bytesWritten,
+        NULL
+    );
+    SetEndOfFile(fileHandle);
+    CloseHandle(fileHandle);
+    if (!res || (GetLastError() != 0 && GetLastError() != ERROR_ALREADY_EXISTS))
+    {
+        PG_LOG('FILE', "IO Error (WriteFile): %s", path);
+        return ERR_WRITING_FILE;
+    }
+    PG_LOG('FILE', "Saved: %s", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeMapFileToBuffer(const char* path, FileBuffer& outputBuffer, Alloc::IAllocator* alloc)
+{
+    HANDLE fileHandle = CreateFile(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        NULL
+    );
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        return ERR_FILE_NOT_FOUND;
+    }
+
+    LARGE_INTEGER fileSize;
+    fileSize.QuadPart = 0;
+    GetFileSizeEx(fileHandle, &fileSize);
+    if (fileSize.HighPart != 0 || fileSize.LowPart > 0x7FFFFFFF)
+    {
+        PG_FAILSTR("Pegasus does not support files bigger than 2 gb!");
+        CloseHandle(fileHandle);
+        return ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    // Empty files cannot be mapped, they get an empty allocated buffer
+    if (fileSize.LowPart == 0)
+    {
+        CloseHandle(fileHandle);
+        return NativeOpenFileToBuffer(path, outputBuffer, true, alloc);
+    }
+
+    // Copy-on-write mapping: pages are shared with the file cache until written to
+    HANDLE mappingHandle = CreateFileMapping(fileHandle, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    char* view = nullptr;
+    if (mappingHandle != NULL)
+    {
+        view = static_cast<char*>(MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0));
+
+        // The view keeps a reference on the mapping and the file, the handles can be closed
+        CloseHandle(mappingHandle);
+    }
+    CloseHandle(fileHandle);
+
+    if (view == nullptr)
+    {
+        PG_LOG('FILE', "IO Error (MapViewOfFile): %s, falling back to a read", path);
+        return NativeOpenFileToBuffer(path, outputBuffer, true, alloc);
+    }
+
+    outputBuffer.OwnMappedView(alloc, view, static_cast<int>(fileSize.LowPart));
+    PG_LOG('FILE', "Successfully mapped file \"%s\"", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeUnmapFile(char* view, int viewSize)
+{
+    if (!UnmapViewOfFile(view))
+    {
+        PG_FAILSTR("Unable to unmap a file view of %d bytes", viewSize);
+    }
+}
+
+}   // namespace internal
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_USE_NATIVE_IO_CALLS
+#endif  // PEGASUS_PLATFORM_WINDOWS
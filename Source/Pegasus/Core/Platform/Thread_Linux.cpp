@@ -0,0 +1,178 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread_Linux.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Threads and synchronization primitives (pthread implementation)
+
+#if PEGASUS_PLATFORM_LINUX
+
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Core/Assertion.h"
+
+#include <pthread.h>
+#include <unistd.h>
+
+namespace Pegasus {
+namespace Core {
+
+static_assert(sizeof(pthread_mutex_t) <= THREAD_NATIVE_STORAGE_SIZE, "Mutex storage too small");
+static_assert(sizeof(pthread_cond_t) <= THREAD_NATIVE_STORAGE_SIZE, "Condition variable storage too small");
+static_assert(sizeof(pthread_t) + 2 * sizeof(void*) <= THREAD_NATIVE_STORAGE_SIZE, "Thread storage too small");
+
+//----------------------------------------------------------------------------------------
+
+Mutex::Mutex()
+{
+    pthread_mutex_init(reinterpret_cast<pthread_mutex_t*>(mStorage), nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+Mutex::~Mutex()
+{
+    pthread_mutex_destroy(reinterpret_cast<pthread_mutex_t*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Lock()
+{
+    pthread_mutex_lock(reinterpret_cast<pthread_mutex_t*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Unlock()
+{
+    pthread_mutex_unlock(reinterpret_cast<pthread_mutex_t*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::ConditionVariable()
+{
+    pthread_cond_init(reinterpret_cast<pthread_cond_t*>(mStorage), nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::~ConditionVariable()
+{
+    pthread_cond_destroy(reinterpret_cast<pthread_cond_t*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Wait(Mutex& mutex)
+{
+    pthread_cond_wait(reinterpret_cast<pthread_cond_t*>(mStorage),
+                      reinterpret_cast<pthread_mutex_t*>(mutex.mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Signal()
+{
+    pthread_cond_signal(reinterpret_cast<pthread_cond_t*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Broadcast()
+{
+    pthread_cond_broadcast(reinterpret_cast<pthread_cond_t*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Entry point of the native threads, forwards to the function of the thread object
+static void* ThreadEntryPoint(void* param)
+{
+    void** args = static_cast<void**>(param);
+    Thread::ThreadFunc func = reinterpret_cast<Thread::ThreadFunc>(args[0]);
+    func(args[1]);
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+Thread::Thread()
+:   mFunc(nullptr),
+    mUserData(nullptr),
+    mIsRunning(false)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+Thread::~Thread()
+{
+    PG_ASSERTSTR(!mIsRunning, "A thread must be joined before being destroyed");
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Thread::Start(ThreadFunc func, void* userData, const char* name)
+{
+    PG_ASSERTSTR(!mIsRunning, "The thread is already running");
+    mFunc = func;
+    mUserData = userData;
+
+    // The function and the user data are read from this object by the new thread,
+    // the storage after the thread ID is used to pass them
+    void** args = reinterpret_cast<void**>(mStorage + sizeof(pthread_t));
+    args[0] = reinterpret_cast<void*>(mFunc);
+    args[1] = mUserData;
+
+    pthread_t* thread = reinterpret_cast<pthread_t*>(mStorage);
+    if (pthread_create(thread, nullptr, ThreadEntryPoint, args) != 0)
+    {
+        PG_FAILSTR("Unable to create the thread %s", name);
+        return false;
+    }
+
+#if defined(__GLIBC__)
+    // Thread names are limited to 15 characters
+    char shortName[16];
+    unsigned int c = 0;
+    for (; c < 15 && name[c] != '\0'; ++c)
+    {
+        shortName[c] = name[c];
+    }
+    shortName[c] = '\0';
+    pthread_setname_np(*thread, shortName);
+#endif
+
+    mIsRunning = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Thread::Join()
+{
+    if (mIsRunning)
+    {
+        pthread_join(*reinterpret_cast<pthread_t*>(mStorage), nullptr);
+        mIsRunning = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetHardwareThreadCount()
+{
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return count > 0 ? static_cast<unsigned int>(count) : 1;
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_LINUX
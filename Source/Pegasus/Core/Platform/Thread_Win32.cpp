@@ -0,0 +1,172 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread_Win32.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Threads and synchronization primitives (Win32 implementation)
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Core/Assertion.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace Pegasus {
+namespace Core {
+
+// Slim reader/writer locks are lighter than critical sections and work with condition variables
+static_assert(sizeof(SRWLOCK) <= THREAD_NATIVE_STORAGE_SIZE, "Mutex storage too small");
+static_assert(sizeof(CONDITION_VARIABLE) <= THREAD_NATIVE_STORAGE_SIZE, "Condition variable storage too small");
+static_assert(sizeof(HANDLE) + 2 * sizeof(void*) <= THREAD_NATIVE_STORAGE_SIZE, "Thread storage too small");
+
+//----------------------------------------------------------------------------------------
+
+Mutex::Mutex()
+{
+    InitializeSRWLock(reinterpret_cast<SRWLOCK*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+Mutex::~Mutex()
+{
+    // SRW locks do not need to be destroyed
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Lock()
+{
+    AcquireSRWLockExclusive(reinterpret_cast<SRWLOCK*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mutex::Unlock()
+{
+    ReleaseSRWLockExclusive(reinterpret_cast<SRWLOCK*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::ConditionVariable()
+{
+    InitializeConditionVariable(reinterpret_cast<CONDITION_VARIABLE*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+ConditionVariable::~ConditionVariable()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Wait(Mutex& mutex)
+{
+    SleepConditionVariableSRW(reinterpret_cast<CONDITION_VARIABLE*>(mStorage),
+                              reinterpret_cast<SRWLOCK*>(mutex.mStorage),
+                              INFINITE, 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Signal()
+{
+    WakeConditionVariable(reinterpret_cast<CONDITION_VARIABLE*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConditionVariable::Broadcast()
+{
+    WakeAllConditionVariable(reinterpret_cast<CONDITION_VARIABLE*>(mStorage));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Entry point of the native threads, forwards to the function of the thread object
+static DWORD WINAPI ThreadEntryPoint(LPVOID param)
+{
+    void** args = static_cast<void**>(param);
+    Thread::ThreadFunc func = reinterpret_cast<Thread::ThreadFunc>(args[0]);
+    func(args[1]);
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+Thread::Thread()
+:   mFunc(nullptr),
+    mUserData(nullptr),
+    mIsRunning(false)
+{
+    *reinterpret_cast<HANDLE*>(mStorage) = NULL;
+}
+
+//----------------------------------------------------------------------------------------
+
+Thread::~Thread()
+{
+    PG_ASSERTSTR(!mIsRunning, "A thread must be joined before being destroyed");
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Thread::Start(ThreadFunc func, void* userData, const char* name)
+{
+    PG_ASSERTSTR(!mIsRunning, "The thread is already running");
+    mFunc = func;
+    mUserData = userData;
+
+    // The function and the user data are read from this object by the new thread,
+    // the storage after the handle is used to pass them
+    void** args = reinterpret_cast<void**>(mStorage + sizeof(void*));
+    args[0] = reinterpret_cast<void*>(mFunc);
+    args[1] = mUserData;
+
+    HANDLE handle = CreateThread(NULL, 0, ThreadEntryPoint, args, 0, NULL);
+    if (handle == NULL)
+    {
+        PG_FAILSTR("Unable to create the thread %s", name);
+        return false;
+    }
+    *reinterpret_cast<HANDLE*>(mStorage) = handle;
+    mIsRunning = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Thread::Join()
+{
+    if (mIsRunning)
+    {
+        HANDLE handle = *reinterpret_cast<HANDLE*>(mStorage);
+        WaitForSingleObject(handle, INFINITE);
+        CloseHandle(handle);
+        *reinterpret_cast<HANDLE*>(mStorage) = NULL;
+        mIsRunning = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetHardwareThreadCount()
+{
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwNumberOfProcessors > 0 ? static_cast<unsigned int>(systemInfo.dwNumberOfProcessors) : 1;
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
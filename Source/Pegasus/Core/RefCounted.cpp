@@ -30,9 +30,15 @@ RefCounted::~RefCounted()
 void RefCounted::Release()
 {
     PG_ASSERTSTR(mRefCount > 0, "Invalid reference counter (%d), it should have a positive value", mRefCount);
-    --mRefCount;
 
-    if (mRefCount <= 0)
+#if PEGASUS_ENABLE_ATOMIC_REFCOUNT
+    // Only the owner releasing the last reference sees a counter of 0
+    const int refCount = AtomicDecrementAcqRel(&mRefCount);
+#else
+    const int refCount = --mRefCount;
+#endif
+
+    if (refCount <= 0)
     {
         PG_DELETE(mAllocator, this);
     }
@@ -0,0 +1,273 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WorkerPool.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Pool of worker threads running short CPU tasks
+
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Memory/MemoryManager.h"
+
+namespace Pegasus {
+namespace Core {
+
+//! Initial size of the task queue, grown when full
+static const unsigned int INITIAL_TASK_CAPACITY = 64;
+
+//----------------------------------------------------------------------------------------
+
+WorkerPool::WorkerPool()
+:   mAlloc(Memory::GetCoreAllocator()),
+    mTasks(nullptr),
+    mTaskCapacity(INITIAL_TASK_CAPACITY),
+    mTaskHead(0),
+    mTaskCount(0),
+    mWorkerCount(0),
+    mShutdown(false)
+{
+    mTasks = PG_NEW_ARRAY(mAlloc, -1, "WorkerPool Tasks", Alloc::PG_MEM_PERM, Task, mTaskCapacity);
+
+    // The thread creating the pool also runs tasks while waiting, keep one hardware thread for it
+    unsigned int workerCount = GetHardwareThreadCount() - 1;
+    if (workerCount > MAX_WORKERS)
+    {
+        workerCount = MAX_WORKERS;
+    }
+
+    for (unsigned int w = 0; w < workerCount; ++w)
+    {
+        if (!mWorkers[w].Start(WorkerEntryPoint, this, "Pegasus Worker"))
+        {
+            break;
+        }
+        ++mWorkerCount;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+WorkerPool::~WorkerPool()
+{
+    mMutex.Lock();
+    PG_ASSERTSTR(mTaskCount == 0, "The worker pool is destroyed with %u queued tasks", mTaskCount);
+    mShutdown = true;
+    mWorkAvailable.Broadcast();
+    mMutex.Unlock();
+
+    for (unsigned int w = 0; w < mWorkerCount; ++w)
+    {
+        mWorkers[w].Join();
+    }
+
+    PG_DELETE_ARRAY(mAlloc, mTasks);
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorkerPool::Submit(TaskGroup& group, TaskFunc func, void* userData)
+{
+    PG_ASSERTSTR(func != nullptr, "Invalid task function");
+
+    ScopedLock lock(mMutex);
+
+    // Grow the ring buffer when full, unwrapping the queued tasks
+    if (mTaskCount == mTaskCapacity)
+    {
+        const unsigned int newCapacity = mTaskCapacity * 2;
+        Task* newTasks = PG_NEW_ARRAY(mAlloc, -1, "WorkerPool Tasks", Alloc::PG_MEM_PERM, Task, newCapacity);
+        for (unsigned int t = 0; t < mTaskCount; ++t)
+        {
+            newTasks[t] = mTasks[(mTaskHead + t) & (mTaskCapacity - 1)];
+        }
+        PG_DELETE_ARRAY(mAlloc, mTasks);
+        mTasks = newTasks;
+        mTaskCapacity = newCapacity;
+        mTaskHead = 0;
+    }
+
+    Task& task = mTasks[(mTaskHead + mTaskCount) & (mTaskCapacity - 1)];
+    task.mFunc = func;
+    task.mUserData = userData;
+    task.mGroup = &group;
+    ++mTaskCount;
+    ++group.mPendingCount;
+
+    mWorkAvailable.Signal();
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorkerPool::Wait(TaskGroup& group)
+{
+    mMutex.Lock();
+    while (group.mPendingCount > 0)
+    {
+        Task task;
+        if (PopTask(task))
+        {
+            mMutex.Unlock();
+            RunTask(task);
+            mMutex.Lock();
+        }
+        else
+        {
+            // The remaining tasks of the group are running on other threads
+            mTaskCompleted.Wait(mMutex);
+        }
+    }
+    mMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+//! State shared by the threads processing a ParallelFor() range
+struct ParallelForJob
+{
+    WorkerPool::RangeFunc mFunc;
+    void* mUserData;
+    unsigned int mCount;
+    unsigned int mGrainSize;
+    volatile int mNextIndex;        //!< First item of the next chunk to process
+};
+
+//! Task processing chunks of a range until it is exhausted
+//! \param userData ParallelForJob
+static void ParallelForTask(void* userData)
+{
+    ParallelForJob* job = static_cast<ParallelForJob*>(userData);
+    for (;;)
+    {
+        const unsigned int begin = static_cast<unsigned int>(AtomicAdd(&job->mNextIndex, static_cast<int>(job->mGrainSize)));
+        if (begin >= job->mCount)
+        {
+            break;
+        }
+        const unsigned int end = (job->mCount - begin > job->mGrainSize) ? begin + job->mGrainSize : job->mCount;
+        job->mFunc(job->mUserData, begin, end);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorkerPool::ParallelFor(unsigned int count, unsigned int grainSize, RangeFunc func, void* userData)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (grainSize == 0)
+    {
+        grainSize = 1;
+    }
+
+    const unsigned int chunkCount = (count + grainSize - 1) / grainSize;
+    if (chunkCount == 1 || mWorkerCount == 0)
+    {
+        func(userData, 0, count);
+        return;
+    }
+
+    ParallelForJob job;
+    job.mFunc = func;
+    job.mUserData = userData;
+    job.mCount = count;
+    job.mGrainSize = grainSize;
+    job.mNextIndex = 0;
+
+    // Each helper drains chunks until the range is exhausted, the calling thread takes part too
+    const unsigned int helperCount = (chunkCount - 1 < mWorkerCount) ? chunkCount - 1 : mWorkerCount;
+    TaskGroup group;
+    for (unsigned int h = 0; h < helperCount; ++h)
+    {
+        Submit(group, ParallelForTask, &job);
+    }
+    ParallelForTask(&job);
+    Wait(group);
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorkerPool::WorkerEntryPoint(void* userData)
+{
+    static_cast<WorkerPool*>(userData)->WorkerLoop();
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorkerPool::WorkerLoop()
+{
+    mMutex.Lock();
+    for (;;)
+    {
+        Task task;
+        if (PopTask(task))
+        {
+            mMutex.Unlock();
+            RunTask(task);
+            mMutex.Lock();
+        }
+        else if (mShutdown)
+        {
+            break;
+        }
+        else
+        {
+            mWorkAvailable.Wait(mMutex);
+        }
+    }
+    mMutex.Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool WorkerPool::PopTask(Task& task)
+{
+    if (mTaskCount == 0)
+    {
+        return false;
+    }
+    task = mTasks[mTaskHead];
+    mTaskHead = (mTaskHead + 1) & (mTaskCapacity - 1);
+    --mTaskCount;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorkerPool::RunTask(const Task& task)
+{
+    task.mFunc(task.mUserData);
+
+    ScopedLock lock(mMutex);
+    PG_ASSERT(task.mGroup->mPendingCount > 0);
+    --task.mGroup->mPendingCount;
+    if (task.mGroup->mPendingCount == 0)
+    {
+        mTaskCompleted.Broadcast();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void ParallelFor(unsigned int count, unsigned int grainSize, WorkerPool::RangeFunc func, void* userData)
+{
+    WorkerPool* pool = WorkerPool::GetInstance();
+    if (pool != nullptr)
+    {
+        pool->ParallelFor(count, grainSize, func, userData);
+    }
+    else if (count > 0)
+    {
+        func(userData, 0, count);
+    }
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
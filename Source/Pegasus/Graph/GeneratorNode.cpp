@@ -66,11 +66,10 @@ NodeDataReturn GeneratorNode::GetUpdatedData(bool & updated)
         // No need to re-invalidate the GPU data, it is automatically invalidated
         // when the node data is invalidated
 
-        // Generate the node data using the generator-specific code
-        GenerateData();
-
-        // Validate the node data, the GPU node data is still dirty
-        GetData()->Validate();
+        // Generate the node data using the generator-specific code,
+        // or reuse the data generated by an identical node.
+        // Validates the node data, the GPU node data is still dirty
+        RegenerateData();
 
         updated = true;
     }
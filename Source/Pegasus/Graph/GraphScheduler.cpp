@@ -0,0 +1,364 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphScheduler.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Evaluation of the dirty nodes of a graph, in parallel on the worker pool
+
+#include "Pegasus/Graph/GraphScheduler.h"
+#include "Pegasus/Core/Atomic.h"
+
+namespace Pegasus {
+namespace Graph {
+
+//! Index stored for the nodes being visited, not sorted yet
+static const unsigned int VISITING_NODE = 0xFFFFFFFF;
+
+//----------------------------------------------------------------------------------------
+
+GraphScheduler::GraphScheduler(Alloc::IAllocator* alloc)
+:   mAlloc(alloc),
+    mWorkerPool(nullptr),
+    mEntries(alloc),
+    mDependents(alloc),
+    mStack(alloc),
+    mEntryIndices(alloc),
+#if PEGASUS_USE_EVENTS
+    mEventRecorders(alloc),
+#endif
+    mLastVisitedNodeCount(0),
+    mLastGeneratedNodeCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+GraphScheduler::~GraphScheduler()
+{
+#if PEGASUS_USE_EVENTS
+    for (unsigned int r = 0; r < mEventRecorders.GetSize(); ++r)
+    {
+        PG_DELETE(mAlloc, mEventRecorders[r]);
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphScheduler::Evaluate(Node* root)
+{
+    if (root == nullptr)
+    {
+        return;
+    }
+
+    // Already evaluated during the current pass
+    const unsigned int epoch = EvaluationPass::GetCurrentEpoch();
+    if ((epoch != 0) && (root->mDataEpoch == epoch))
+    {
+        return;
+    }
+
+    // Propagate the pending changes (property grids, inputs) to the dirty flags the dependencies are built from.
+    // Memoized in a pass, so the pull of the data after the evaluation does not update the nodes again
+    (void) root->UpdateInPass();
+
+    SortNodes(root);
+    const unsigned int generatedCount = BuildDependencies();
+    mLastVisitedNodeCount = mEntries.GetSize();
+    mLastGeneratedNodeCount = generatedCount;
+    if (generatedCount == 0)
+    {
+        return;
+    }
+
+    // Nodes regenerated only because an input changed are invalidated here,
+    // so GetUpdatedData() regenerates them even when called after their inputs are up to date
+    bool isParallel = (generatedCount > 1);
+    for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+    {
+        Entry& entry = mEntries[e];
+        if (entry.mNeedsGeneration)
+        {
+            entry.mNode->InvalidateData();
+            if (entry.mNode->GetMode() == Node::COMPUTE)
+            {
+                isParallel = false;
+            }
+        }
+    }
+
+#if PEGASUS_GRAPH_PARALLEL_EVALUATION
+    mWorkerPool = Core::WorkerPool::GetInstance();
+    if (mWorkerPool == nullptr || mWorkerPool->GetWorkerCount() == 0)
+    {
+        isParallel = false;
+    }
+#else
+    isParallel = false;
+#endif
+
+    if (isParallel)
+    {
+        // Visit the up-to-date nodes on this thread, so the tasks reading them
+        // during the pass only read the result stored in the nodes
+        if (epoch != 0)
+        {
+            for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+            {
+                if (!mEntries[e].mNeedsGeneration)
+                {
+                    bool updated = false;
+                    (void) mEntries[e].mNode->GetUpdatedDataInPass(updated);
+                }
+            }
+        }
+
+#if PEGASUS_USE_EVENTS
+        AssignEventRecorders();
+#endif
+
+        // Start with the nodes without any input to wait for, the tasks submit the other ones
+        for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+        {
+            Entry& entry = mEntries[e];
+            if (entry.mNeedsGeneration && entry.mPendingInputs == 0)
+            {
+                mWorkerPool->Submit(mTaskGroup, GenerateNodeTask, &entry);
+            }
+        }
+        mWorkerPool->Wait(mTaskGroup);
+
+#if PEGASUS_USE_EVENTS
+        DispatchRecordedEvents();
+#endif
+    }
+    else
+    {
+        // The entries are sorted with the inputs first
+        for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+        {
+            if (mEntries[e].mNeedsGeneration)
+            {
+                GenerateNode(mEntries[e]);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphScheduler::SortNodes(Node* root)
+{
+    mEntries.Reset();
+    mStack.Reset();
+    mEntryIndices.Reset();
+
+    // Iterative post-order depth first traversal, a node is added once all its inputs are
+    mEntryIndices.Insert(root, VISITING_NODE);
+    StackItem& rootItem = mStack.PushEmpty();
+    rootItem.mNode = root;
+    rootItem.mNextInput = 0;
+
+    while (mStack.GetSize() > 0)
+    {
+        StackItem& item = mStack[mStack.GetSize() - 1];
+        if (item.mNextInput < item.mNode->mNumInputs)
+        {
+            Node* input = item.mNode->mInputs[item.mNextInput++];
+            const unsigned int* inputIndex = mEntryIndices.Find(input);
+            if (inputIndex == nullptr)
+            {
+                mEntryIndices.Insert(input, VISITING_NODE);
+                StackItem& inputItem = mStack.PushEmpty();
+                inputItem.mNode = input;
+                inputItem.mNextInput = 0;
+            }
+            else
+            {
+                PG_ASSERTSTR(*inputIndex != VISITING_NODE, "Cycle detected in a graph, the node is its own input");
+            }
+        }
+        else
+        {
+            Node* node = item.mNode;
+            mStack.Pop();
+            mEntryIndices.Insert(node, mEntries.GetSize());
+
+            Entry& entry = mEntries.PushEmpty();
+            entry.mNode = node;
+            entry.mScheduler = this;
+            entry.mPendingInputs = 0;
+            entry.mFirstDependent = 0;
+            entry.mDependentCount = 0;
+            entry.mNeedsGeneration = false;
+#if PEGASUS_USE_EVENTS
+            entry.mEventRecorder = nullptr;
+#endif
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GraphScheduler::BuildDependencies()
+{
+    const unsigned int entryCount = mEntries.GetSize();
+    unsigned int generatedCount = 0;
+    unsigned int edgeCount = 0;
+
+    // Propagate the dirty flags from the inputs and count the edges between nodes to regenerate.
+    // Inputs connected several times to the same node count once
+    for (unsigned int e = 0; e < entryCount; ++e)
+    {
+        Entry& entry = mEntries[e];
+        Node* node = entry.mNode;
+        entry.mNeedsGeneration = node->IsDataDirty();
+        for (unsigned int i = 0; i < node->mNumInputs; ++i)
+        {
+            Entry& input = mEntries[*mEntryIndices.Find(node->mInputs[i])];
+            if (input.mNeedsGeneration)
+            {
+                entry.mNeedsGeneration = true;
+
+                bool isDuplicate = false;
+                for (unsigned int j = 0; j < i; ++j)
+                {
+                    isDuplicate |= (node->mInputs[j] == node->mInputs[i]);
+                }
+                if (!isDuplicate)
+                {
+                    ++entry.mPendingInputs;
+                    ++input.mDependentCount;
+                    ++edgeCount;
+                }
+            }
+        }
+        if (entry.mNeedsGeneration)
+        {
+            ++generatedCount;
+        }
+    }
+
+    if (generatedCount == 0)
+    {
+        return 0;
+    }
+
+    // Reserve a range of dependents for each entry, then fill the ranges
+    unsigned int firstDependent = 0;
+    for (unsigned int e = 0; e < entryCount; ++e)
+    {
+        mEntries[e].mFirstDependent = firstDependent;
+        firstDependent += mEntries[e].mDependentCount;
+        mEntries[e].mDependentCount = 0;
+    }
+
+    mDependents.Reset();
+    mDependents.Reserve(edgeCount);
+    for (unsigned int d = 0; d < edgeCount; ++d)
+    {
+        mDependents.PushBack(0);
+    }
+
+    for (unsigned int e = 0; e < entryCount; ++e)
+    {
+        Node* node = mEntries[e].mNode;
+        for (unsigned int i = 0; i < node->mNumInputs; ++i)
+        {
+            Entry& input = mEntries[*mEntryIndices.Find(node->mInputs[i])];
+            bool isDuplicate = false;
+            for (unsigned int j = 0; j < i; ++j)
+            {
+                isDuplicate |= (node->mInputs[j] == node->mInputs[i]);
+            }
+            if (input.mNeedsGeneration && !isDuplicate)
+            {
+                mDependents[input.mFirstDependent + input.mDependentCount] = e;
+                ++input.mDependentCount;
+            }
+        }
+    }
+
+    return generatedCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphScheduler::GenerateNode(Entry& entry)
+{
+    // The inputs are up to date, so only the data of this node is generated
+    bool updated = false;
+    (void) entry.mNode->GetUpdatedDataInPass(updated);
+    PG_ASSERTSTR(updated, "A node marked as dirty by the graph scheduler has not been regenerated");
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphScheduler::GenerateNodeTask(void* userData)
+{
+    Entry& entry = *static_cast<Entry*>(userData);
+    {
+#if PEGASUS_USE_EVENTS
+        // The listeners expect the events on the main thread, Evaluate() dispatches them after the tasks
+        Core::ScopedEventRecording recording(entry.mEventRecorder);
+#endif
+        GenerateNode(entry);
+    }
+
+    // The last input to finish submits the dependent node
+    GraphScheduler* scheduler = entry.mScheduler;
+    for (unsigned int d = 0; d < entry.mDependentCount; ++d)
+    {
+        Entry& dependent = scheduler->mEntries[scheduler->mDependents[entry.mFirstDependent + d]];
+        if (Core::AtomicAdd(&dependent.mPendingInputs, -1) == 1)
+        {
+            scheduler->mWorkerPool->Submit(scheduler->mTaskGroup, GenerateNodeTask, &dependent);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_USE_EVENTS
+
+void GraphScheduler::AssignEventRecorders()
+{
+    unsigned int recorderCount = 0;
+    for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+    {
+        Entry& entry = mEntries[e];
+        if (entry.mNeedsGeneration)
+        {
+            if (recorderCount == mEventRecorders.GetSize())
+            {
+                mEventRecorders.PushBack(PG_NEW(mAlloc, -1, "GraphScheduler EventRecorder", Alloc::PG_MEM_PERM) Core::EventRecorder(mAlloc));
+            }
+            entry.mEventRecorder = mEventRecorders[recorderCount++];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphScheduler::DispatchRecordedEvents()
+{
+    // The entries are sorted with the inputs first, as the serial evaluation generates them
+    for (unsigned int e = 0; e < mEntries.GetSize(); ++e)
+    {
+        if (mEntries[e].mEventRecorder != nullptr)
+        {
+            mEntries[e].mEventRecorder->DispatchEvents();
+        }
+    }
+}
+
+#endif  // PEGASUS_USE_EVENTS
+
+
+}   // namespace Graph
+}   // namespace Pegasus
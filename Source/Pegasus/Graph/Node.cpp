@@ -11,8 +11,11 @@
 
 #include "Pegasus/Graph/Node.h"
 #include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/NodeDataCache.h"
+#include "Pegasus/Core/Atomic.h"
 #include "Pegasus/AssetLib/Asset.h"
 #include "Pegasus/AssetLib/ASTree.h"
+#include "Pegasus/Utils/Hash.h"
 #include "Pegasus/Utils/String.h"
 
 using namespace Pegasus::AssetLib;
@@ -31,6 +34,12 @@ Node::Node(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocato
 ,   mNodeAllocator(nodeAllocator)
 ,   mNodeDataAllocator(nodeDataAllocator)
 ,   mNumInputs(0)
+,   mDataCache(nullptr)
+,   mContentKey(0)
+,   mUpdateEpoch(0)
+,   mUpdateResult(false)
+,   mDataEpoch(0)
+,   mDataUpdated(false)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -116,6 +125,57 @@ NodeDataReturn Node::GetUpdatedData(bool & updated)
 
 //----------------------------------------------------------------------------------------
 
+bool Node::UpdateInPass()
+{
+    const unsigned int epoch = EvaluationPass::GetCurrentEpoch();
+    if (epoch == 0)
+    {
+        return Update();
+    }
+
+    // Already updated during this pass, through another parent node
+    if (mUpdateEpoch == epoch)
+    {
+        EvaluationPass::CountVisit(false);
+        return mUpdateResult;
+    }
+
+    EvaluationPass::CountVisit(true);
+    mUpdateResult = Update();
+    mUpdateEpoch = epoch;
+    return mUpdateResult;
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataReturn Node::GetUpdatedDataInPass(bool & updated)
+{
+    const unsigned int epoch = EvaluationPass::GetCurrentEpoch();
+    if (epoch == 0)
+    {
+        return GetUpdatedData(updated);
+    }
+
+    // Already up-to-date during this pass, the inputs do not need to be visited again.
+    // The updated flag is forwarded, so every parent knows this node has been recomputed
+    if (mDataEpoch == epoch)
+    {
+        EvaluationPass::CountVisit(false);
+        updated |= mDataUpdated;
+        return mData;
+    }
+
+    EvaluationPass::CountVisit(true);
+    bool nodeUpdated = false;
+    NodeDataReturn data = GetUpdatedData(nodeUpdated);
+    mDataUpdated = nodeUpdated;
+    mDataEpoch = epoch;
+    updated |= nodeUpdated;
+    return data;
+}
+
+//----------------------------------------------------------------------------------------
+
 void Node::ReleaseDataAndPropagate()
 {
     // Deallocate the data if defined
@@ -155,6 +215,122 @@ void Node::CreateData()
 
 //----------------------------------------------------------------------------------------
 
+void Node::RegenerateData()
+{
+    PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being regenerated");
+
+    mContentKey = ((mDataCache != nullptr) && IsDataCacheable()) ? ComputeContentKey() : 0;
+
+    // Identical data generated before, by this node or another one with the same content key,
+    // possibly during a previous run when loaded from the cache file
+    const NodeDataCache::FindResult found = (mContentKey != 0) ? mDataCache->Find(mContentKey, *mData)
+                                                               : NodeDataCache::FIND_MISS;
+    if (found == NodeDataCache::FIND_MISS)
+    {
+        GenerateData();
+        FinalizeData();
+    }
+    mData->Validate();
+
+    // The cache keeps its own copy, so this node can regenerate its data in place later
+    if ((mContentKey != 0) && (found != NodeDataCache::FIND_MEMORY_HIT) && mDataCache->CanStore(mData->GetContentSize()))
+    {
+        NodeDataRef cachedData = AllocateData();
+        if ((cachedData != nullptr) && cachedData->CopyContent(*mData))
+        {
+            cachedData->Validate();
+            mDataCache->Insert(mContentKey, cachedData, mData->GetContentSize());
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Largest property, in bytes (PROPERTYTYPE_STRING64)
+static const unsigned int MAX_PROPERTY_SIZE = 64;
+
+//! Add the value of a property to a content key
+//! \param key Content key computed so far
+//! \param record Record of the property
+//! \param accessor Accessor to the value of the property
+//! \return Content key including the value of the property
+static unsigned long long HashPropertyValue(unsigned long long key,
+                                            const PropertyGrid::PropertyRecord & record,
+                                            const PropertyGrid::PropertyReadAccessor & accessor)
+{
+    union
+    {
+        unsigned char bytes[MAX_PROPERTY_SIZE];
+        void * pointer;
+        double number;
+    } value;
+
+    if (record.size <= 0 || record.size > static_cast<int>(MAX_PROPERTY_SIZE))
+    {
+        PG_FAILSTR("Invalid size (%d) for the property %s", record.size, record.name);
+        return key;
+    }
+    accessor.Read(value.bytes, static_cast<unsigned int>(record.size));
+
+    switch (record.type)
+    {
+        case PropertyGrid::PROPERTYTYPE_STRING64:
+            {
+                // Only the characters, the end of the buffer is undefined
+                value.bytes[MAX_PROPERTY_SIZE - 1] = '\0';
+                const char * str = reinterpret_cast<const char *>(value.bytes);
+                return Utils::HashFnv1a64(str, static_cast<unsigned int>(Utils::Strlen(str)) + 1, key);
+            }
+
+        case PropertyGrid::PROPERTYTYPE_CUSTOM_ENUM:
+            {
+                // Only the value, the name is a pointer
+                const int enumValue = reinterpret_cast<const PropertyGrid::BaseEnumType *>(value.bytes)->GetValue();
+                return Utils::HashFnv1a64(&enumValue, sizeof(enumValue), key);
+            }
+
+        default:
+            return Utils::HashFnv1a64(value.bytes, static_cast<unsigned int>(record.size), key);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long Node::ComputeContentKey() const
+{
+    const char * className = GetClassInstanceName();
+    unsigned long long key = Utils::HashFnv1a64(className, static_cast<unsigned int>(Utils::Strlen(className)));
+
+    for (unsigned int p = 0; p < GetNumClassProperties(); ++p)
+    {
+        key = HashPropertyValue(key, GetClassPropertyRecord(p), GetClassReadPropertyAccessor(p));
+    }
+    for (unsigned int p = 0; p < GetNumObjectProperties(); ++p)
+    {
+        const PropertyGrid::PropertyRecord & record = GetObjectPropertyRecord(p);
+        key = Utils::HashFnv1a64(record.name, static_cast<unsigned int>(Utils::Strlen(record.name)), key);
+        key = HashPropertyValue(key, record, GetObjectReadPropertyAccessor(p));
+    }
+
+    key = HashConfiguration(key);
+
+    // The inputs are ordered, so the same nodes connected in a different order give a different key
+    for (unsigned int i = 0; i < mNumInputs; ++i)
+    {
+        const unsigned long long inputKey = mInputs[i]->mContentKey;
+        if (inputKey == 0)
+        {
+            return 0;
+        }
+        key = Utils::HashFnv1a64(&inputKey, sizeof(inputKey), key);
+    }
+
+    // 0 is reserved for the nodes that are not cacheable
+    return (key != 0) ? key : 1;
+}
+
+//----------------------------------------------------------------------------------------
+
 void Node::InvalidateData()
 {
     if (mData != nullptr)
@@ -395,6 +571,68 @@ bool Node::ReadFromObject(NodeManager* nodeManager, const AssetLib::Asset* paren
     return true;
 }
 
+//----------------------------------------------------------------------------------------
+
+unsigned int EvaluationPass::sCurrentEpoch = 0;
+unsigned int EvaluationPass::sLastEpoch = 0;
+volatile int EvaluationPass::sVisitCount = 0;
+volatile int EvaluationPass::sEvaluationCount = 0;
+
+//----------------------------------------------------------------------------------------
+
+EvaluationPass::EvaluationPass()
+:   mIsOutermost(sCurrentEpoch == 0)
+{
+    if (mIsOutermost)
+    {
+        // Epoch 0 is reserved for the nodes never visited in a pass
+        ++sLastEpoch;
+        if (sLastEpoch == 0)
+        {
+            sLastEpoch = 1;
+        }
+        sCurrentEpoch = sLastEpoch;
+        sVisitCount = 0;
+        sEvaluationCount = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+EvaluationPass::~EvaluationPass()
+{
+    if (mIsOutermost)
+    {
+        sCurrentEpoch = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int EvaluationPass::GetVisitCount()
+{
+    return static_cast<unsigned int>(Core::AtomicLoad(&sVisitCount));
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int EvaluationPass::GetEvaluationCount()
+{
+    return static_cast<unsigned int>(Core::AtomicLoad(&sEvaluationCount));
+}
+
+//----------------------------------------------------------------------------------------
+
+void EvaluationPass::CountVisit(bool evaluated)
+{
+    // Nodes are visited by the worker threads during a parallel graph evaluation
+    Core::AtomicIncrementRelaxed(&sVisitCount);
+    if (evaluated)
+    {
+        Core::AtomicIncrementRelaxed(&sEvaluationCount);
+    }
+}
+
 
 }   // namespace Graph
 }   // namespace Pegasus
@@ -36,9 +36,15 @@ NodeData::~NodeData()
 void NodeData::Release()
 {
     PG_ASSERTSTR(mRefCount > 0, "Invalid reference counter (%d), it should have a positive value", mRefCount);
-    --mRefCount;
 
-    if (mRefCount <= 0)
+#if PEGASUS_ENABLE_ATOMIC_REFCOUNT
+    // Only the owner releasing the last reference sees a counter of 0
+    const int refCount = Core::AtomicDecrementAcqRel(&mRefCount);
+#else
+    const int refCount = --mRefCount;
+#endif
+
+    if (refCount <= 0)
     {
         //! \todo The destructor is called explicitly here because PG_DELETE does not do it.
         //!       This should be replaced by implicit destructors
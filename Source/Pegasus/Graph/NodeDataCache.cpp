@@ -0,0 +1,387 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataCache.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Content addressed cache of generated node data, shared by the graphs of a node manager
+
+#include "Pegasus/Graph/NodeDataCache.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Graph {
+
+//! Identifier of the cache files
+static const char FILE_MAGIC[4] = { 'P', 'G', 'N', 'C' };
+
+//----------------------------------------------------------------------------------------
+
+NodeDataCache::NodeDataCache(Alloc::IAllocator* alloc)
+:   mAlloc(alloc),
+    mEntries(alloc),
+    mEntryIndices(alloc),
+    mFileEntries(alloc),
+    mFirstUsed(INVALID_INDEX),
+    mLastUsed(INVALID_INDEX),
+    mFileReaderCount(0),
+    mFirstFree(INVALID_INDEX),
+    mMemoryBudget(DEFAULT_MEMORY_BUDGET),
+    mMemorySize(0),
+    mHitCount(0),
+    mFileHitCount(0),
+    mMissCount(0),
+    mEvictionCount(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataCache::~NodeDataCache()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::SetMemoryBudget(unsigned int budget)
+{
+    Core::ScopedLock lock(mMutex);
+    mMemoryBudget = budget;
+    EvictUntil(budget);
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataCache::FindResult NodeDataCache::Find(Key key, NodeData& data)
+{
+    NodeDataRef cachedData;
+    FileEntry fileEntry;
+    {
+        Core::ScopedLock lock(mMutex);
+        const unsigned int* index = mEntryIndices.Find(key);
+        if (index != nullptr)
+        {
+            ++mHitCount;
+            Unlink(*index);
+            LinkFront(*index);
+            cachedData = mEntries[*index].mData;
+        }
+        else
+        {
+            const FileEntry* foundFileEntry = mFileEntries.Find(key);
+            if (foundFileEntry == nullptr)
+            {
+                ++mMissCount;
+                return FIND_MISS;
+            }
+            fileEntry = *foundFileEntry;
+            ++mFileReaderCount;
+        }
+    }
+
+    if (cachedData != nullptr)
+    {
+        // The cached data is never modified, the reference keeps it alive
+        // if another thread evicts the entry during the copy
+        const bool copied = data.CopyContent(*cachedData);
+        PG_ASSERTSTR(copied, "Cached node data cannot be copied, it should not have been cached");
+        return copied ? FIND_MEMORY_HIT : FIND_MISS;
+    }
+
+    // The file buffer is only replaced or destroyed by Load() and Clear(), which are not called during the evaluation.
+    // The content of a node whose configuration changed since the file was saved does not match and is rejected
+    const bool isRead = data.ReadContent(mFileBuffer.GetBuffer() + fileEntry.mOffset, fileEntry.mSize);
+
+    Core::ScopedLock lock(mMutex);
+    --mFileReaderCount;
+    if (!isRead)
+    {
+        ++mMissCount;
+        return FIND_MISS;
+    }
+    ++mHitCount;
+    ++mFileHitCount;
+    return FIND_FILE_HIT;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NodeDataCache::CanStore(unsigned int size) const
+{
+    return (size > 0) && (size <= mMemoryBudget);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::Insert(Key key, NodeDataIn data, unsigned int size)
+{
+    PG_ASSERTSTR(key != 0, "Invalid key for the node data cache");
+    PG_ASSERTSTR(data != nullptr, "Invalid data added to the node data cache");
+
+    Core::ScopedLock lock(mMutex);
+    if (size == 0 || size > mMemoryBudget)
+    {
+        return;
+    }
+
+    // Another node with the same content may have been generated at the same time
+    const unsigned int* existingIndex = mEntryIndices.Find(key);
+    if (existingIndex != nullptr)
+    {
+        RemoveEntry(*existingIndex);
+    }
+
+    EvictUntil(mMemoryBudget - size);
+
+    unsigned int index = mFirstFree;
+    if (index != INVALID_INDEX)
+    {
+        mFirstFree = mEntries[index].mNext;
+    }
+    else
+    {
+        index = mEntries.GetSize();
+        mEntries.PushEmpty();
+    }
+
+    Entry& entry = mEntries[index];
+    entry.mKey = key;
+    entry.mData = data;
+    entry.mSize = size;
+    LinkFront(index);
+    mEntryIndices.Insert(key, index);
+    mMemorySize += size;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::Clear()
+{
+    Core::ScopedLock lock(mMutex);
+    PG_ASSERTSTR(mFileReaderCount == 0, "The node data cache is cleared while its file entries are being read");
+    mEntries.Clear();
+    mEntryIndices.Reset();
+    mFirstUsed = INVALID_INDEX;
+    mLastUsed = INVALID_INDEX;
+    mFirstFree = INVALID_INDEX;
+    mMemorySize = 0;
+    mFileEntries.Reset();
+    mFileBuffer.DestroyBuffer();
+}
+
+//----------------------------------------------------------------------------------------
+
+Io::IoError NodeDataCache::Load(Io::IOManager* ioManager, const char* relativePath)
+{
+    PG_ASSERTSTR(ioManager != nullptr, "Invalid IO manager to load the node data cache");
+
+    Core::ScopedLock lock(mMutex);
+    PG_ASSERTSTR(mFileReaderCount == 0, "The node data cache file is loaded while the entries of the previous one are being read");
+    mFileEntries.Reset();
+    mFileBuffer.DestroyBuffer();
+
+    // Loaded in memory rather than mapped, so Save() can overwrite the file
+    const Io::IoError error = ioManager->OpenFileToBuffer(relativePath, mFileBuffer, true, mAlloc);
+    if (error != Io::ERR_NONE)
+    {
+        return error;
+    }
+
+    const unsigned int fileSize = static_cast<unsigned int>(mFileBuffer.GetFileSize());
+    FileHeader header;
+    bool isValid = (fileSize >= sizeof(FileHeader));
+    if (isValid)
+    {
+        Utils::Memcpy(&header, mFileBuffer.GetBuffer(), sizeof(FileHeader));
+        for (unsigned int c = 0; c < sizeof(FILE_MAGIC); ++c)
+        {
+            isValid &= (header.mMagic[c] == FILE_MAGIC[c]);
+        }
+        isValid = isValid
+               && (header.mVersion == FILE_VERSION)
+               && (header.mEntryCount <= (fileSize - sizeof(FileHeader)) / sizeof(FileEntry));
+    }
+
+    const unsigned int contentOffset = isValid ? sizeof(FileHeader) + header.mEntryCount * sizeof(FileEntry) : 0;
+    for (unsigned int e = 0; isValid && (e < header.mEntryCount); ++e)
+    {
+        FileEntry entry;
+        Utils::Memcpy(&entry, mFileBuffer.GetBuffer() + sizeof(FileHeader) + e * sizeof(FileEntry), sizeof(FileEntry));
+        isValid = (entry.mKey != 0) && (entry.mOffset >= contentOffset) && (entry.mOffset <= fileSize)
+               && (entry.mSize <= fileSize - entry.mOffset);
+        if (isValid)
+        {
+            mFileEntries.Insert(entry.mKey, entry);
+        }
+    }
+
+    if (!isValid)
+    {
+        PG_LOG('FILE', "Ignoring the invalid or outdated node data cache file \"%s\"", relativePath);
+        mFileEntries.Reset();
+        mFileBuffer.DestroyBuffer();
+        return Io::ERR_READING_FILE;
+    }
+
+    PG_LOG('FILE', "Loaded %u entries from the node data cache file \"%s\"", mFileEntries.GetSize(), relativePath);
+    return Io::ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+Io::IoError NodeDataCache::Save(Io::IOManager* ioManager, const char* relativePath)
+{
+    PG_ASSERTSTR(ioManager != nullptr, "Invalid IO manager to save the node data cache");
+
+    Core::ScopedLock lock(mMutex);
+    Utils::Vector<FileEntry> fileEntries(mAlloc);
+    Utils::ByteStream content(mAlloc);
+
+    // Most recently used entries first, so they are the ones kept when the budget is reached
+    for (unsigned int index = mFirstUsed; index != INVALID_INDEX; index = mEntries[index].mNext)
+    {
+        const Entry& entry = mEntries[index];
+        const unsigned int offset = static_cast<unsigned int>(content.GetSize());
+        if (entry.mData->WriteContent(content))
+        {
+            FileEntry& fileEntry = fileEntries.PushEmpty();
+            fileEntry.mKey = entry.mKey;
+            fileEntry.mOffset = offset;
+            fileEntry.mSize = static_cast<unsigned int>(content.GetSize()) - offset;
+        }
+    }
+
+    // Then the entries of the previous run that have not been needed yet, copied as they are
+    for (unsigned int slot = 0; slot < mFileEntries.GetSlotCount(); ++slot)
+    {
+        if (mFileEntries.IsSlotUsed(slot) && !mEntryIndices.Contains(mFileEntries.GetSlotKey(slot)))
+        {
+            const FileEntry& loadedEntry = mFileEntries.GetSlotValue(slot);
+            if (static_cast<unsigned int>(content.GetSize()) + loadedEntry.mSize > mMemoryBudget)
+            {
+                continue;
+            }
+            FileEntry& fileEntry = fileEntries.PushEmpty();
+            fileEntry.mKey = loadedEntry.mKey;
+            fileEntry.mOffset = static_cast<unsigned int>(content.GetSize());
+            fileEntry.mSize = loadedEntry.mSize;
+            content.Append(mFileBuffer.GetBuffer() + loadedEntry.mOffset, static_cast<int>(loadedEntry.mSize));
+        }
+    }
+
+    // The offsets are relative to the start of the file
+    const unsigned int contentOffset = sizeof(FileHeader) + fileEntries.GetSize() * sizeof(FileEntry);
+    FileHeader header;
+    Utils::Memcpy(header.mMagic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.mVersion = FILE_VERSION;
+    header.mEntryCount = fileEntries.GetSize();
+    header.mPadding = 0;
+
+    Utils::ByteStream file(mAlloc);
+    file.Append(&header, sizeof(FileHeader));
+    for (unsigned int e = 0; e < fileEntries.GetSize(); ++e)
+    {
+        fileEntries[e].mOffset += contentOffset;
+        file.Append(&fileEntries[e], sizeof(FileEntry));
+    }
+    file.Append(&content);
+
+    Io::FileBuffer fileBuffer;
+    fileBuffer.OwnBuffer(mAlloc, static_cast<char*>(file.GetBuffer()), file.GetSize());
+    const Io::IoError error = ioManager->SaveFileToBuffer(relativePath, fileBuffer);
+    fileBuffer.ForgetBuffer();
+
+    if (error == Io::ERR_NONE)
+    {
+        PG_LOG('FILE', "Saved %u entries to the node data cache file \"%s\"", fileEntries.GetSize(), relativePath);
+    }
+    return error;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::ResetStatistics()
+{
+    Core::ScopedLock lock(mMutex);
+    mHitCount = 0;
+    mFileHitCount = 0;
+    mMissCount = 0;
+    mEvictionCount = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::Unlink(unsigned int index)
+{
+    Entry& entry = mEntries[index];
+    if (entry.mPrev != INVALID_INDEX)
+    {
+        mEntries[entry.mPrev].mNext = entry.mNext;
+    }
+    else
+    {
+        mFirstUsed = entry.mNext;
+    }
+
+    if (entry.mNext != INVALID_INDEX)
+    {
+        mEntries[entry.mNext].mPrev = entry.mPrev;
+    }
+    else
+    {
+        mLastUsed = entry.mPrev;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::LinkFront(unsigned int index)
+{
+    Entry& entry = mEntries[index];
+    entry.mPrev = INVALID_INDEX;
+    entry.mNext = mFirstUsed;
+    if (mFirstUsed != INVALID_INDEX)
+    {
+        mEntries[mFirstUsed].mPrev = index;
+    }
+    else
+    {
+        mLastUsed = index;
+    }
+    mFirstUsed = index;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::RemoveEntry(unsigned int index)
+{
+    Entry& entry = mEntries[index];
+    Unlink(index);
+    mEntryIndices.Remove(entry.mKey);
+    mMemorySize -= entry.mSize;
+
+    entry.mData = nullptr;
+    entry.mSize = 0;
+    entry.mNext = mFirstFree;
+    mFirstFree = index;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataCache::EvictUntil(unsigned int size)
+{
+    while (mMemorySize > size && mLastUsed != INVALID_INDEX)
+    {
+        RemoveEntry(mLastUsed);
+        ++mEvictionCount;
+    }
+}
+
+
+}   // namespace Graph
+}   // namespace Pegasus
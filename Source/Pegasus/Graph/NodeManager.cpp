@@ -21,7 +21,10 @@ namespace Graph {
 NodeManager::NodeManager(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
 :   mNodeAllocator(nodeAllocator),
     mNodeDataAllocator(nodeDataAllocator),
-    mNumRegisteredNodes(0)
+    mNumRegisteredNodes(0),
+    mRegisteredNodeIndices(nodeAllocator),
+    mScheduler(nodeAllocator),
+    mDataCache(nodeAllocator)
 {
     PG_ASSERTSTR(nodeAllocator != nullptr, "Invalid node allocator given to the NodeManager");
     PG_ASSERTSTR(nodeDataAllocator != nullptr, "Invalid node data allocator given to the NodeManager");
@@ -61,6 +64,12 @@ void NodeManager::RegisterNode(const char * className, Node::CreateNodeFunc crea
         return;
     }
 
+    if (mRegisteredNodeIndices.Contains(className))
+    {
+        PG_FAILSTR("Trying to register the node class %s but it is already registered", className);
+        return;
+    }
+
     // After the parameters have been validated, register the class
     NodeEntry & entry = mRegisteredNodes[mNumRegisteredNodes];
 #if PEGASUS_COMPILER_MSVC
@@ -70,6 +79,7 @@ void NodeManager::RegisterNode(const char * className, Node::CreateNodeFunc crea
     strncpy(entry.className, className, MAX_CLASS_NAME_LENGTH);
 #endif  // PEGASUS_COMPILER_MSVC
     entry.createNodeFunc = createNodeFunc;
+    mRegisteredNodeIndices.Insert(entry.className, mNumRegisteredNodes);
     ++mNumRegisteredNodes;
 }
 
@@ -82,7 +92,12 @@ NodeReturn NodeManager::CreateNode(const char * className)
     {
         NodeEntry & entry = mRegisteredNodes[registeredNodeIndex];
         PG_ASSERT(entry.createNodeFunc != nullptr);
-        return entry.createNodeFunc(this, mNodeAllocator, mNodeDataAllocator);
+        NodeReturn node = entry.createNodeFunc(this, mNodeAllocator, mNodeDataAllocator);
+        if (node != nullptr)
+        {
+            node->mDataCache = &mDataCache;
+        }
+        return node;
     }
     else
     {
@@ -109,18 +124,15 @@ unsigned int NodeManager::GetRegisteredNodeIndex(const char * className) const
         return mNumRegisteredNodes;
     }
 
-    unsigned int index;
-    for (index = 0; index < mNumRegisteredNodes; ++index)
+    const unsigned int * index = mRegisteredNodeIndices.Find(className);
+    if (index != nullptr)
     {
-        if (Pegasus::Utils::Strcmp(mRegisteredNodes[index].className, className) == 0)
-        {
-            // Node found
-            return index;
-        }
+        // Node found
+        PG_ASSERT(*index < mNumRegisteredNodes);
+        return *index;
     }
 
     // Node not found
-    PG_ASSERT(index == mNumRegisteredNodes);
     return mNumRegisteredNodes;
 }
 
@@ -51,7 +51,7 @@ bool OperatorNode::Update()
     bool dirtyFlagSet = false;
     for (unsigned i = 0; i < numInputs; ++i)
     {
-        dirtyFlagSet |= GetInput(i)->Update();
+        dirtyFlagSet |= GetInput(i)->UpdateInPass();
     }
 
     if (IsDataAllocated() && IsPropertyGridDirty())
@@ -104,7 +104,7 @@ NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
     bool inputUpdated = false;
     for (unsigned int i = 0; i < numInputs; ++i)
     {
-        (void) GetInput(i)->GetUpdatedData(inputUpdated);
+        (void) GetInput(i)->GetUpdatedDataInPass(inputUpdated);
     }
 
     // If any input has been updated or if the data is dirty, re-generate them
@@ -114,11 +114,10 @@ NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
         // re-invalidate the operator data so the GPU data dirty flag is set
         GetData()->Invalidate();
 
-        // Generate the node data using the operator-specific code
-        GenerateData();
-
-        // Validate the node data, the GPU node data is still dirty
-        GetData()->Validate();
+        // Generate the node data using the operator-specific code,
+        // or reuse the data generated by an identical node.
+        // Validates the node data, the GPU node data is still dirty
+        RegenerateData();
 
         updated = true;
     }
@@ -10,6 +10,7 @@
 //! \brief	Base output node class, for the root of the graphs
 
 #include "Pegasus/Graph/OutputNode.h"
+#include "Pegasus/Graph/NodeManager.h"
 #include "Pegasus/AssetLib/Asset.h"
 
 namespace Pegasus {
@@ -43,7 +44,7 @@ bool OutputNode::Update()
     if (GetNumInputs() == 1)
     {
         // Update the input node and return its dirty state
-        return GetInput(0)->Update();
+        return GetInput(0)->UpdateInPass();
     }
     else
     {
@@ -64,7 +65,7 @@ NodeDataReturn OutputNode::GetUpdatedData(bool & updated)
     if (GetNumInputs() == 1)
     {
         // Redirect the updated data from the input node
-        return GetInput(0)->GetUpdatedData(updated);
+        return GetInput(0)->GetUpdatedDataInPass(updated);
     }
     else
     {
@@ -89,6 +90,17 @@ OutputNode::~OutputNode()
 
 //----------------------------------------------------------------------------------------
 
+void OutputNode::EvaluateInputGraph()
+{
+    if ((mNodeManager != nullptr) && (GetNumInputs() > 0))
+    {
+        NodeRef inputNode = GetInput(0);
+        mNodeManager->GetScheduler()->Evaluate(inputNode);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 NodeData * OutputNode::AllocateData() const
 {
     PG_FAILSTR("Output nodes do not have data, so there is nothing to allocate");
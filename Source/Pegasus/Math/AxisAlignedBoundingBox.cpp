@@ -223,6 +223,21 @@ void AxisAlignedBoundingBox::Union(const AxisAlignedBoundingBox & box)
 
 //----------------------------------------------------------------------------------------
 
+void AxisAlignedBoundingBox::Transform(Mat44In mat)
+{
+    // The center is transformed, and each half size is the sum of the projections of the
+    // transformed half sizes on the axis (Arvo, Transforming Axis-Aligned Bounding Boxes)
+    const Point3 center = GetCenter();
+    const Vec3 size = GetSize();
+    const Point3 newCenter(mat.m11 * center.x + mat.m12 * center.y + mat.m13 * center.z + mat.m14,
+                           mat.m21 * center.x + mat.m22 * center.y + mat.m23 * center.z + mat.m24,
+                           mat.m31 * center.x + mat.m32 * center.y + mat.m33 * center.z + mat.m34);
+    const Vec3 newSize(Abs(mat.m11) * size.x + Abs(mat.m12) * size.y + Abs(mat.m13) * size.z,
+                       Abs(mat.m21) * size.x + Abs(mat.m22) * size.y + Abs(mat.m23) * size.z,
+                       Abs(mat.m31) * size.x + Abs(mat.m32) * size.y + Abs(mat.m33) * size.z);
+    SetCenterSize(newCenter, newSize);
+}
+
 bool AxisAlignedBoundingBox::IsInside(Point3In point) const
 {
     if (!areMinMaxDefined)
@@ -279,6 +294,25 @@ bool AxisAlignedBoundingBox::IsBehind(const Plane & plane) const
 
 //----------------------------------------------------------------------------------------
 
+bool AxisAlignedBoundingBox::IsOutsideClipSpace(Mat44In mat) const
+{
+    // One bit per plane of the clip space, kept while all the corners are outside the plane
+    Point3 corners[8];
+    ComputeCornerCoordinates(corners);
+    unsigned int outsidePlanes = 0x3f;
+    for (unsigned int c = 0; c < 8; ++c)
+    {
+        Vec4 clip;
+        Mult44_41(clip, mat, Vec4(corners[c].x, corners[c].y, corners[c].z, 1.0f));
+        outsidePlanes &= (clip.x < -clip.w ? 0x01 : 0) | (clip.x > clip.w ? 0x02 : 0)
+                       | (clip.y < -clip.w ? 0x04 : 0) | (clip.y > clip.w ? 0x08 : 0)
+                       | (clip.z < -clip.w ? 0x10 : 0) | (clip.z > clip.w ? 0x20 : 0);
+    }
+    return outsidePlanes != 0;
+}
+
+//----------------------------------------------------------------------------------------
+
 //! \todo Implement camera support
 //bool AxisAlignedBoundingBox::IsInsideViewRegion(const Camera & camera) const
 //{
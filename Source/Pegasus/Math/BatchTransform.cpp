@@ -0,0 +1,231 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BatchTransform.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Transformation of arrays of vectors by one matrix, and their bounds (SSE2 implementation when available)
+
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Math/Constants.h"
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#else
+#include <math.h>
+#endif
+
+namespace Pegasus {
+namespace Math {
+
+
+// The SSE2 versions multiply each column of the matrix by one component of the vector,
+// then add the products in the order of Mult44_41() and Mult33_31(), giving the same bits.
+// The vectors are not 16 bytes aligned in the vertex structures, hence the unaligned loads and stores.
+
+void TransformPositions(Vec4 * dst, unsigned int dstStride,
+                        const Vec4 * src, unsigned int srcStride,
+                        unsigned int count, Mat44In mat)
+{
+    char * dstBytes = reinterpret_cast<char *>(dst);
+    const char * srcBytes = reinterpret_cast<const char *>(src);
+
+#if PEGASUS_ENABLE_SSE2
+    const __m128 col1 = _mm_setr_ps(mat.m11, mat.m21, mat.m31, mat.m41);
+    const __m128 col2 = _mm_setr_ps(mat.m12, mat.m22, mat.m32, mat.m42);
+    const __m128 col3 = _mm_setr_ps(mat.m13, mat.m23, mat.m33, mat.m43);
+    const __m128 col4 = _mm_setr_ps(mat.m14, mat.m24, mat.m34, mat.m44);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const __m128 vec = _mm_loadu_ps(reinterpret_cast<const float *>(srcBytes));
+        __m128 result = _mm_mul_ps(col1, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(0, 0, 0, 0)));
+        result = _mm_add_ps(result, _mm_mul_ps(col2, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(1, 1, 1, 1))));
+        result = _mm_add_ps(result, _mm_mul_ps(col3, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(2, 2, 2, 2))));
+        result = _mm_add_ps(result, _mm_mul_ps(col4, _mm_shuffle_ps(vec, vec, _MM_SHUFFLE(3, 3, 3, 3))));
+        _mm_storeu_ps(reinterpret_cast<float *>(dstBytes), result);
+        dstBytes += dstStride;
+        srcBytes += srcStride;
+    }
+#else
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const Vec4 & vec = *reinterpret_cast<const Vec4 *>(srcBytes);
+        const PFloat32 t0 = mat.m11 * vec.x + mat.m12 * vec.y + mat.m13 * vec.z + mat.m14 * vec.w;
+        const PFloat32 t1 = mat.m21 * vec.x + mat.m22 * vec.y + mat.m23 * vec.z + mat.m24 * vec.w;
+        const PFloat32 t2 = mat.m31 * vec.x + mat.m32 * vec.y + mat.m33 * vec.z + mat.m34 * vec.w;
+        const PFloat32 t3 = mat.m41 * vec.x + mat.m42 * vec.y + mat.m43 * vec.z + mat.m44 * vec.w;
+        Vec4 & result = *reinterpret_cast<Vec4 *>(dstBytes);
+        result.x = t0;
+        result.y = t1;
+        result.z = t2;
+        result.w = t3;
+        dstBytes += dstStride;
+        srcBytes += srcStride;
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+void TransformNormals(Vec3 * dst, unsigned int dstStride,
+                      const Vec3 * src, unsigned int srcStride,
+                      unsigned int count, Mat33In mat, bool normalize)
+{
+    char * dstBytes = reinterpret_cast<char *>(dst);
+    const char * srcBytes = reinterpret_cast<const char *>(src);
+
+#if PEGASUS_ENABLE_SSE2
+    // Three floats per normal, loaded one by one not to read past the last normal
+    const __m128 col1 = _mm_setr_ps(mat.m11, mat.m21, mat.m31, 0.0f);
+    const __m128 col2 = _mm_setr_ps(mat.m12, mat.m22, mat.m32, 0.0f);
+    const __m128 col3 = _mm_setr_ps(mat.m13, mat.m23, mat.m33, 0.0f);
+    const __m128 epsilon = _mm_set_ss(PFLOAT_EPSILON);
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const float * vec = reinterpret_cast<const float *>(srcBytes);
+        __m128 result = _mm_mul_ps(col1, _mm_set1_ps(vec[0]));
+        result = _mm_add_ps(result, _mm_mul_ps(col2, _mm_set1_ps(vec[1])));
+        result = _mm_add_ps(result, _mm_mul_ps(col3, _mm_set1_ps(vec[2])));
+        if (normalize)
+        {
+            const __m128 squares = _mm_mul_ps(result, result);
+            const __m128 lengthSq = _mm_add_ss(_mm_add_ss(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(1, 1, 1, 1))),
+                                               _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 2, 2, 2)));
+            const __m128 length = _mm_sqrt_ss(lengthSq);
+            if (_mm_comigt_ss(length, epsilon))
+            {
+                result = _mm_div_ps(result, _mm_shuffle_ps(length, length, _MM_SHUFFLE(0, 0, 0, 0)));
+            }
+        }
+        float * out = reinterpret_cast<float *>(dstBytes);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(out), result);
+        _mm_store_ss(out + 2, _mm_movehl_ps(result, result));
+        dstBytes += dstStride;
+        srcBytes += srcStride;
+    }
+#else
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const Vec3 & vec = *reinterpret_cast<const Vec3 *>(srcBytes);
+        PFloat32 t0 = mat.m11 * vec.x + mat.m12 * vec.y + mat.m13 * vec.z;
+        PFloat32 t1 = mat.m21 * vec.x + mat.m22 * vec.y + mat.m23 * vec.z;
+        PFloat32 t2 = mat.m31 * vec.x + mat.m32 * vec.y + mat.m33 * vec.z;
+        if (normalize)
+        {
+            const PFloat32 length = sqrtf(t0 * t0 + t1 * t1 + t2 * t2);
+            if (length > PFLOAT_EPSILON)
+            {
+                t0 /= length;
+                t1 /= length;
+                t2 /= length;
+            }
+        }
+        Vec3 & result = *reinterpret_cast<Vec3 *>(dstBytes);
+        result.x = t0;
+        result.y = t1;
+        result.z = t2;
+        dstBytes += dstStride;
+        srcBytes += srcStride;
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_ENABLE_SSE2
+
+//! Load the xyz coordinates of a position, w being 0, without reading past the position
+static inline __m128 LoadPosition(const char * bytes)
+{
+    const float * vec = reinterpret_cast<const float *>(bytes);
+    return _mm_movelh_ps(_mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(vec)), _mm_load_ss(vec + 2));
+}
+
+#endif  // PEGASUS_ENABLE_SSE2
+
+//----------------------------------------------------------------------------------------
+
+void ComputeBounds(Vec3 & min, Vec3 & max, const Vec3 * src, unsigned int srcStride, unsigned int count)
+{
+    if (count == 0)
+    {
+        SetZero(min);
+        SetZero(max);
+        return;
+    }
+    const char * srcBytes = reinterpret_cast<const char *>(src);
+
+#if PEGASUS_ENABLE_SSE2
+    // One position per register, the reduction being done on all the coordinates at once
+    __m128 minVec = LoadPosition(srcBytes);
+    __m128 maxVec = minVec;
+    for (unsigned int i = 1; i < count; ++i)
+    {
+        srcBytes += srcStride;
+        const __m128 vec = LoadPosition(srcBytes);
+        minVec = _mm_min_ps(minVec, vec);
+        maxVec = _mm_max_ps(maxVec, vec);
+    }
+    float minCoords[4];
+    float maxCoords[4];
+    _mm_storeu_ps(minCoords, minVec);
+    _mm_storeu_ps(maxCoords, maxVec);
+    min = Vec3(minCoords[0], minCoords[1], minCoords[2]);
+    max = Vec3(maxCoords[0], maxCoords[1], maxCoords[2]);
+#else
+    min = max = *src;
+    for (unsigned int i = 1; i < count; ++i)
+    {
+        srcBytes += srcStride;
+        const Vec3 & vec = *reinterpret_cast<const Vec3 *>(srcBytes);
+        min.x = vec.x < min.x ? vec.x : min.x;
+        min.y = vec.y < min.y ? vec.y : min.y;
+        min.z = vec.z < min.z ? vec.z : min.z;
+        max.x = vec.x > max.x ? vec.x : max.x;
+        max.y = vec.y > max.y ? vec.y : max.y;
+        max.z = vec.z > max.z ? vec.z : max.z;
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+PFloat32 ComputeMaxSquaredDistance(Point3In center, const Vec3 * src, unsigned int srcStride, unsigned int count)
+{
+    const char * srcBytes = reinterpret_cast<const char *>(src);
+
+#if PEGASUS_ENABLE_SSE2
+    const __m128 centerVec = _mm_setr_ps(center.x, center.y, center.z, 0.0f);
+    __m128 maxSquaredDistance = _mm_setzero_ps();
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const __m128 offset = _mm_sub_ps(LoadPosition(srcBytes), centerVec);
+        const __m128 squares = _mm_mul_ps(offset, offset);
+        const __m128 squaredDistance = _mm_add_ss(_mm_add_ss(squares, _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(1, 1, 1, 1))),
+                                                  _mm_shuffle_ps(squares, squares, _MM_SHUFFLE(2, 2, 2, 2)));
+        maxSquaredDistance = _mm_max_ss(maxSquaredDistance, squaredDistance);
+        srcBytes += srcStride;
+    }
+    return _mm_cvtss_f32(maxSquaredDistance);
+#else
+    PFloat32 maxSquaredDistance = 0.0f;
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        const Vec3 & vec = *reinterpret_cast<const Vec3 *>(srcBytes);
+        const PFloat32 x = vec.x - center.x;
+        const PFloat32 y = vec.y - center.y;
+        const PFloat32 z = vec.z - center.z;
+        const PFloat32 squaredDistance = x * x + y * y + z * z;
+        maxSquaredDistance = squaredDistance > maxSquaredDistance ? squaredDistance : maxSquaredDistance;
+        srcBytes += srcStride;
+    }
+    return maxSquaredDistance;
+#endif
+}
+
+
+}   // namespace Math
+}   // namespace Pegasus
@@ -25,9 +25,9 @@ BoundingSphere::BoundingSphere()
 
 BoundingSphere::BoundingSphere(Point3In center, PFloat32 radius)
 :   mCenter(center),
-    mRadius(radius > 0.0f ? radius : 1.0f)
+    mRadius(radius >= 0.0f ? radius : 1.0f)
 {
-    PG_ASSERT(radius > 0.0f);
+    PG_ASSERT(radius >= 0.0f);
 }
 
 //----------------------------------------------------------------------------------------
@@ -40,6 +40,44 @@ BoundingSphere::BoundingSphere(const BoundingSphere & sphere)
 
 //----------------------------------------------------------------------------------------
 
+void BoundingSphere::Union(const BoundingSphere & sphere)
+{
+    const Vec3 offset = sphere.mCenter - mCenter;
+    const PFloat32 distance = Length(offset);
+
+    // One of the spheres containing the other one
+    if (distance + sphere.mRadius <= mRadius)
+    {
+        return;
+    }
+    if (distance + mRadius <= sphere.mRadius)
+    {
+        *this = sphere;
+        return;
+    }
+
+    // Sphere going through the two farthest points of the spheres, on the line of the centers
+    const PFloat32 radius = (distance + mRadius + sphere.mRadius) * 0.5f;
+    mCenter += offset * ((radius - mRadius) / distance);
+    mRadius = radius;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoundingSphere::Transform(Mat44In mat)
+{
+    // The columns of the 3x3 part are the transformed axes, the longest one giving the largest scale
+    const PFloat32 scaleX = mat.m11 * mat.m11 + mat.m21 * mat.m21 + mat.m31 * mat.m31;
+    const PFloat32 scaleY = mat.m12 * mat.m12 + mat.m22 * mat.m22 + mat.m32 * mat.m32;
+    const PFloat32 scaleZ = mat.m13 * mat.m13 + mat.m23 * mat.m23 + mat.m33 * mat.m33;
+    mRadius *= Sqrt(Max(scaleX, scaleY, scaleZ));
+    mCenter = Point3(mat.m11 * mCenter.x + mat.m12 * mCenter.y + mat.m13 * mCenter.z + mat.m14,
+                     mat.m21 * mCenter.x + mat.m22 * mCenter.y + mat.m23 * mCenter.z + mat.m24,
+                     mat.m31 * mCenter.x + mat.m32 * mCenter.y + mat.m33 * mCenter.z + mat.m34);
+}
+
+//----------------------------------------------------------------------------------------
+
 //! \todo Implement camera support
 //bool BoundingSphere::IsFullyInsideViewRegion(const Camera & camera) const
 //{
@@ -54,6 +54,20 @@ BoxGenerator::~BoxGenerator()
 
 //----------------------------------------------------------------------------------------
 
+void BoxGenerator::ComputeCounts(unsigned int faceEnableMask, int faceSubdivision, int& vertexCount, int& indexCount)
+{
+    const int subdivisionCount = faceSubdivision >= 1 ? faceSubdivision : 1;
+    int faceCount = 0;
+    for (int face = 0; face < 6; ++face)
+    {
+        faceCount += (faceEnableMask >> face) & 1;
+    }
+    vertexCount = faceCount * (subdivisionCount + 1) * (subdivisionCount + 1);
+    indexCount = faceCount * subdivisionCount * subdivisionCount * 6;
+}
+
+//----------------------------------------------------------------------------------------
+
 void BoxGenerator::GenerateData()
 {
     using namespace Pegasus::Math;
@@ -79,7 +93,10 @@ void BoxGenerator::GenerateData()
         mVertsPerFace *= mVertsPerFace;
         subdivisionCount = GetFaceSubdivision();
     }
-    meshData->AllocateVertexes(6 /*sides*/ * (mVertsPerFace));
+    int vertexCount = 0;
+    int indexCount = 0;
+    ComputeCounts(faceEnableMask, GetFaceSubdivision(), vertexCount, indexCount);
+    meshData->AllocateVertexes(vertexCount);
 
     StdVertex * stream = meshData->GetStream<StdVertex>(0);
 
@@ -128,9 +145,8 @@ void BoxGenerator::GenerateData()
     }
 
 	//set the index data
-    const short indexesPerFace = 6;
-    meshData->AllocateIndexes(indexesPerFace * subdivisionCount * subdivisionCount * 6/*faces*/);
-    unsigned short * idx = meshData->GetIndexBuffer();
+    meshData->AllocateIndexes(indexCount);
+    unsigned int * idx = meshData->GetIndexBuffer();
     int indexOffset = 0;
     for (unsigned short face = 0; face < 6; ++face)
     {
@@ -143,11 +159,10 @@ void BoxGenerator::GenerateData()
             for (int i = 0; i < subdivisionCount; ++i)
             {
                 int offset = faceOffsets[face] + i * vertCountInt + j;
-                const unsigned short offsetS = (unsigned short)offset;
-                const unsigned short a = offsetS;
-                const unsigned short b = a + 1;
-                const unsigned short c = a + (unsigned short)vertCountInt;
-                const unsigned short d = c + 1;
+                const unsigned int a = (unsigned int)offset;
+                const unsigned int b = a + 1;
+                const unsigned int c = a + (unsigned int)vertCountInt;
+                const unsigned int d = c + 1;
                 if ((face % 2) == 0)
                 {
                     idx[indexOffset++] = a;
@@ -169,6 +184,7 @@ void BoxGenerator::GenerateData()
             }
         }
     }
+    PG_ASSERT(currIdx == vertexCount && indexOffset == indexCount);
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
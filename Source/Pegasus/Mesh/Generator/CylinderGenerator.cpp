@@ -46,6 +46,20 @@ CylinderGenerator::~CylinderGenerator()
 
 //----------------------------------------------------------------------------
 
+void CylinderGenerator::ComputeCounts(int faceCount, int ringCuts, int& vertexCount, int& indexCount)
+{
+    faceCount = faceCount < 3 ? 3 : faceCount;
+    const int ringCount = (ringCuts < 0 ? 0 : ringCuts) + 2; //the first two caps are rings as well
+    const int capVertexCount = faceCount + 1; //the center
+    const int ringVertexCount = faceCount + 1; //an extra vertex to close the seem.
+    const int capIndexCount = 3 * faceCount; //1 triangle per face
+    const int tubeIndexCount = faceCount * (ringCount - 1) * 3 * 2; //2 triangles per face between rings
+    vertexCount = capVertexCount * 2 + ringCount * ringVertexCount;
+    indexCount = capIndexCount * 2 + tubeIndexCount;
+}
+
+//----------------------------------------------------------------------------
+
 void CylinderGenerator::GenerateData()
 {
     using namespace Pegasus::Math;
@@ -75,17 +89,17 @@ void CylinderGenerator::GenerateData()
     //figure out sizes
     const int ringVertexCount = faceCount + 1;//an extra vertex to close the seem.
     const int capVertexCount = faceCount + 1; 
-    const int capIndexCount = 3*faceCount; //1 triangle per face
-    const int ringVertexCounts = ringCuts*ringVertexCount; //2 extra because we consider the top and bottom cap
-    const int tubeIndexCounts = faceCount * (ringCuts - 1) * 3 * 2; 
     const float halfHeight = GetCylinderHeight() * 0.5f;
 
     //layout of mesh is going to be Cap + Ring + ... + Ring + Cap
-    meshData->AllocateVertexes(capVertexCount * 2 + ringVertexCounts);
-    meshData->AllocateIndexes(capIndexCount * 2 + tubeIndexCounts);
+    int vertexCount = 0;
+    int indexCount = 0;
+    ComputeCounts(faceCount, ringCuts - 2, vertexCount, indexCount);
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(indexCount);
 
     StdVertex * stream = meshData->GetStream<StdVertex>(0);
-    unsigned short* indexBuffer = meshData->GetIndexBuffer();
+    unsigned int* indexBuffer = meshData->GetIndexBuffer();
     int nextIndex = 0;
     PG_ASSERT(stream);
 
@@ -137,6 +151,7 @@ void CylinderGenerator::GenerateData()
 
         currVertexOffset += ringVertexCount;
     }
+    PG_ASSERT(currVertexOffset == vertexCount && nextIndex == indexCount);
     
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
@@ -146,7 +161,7 @@ void CylinderGenerator::CreateRing(
    int destinationOffset,
    float zVal,
    int faceCount,
-   unsigned short* indexBuffer,
+   unsigned int* indexBuffer,
    int& nextIndex,
    const Math::Vec2& uvOffset,
    const Math::Vec2& uvScale,
@@ -16,14 +16,6 @@
 using namespace Pegasus::Math;
 
 
-//TODO make part of the default MeshGenerator
-struct Vertex
-{
-    Pegasus::Math::Vec4 position; 
-    Pegasus::Math::Vec3 normal;        
-    Pegasus::Math::Vec2 uv; 
-};
-
 static Vec2 GenUvs(const Vec3& p)
 {
     float v = Acos(p.y) / P_2_PI;
@@ -51,7 +43,7 @@ END_IMPLEMENT_PROPERTIES(IcosphereGenerator)
 IcosphereGenerator::IcosphereGenerator(Pegasus::Alloc::IAllocator * nodeAllocator,
                                        Pegasus::Alloc::IAllocator * nodeDataAllocator)
 : MeshGenerator(nodeAllocator, nodeDataAllocator),
-  mIdxCache(nodeAllocator, sizeof(unsigned short))
+  mMidpoints(nodeAllocator)
 {
     //INIT properties
     BEGIN_INIT_PROPERTIES(IcosphereGenerator)
@@ -68,70 +60,78 @@ IcosphereGenerator::~IcosphereGenerator()
 
 //----------------------------------------------------------------------------------------
 
-unsigned short IcosphereGenerator::GenChild(MeshData * meshData, unsigned short p1, unsigned short p2)
+void IcosphereGenerator::ComputeCounts(int degree, int& vertexCount, int& indexCount)
 {
-    unsigned short r = 0; 
-    // is there a child generated by these two vertices?
-    mIdxCache.Get(p1, p2, r);
+    const int triangleCount = 20 << (2 * ((degree <= 0 ? 1 : degree) - 1));
+    vertexCount = triangleCount / 2 + 2; //Euler: V = E - F + 2, with E = 3F / 2
+    indexCount = 3 * triangleCount;
+}
 
-    //mIdxCache represents an infinite table with values initialized to 0
-    if (r == 0) //no index generated yet, lets go and generate the child, which is the midpoint
+//----------------------------------------------------------------------------------------
+
+unsigned int IcosphereGenerator::GenChild(StdVertex * vertices, unsigned int & vertexCount, unsigned int p1, unsigned int p2)
+{
+    // the edge is shared by two triangles, keyed the same way from both sides
+    const unsigned long long edge = p1 < p2 ? ((static_cast<unsigned long long>(p1) << 32) | p2)
+                                            : ((static_cast<unsigned long long>(p2) << 32) | p1);
+    const unsigned int * cachedChild = mMidpoints.Find(edge);
+    if (cachedChild != nullptr)
     {
-        StdVertex * stream = meshData->GetStream<StdVertex>(0);
-        StdVertex * v1 = &stream[p1];
-        StdVertex * v2 = &stream[p2];
-        
-        StdVertex newVert;
-        //generate midpoint 
-        newVert.position =  (v1->position + v2->position) * 0.5;
-        Vec3 normalizedP = newVert.position.xyz;
-        Normalize(normalizedP);
-        newVert.position = Vec4(GetRadius()*normalizedP, 1.0);
-        newVert.normal = normalizedP;
-        newVert.uv = GenUvs(normalizedP);
-        
-        r = meshData->PushVertex(newVert, 0) + 1;
-        
-        //store the cached index
-        mIdxCache.Insert(p1, p2, r);
-        
+        return *cachedChild;
     }
-    
-    return r - 1;
 
+    //no index generated yet, lets go and generate the child, which is the midpoint
+    const StdVertex * v1 = &vertices[p1];
+    const StdVertex * v2 = &vertices[p2];
+    StdVertex & newVert = vertices[vertexCount];
+
+    //generate midpoint 
+    newVert.position =  (v1->position + v2->position) * 0.5;
+    Vec3 normalizedP = newVert.position.xyz;
+    Normalize(normalizedP);
+    newVert.position = Vec4(GetRadius()*normalizedP, 1.0);
+    newVert.normal = normalizedP;
+    newVert.uv = GenUvs(normalizedP);
+
+    //store the cached index
+    mMidpoints.Insert(edge, vertexCount);
+    return vertexCount++;
 }
 
 //----------------------------------------------------------------------------------------
 
-void IcosphereGenerator::Tesselate(MeshData * meshData, int level, unsigned short a, unsigned short b, unsigned short c)
+void IcosphereGenerator::Subdivide(const unsigned int * triangles, int triangleCount, unsigned int * children, StdVertex * vertices, unsigned int & vertexCount)
 {
-    PG_ASSERT(level >= 1);
-    if (level == 1)
-    {
-        //base case, lets go ahead and register this triangle (reached the lowest tesselation level possilbe)
-        meshData->PushIndex(a);
-        meshData->PushIndex(b);
-        meshData->PushIndex(c);
-    }
-    else
+    // every edge of the level is shared by 2 triangles, and the midpoints of the previous levels are not needed anymore
+    mMidpoints.Reset();
+    mMidpoints.Reserve(static_cast<unsigned int>(triangleCount) * 3 / 2);
+
+    for (int t = 0; t < triangleCount; ++t)
     {
+        const unsigned int a = triangles[t * 3];
+        const unsigned int b = triangles[t * 3 + 1];
+        const unsigned int c = triangles[t * 3 + 2];
+
         //lets subdivide 1 triangle into 4 triangles internally.
         // generate spherical points from two parent points
-        unsigned short c1 = GenChild(meshData, a, b);
-        unsigned short c2 = GenChild(meshData, b, c);
-        unsigned short c3 = GenChild(meshData, c, a);
-        
-        // recurse and tesselate triangel to this:
+        const unsigned int c1 = GenChild(vertices, vertexCount, a, b);
+        const unsigned int c2 = GenChild(vertices, vertexCount, b, c);
+        const unsigned int c3 = GenChild(vertices, vertexCount, c, a);
+
+        // tesselate triangle to this:
         //            /\
         //           /  \
         //          /____\
         //         / \  / \
         //        /___\/___\
 
-        Tesselate(meshData, level - 1, a, c1, c3);
-        Tesselate(meshData, level - 1, c1, b, c2);
-        Tesselate(meshData, level - 1, c2, c, c3);
-        Tesselate(meshData, level - 1, c1, c2, c3);
+        const unsigned int childTriangles[] = {
+            a,  c1, c3,
+            c1, b,  c2,
+            c2, c,  c3,
+            c1, c2, c3
+        };
+        Pegasus::Utils::Memcpy(children + t * 12, childTriangles, sizeof(childTriangles));
     }
 }
 
@@ -146,8 +146,16 @@ void IcosphereGenerator::GenerateData()
     MeshDataRef meshData = GetData();
     PG_ASSERT(meshData != nullptr); 
 
-    // clear any previous data
-    meshData->Clear();
+    // the streams are allocated once with their exact sizes, each tesselation level
+    // writing its vertices and triangles in place
+    const int degree = GetDegree() <= 0 ? 1 : GetDegree();
+    int vertexCount = 0;
+    int indexCount = 0;
+    ComputeCounts(degree, vertexCount, indexCount);
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(indexCount);
+    StdVertex * vertices = meshData->GetStream<StdVertex>(0);
+    unsigned int * indexes = meshData->GetIndexBuffer();
 
     //hardcoded icosahedron
     static const float g = (1.0f + 2.2360679775f) / 2.0f;//golden ratio
@@ -193,29 +201,51 @@ void IcosphereGenerator::GenerateData()
     };
 
     //register all icosahedron vertices
+    unsigned int generatedVertexCount = 0;
     for (int i = 0; i < (sizeof(icosahedron) / sizeof(float)); i += 3)
     {
-        Vertex v;
+        StdVertex & v = vertices[generatedVertexCount++];
         Vec3 pos = Vec3(icosahedron[i + 0], icosahedron[i + 1], icosahedron[i + 2]);
         Normalize(pos);
         v.position = Vec4(GetRadius()*pos, 1.0);
         v.normal = pos;
         v.uv = GenUvs(pos);
-        meshData->PushVertex<Vertex>(v, 0);
     }
     PG_ASSERT(GetDegree() > 0);
-    // do tesseleation step on icosahedron so we generate an icosphere
-    for (int i = 0; i < sizeof(icotriangles)/sizeof(unsigned short); i += 3)
+
+    // the levels alternate between the index buffer and a scratch buffer, starting so that the last level
+    // lands in the index buffer. The largest level of the scratch buffer is the one before the last
+    const int subdivisionCount = degree - 1;
+    unsigned int * scratch = subdivisionCount > 0 ? PG_NEW_ARRAY(GetNodeAllocator(), -1, "IcosphereGenerator::scratch", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, indexCount / 4)
+                                                  : nullptr;
+    unsigned int * level = (subdivisionCount % 2) == 0 ? indexes : scratch;
+    unsigned int * nextLevel = (subdivisionCount % 2) == 0 ? scratch : indexes;
+
+    int triangleCount = sizeof(icotriangles) / (3 * sizeof(unsigned short));
+    for (int t = 0; t < triangleCount; ++t)
+    {
+        level[t * 3]     = icotriangles[t * 3 + 2];
+        level[t * 3 + 1] = icotriangles[t * 3 + 1];
+        level[t * 3 + 2] = icotriangles[t * 3];
+    }
+
+    // do tesseleation steps on icosahedron so we generate an icosphere, a whole level at a time
+    for (int s = 0; s < subdivisionCount; ++s)
     {
-        Tesselate(
-            &(*meshData),
-            GetDegree() <= 0 ? 1 : GetDegree(),
-            icotriangles[i + 2],
-            icotriangles[i + 1],
-            icotriangles[i]
-        );
-    } 
-    mIdxCache.Clear();
+        Subdivide(level, triangleCount, nextLevel, vertices, generatedVertexCount);
+        triangleCount *= 4;
+        unsigned int * subdividedLevel = nextLevel;
+        nextLevel = level;
+        level = subdividedLevel;
+    }
+    PG_ASSERT(level == indexes);
+
+    if (scratch != nullptr)
+    {
+        PG_DELETE_ARRAY(GetNodeAllocator(), scratch);
+    }
+    mMidpoints.Clear();
+    PG_ASSERT(generatedVertexCount == static_cast<unsigned int>(vertexCount) && triangleCount * 3 == indexCount);
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
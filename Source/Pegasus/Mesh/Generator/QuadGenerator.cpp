@@ -70,7 +70,7 @@ void QuadGenerator::GenerateData()
     }
 
     //make compatible with other nodes for now.
-    unsigned short* indices = meshData->GetIndexBuffer();
+    unsigned int* indices = meshData->GetIndexBuffer();
     for (int i = 0; i < 6; ++i) indices[i] = i;
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
@@ -64,6 +64,10 @@ void Mesh::SetOperatorInput(MeshOperatorIn meshOperator)
 MeshDataReturn Mesh::GetUpdatedMeshData()
 {
     PG_ASSERT(mFactory);
+
+    // Shared subgraphs are evaluated once, by the scheduler then by the pull of the data
+    Graph::EvaluationPass evaluationPass;
+    EvaluateInputGraph();
     bool updated = false;
     MeshDataRef meshData = Graph::OutputNode::GetUpdatedData(updated);
     if (meshData != nullptr && meshData->IsGPUDataDirty())
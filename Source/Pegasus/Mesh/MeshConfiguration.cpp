@@ -11,6 +11,7 @@
 //!         between nodes to link them
 
 #include "Pegasus/Mesh/MeshConfiguration.h"
+#include "Pegasus/Utils/Hash.h"
 #include "Pegasus/Utils/Memcpy.h"
 
 namespace Pegasus {
@@ -22,7 +23,9 @@ MeshConfiguration::MeshConfiguration()
 mIsIndexed(true),
 mIsDynamic(false),
 mIsDrawIndirect(false),
-mPrimitiveType(TRIANGLE)
+mPrimitiveType(TRIANGLE),
+mIndexFormat(INDEX_AUTO),
+mVertexFormat(VERTEX_STANDARD)
 {
 }
 
@@ -41,11 +44,30 @@ bool MeshConfiguration::operator==(const MeshConfiguration& other) const
            && mIsDynamic == other.mIsDynamic
            && mIsDrawIndirect == other.mIsDrawIndirect
            && mPrimitiveType == other.mPrimitiveType
+           && mIndexFormat == other.mIndexFormat
+           && mVertexFormat == other.mVertexFormat
            && mInputLayout == other.mInputLayout;
 }
 
 //----------------------------------------------------------------------------------------
 
+unsigned long long MeshConfiguration::Hash(unsigned long long key) const
+{
+    // Field by field, the structures contain padding
+    const int flags[] = { mIsIndexed, mIsDynamic, mIsDrawIndirect, static_cast<int>(mPrimitiveType), static_cast<int>(mIndexFormat), static_cast<int>(mVertexFormat), mInputLayout.GetAttributeCount() };
+    key = Pegasus::Utils::HashFnv1a64(flags, sizeof(flags), key);
+    for (int a = 0; a < mInputLayout.GetAttributeCount(); ++a)
+    {
+        const MeshInputLayout::AttrDesc & desc = mInputLayout.GetAttributeDesc(a);
+        const int fields[] = { static_cast<int>(desc.mSemantic), static_cast<int>(desc.mType), desc.mByteSize,
+                               desc.mByteOffset, desc.mSemanticIndex, desc.mStreamIndex };
+        key = Pegasus::Utils::HashFnv1a64(fields, sizeof(fields), key);
+    }
+    return key;
+}
+
+//----------------------------------------------------------------------------------------
+
 MeshConfiguration & MeshConfiguration::operator=(const MeshConfiguration & other)
 {
     Pegasus::Utils::Memcpy(this, &other, sizeof(MeshConfiguration));
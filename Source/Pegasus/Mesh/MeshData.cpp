@@ -10,19 +10,151 @@
 //! \brief	Mesh node data, used by all mesh nodes, including generators and operators
 
 #include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Utils/ByteStream.h"
 #include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Math/BatchTransform.h"
+
+#include <math.h>
 
 namespace Pegasus {
 namespace Mesh {
 
 
+//! Input layout of the packed meshes, shared by all of them
+class PackedInputLayout : public MeshInputLayout
+{
+public:
+    PackedInputLayout() { GeneratePackedEditorLayout(); }
+};
+
+//! Largest value of the packed positions, read as 1.0 by the GPU
+static const float PACKED_POSITION_MAX = 65535.0f;
+
+//! Largest value of the packed normals, read as 1.0 by the GPU
+static const float PACKED_NORMAL_MAX = 32767.0f;
+
+//----------------------------------------------------------------------------------------
+
+//! Convert a float to a half float, rounding to the nearest even
+//! \param value the float to convert
+//! \return the half float, infinite when too large
+static unsigned short FloatToHalf(float value)
+{
+    unsigned int bits;
+    Pegasus::Utils::Memcpy(&bits, &value, sizeof(bits));
+    const unsigned short sign = static_cast<unsigned short>((bits >> 16) & 0x8000);
+    const unsigned int absBits = bits & 0x7fffffff;
+    if (absBits >= 0x47800000)
+    {
+        // Too large for a half (65536 and above), infinite or NaN
+        return sign | (absBits > 0x7f800000 ? 0x7e00 : 0x7c00);
+    }
+    if (absBits < 0x38800000)
+    {
+        // Below the smallest normalized half (2^-14), denormalized in steps of 2^-24.
+        // Added to 0.5, whose precision is 2^-24, the float addition rounds to the nearest even
+        float absValue;
+        Pegasus::Utils::Memcpy(&absValue, &absBits, sizeof(absValue));
+        const float rounded = absValue + 0.5f;
+        unsigned int roundedBits;
+        Pegasus::Utils::Memcpy(&roundedBits, &rounded, sizeof(roundedBits));
+        return sign | static_cast<unsigned short>(roundedBits - 0x3f000000);
+    }
+
+    // Rebias the exponent from 127 to 15 and round the mantissa to the nearest even,
+    // the carry of the rounding moving to the exponent when needed
+    const unsigned int rounded = absBits - (112 << 23) + 0xfff + ((absBits >> 13) & 1);
+    return sign | static_cast<unsigned short>(rounded >> 13);
+}
+
+//! Convert a half float to a float
+//! \param half the half float to convert
+//! \return the float, exactly the same value
+static float HalfToFloat(unsigned short half)
+{
+    const unsigned int sign = static_cast<unsigned int>(half & 0x8000) << 16;
+    const unsigned int exponent = (half >> 10) & 0x1f;
+    const unsigned int mantissa = half & 0x3ff;
+    if (exponent == 0)
+    {
+        const float value = static_cast<float>(mantissa) * (1.0f / 16777216.0f);
+        return sign != 0 ? -value : value;
+    }
+    const unsigned int bits = sign | (exponent == 0x1f ? 0x7f800000 | (mantissa << 13)
+                                                       : ((exponent + 112) << 23) | (mantissa << 13));
+    float value;
+    Pegasus::Utils::Memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+//! Quantize a value of [-1, 1] to a normalized short
+static short PackSnorm(float value)
+{
+    value = value < -1.0f ? -1.0f : (value > 1.0f ? 1.0f : value);
+    return static_cast<short>(floorf(value * PACKED_NORMAL_MAX + 0.5f));
+}
+
+//! Encode a normal with the octahedral mapping: the normal is projected on the octahedron |x| + |y| + |z| = 1,
+//! and the lower half of the octahedron is folded over the upper half, giving a square of [-1, 1]
+//! \param normal the normal, not necessarily of unit length
+//! \param packed receives the two normalized shorts of the encoding, (0, 0) for a null normal
+static void PackOctahedralNormal(const Math::Vec3 & normal, short packed[2])
+{
+    const float norm = fabsf(normal.x) + fabsf(normal.y) + fabsf(normal.z);
+    float x = 0.0f;
+    float y = 0.0f;
+    if (norm > 0.0f)
+    {
+        x = normal.x / norm;
+        y = normal.y / norm;
+        if (normal.z < 0.0f)
+        {
+            const float foldedX = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+            const float foldedY = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+            x = foldedX;
+            y = foldedY;
+        }
+    }
+    packed[0] = PackSnorm(x);
+    packed[1] = PackSnorm(y);
+}
+
+//! Decode a normal encoded by PackOctahedralNormal(), as done by the shaders
+static Math::Vec3 UnpackOctahedralNormal(const short packed[2])
+{
+    float x = packed[0] / PACKED_NORMAL_MAX;
+    float y = packed[1] / PACKED_NORMAL_MAX;
+    x = x < -1.0f ? -1.0f : x;
+    y = y < -1.0f ? -1.0f : y;
+    const float z = 1.0f - fabsf(x) - fabsf(y);
+    if (z < 0.0f)
+    {
+        const float unfoldedX = (1.0f - fabsf(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+        const float unfoldedY = (1.0f - fabsf(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+        x = unfoldedX;
+        y = unfoldedY;
+    }
+    const float invLength = 1.0f / sqrtf(x * x + y * y + z * z);
+    return Math::Vec3(x * invLength, y * invLength, z * invLength);
+}
+
+//----------------------------------------------------------------------------------------
+
 MeshData::MeshData(const MeshConfiguration & configuration, Graph::Node::Mode mode, Alloc::IAllocator* allocator)
 :   Graph::NodeData(allocator),
     mConfiguration(configuration),
     mIndexCount(0),
     mVertexCount(0),
+    mIsPacked(false),
+    mPositionDecodeScale(0.0f, 0.0f, 0.0f),
+    mPositionDecodeOffset(0.0f, 0.0f, 0.0f),
+    mLodCount(1),
+    mAreBoundsValid(false),
+    mBoundingSphere(Math::POINT3_ORIGIN, 0.0f),
     mMode(mode)
 {
+    mLodIndexOffsets[0] = 0;
     
     //fill in stream strides
     const MeshInputLayout& inputLayout = configuration.GetInputLayout();
@@ -34,53 +166,312 @@ MeshData::MeshData(const MeshConfiguration & configuration, Graph::Node::Mode mo
         mVertexStreams[desc.mStreamIndex].SetStride(prevStride + size);
     }
 
-    mIndexBuffer.SetStride(sizeof(unsigned short));
+    mIndexBuffer.SetStride(GetBuildIndexStride());
 
 }
 
-unsigned short MeshData::InternalPushVertex(const void * vertex, int streamId)
+unsigned int MeshData::InternalPushVertex(const void * vertex, int streamId)
+{   
+    return InternalPushVertexes(vertex, 1, streamId);
+}
+
+unsigned int MeshData::InternalPushVertexes(const void * vertices, int count, int streamId)
 {   
     PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
     PG_ASSERT(streamId < MESH_MAX_STREAMS);
+    PG_ASSERT(count >= 0);
+    PG_ASSERTSTR(!mIsPacked, "The vertices have been packed, call AllocateVertexes() to rebuild them.");
 
     int newElementIndex = GetVertexCount();
     int stride = mVertexStreams[streamId].GetStride();
     int byteOffset = newElementIndex * stride;
 
-    InternalAllocateVertexes(GetVertexCount() + 1, true);
+    InternalAllocateVertexes(GetVertexCount() + count, true);
 
     PG_ASSERT(mVertexStreams[streamId].GetByteSize() >= GetVertexCount() * stride);
 
     char * s = static_cast<char * >(GetStream<void>(streamId)) + byteOffset;
 
-    Pegasus::Utils::Memcpy(s, vertex, stride);
-    return static_cast<unsigned short>(newElementIndex);
+    Pegasus::Utils::Memcpy(s, vertices, count * stride);
+    return static_cast<unsigned int>(newElementIndex);
     
 }
 
-void MeshData::PushIndex(unsigned short index)
+void MeshData::PushIndex(unsigned int index)
+{
+    PushIndexes(&index, 1, 0);
+}
+
+void MeshData::PushIndexes(const unsigned int * indices, int count, unsigned int vertexOffset)
 {
     PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
+    PG_ASSERT(count >= 0);
+    if (mIndexBuffer.GetStride() != sizeof(unsigned int))
+    {
+        ConvertIndexStride(sizeof(unsigned int));
+    }
     int idxOffset = GetIndexCount();
-    InternalAllocateIndexes(GetIndexCount() + 1, true);
+    InternalAllocateIndexes(GetIndexCount() + count, true);
     PG_ASSERT(mIndexBuffer.GetByteSize() >= GetIndexCount() * mIndexBuffer.GetStride());
-    unsigned short * idxBuffer = GetIndexBuffer();
-    idxBuffer[idxOffset] = index;
+    unsigned int * idxBuffer = GetIndexBuffer() + idxOffset;
+    for (int i = 0; i < count; ++i)
+    {
+        idxBuffer[i] = indices[i] + vertexOffset;
+    }
+}
+
+unsigned int MeshData::GetIndex(int i) const
+{
+    PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
+    PG_ASSERT(i >= 0 && i < mIndexCount);
+    if (mIndexBuffer.GetStride() == sizeof(unsigned short))
+    {
+        return static_cast<const unsigned short *>(mIndexBuffer.GetBuffer())[i];
+    }
+    return static_cast<const unsigned int *>(mIndexBuffer.GetBuffer())[i];
+}
+
+void MeshData::GetIndexes(unsigned int * dest, int first, int count, unsigned int vertexOffset) const
+{
+    PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
+    PG_ASSERT(first >= 0 && count >= 0 && first + count <= mIndexCount);
+    if (mIndexBuffer.GetStride() == sizeof(unsigned short))
+    {
+        const unsigned short * src = static_cast<const unsigned short *>(mIndexBuffer.GetBuffer()) + first;
+        for (int i = 0; i < count; ++i)
+        {
+            dest[i] = src[i] + vertexOffset;
+        }
+    }
+    else
+    {
+        const unsigned int * src = static_cast<const unsigned int *>(mIndexBuffer.GetBuffer()) + first;
+        for (int i = 0; i < count; ++i)
+        {
+            dest[i] = src[i] + vertexOffset;
+        }
+    }
+}
+
+void MeshData::SetLodIndexCounts(const int * indexCounts, int lodCount)
+{
+    PG_ASSERTSTR(lodCount >= 1 && lodCount <= MESH_MAX_LODS, "Invalid number of levels of detail (%d)", lodCount);
+    int offset = 0;
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        PG_ASSERT(indexCounts[lod] >= 0);
+        mLodIndexOffsets[lod] = offset;
+        offset += indexCounts[lod];
+    }
+    PG_ASSERTSTR(offset == mIndexCount, "The levels of detail must cover all the indices");
+    mLodCount = lodCount;
+}
+
+int MeshData::GetLodIndexOffset(int lod) const
+{
+    PG_ASSERT(lod >= 0 && lod < mLodCount);
+    return mLodIndexOffsets[lod];
+}
+
+int MeshData::GetLodIndexCount(int lod) const
+{
+    PG_ASSERT(lod >= 0 && lod < mLodCount);
+    const int endOffset = (lod + 1 < mLodCount) ? mLodIndexOffsets[lod + 1] : mIndexCount;
+    return endOffset - mLodIndexOffsets[lod];
+}
+
+void MeshData::FinalizeIndexFormat()
+{
+    if (mMode != Graph::Node::STANDARD || !mConfiguration.GetIsIndexed() || mIndexBuffer.GetStride() != sizeof(unsigned int))
+    {
+        return;
+    }
+
+    // 16-bit indices halve the memory and the bandwidth of the index buffer.
+    // 0xffff is kept out of the indices, the GPUs reading it as a strip restart
+    const MeshConfiguration::IndexFormat indexFormat = mConfiguration.GetIndexFormat();
+    const bool fitsIn16Bits = mVertexCount <= 0xffff;
+    PG_ASSERTSTR(indexFormat != MeshConfiguration::INDEX_16 || fitsIn16Bits, "Too many vertices for 16-bit indices, keeping 32-bit indices.");
+    if (fitsIn16Bits && indexFormat != MeshConfiguration::INDEX_32)
+    {
+        ConvertIndexStride(sizeof(unsigned short));
+    }
+}
+
+void MeshData::FinalizeBounds()
+{
+    if (mAreBoundsValid || mMode != Graph::Node::STANDARD)
+    {
+        return;
+    }
+
+    // The sphere is centered on the box, its radius reaching the farthest position
+    int streamIndex = 0;
+    int byteOffset = 0;
+    Math::Vec3 minPosition(0.0f, 0.0f, 0.0f);
+    Math::Vec3 maxPosition(0.0f, 0.0f, 0.0f);
+    float radius = 0.0f;
+    if (mIsPacked)
+    {
+        // The packed positions are inside the box of their decoding parameters
+        minPosition = mPositionDecodeOffset;
+        maxPosition = mPositionDecodeOffset + mPositionDecodeScale;
+        radius = Math::Length(mPositionDecodeScale) * 0.5f;
+    }
+    else if (mVertexCount > 0)
+    {
+        if (!FindPositionAttribute(streamIndex, byteOffset))
+        {
+            // Without float positions the bounds are unknown, and the mesh is never culled
+            return;
+        }
+        const int stride = mVertexStreams[streamIndex].GetStride();
+        const Math::Vec3 * positions = reinterpret_cast<const Math::Vec3 *>(static_cast<const char *>(mVertexStreams[streamIndex].GetBuffer()) + byteOffset);
+        Math::ComputeBounds(minPosition, maxPosition, positions, stride, mVertexCount);
+        const Math::Vec3 center = (minPosition + maxPosition) * 0.5f;
+        radius = sqrtf(Math::ComputeMaxSquaredDistance(center, positions, stride, mVertexCount));
+    }
+
+    mBoundingBox.SetMinMax(minPosition, maxPosition);
+    mBoundingSphere.SetCenter((minPosition + maxPosition) * 0.5f);
+    mBoundingSphere.SetRadius(radius);
+    mAreBoundsValid = true;
+}
+
+void MeshData::SetBounds(const Math::AxisAlignedBoundingBox & box, const Math::BoundingSphere & sphere)
+{
+    mBoundingBox = box;
+    mBoundingSphere = sphere;
+    mAreBoundsValid = true;
+}
+
+void MeshData::FinalizeVertexFormat()
+{
+    if (mIsPacked || mConfiguration.GetVertexFormat() != MeshConfiguration::VERTEX_PACKED || !IsPackable())
+    {
+        return;
+    }
+
+    // The positions are quantized over the box of their coordinates, the shaders getting them back
+    // with the decode scale and offset. The box is computed again, the bounds given by SetBounds() can be larger
+    const StdVertex * vertices = static_cast<const StdVertex *>(mVertexStreams[0].GetBuffer());
+    Math::Vec3 minPosition;
+    Math::Vec3 maxPosition;
+    Math::ComputeBounds(minPosition, maxPosition, reinterpret_cast<const Math::Vec3 *>(&vertices->position), sizeof(StdVertex), mVertexCount);
+    const Math::Vec3 scale = maxPosition - minPosition;
+    const float positionQuantization[3] = {
+        scale.x > 0.0f ? PACKED_POSITION_MAX / scale.x : 0.0f,
+        scale.y > 0.0f ? PACKED_POSITION_MAX / scale.y : 0.0f,
+        scale.z > 0.0f ? PACKED_POSITION_MAX / scale.z : 0.0f
+    };
+
+    // Into a new stream, the packed vertices are smaller than the input ones
+    Stream packed;
+    packed.SetStride(sizeof(PackedVertex));
+    packed.Grow(GetAllocator(), mVertexCount, false);
+    PackedVertex * packedVertices = static_cast<PackedVertex *>(packed.GetBuffer());
+    for (int v = 0; v < mVertexCount; ++v)
+    {
+        const StdVertex & vertex = vertices[v];
+        PackedVertex & packedVertex = packedVertices[v];
+        for (int c = 0; c < 3; ++c)
+        {
+            const float position = (vertex.position.v[c] - minPosition.v[c]) * positionQuantization[c];
+            packedVertex.position[c] = static_cast<unsigned short>(floorf(position + 0.5f));
+        }
+        packedVertex.position[3] = static_cast<unsigned short>(PACKED_POSITION_MAX);
+        PackOctahedralNormal(vertex.normal, packedVertex.normal);
+        packedVertex.uv[0] = FloatToHalf(vertex.uv.x);
+        packedVertex.uv[1] = FloatToHalf(vertex.uv.y);
+    }
+
+    if (mVertexStreams[0].GetBuffer() != nullptr)
+    {
+        mVertexStreams[0].Destroy(GetAllocator());
+    }
+    mVertexStreams[0].Swap(packed);
+    mIsPacked = true;
+    mPositionDecodeScale = scale;
+    mPositionDecodeOffset = minPosition;
+
+    // Every vertex fetch of the shaders reads the packed size instead of the full one
+    PG_LOG('MESH', "Packed %d vertices: %d -> %d bytes per vertex, %d -> %d bytes in total",
+           mVertexCount, static_cast<int>(sizeof(StdVertex)), static_cast<int>(sizeof(PackedVertex)),
+           mVertexCount * static_cast<int>(sizeof(StdVertex)), mVertexCount * static_cast<int>(sizeof(PackedVertex)));
+}
+
+const MeshInputLayout & MeshData::GetInputLayout() const
+{
+    static const PackedInputLayout sPackedInputLayout;
+    return mIsPacked ? sPackedInputLayout : mConfiguration.GetInputLayout();
+}
+
+void MeshData::GetStdVertexes(StdVertex * dest, int first, int count) const
+{
+    PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
+    PG_ASSERT(first >= 0 && count >= 0 && first + count <= mVertexCount);
+    if (!mIsPacked)
+    {
+        PG_ASSERTSTR(mVertexStreams[0].GetStride() == sizeof(StdVertex), "stream strides must match!");
+        if (count > 0)
+        {
+            Pegasus::Utils::Memcpy(dest, static_cast<const StdVertex *>(mVertexStreams[0].GetBuffer()) + first, count * sizeof(StdVertex));
+        }
+        return;
+    }
+
+    const PackedVertex * src = static_cast<const PackedVertex *>(mVertexStreams[0].GetBuffer()) + first;
+    const Math::Vec3 scale = mPositionDecodeScale * (1.0f / PACKED_POSITION_MAX);
+    for (int v = 0; v < count; ++v)
+    {
+        const PackedVertex & packedVertex = src[v];
+        StdVertex & vertex = dest[v];
+        vertex.position.x = mPositionDecodeOffset.x + scale.x * packedVertex.position[0];
+        vertex.position.y = mPositionDecodeOffset.y + scale.y * packedVertex.position[1];
+        vertex.position.z = mPositionDecodeOffset.z + scale.z * packedVertex.position[2];
+        vertex.position.w = 1.0f;
+        vertex.normal = UnpackOctahedralNormal(packedVertex.normal);
+        vertex.uv.x = HalfToFloat(packedVertex.uv[0]);
+        vertex.uv.y = HalfToFloat(packedVertex.uv[1]);
+    }
 }
 
 void MeshData::AllocateVertexes(int count)
 {
+    ResetVertexFormat(false);
     InternalAllocateVertexes(count, false);
 }
 
 void MeshData::AllocateIndexes(int count)
 {
+    ResetIndexStride(GetBuildIndexStride());
     InternalAllocateIndexes(count, false);
 }
 
+void MeshData::ReserveVertexes(int count)
+{
+    if (mMode == Graph::Node::STANDARD)
+    {
+        for (int stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+        {
+            mVertexStreams[stream].Reserve(GetAllocator(), count);
+        }
+    }
+}
+
+void MeshData::ReserveIndexes(int count)
+{
+    if (mConfiguration.GetIsIndexed() && mMode == Graph::Node::STANDARD)
+    {
+        ConvertIndexStride(sizeof(unsigned int));
+        mIndexBuffer.Reserve(GetAllocator(), count);
+    }
+}
+
 void MeshData::InternalAllocateVertexes(int count, bool preserveElements)
 {
     mVertexCount = count;
+    mAreBoundsValid = false;
     
     if (mMode == Graph::Node::STANDARD)
     {
@@ -93,6 +484,7 @@ void MeshData::InternalAllocateVertexes(int count, bool preserveElements)
 
 void MeshData::InternalAllocateIndexes(int count, bool preserveElements)
 {
+    mLodCount = 1;
     if (mConfiguration.GetIsIndexed())
     {
         mIndexCount = count;
@@ -103,6 +495,99 @@ void MeshData::InternalAllocateIndexes(int count, bool preserveElements)
     }
 }
 
+int MeshData::GetBuildIndexStride() const
+{
+    if (mMode == Graph::Node::STANDARD || mConfiguration.GetIndexFormat() == MeshConfiguration::INDEX_32)
+    {
+        return sizeof(unsigned int);
+    }
+    return sizeof(unsigned short);
+}
+
+void MeshData::ResetIndexStride(int stride)
+{
+    if (mIndexBuffer.GetStride() != stride)
+    {
+        if (mIndexBuffer.GetBuffer() != nullptr)
+        {
+            mIndexBuffer.Destroy(GetAllocator());
+        }
+        mIndexBuffer.SetStride(stride);
+    }
+}
+
+void MeshData::ConvertIndexStride(int stride)
+{
+    PG_ASSERT(mMode == Graph::Node::STANDARD);
+    PG_ASSERT(stride == sizeof(unsigned short) || stride == sizeof(unsigned int));
+    if (mIndexBuffer.GetStride() == stride)
+    {
+        return;
+    }
+
+    // Into a new buffer, the indices cannot be converted in place when widened
+    Stream converted;
+    converted.SetStride(stride);
+    converted.Grow(GetAllocator(), mIndexCount, false);
+    if (stride == sizeof(unsigned short))
+    {
+        const unsigned int * src = static_cast<const unsigned int *>(mIndexBuffer.GetBuffer());
+        unsigned short * dst = static_cast<unsigned short *>(converted.GetBuffer());
+        for (int i = 0; i < mIndexCount; ++i)
+        {
+            dst[i] = static_cast<unsigned short>(src[i]);
+        }
+    }
+    else
+    {
+        GetIndexes(static_cast<unsigned int *>(converted.GetBuffer()), 0, mIndexCount, 0);
+    }
+
+    if (mIndexBuffer.GetBuffer() != nullptr)
+    {
+        mIndexBuffer.Destroy(GetAllocator());
+    }
+    mIndexBuffer.Swap(converted);
+}
+
+bool MeshData::FindPositionAttribute(int & streamIndex, int & byteOffset) const
+{
+    const MeshInputLayout & inputLayout = mConfiguration.GetInputLayout();
+    for (int i = 0; i < inputLayout.GetAttributeCount(); ++i)
+    {
+        const MeshInputLayout::AttrDesc & desc = inputLayout.GetAttributeDesc(i);
+        if (desc.mSemantic == MeshInputLayout::POSITION && desc.mSemanticIndex == 0
+            && (desc.mType == Core::FORMAT_RGBA_32_FLOAT || desc.mType == Core::FORMAT_RGB_32_FLOAT))
+        {
+            streamIndex = desc.mStreamIndex;
+            byteOffset = desc.mByteOffset;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MeshData::IsPackable() const
+{
+    MeshInputLayout editorLayout;
+    editorLayout.GenerateEditorLayout(MeshInputLayout::USE_POSITION | MeshInputLayout::USE_NORMAL | MeshInputLayout::USE_UV);
+    return mMode == Graph::Node::STANDARD && mConfiguration.GetInputLayout() == editorLayout;
+}
+
+void MeshData::ResetVertexFormat(bool isPacked)
+{
+    if (mIsPacked != isPacked)
+    {
+        PG_ASSERT(!isPacked || IsPackable());
+        if (mVertexStreams[0].GetBuffer() != nullptr)
+        {
+            mVertexStreams[0].Destroy(GetAllocator());
+        }
+        mVertexStreams[0].SetStride(static_cast<int>(isPacked ? sizeof(PackedVertex) : sizeof(StdVertex)));
+        mIsPacked = isPacked;
+    }
+}
+
 void MeshData::Clear()
 {
     for (int s = 0; s < MESH_MAX_STREAMS; ++s)
@@ -117,9 +602,226 @@ void MeshData::Clear()
     {
         mIndexBuffer.Destroy(GetAllocator());
     }
+    mIndexBuffer.SetStride(GetBuildIndexStride());
+    ResetVertexFormat(false);
     
     mVertexCount = 0;
     mIndexCount = 0;
+    mLodCount = 1;
+    mAreBoundsValid = false;
+}
+
+bool MeshData::CopyContent(const Graph::NodeData & source)
+{
+    const MeshData & sourceMesh = static_cast<const MeshData &>(source);
+    if (mMode != Graph::Node::STANDARD || sourceMesh.mMode != Graph::Node::STANDARD)
+    {
+        return false;
+    }
+    if (sourceMesh.mIsPacked && !IsPackable())
+    {
+        PG_FAILSTR("Trying to copy packed mesh data into a mesh data that cannot be packed");
+        return false;
+    }
+    ResetVertexFormat(sourceMesh.mIsPacked);
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        if (mVertexStreams[s].GetStride() != sourceMesh.mVertexStreams[s].GetStride())
+        {
+            PG_FAILSTR("Trying to copy mesh data with a different input layout");
+            return false;
+        }
+    }
+
+    InternalAllocateVertexes(sourceMesh.GetVertexCount(), false);
+    mPositionDecodeScale = sourceMesh.mPositionDecodeScale;
+    mPositionDecodeOffset = sourceMesh.mPositionDecodeOffset;
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int byteSize = sourceMesh.GetVertexCount() * mVertexStreams[s].GetStride();
+        if (byteSize > 0)
+        {
+            Pegasus::Utils::Memcpy(mVertexStreams[s].GetBuffer(), sourceMesh.mVertexStreams[s].GetBuffer(), byteSize);
+        }
+    }
+
+    ResetIndexStride(sourceMesh.mIndexBuffer.GetStride());
+    InternalAllocateIndexes(sourceMesh.GetIndexCount(), false);
+    const int indexByteSize = GetIndexCount() * mIndexBuffer.GetStride();
+    if (indexByteSize > 0)
+    {
+        Pegasus::Utils::Memcpy(mIndexBuffer.GetBuffer(), sourceMesh.mIndexBuffer.GetBuffer(), indexByteSize);
+    }
+    mLodCount = sourceMesh.mLodCount;
+    Pegasus::Utils::Memcpy(mLodIndexOffsets, sourceMesh.mLodIndexOffsets, sizeof(mLodIndexOffsets));
+    mAreBoundsValid = sourceMesh.mAreBoundsValid;
+    mBoundingBox = sourceMesh.mBoundingBox;
+    mBoundingSphere = sourceMesh.mBoundingSphere;
+    return true;
+}
+
+unsigned int MeshData::GetContentSize() const
+{
+    int byteSize = GetIndexCount() * mIndexBuffer.GetStride();
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        byteSize += GetVertexCount() * mVertexStreams[s].GetStride();
+    }
+    return static_cast<unsigned int>(byteSize);
+}
+
+bool MeshData::WriteContent(Utils::ByteStream & stream) const
+{
+    if (mMode != Graph::Node::STANDARD)
+    {
+        return false;
+    }
+
+    const int counts[] = { mVertexCount, mIndexCount, mIndexBuffer.GetStride(), mIsPacked ? 1 : 0, mLodCount, mAreBoundsValid ? 1 : 0 };
+    stream.Append(counts, sizeof(counts));
+    if (mIsPacked)
+    {
+        const float decode[] = { mPositionDecodeScale.x, mPositionDecodeScale.y, mPositionDecodeScale.z,
+                                 mPositionDecodeOffset.x, mPositionDecodeOffset.y, mPositionDecodeOffset.z };
+        stream.Append(decode, sizeof(decode));
+    }
+    if (mLodCount > 1)
+    {
+        // The first level always starts at the first index
+        stream.Append(mLodIndexOffsets + 1, (mLodCount - 1) * sizeof(int));
+    }
+    if (mAreBoundsValid)
+    {
+        const Math::Vec3 & minPosition = mBoundingBox.GetMin();
+        const Math::Vec3 & maxPosition = mBoundingBox.GetMax();
+        const Math::Vec3 & center = mBoundingSphere.GetCenter();
+        const float bounds[] = { minPosition.x, minPosition.y, minPosition.z, maxPosition.x, maxPosition.y, maxPosition.z,
+                                 center.x, center.y, center.z, mBoundingSphere.GetRadius() };
+        stream.Append(bounds, sizeof(bounds));
+    }
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int byteSize = mVertexCount * mVertexStreams[s].GetStride();
+        if (byteSize > 0)
+        {
+            stream.Append(mVertexStreams[s].GetBuffer(), byteSize);
+        }
+    }
+    const int indexByteSize = mIndexCount * mIndexBuffer.GetStride();
+    if (indexByteSize > 0)
+    {
+        stream.Append(mIndexBuffer.GetBuffer(), indexByteSize);
+    }
+    return true;
+}
+
+bool MeshData::ReadContent(const void * buffer, unsigned int size)
+{
+    int counts[6];
+    float decode[6];
+    int lodIndexOffsets[MESH_MAX_LODS];
+    float bounds[10];
+    if (mMode != Graph::Node::STANDARD || size < sizeof(counts))
+    {
+        return false;
+    }
+    const char * content = static_cast<const char *>(buffer);
+    Pegasus::Utils::Memcpy(counts, content, sizeof(counts));
+    content += sizeof(counts);
+
+    // The size has to match the input layout of this mesh before anything is allocated
+    const int vertexCount = counts[0];
+    const int indexCount = mConfiguration.GetIsIndexed() ? counts[1] : 0;
+    const int indexStride = counts[2];
+    const bool isPacked = counts[3] != 0;
+    const int lodCount = counts[4];
+    const bool areBoundsValid = counts[5] != 0;
+    if (vertexCount < 0 || indexCount < 0 || (!mConfiguration.GetIsIndexed() && counts[1] != 0)
+        || (indexStride != sizeof(unsigned short) && indexStride != sizeof(unsigned int))
+        || (counts[3] != 0 && counts[3] != 1) || (isPacked && !IsPackable())
+        || lodCount < 1 || lodCount > MESH_MAX_LODS || (counts[5] != 0 && counts[5] != 1))
+    {
+        return false;
+    }
+    const unsigned int headerSize = sizeof(counts) + (isPacked ? sizeof(decode) : 0) + (lodCount - 1) * sizeof(int)
+                                  + (areBoundsValid ? sizeof(bounds) : 0);
+    if (size < headerSize)
+    {
+        return false;
+    }
+    if (isPacked)
+    {
+        Pegasus::Utils::Memcpy(decode, content, sizeof(decode));
+        content += sizeof(decode);
+    }
+    lodIndexOffsets[0] = 0;
+    if (lodCount > 1)
+    {
+        Pegasus::Utils::Memcpy(lodIndexOffsets + 1, content, (lodCount - 1) * sizeof(int));
+        content += (lodCount - 1) * sizeof(int);
+    }
+    if (areBoundsValid)
+    {
+        Pegasus::Utils::Memcpy(bounds, content, sizeof(bounds));
+        content += sizeof(bounds);
+        if (bounds[0] > bounds[3] || bounds[1] > bounds[4] || bounds[2] > bounds[5] || !(bounds[9] >= 0.0f))
+        {
+            return false;
+        }
+    }
+    for (int lod = 1; lod < lodCount; ++lod)
+    {
+        if (lodIndexOffsets[lod] < lodIndexOffsets[lod - 1] || lodIndexOffsets[lod] > indexCount)
+        {
+            return false;
+        }
+    }
+    unsigned long long expectedSize = headerSize + static_cast<unsigned long long>(indexCount) * indexStride;
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int stride = (s == 0 && isPacked != mIsPacked) ? static_cast<int>(isPacked ? sizeof(PackedVertex) : sizeof(StdVertex))
+                                                              : mVertexStreams[s].GetStride();
+        expectedSize += static_cast<unsigned long long>(vertexCount) * stride;
+    }
+    if (expectedSize != size)
+    {
+        return false;
+    }
+
+    ResetVertexFormat(isPacked);
+    InternalAllocateVertexes(vertexCount, false);
+    if (isPacked)
+    {
+        mPositionDecodeScale = Math::Vec3(decode[0], decode[1], decode[2]);
+        mPositionDecodeOffset = Math::Vec3(decode[3], decode[4], decode[5]);
+    }
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int byteSize = vertexCount * mVertexStreams[s].GetStride();
+        if (byteSize > 0)
+        {
+            Pegasus::Utils::Memcpy(mVertexStreams[s].GetBuffer(), content, byteSize);
+            content += byteSize;
+        }
+    }
+
+    ResetIndexStride(indexStride);
+    InternalAllocateIndexes(indexCount, false);
+    const int indexByteSize = indexCount * indexStride;
+    if (indexByteSize > 0)
+    {
+        Pegasus::Utils::Memcpy(mIndexBuffer.GetBuffer(), content, indexByteSize);
+    }
+    mLodCount = lodCount;
+    Pegasus::Utils::Memcpy(mLodIndexOffsets, lodIndexOffsets, lodCount * sizeof(int));
+    if (areBoundsValid)
+    {
+        mBoundingBox.SetMinMax(Math::Vec3(bounds[0], bounds[1], bounds[2]), Math::Vec3(bounds[3], bounds[4], bounds[5]));
+        mBoundingSphere.SetCenter(Math::Vec3(bounds[6], bounds[7], bounds[8]));
+        mBoundingSphere.SetRadius(bounds[9]);
+    }
+    mAreBoundsValid = areBoundsValid;
+    return true;
 }
 
 MeshData::~MeshData()
@@ -139,8 +841,20 @@ void MeshData::Stream::Grow(Alloc::IAllocator * allocator, int count, bool prese
     {
         const int MINIMUM_BYTE_GROWTH = 32 * mStride; //grow on 
 
+        // Room left for the pushed elements
+        if (preserveElements && count * mStride <= mByteSize)
+        {
+            return;
+        }
+
         int newByteSize = ((count * mStride) / MINIMUM_BYTE_GROWTH + 1) * MINIMUM_BYTE_GROWTH;
 
+        // Geometric growth, so pushing n elements copies O(n) bytes in total
+        if (preserveElements && newByteSize < 2 * mByteSize && mByteSize < 0x40000000)
+        {
+            newByteSize = 2 * mByteSize;
+        }
+
         if (newByteSize > mByteSize || newByteSize < (mByteSize / 2))
         {
             char * newList = PG_NEW_ARRAY(allocator, -1, "MeshData::Stream[i].mBuffer", Alloc::PG_MEM_TEMP, char, newByteSize);
@@ -159,6 +873,22 @@ void MeshData::Stream::Grow(Alloc::IAllocator * allocator, int count, bool prese
     }
 }
 
+void MeshData::Stream::Reserve(Alloc::IAllocator * allocator, int count)
+{
+    if (mStride > 0 && count * mStride > mByteSize)
+    {
+        const int newByteSize = count * mStride;
+        char * newList = PG_NEW_ARRAY(allocator, -1, "MeshData::Stream[i].mBuffer", Alloc::PG_MEM_TEMP, char, newByteSize);
+        if (mByteSize > 0)
+        {
+            Pegasus::Utils::Memcpy(newList, mBuffer, mByteSize);
+            Destroy(allocator);
+        }
+        mBuffer = newList;
+        mByteSize = newByteSize;
+    }
+}
+
 void MeshData::Stream::Destroy(Alloc::IAllocator * allocator)
 {
     PG_ASSERT(mBuffer != nullptr);
@@ -167,6 +897,19 @@ void MeshData::Stream::Destroy(Alloc::IAllocator * allocator)
     mByteSize = 0;
 }
 
+void MeshData::Stream::Swap(Stream& other)
+{
+    char * buffer = mBuffer;
+    int stride = mStride;
+    int byteSize = mByteSize;
+    mBuffer = other.mBuffer;
+    mStride = other.mStride;
+    mByteSize = other.mByteSize;
+    other.mBuffer = buffer;
+    other.mStride = stride;
+    other.mByteSize = byteSize;
+}
+
 MeshData::Stream::~Stream()
 {
     PG_ASSERTSTR(mBuffer == nullptr, "Destroy must be called explicitely on this stream");
@@ -101,6 +101,18 @@ Graph::NodeData * MeshGenerator::AllocateData() const
                     MeshData(mConfiguration, GetMode(), GetNodeDataAllocator());
 }
 
+//----------------------------------------------------------------------------------------
+
+void MeshGenerator::FinalizeData()
+{
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    MeshData * meshData = static_cast<MeshData *>(&(*dataRef));
+    meshData->FinalizeBounds();
+    meshData->FinalizeIndexFormat();
+    meshData->FinalizeVertexFormat();
+}
+
 
 }   // namespace Mesh
 }   // namespace Pegasus
@@ -105,6 +105,43 @@ void MeshInputLayout::GenerateEditorLayout(MeshInputLayout::LayoutUsageBitMask m
 
 //----------------------------------------------------------------------------------------
 
+void MeshInputLayout::GeneratePackedEditorLayout()
+{
+    mAttributeCount = 0; // delete all previous attributes, if any
+
+    AttrDesc attrPos = {
+        MeshInputLayout::POSITION,
+        Pegasus::Core::FORMAT_RGBA_16_UNORM, // 16 bit precision over the bounding box, w = 1
+        8,
+        0, // byte offset
+        0, // semantic index
+        0  // use the first stream
+    };
+    RegisterAttribute(attrPos);
+
+    AttrDesc attrNorm = {
+        MeshInputLayout::NORMAL,
+        Pegasus::Core::FORMAT_RG16_SNORM, // octahedral encoding, decoded by the shader
+        4,
+        8, // byte offset
+        0, // semantic index
+        0  // use the first stream
+    };
+    RegisterAttribute(attrNorm);
+
+    AttrDesc attrUV = {
+        MeshInputLayout::UV,
+        Pegasus::Core::FORMAT_RG16_FLOAT, // 16 bit precision
+        4,
+        12, // byte offset
+        0, // semantic index
+        0  // use the first stream
+    };
+    RegisterAttribute(attrUV);
+}
+
+//----------------------------------------------------------------------------------------
+
 void MeshInputLayout::RegisterAttribute(AttrDesc& attribute)
 {
     PG_ASSERTSTR(mAttributeCount < MESH_MAX_ATTRIBUTES, "Attribute max capd! make sure you increase the count");
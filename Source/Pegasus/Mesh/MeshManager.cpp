@@ -14,6 +14,9 @@
 #include "Pegasus/Mesh/Operator/CombineTransformOperator.h"
 #include "Pegasus/Mesh/Operator/MultiCopyOperator.h"
 #include "Pegasus/Mesh/Operator/WaveFieldOperator.h"
+#include "Pegasus/Mesh/Operator/VertexCacheOperator.h"
+#include "Pegasus/Mesh/Operator/VertexWeldOperator.h"
+#include "Pegasus/Mesh/Operator/SimplifyOperator.h"
 #include "Pegasus/Mesh/Generator/QuadGenerator.h"
 #include "Pegasus/Mesh/Generator/BoxGenerator.h"
 #include "Pegasus/Mesh/Generator/IcosphereGenerator.h"
@@ -213,6 +216,9 @@ void MeshManager::RegisterAllMeshNodes()
     REGISTER_MESH_NODE_OPERATOR(CombineTransformOperator);
     REGISTER_MESH_NODE_OPERATOR(MultiCopyOperator);
     REGISTER_MESH_NODE_OPERATOR(WaveFieldOperator);
+    REGISTER_MESH_NODE_OPERATOR(VertexCacheOperator);
+    REGISTER_MESH_NODE_OPERATOR(VertexWeldOperator);
+    REGISTER_MESH_NODE_OPERATOR(SimplifyOperator);
 
     // Register the generator nodes
     REGISTER_MESH_NODE_GENERATOR(QuadGenerator);
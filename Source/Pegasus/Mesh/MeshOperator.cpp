@@ -100,6 +100,18 @@ Graph::NodeData * MeshOperator::AllocateData() const
 
 //----------------------------------------------------------------------------------------
 
+void MeshOperator::FinalizeData()
+{
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    MeshData * meshData = static_cast<MeshData *>(&(*dataRef));
+    meshData->FinalizeBounds();
+    meshData->FinalizeIndexFormat();
+    meshData->FinalizeVertexFormat();
+}
+
+//----------------------------------------------------------------------------------------
+
 void MeshOperator::AddGeneratorInput(MeshGeneratorIn meshGenerator)
 {
     if (meshGenerator->GetConfiguration() == GetConfiguration())
@@ -0,0 +1,930 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshOptimizer.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Reordering of the triangles and vertices of meshes for the GPU caches, vertex welding and simplification
+
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Utils/Hash.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+#include <float.h>
+#include <math.h>
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Constants of the scoring of Tom Forsyth
+static const float FORSYTH_CACHE_DECAY_POWER = 1.5f;
+static const float FORSYTH_LAST_TRI_SCORE = 0.75f;
+static const float FORSYTH_VALENCE_BOOST_SCALE = 2.0f;
+static const float FORSYTH_VALENCE_BOOST_POWER = 0.5f;
+
+//! Number of precomputed valence scores, the scores of the larger valences being computed on the fly
+static const int FORSYTH_VALENCE_TABLE_SIZE = 32;
+
+//! Unused entry of the remapping tables
+static const unsigned int INVALID_VERTEX = 0xffffffff;
+
+//! Number of quantized components of the welded vertices (position xyz, normal xyz and uv)
+static const int WELD_KEY_SIZE = 8;
+
+//! Number of components of the vertices compared by the simplification (position xyz, weighted normal xyz and weighted uv)
+static const int SIMPLIFY_VECTOR_SIZE = 8;
+
+//! Number of coefficients of the upper triangle of the symmetric matrices of the quadrics
+static const int SIMPLIFY_MATRIX_SIZE = SIMPLIFY_VECTOR_SIZE * (SIMPLIFY_VECTOR_SIZE + 1) / 2;
+
+//! Smallest cosine of the rotation of a triangle normal allowed by a collapse, to prevent the folds
+static const float SIMPLIFY_MIN_NORMAL_COSINE = 0.25f;
+
+//! Number of bits of the keys sorted by each pass of the radix sort
+static const int RADIX_SORT_BITS = 11;
+
+//----------------------------------------------------------------------------------------
+
+//! Scores of the vertices, depending on their position in the cache and on their number of remaining triangles
+class ForsythScores
+{
+public:
+
+    //! Constructor
+    //! \param cacheSize Number of entries of the LRU cache
+    explicit ForsythScores(int cacheSize)
+    {
+        for (int p = 0; p < cacheSize; ++p)
+        {
+            if (p < 3)
+            {
+                // The vertices of the last triangle get a fixed score,
+                // so the next triangle does not reuse all of them (which would produce strips)
+                mCacheScores[p] = FORSYTH_LAST_TRI_SCORE;
+            }
+            else
+            {
+                const float scaler = 1.0f / static_cast<float>(cacheSize - 3);
+                mCacheScores[p] = powf(1.0f - static_cast<float>(p - 3) * scaler, FORSYTH_CACHE_DECAY_POWER);
+            }
+        }
+
+        mValenceScores[0] = -1.0f;
+        for (int v = 1; v < FORSYTH_VALENCE_TABLE_SIZE; ++v)
+        {
+            mValenceScores[v] = FORSYTH_VALENCE_BOOST_SCALE * powf(static_cast<float>(v), -FORSYTH_VALENCE_BOOST_POWER);
+        }
+    }
+
+    //! Compute the score of a vertex
+    //! \param cachePosition Position of the vertex in the cache, -1 when not in the cache
+    //! \param remainingTriangles Number of triangles using the vertex and not emitted yet
+    //! \return Score of the vertex, -1 when it has no triangle left
+    inline float GetScore(int cachePosition, unsigned int remainingTriangles) const
+    {
+        if (remainingTriangles == 0)
+        {
+            return -1.0f;
+        }
+
+        // Boost the vertices with few triangles left, to get rid of the lone triangles quickly
+        float score = remainingTriangles < static_cast<unsigned int>(FORSYTH_VALENCE_TABLE_SIZE) ? mValenceScores[remainingTriangles]
+                    : FORSYTH_VALENCE_BOOST_SCALE * powf(static_cast<float>(remainingTriangles), -FORSYTH_VALENCE_BOOST_POWER);
+        if (cachePosition >= 0)
+        {
+            score += mCacheScores[cachePosition];
+        }
+        return score;
+    }
+
+private:
+
+    //! Scores of the positions in the cache
+    float mCacheScores[MESH_OPTIMIZER_MAX_CACHE_SIZE];
+
+    //! Scores of the small numbers of remaining triangles
+    float mValenceScores[FORSYTH_VALENCE_TABLE_SIZE];
+};
+
+//----------------------------------------------------------------------------------------
+
+float ComputeACMR(const unsigned int * indexes, int indexCount, int vertexCount, int cacheSize, Alloc::IAllocator * allocator)
+{
+    PG_ASSERTSTR(indexCount % 3 == 0, "The index count (%d) must be a multiple of 3", indexCount);
+    PG_ASSERTSTR(cacheSize >= 3 && cacheSize <= MESH_OPTIMIZER_MAX_CACHE_SIZE, "Invalid cache size (%d)", cacheSize);
+    if (indexCount < 3)
+    {
+        return 0.0f;
+    }
+
+    // A vertex is in the FIFO when less than cacheSize misses happened since it was loaded.
+    // The time starts after cacheSize so the timestamps of 0 are out of the cache
+    unsigned int * loadTimes = PG_NEW_ARRAY(allocator, -1, "ComputeACMR::loadTimes", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        loadTimes[v] = 0;
+    }
+
+    const unsigned int size = static_cast<unsigned int>(cacheSize);
+    unsigned int time = size + 1;
+    int misses = 0;
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const unsigned int v = indexes[i];
+        PG_ASSERT(v < static_cast<unsigned int>(vertexCount));
+        if (time - loadTimes[v] > size)
+        {
+            loadTimes[v] = time++;
+            ++misses;
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, loadTimes);
+    return static_cast<float>(misses) / static_cast<float>(indexCount / 3);
+}
+
+//----------------------------------------------------------------------------------------
+
+void OptimizeVertexCache(unsigned int * dest, const unsigned int * indexes, int indexCount, int vertexCount, int cacheSize, Alloc::IAllocator * allocator)
+{
+    PG_ASSERTSTR(indexCount % 3 == 0, "The index count (%d) must be a multiple of 3", indexCount);
+    PG_ASSERTSTR(cacheSize > 3 && cacheSize <= MESH_OPTIMIZER_MAX_CACHE_SIZE, "Invalid cache size (%d)", cacheSize);
+    PG_ASSERTSTR(dest != indexes, "The reordered indices must not overwrite the source indices");
+    const int triangleCount = indexCount / 3;
+    if (triangleCount == 0)
+    {
+        return;
+    }
+
+    // Triangles of each vertex, sorted by vertex. The emitted triangles are swapped
+    // to the end of the list of each vertex, so the remaining ones stay first
+    unsigned int * triangleOffsets = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::triangleOffsets", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    unsigned int * remainingTriangles = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::remainingTriangles", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    unsigned int * vertexTriangles = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::vertexTriangles", Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    float * vertexScores = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::vertexScores", Alloc::PG_MEM_TEMP, float, vertexCount);
+    float * triangleScores = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::triangleScores", Alloc::PG_MEM_TEMP, float, triangleCount);
+    bool * emittedTriangles = PG_NEW_ARRAY(allocator, -1, "OptimizeVertexCache::emittedTriangles", Alloc::PG_MEM_TEMP, bool, triangleCount);
+
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        remainingTriangles[v] = 0;
+    }
+    for (int i = 0; i < indexCount; ++i)
+    {
+        PG_ASSERT(indexes[i] < static_cast<unsigned int>(vertexCount));
+        ++remainingTriangles[indexes[i]];
+    }
+    unsigned int offset = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        triangleOffsets[v] = offset;
+        offset += remainingTriangles[v];
+        remainingTriangles[v] = 0;
+    }
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const unsigned int v = indexes[i];
+        vertexTriangles[triangleOffsets[v] + remainingTriangles[v]++] = static_cast<unsigned int>(i / 3);
+    }
+
+    // Initial scores, no vertex being in the cache
+    const ForsythScores scores(cacheSize);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        vertexScores[v] = scores.GetScore(-1, remainingTriangles[v]);
+    }
+    int bestTriangle = 0;
+    for (int t = 0; t < triangleCount; ++t)
+    {
+        triangleScores[t] = vertexScores[indexes[t * 3]] + vertexScores[indexes[t * 3 + 1]] + vertexScores[indexes[t * 3 + 2]];
+        emittedTriangles[t] = false;
+        if (triangleScores[t] > triangleScores[bestTriangle])
+        {
+            bestTriangle = t;
+        }
+    }
+
+    // The LRU cache, with room for the 3 vertices pushed by a triangle before the oldest ones are evicted
+    unsigned int cacheBuffers[2][MESH_OPTIMIZER_MAX_CACHE_SIZE + 3];
+    unsigned int * cache = cacheBuffers[0];
+    unsigned int * newCache = cacheBuffers[1];
+    int cacheCount = 0;
+    int firstRemainingTriangle = 0;
+
+    for (int e = 0; e < triangleCount; ++e)
+    {
+        // When no triangle touches the cache, restart from the first triangle not emitted
+        if (bestTriangle < 0)
+        {
+            while (emittedTriangles[firstRemainingTriangle])
+            {
+                ++firstRemainingTriangle;
+            }
+            bestTriangle = firstRemainingTriangle;
+        }
+
+        const unsigned int * triangle = indexes + bestTriangle * 3;
+        dest[e * 3    ] = triangle[0];
+        dest[e * 3 + 1] = triangle[1];
+        dest[e * 3 + 2] = triangle[2];
+        emittedTriangles[bestTriangle] = true;
+
+        // Move the triangle out of the remaining ones of its vertices, once per corner
+        int newCacheCount = 0;
+        for (int c = 0; c < 3; ++c)
+        {
+            const unsigned int v = triangle[c];
+            unsigned int * vertexList = vertexTriangles + triangleOffsets[v];
+            const unsigned int last = --remainingTriangles[v];
+            for (unsigned int t = 0; t <= last; ++t)
+            {
+                if (vertexList[t] == static_cast<unsigned int>(bestTriangle))
+                {
+                    vertexList[t] = vertexList[last];
+                    vertexList[last] = bestTriangle;
+                    break;
+                }
+            }
+
+            // The vertices of the triangle go to the front of the cache, skipping the degenerate corners
+            if ((c == 0) || (v != triangle[0] && (c == 1 || v != triangle[1])))
+            {
+                newCache[newCacheCount++] = v;
+            }
+        }
+
+        for (int i = 0; i < cacheCount; ++i)
+        {
+            const unsigned int v = cache[i];
+            if (v != triangle[0] && v != triangle[1] && v != triangle[2])
+            {
+                newCache[newCacheCount++] = v;
+            }
+        }
+
+        // Rescore the vertices whose position changed, including the evicted ones,
+        // and pick the best triangle among theirs
+        bestTriangle = -1;
+        float bestScore = -1.0f;
+        for (int i = 0; i < newCacheCount; ++i)
+        {
+            const unsigned int v = newCache[i];
+            const float score = scores.GetScore(i < cacheSize ? i : -1, remainingTriangles[v]);
+            const float delta = score - vertexScores[v];
+            vertexScores[v] = score;
+
+            const unsigned int * vertexList = vertexTriangles + triangleOffsets[v];
+            for (unsigned int t = 0; t < remainingTriangles[v]; ++t)
+            {
+                const unsigned int triangleIndex = vertexList[t];
+                triangleScores[triangleIndex] += delta;
+                if (triangleScores[triangleIndex] > bestScore)
+                {
+                    bestScore = triangleScores[triangleIndex];
+                    bestTriangle = static_cast<int>(triangleIndex);
+                }
+            }
+        }
+
+        unsigned int * swapCache = cache;
+        cache = newCache;
+        newCache = swapCache;
+        cacheCount = newCacheCount < cacheSize ? newCacheCount : cacheSize;
+    }
+
+    PG_DELETE_ARRAY(allocator, emittedTriangles);
+    PG_DELETE_ARRAY(allocator, triangleScores);
+    PG_DELETE_ARRAY(allocator, vertexScores);
+    PG_DELETE_ARRAY(allocator, vertexTriangles);
+    PG_DELETE_ARRAY(allocator, remainingTriangles);
+    PG_DELETE_ARRAY(allocator, triangleOffsets);
+}
+
+//----------------------------------------------------------------------------------------
+
+int OptimizeVertexFetch(unsigned int * remap, unsigned int * indexes, int indexCount, int vertexCount)
+{
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        remap[v] = INVALID_VERTEX;
+    }
+
+    unsigned int nextVertex = 0;
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const unsigned int v = indexes[i];
+        PG_ASSERT(v < static_cast<unsigned int>(vertexCount));
+        if (remap[v] == INVALID_VERTEX)
+        {
+            remap[v] = nextVertex++;
+        }
+        indexes[i] = remap[v];
+    }
+
+    const int usedVertexCount = static_cast<int>(nextVertex);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (remap[v] == INVALID_VERTEX)
+        {
+            remap[v] = nextVertex++;
+        }
+    }
+    return usedVertexCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Quantize the attributes of a vertex for the welding
+//! \param vertex Vertex to quantize
+//! \param inverseTolerances Inverse of the tolerances of the position, normal and uv
+//! \param key Receives the quantized components
+static void ComputeWeldKey(const StdVertex & vertex, const float inverseTolerances[3], long long key[WELD_KEY_SIZE])
+{
+    const float components[WELD_KEY_SIZE] = {
+        vertex.position.x * inverseTolerances[0], vertex.position.y * inverseTolerances[0], vertex.position.z * inverseTolerances[0],
+        vertex.normal.x * inverseTolerances[1], vertex.normal.y * inverseTolerances[1], vertex.normal.z * inverseTolerances[1],
+        vertex.uv.x * inverseTolerances[2], vertex.uv.y * inverseTolerances[2]
+    };
+    for (int c = 0; c < WELD_KEY_SIZE; ++c)
+    {
+        key[c] = static_cast<long long>(floor(static_cast<double>(components[c]) + 0.5));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+int WeldVertexes(unsigned int * remap, const StdVertex * vertices, int vertexCount,
+                 float positionTolerance, float normalTolerance, float uvTolerance, Alloc::IAllocator * allocator)
+{
+    PG_ASSERTSTR(positionTolerance > 0.0f && normalTolerance > 0.0f && uvTolerance > 0.0f, "The welding tolerances must be positive");
+    const float inverseTolerances[3] = { 1.0f / positionTolerance, 1.0f / normalTolerance, 1.0f / uvTolerance };
+
+    // Each slot holds the first vertex of a welded group, and the hash of its key to skip most key comparisons.
+    // The load factor is kept under 1/2 so the probe sequences stay short
+    unsigned int slotCount = 16;
+    while (slotCount < static_cast<unsigned int>(vertexCount) * 2)
+    {
+        slotCount <<= 1;
+    }
+    const unsigned int mask = slotCount - 1;
+    unsigned int * slotVertices = PG_NEW_ARRAY(allocator, -1, "WeldVertexes::slotVertices", Alloc::PG_MEM_TEMP, unsigned int, slotCount);
+    unsigned int * slotHashes = PG_NEW_ARRAY(allocator, -1, "WeldVertexes::slotHashes", Alloc::PG_MEM_TEMP, unsigned int, slotCount);
+    for (unsigned int slot = 0; slot < slotCount; ++slot)
+    {
+        slotVertices[slot] = INVALID_VERTEX;
+    }
+
+    long long key[WELD_KEY_SIZE];
+    long long slotKey[WELD_KEY_SIZE];
+    unsigned int weldedVertexCount = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        ComputeWeldKey(vertices[v], inverseTolerances, key);
+        unsigned int hash = 0;
+        for (int c = 0; c < WELD_KEY_SIZE; ++c)
+        {
+            hash = Utils::HashUInt64(static_cast<unsigned long long>(key[c]) ^ (static_cast<unsigned long long>(hash) * Utils::FNV1A64_PRIME));
+        }
+
+        unsigned int slot = hash & mask;
+        for (; slotVertices[slot] != INVALID_VERTEX; slot = (slot + 1) & mask)
+        {
+            if (slotHashes[slot] == hash)
+            {
+                ComputeWeldKey(vertices[slotVertices[slot]], inverseTolerances, slotKey);
+                int c = 0;
+                while (c < WELD_KEY_SIZE && key[c] == slotKey[c])
+                {
+                    ++c;
+                }
+                if (c == WELD_KEY_SIZE)
+                {
+                    break;
+                }
+            }
+        }
+
+        if (slotVertices[slot] == INVALID_VERTEX)
+        {
+            slotVertices[slot] = static_cast<unsigned int>(v);
+            slotHashes[slot] = hash;
+            remap[v] = weldedVertexCount++;
+        }
+        else
+        {
+            remap[v] = remap[slotVertices[slot]];
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, slotHashes);
+    PG_DELETE_ARRAY(allocator, slotVertices);
+    return static_cast<int>(weldedVertexCount);
+}
+
+
+//----------------------------------------------------------------------------------------
+
+//! Quadric error of a vertex, the squared distance to a set of planes of the space of the positions and attributes,
+//! error(x) = xAx + 2bx + c. The planes are the ones of the triangles around the vertex, weighted by their area
+struct SimplifyQuadric
+{
+    float mA[SIMPLIFY_MATRIX_SIZE];     //!< Upper triangle of the symmetric matrix, row by row
+    float mB[SIMPLIFY_VECTOR_SIZE];
+    float mC;
+    float mWeight;                      //!< Sum of the areas of the triangles
+};
+
+//! Reset a quadric to no plane
+//! \param quadric Quadric to reset
+static void ClearQuadric(SimplifyQuadric & quadric)
+{
+    for (int i = 0; i < SIMPLIFY_MATRIX_SIZE; ++i)
+    {
+        quadric.mA[i] = 0.0f;
+    }
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        quadric.mB[i] = 0.0f;
+    }
+    quadric.mC = 0.0f;
+    quadric.mWeight = 0.0f;
+}
+
+//! Add the planes of a quadric to another one
+//! \param quadric Quadric receiving the planes
+//! \param other Quadric to add
+static void AddQuadric(SimplifyQuadric & quadric, const SimplifyQuadric & other)
+{
+    for (int i = 0; i < SIMPLIFY_MATRIX_SIZE; ++i)
+    {
+        quadric.mA[i] += other.mA[i];
+    }
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        quadric.mB[i] += other.mB[i];
+    }
+    quadric.mC += other.mC;
+    quadric.mWeight += other.mWeight;
+}
+
+//! Compute the sum of the squared distances of a point to the planes of a quadric, weighted by their area
+//! \param quadric Quadric to evaluate
+//! \param x Point, position and weighted attributes
+//! \return Weighted sum of the squared distances, not divided by the weight of the quadric
+static float EvaluateQuadric(const SimplifyQuadric & quadric, const float x[SIMPLIFY_VECTOR_SIZE])
+{
+    float error = quadric.mC;
+    int a = 0;
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        float row = quadric.mA[a++] * x[i] * 0.5f + quadric.mB[i];
+        for (int j = i + 1; j < SIMPLIFY_VECTOR_SIZE; ++j)
+        {
+            row += quadric.mA[a++] * x[j];
+        }
+        error += 2.0f * row * x[i];
+    }
+    return error;
+}
+
+//! Compute the quadric of the plane of a triangle, in the space of the positions and attributes
+//! \param quadric Receives the quadric, weighted by the area of the triangle
+//! \param p0 First corner
+//! \param p1 Second corner
+//! \param p2 Third corner
+//! \return False for a degenerate triangle, whose quadric is not computed
+static bool ComputeTriangleQuadric(SimplifyQuadric & quadric, const float * p0, const float * p1, const float * p2)
+{
+    // Area from the positions only
+    const float u[3] = { p1[0] - p0[0], p1[1] - p0[1], p1[2] - p0[2] };
+    const float v[3] = { p2[0] - p0[0], p2[1] - p0[1], p2[2] - p0[2] };
+    const float cx = u[1] * v[2] - u[2] * v[1];
+    const float cy = u[2] * v[0] - u[0] * v[2];
+    const float cz = u[0] * v[1] - u[1] * v[0];
+    const float area = 0.5f * sqrtf(cx * cx + cy * cy + cz * cz);
+
+    // Orthonormal basis (e1, e2) of the plane of the triangle
+    float e1[SIMPLIFY_VECTOR_SIZE];
+    float e2[SIMPLIFY_VECTOR_SIZE];
+    float length1 = 0.0f;
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        e1[i] = p1[i] - p0[i];
+        e2[i] = p2[i] - p0[i];
+        length1 += e1[i] * e1[i];
+    }
+    length1 = sqrtf(length1);
+    if (area <= 0.0f || length1 <= FLT_EPSILON)
+    {
+        return false;
+    }
+    float projection = 0.0f;
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        e1[i] /= length1;
+        projection += e1[i] * e2[i];
+    }
+    float length2 = 0.0f;
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        e2[i] -= projection * e1[i];
+        length2 += e2[i] * e2[i];
+    }
+    length2 = sqrtf(length2);
+    if (length2 <= FLT_EPSILON)
+    {
+        return false;
+    }
+
+    // A = I - e1e1 - e2e2, b = (p0.e1)e1 + (p0.e2)e2 - p0, c = p0.p0 - (p0.e1)^2 - (p0.e2)^2
+    float p0e1 = 0.0f;
+    float p0e2 = 0.0f;
+    float p0p0 = 0.0f;
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        e2[i] /= length2;
+        p0e1 += p0[i] * e1[i];
+        p0e2 += p0[i] * e2[i];
+        p0p0 += p0[i] * p0[i];
+    }
+    int a = 0;
+    for (int i = 0; i < SIMPLIFY_VECTOR_SIZE; ++i)
+    {
+        for (int j = i; j < SIMPLIFY_VECTOR_SIZE; ++j)
+        {
+            quadric.mA[a++] = area * ((i == j ? 1.0f : 0.0f) - e1[i] * e1[j] - e2[i] * e2[j]);
+        }
+        quadric.mB[i] = area * (p0e1 * e1[i] + p0e2 * e2[i] - p0[i]);
+    }
+    quadric.mC = area * (p0p0 - p0e1 * p0e1 - p0e2 * p0e2);
+    quadric.mWeight = area;
+    return true;
+}
+
+//! Build the list of the triangles of each vertex
+//! \param triangleOffsets Receives the position of the first triangle of each vertex in vertexTriangles, vertexCount + 1 elements
+//! \param vertexTriangles Receives the triangles of each vertex, indexCount elements
+//! \param indexes Indices of the triangle list
+//! \param indexCount Number of indices
+//! \param vertexCount Number of vertices
+static void BuildVertexTriangles(unsigned int * triangleOffsets, unsigned int * vertexTriangles,
+                                 const unsigned int * indexes, int indexCount, int vertexCount)
+{
+    for (int v = 0; v <= vertexCount; ++v)
+    {
+        triangleOffsets[v] = 0;
+    }
+    for (int i = 0; i < indexCount; ++i)
+    {
+        ++triangleOffsets[indexes[i] + 1];
+    }
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        triangleOffsets[v + 1] += triangleOffsets[v];
+    }
+    for (int i = 0; i < indexCount; ++i)
+    {
+        vertexTriangles[triangleOffsets[indexes[i]]++] = static_cast<unsigned int>(i / 3);
+    }
+
+    // Each offset has moved to the start of the next list
+    for (int v = vertexCount; v > 0; --v)
+    {
+        triangleOffsets[v] = triangleOffsets[v - 1];
+    }
+    triangleOffsets[0] = 0;
+}
+
+//! Count the triangles of a list containing a directed edge
+//! \param indexes Indices of the triangle list
+//! \param triangles Triangles to search
+//! \param triangleCount Number of triangles to search
+//! \param a First vertex of the edge
+//! \param b Second vertex of the edge
+//! \return Number of triangles containing the edge from a to b
+static int CountDirectedEdges(const unsigned int * indexes, const unsigned int * triangles, unsigned int triangleCount, unsigned int a, unsigned int b)
+{
+    int count = 0;
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        const unsigned int * corners = indexes + triangles[t] * 3;
+        count += (corners[0] == a && corners[1] == b) || (corners[1] == a && corners[2] == b) || (corners[2] == a && corners[0] == b);
+    }
+    return count;
+}
+
+//! Sort items by increasing key with a radix sort
+//! \param items Items to sort, indices in the keys
+//! \param tempItems Temporary buffer, count elements
+//! \param keys Key of each item
+//! \param count Number of items
+static void RadixSortByKey(unsigned int * items, unsigned int * tempItems, const unsigned int * keys, int count)
+{
+    unsigned int histogram[1 << RADIX_SORT_BITS];
+    unsigned int * src = items;
+    unsigned int * dst = tempItems;
+    for (int shift = 0; shift < 32; shift += RADIX_SORT_BITS)
+    {
+        for (int h = 0; h < (1 << RADIX_SORT_BITS); ++h)
+        {
+            histogram[h] = 0;
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            ++histogram[(keys[src[i]] >> shift) & ((1 << RADIX_SORT_BITS) - 1)];
+        }
+        unsigned int offset = 0;
+        for (int h = 0; h < (1 << RADIX_SORT_BITS); ++h)
+        {
+            const unsigned int bucketSize = histogram[h];
+            histogram[h] = offset;
+            offset += bucketSize;
+        }
+        for (int i = 0; i < count; ++i)
+        {
+            dst[histogram[(keys[src[i]] >> shift) & ((1 << RADIX_SORT_BITS) - 1)]++] = src[i];
+        }
+        unsigned int * swap = src;
+        src = dst;
+        dst = swap;
+    }
+    if (src != items)
+    {
+        for (int i = 0; i < count; ++i)
+        {
+            items[i] = src[i];
+        }
+    }
+}
+
+//! Check that collapsing a vertex into another one does not flip or fold any triangle, and count the triangles it removes
+//! \param indexes Indices of the triangle list
+//! \param triangles Triangles of the collapsed vertex
+//! \param triangleCount Number of triangles of the collapsed vertex
+//! \param remap Vertex replacing each vertex, for the collapses of the current pass
+//! \param points Normalized positions and attributes of the vertices
+//! \param u Collapsed vertex
+//! \param v Vertex replacing u
+//! \return Number of triangles removed by the collapse, -1 when the normal of a triangle would rotate too much
+static int CheckCollapse(const unsigned int * indexes, const unsigned int * triangles, unsigned int triangleCount,
+                         const unsigned int * remap, const float * points, unsigned int u, unsigned int v)
+{
+    int removedCount = 0;
+    for (unsigned int t = 0; t < triangleCount; ++t)
+    {
+        const unsigned int * corners = indexes + triangles[t] * 3;
+        unsigned int c[3] = { remap[corners[0]], remap[corners[1]], remap[corners[2]] };
+        if (c[0] == c[1] || c[1] == c[2] || c[2] == c[0])
+        {
+            // Already removed by another collapse
+            continue;
+        }
+        if (c[0] == v || c[1] == v || c[2] == v)
+        {
+            ++removedCount;
+            continue;
+        }
+
+        // Rotated so that u is the first corner
+        const int first = (c[0] == u) ? 0 : ((c[1] == u) ? 1 : 2);
+        const float * p1 = points + c[(first + 1) % 3] * SIMPLIFY_VECTOR_SIZE;
+        const float * p2 = points + c[(first + 2) % 3] * SIMPLIFY_VECTOR_SIZE;
+        const float * pu = points + u * SIMPLIFY_VECTOR_SIZE;
+        const float * pv = points + v * SIMPLIFY_VECTOR_SIZE;
+        const float e[3] = { p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2] };
+        const float du[3] = { pu[0] - p1[0], pu[1] - p1[1], pu[2] - p1[2] };
+        const float dv[3] = { pv[0] - p1[0], pv[1] - p1[1], pv[2] - p1[2] };
+        const float nu[3] = { e[1] * du[2] - e[2] * du[1], e[2] * du[0] - e[0] * du[2], e[0] * du[1] - e[1] * du[0] };
+        const float nv[3] = { e[1] * dv[2] - e[2] * dv[1], e[2] * dv[0] - e[0] * dv[2], e[0] * dv[1] - e[1] * dv[0] };
+        const float dot = nu[0] * nv[0] + nu[1] * nv[1] + nu[2] * nv[2];
+        const float squaredLengths = (nu[0] * nu[0] + nu[1] * nu[1] + nu[2] * nu[2]) * (nv[0] * nv[0] + nv[1] * nv[1] + nv[2] * nv[2]);
+        if (dot <= 0.0f || dot * dot < SIMPLIFY_MIN_NORMAL_COSINE * SIMPLIFY_MIN_NORMAL_COSINE * squaredLengths)
+        {
+            return -1;
+        }
+    }
+    return removedCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+int SimplifyMesh(unsigned int * dest, const unsigned int * indexes, int indexCount, const StdVertex * vertices, int vertexCount,
+                 int targetIndexCount, float maxError, float normalWeight, float uvWeight, float * resultError, Alloc::IAllocator * allocator)
+{
+    PG_ASSERTSTR(indexCount % 3 == 0, "The index count (%d) must be a multiple of 3", indexCount);
+    if (dest != indexes)
+    {
+        for (int i = 0; i < indexCount; ++i)
+        {
+            dest[i] = indexes[i];
+        }
+    }
+    *resultError = 0.0f;
+    if (indexCount <= targetIndexCount || vertexCount == 0)
+    {
+        return indexCount;
+    }
+
+    // Positions normalized by the largest size of the bounding box, so the errors do not depend on the size of the mesh
+    float minPosition[3] = { vertices[0].position.x, vertices[0].position.y, vertices[0].position.z };
+    float maxPosition[3] = { minPosition[0], minPosition[1], minPosition[2] };
+    for (int v = 1; v < vertexCount; ++v)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            minPosition[i] = vertices[v].position.v[i] < minPosition[i] ? vertices[v].position.v[i] : minPosition[i];
+            maxPosition[i] = vertices[v].position.v[i] > maxPosition[i] ? vertices[v].position.v[i] : maxPosition[i];
+        }
+    }
+    float size = maxPosition[0] - minPosition[0];
+    size = (maxPosition[1] - minPosition[1] > size) ? maxPosition[1] - minPosition[1] : size;
+    size = (maxPosition[2] - minPosition[2] > size) ? maxPosition[2] - minPosition[2] : size;
+    const float inverseSize = (size > 0.0f) ? 1.0f / size : 0.0f;
+
+    float * points = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::points", Alloc::PG_MEM_TEMP, float, vertexCount * SIMPLIFY_VECTOR_SIZE);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        float * point = points + v * SIMPLIFY_VECTOR_SIZE;
+        point[0] = (vertices[v].position.x - minPosition[0]) * inverseSize;
+        point[1] = (vertices[v].position.y - minPosition[1]) * inverseSize;
+        point[2] = (vertices[v].position.z - minPosition[2]) * inverseSize;
+        point[3] = vertices[v].normal.x * normalWeight;
+        point[4] = vertices[v].normal.y * normalWeight;
+        point[5] = vertices[v].normal.z * normalWeight;
+        point[6] = vertices[v].uv.x * uvWeight;
+        point[7] = vertices[v].uv.y * uvWeight;
+    }
+
+    // Quadrics of the vertices, from the planes of their triangles
+    SimplifyQuadric * quadrics = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::quadrics", Alloc::PG_MEM_TEMP, SimplifyQuadric, vertexCount);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        ClearQuadric(quadrics[v]);
+    }
+    for (int i = 0; i < indexCount; i += 3)
+    {
+        PG_ASSERT(dest[i] < static_cast<unsigned int>(vertexCount) && dest[i + 1] < static_cast<unsigned int>(vertexCount)
+                  && dest[i + 2] < static_cast<unsigned int>(vertexCount));
+        SimplifyQuadric triangleQuadric;
+        if (ComputeTriangleQuadric(triangleQuadric, points + dest[i] * SIMPLIFY_VECTOR_SIZE,
+                                   points + dest[i + 1] * SIMPLIFY_VECTOR_SIZE, points + dest[i + 2] * SIMPLIFY_VECTOR_SIZE))
+        {
+            AddQuadric(quadrics[dest[i]], triangleQuadric);
+            AddQuadric(quadrics[dest[i + 1]], triangleQuadric);
+            AddQuadric(quadrics[dest[i + 2]], triangleQuadric);
+        }
+    }
+
+    unsigned int * triangleOffsets = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::triangleOffsets", Alloc::PG_MEM_TEMP, unsigned int, vertexCount + 1);
+    unsigned int * vertexTriangles = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::vertexTriangles", Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    unsigned int * remap = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::remap", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    unsigned int * collapseTargets = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::collapseTargets", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    unsigned int * collapseKeys = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::collapseKeys", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    unsigned int * collapseOrder = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::collapseOrder", Alloc::PG_MEM_TEMP, unsigned int, vertexCount * 2);
+    float * collapseErrors = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::collapseErrors", Alloc::PG_MEM_TEMP, float, vertexCount);
+    bool * lockedVertices = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::lockedVertices", Alloc::PG_MEM_TEMP, bool, vertexCount);
+    bool * touchedVertices = PG_NEW_ARRAY(allocator, -1, "SimplifyMesh::touchedVertices", Alloc::PG_MEM_TEMP, bool, vertexCount);
+
+    // The vertices of the edges without exactly one opposite edge are on a border, a seam or a non-manifold edge,
+    // and are locked so the simplification does not open holes
+    BuildVertexTriangles(triangleOffsets, vertexTriangles, dest, indexCount, vertexCount);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        lockedVertices[v] = false;
+        remap[v] = static_cast<unsigned int>(v);
+    }
+    for (int i = 0; i < indexCount; ++i)
+    {
+        const unsigned int a = dest[i];
+        const unsigned int b = dest[(i % 3 == 2) ? i - 2 : i + 1];
+        if (CountDirectedEdges(dest, vertexTriangles + triangleOffsets[b], triangleOffsets[b + 1] - triangleOffsets[b], b, a) != 1
+            || CountDirectedEdges(dest, vertexTriangles + triangleOffsets[a], triangleOffsets[a + 1] - triangleOffsets[a], a, b) != 1)
+        {
+            lockedVertices[a] = lockedVertices[b] = true;
+        }
+    }
+
+    // Passes collapsing the cheapest edges, each vertex being involved in one collapse at most per pass,
+    // so the errors computed at the start of the pass stay exact
+    const float maxSquaredError = (maxError > 0.0f) ? maxError * maxError : FLT_MAX;
+    float largestError = 0.0f;
+    int currentIndexCount = indexCount;
+    while (currentIndexCount > targetIndexCount)
+    {
+        BuildVertexTriangles(triangleOffsets, vertexTriangles, dest, currentIndexCount, vertexCount);
+
+        // Cheapest collapse of each vertex into one of its neighbors, the error being the mean squared distance
+        // of the remaining vertex to the planes of both vertices
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            collapseErrors[v] = FLT_MAX;
+        }
+        for (int i = 0; i < currentIndexCount; ++i)
+        {
+            const unsigned int u = dest[i];
+            if (lockedVertices[u])
+            {
+                continue;
+            }
+            for (int c = 1; c < 3; ++c)
+            {
+                const unsigned int v = dest[(i / 3) * 3 + (i % 3 + c) % 3];
+                const float * pv = points + v * SIMPLIFY_VECTOR_SIZE;
+                const float weight = quadrics[u].mWeight + quadrics[v].mWeight;
+                float error = (weight > 0.0f) ? (EvaluateQuadric(quadrics[u], pv) + EvaluateQuadric(quadrics[v], pv)) / weight : 0.0f;
+                error = (error > 0.0f) ? error : 0.0f;
+                if (error < collapseErrors[u])
+                {
+                    collapseErrors[u] = error;
+                    collapseTargets[u] = v;
+                }
+            }
+        }
+
+        // Sorted by error, the bits of the positive floats having the same order as the floats.
+        // The locked and unused vertices keep the FLT_MAX error and have no collapse
+        int collapseCount = 0;
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            if (collapseErrors[v] < FLT_MAX && collapseErrors[v] <= maxSquaredError)
+            {
+                Utils::Memcpy(&collapseKeys[v], &collapseErrors[v], sizeof(float));
+                collapseOrder[collapseCount++] = static_cast<unsigned int>(v);
+            }
+        }
+        RadixSortByKey(collapseOrder, collapseOrder + vertexCount, collapseKeys, collapseCount);
+
+        for (int v = 0; v < vertexCount; ++v)
+        {
+            touchedVertices[v] = false;
+        }
+        int removedIndexCount = 0;
+        int appliedCount = 0;
+        for (int c = 0; c < collapseCount && currentIndexCount - removedIndexCount > targetIndexCount; ++c)
+        {
+            const unsigned int u = collapseOrder[c];
+            const unsigned int v = collapseTargets[u];
+            if (touchedVertices[u] || touchedVertices[v])
+            {
+                continue;
+            }
+            const int removedCount = CheckCollapse(dest, vertexTriangles + triangleOffsets[u], triangleOffsets[u + 1] - triangleOffsets[u],
+                                                   remap, points, u, v);
+            if (removedCount <= 0)
+            {
+                continue;
+            }
+            remap[u] = v;
+            touchedVertices[u] = touchedVertices[v] = true;
+            AddQuadric(quadrics[v], quadrics[u]);
+            removedIndexCount += removedCount * 3;
+            largestError = (collapseErrors[u] > largestError) ? collapseErrors[u] : largestError;
+            ++appliedCount;
+        }
+        if (appliedCount == 0)
+        {
+            break;
+        }
+
+        // Remove the collapsed triangles
+        int writtenIndexCount = 0;
+        for (int i = 0; i < currentIndexCount; i += 3)
+        {
+            const unsigned int a = remap[dest[i]];
+            const unsigned int b = remap[dest[i + 1]];
+            const unsigned int c = remap[dest[i + 2]];
+            if (a != b && b != c && c != a)
+            {
+                dest[writtenIndexCount++] = a;
+                dest[writtenIndexCount++] = b;
+                dest[writtenIndexCount++] = c;
+            }
+        }
+        PG_ASSERT(writtenIndexCount == currentIndexCount - removedIndexCount);
+        currentIndexCount = writtenIndexCount;
+    }
+
+    PG_DELETE_ARRAY(allocator, touchedVertices);
+    PG_DELETE_ARRAY(allocator, lockedVertices);
+    PG_DELETE_ARRAY(allocator, collapseErrors);
+    PG_DELETE_ARRAY(allocator, collapseOrder);
+    PG_DELETE_ARRAY(allocator, collapseKeys);
+    PG_DELETE_ARRAY(allocator, collapseTargets);
+    PG_DELETE_ARRAY(allocator, remap);
+    PG_DELETE_ARRAY(allocator, vertexTriangles);
+    PG_DELETE_ARRAY(allocator, triangleOffsets);
+    PG_DELETE_ARRAY(allocator, quadrics);
+    PG_DELETE_ARRAY(allocator, points);
+
+    *resultError = sqrtf(largestError);
+    return currentIndexCount;
+}
+
+}   // namespace Mesh
+}   // namespace Pegasus
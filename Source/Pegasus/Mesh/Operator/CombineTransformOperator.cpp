@@ -12,6 +12,8 @@
 
 #include "Pegasus/Mesh/Operator/CombineTransformOperator.h"
 #include "Pegasus/Math/Quaternion.h"
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Core/WorkerPool.h"
 
 namespace Pegasus {
 namespace Mesh {
@@ -58,27 +60,57 @@ CombineTransformOperator::~CombineTransformOperator()
 {
 }
 
-static void TransformAppendMesh(const StdVertex* input, StdVertex* outputDest, int count, const Math::Mat44& targetTransform, const Math::Mat33& targetNormalTransform)
+//! Minimum number of vertices unpacked and transformed by each task
+static const unsigned int COMBINE_TRANSFORM_MIN_VERTEXES_PER_TASK = 4096;
+
+//! Number of vertices unpacked and transformed by each batch of a task, so the vertices
+//! written by the unpacking are still in the cache for the transforms
+static const unsigned int COMBINE_TRANSFORM_VERTEXES_PER_BATCH = 256;
+
+//! Parameters of the transformation of the input meshes
+struct CombineTransformJob
+{
+    const MeshData * mInputs[CombineTransformOperator::MaxCombineTransformInputs];          //!< Input meshes, nullptr when missing
+    unsigned int mVertexSummedCounts[CombineTransformOperator::MaxCombineTransformInputs];  //!< Vertex count of the inputs before each one
+    unsigned int mInputCount;                                                               //!< Number of inputs
+    StdVertex * mOutputVertex;                                                              //!< Vertices of the combined mesh
+    const Math::Mat44 * mMatrices;                                                          //!< Transform of each input
+    const Math::Mat33 * mNormalMatrices;                                                    //!< Normal transform of each input
+};
+
+//! Unpack and transform a range of vertices of the combined mesh, split at the input boundaries and in batches
+//! \param userData CombineTransformJob
+//! \param begin First vertex of the combined mesh
+//! \param end Vertex after the last one
+static void CombineTransformVertexRange(void * userData, unsigned int begin, unsigned int end)
 {
-    for (int v = 0; v < count; ++v)
+    const CombineTransformJob * job = static_cast<const CombineTransformJob *>(userData);
+    unsigned int i = 0;
+    while (begin < end)
     {
-        Math::Mult44_41(outputDest[v].position, targetTransform, input[v].position);
-        Math::Mult33_31(outputDest[v].normal, targetNormalTransform, input[v].normal);
-        float len = Math::Length(outputDest[v].normal);
-        if (Math::Abs(len) > PFLOAT_EPSILON)
+        //find the input of the first vertex, the missing inputs having no vertex
+        unsigned int inputEnd = 0;
+        for (;; ++i)
         {
-            outputDest[v].normal /= len;
+            PG_ASSERT(i < job->mInputCount);
+            if (job->mInputs[i] != nullptr)
+            {
+                inputEnd = job->mVertexSummedCounts[i] + static_cast<unsigned int>(job->mInputs[i]->GetVertexCount());
+                if (begin < inputEnd)
+                {
+                    break;
+                }
+            }
         }
-        
-        outputDest[v].uv = input[v].uv;
-    }
-}
+        unsigned int count = ((end < inputEnd) ? end : inputEnd) - begin;
+        count = (count < COMBINE_TRANSFORM_VERTEXES_PER_BATCH) ? count : COMBINE_TRANSFORM_VERTEXES_PER_BATCH;
 
-static void AppendIndices(const unsigned short* inputIndices, unsigned short* outputIndices, int count, short newOffset)
-{
-    for (int i = 0; i < count; ++i)
-    {
-        outputIndices[i] = inputIndices[i] + newOffset;
+        //transformed in place, once unpacked if needed
+        StdVertex * dst = job->mOutputVertex + begin;
+        job->mInputs[i]->GetStdVertexes(dst, static_cast<int>(begin - job->mVertexSummedCounts[i]), static_cast<int>(count));
+        Math::TransformPositions(&dst->position, sizeof(StdVertex), &dst->position, sizeof(StdVertex), count, job->mMatrices[i]);
+        Math::TransformNormals(&dst->normal, sizeof(StdVertex), &dst->normal, sizeof(StdVertex), count, job->mNormalMatrices[i], true);
+        begin += count;
     }
 }
 
@@ -93,9 +125,15 @@ void CombineTransformOperator::GenerateData()
     Math::Mat33 normalMatrices[MaxCombineTransformInputs];
     GenerateMatrices(matrices, normalMatrices);
 
-    unsigned int indexSummedCounts[MaxCombineTransformInputs];//holds counts of everything before
-    unsigned int vertexSummedCounts[MaxCombineTransformInputs]; //holds counts of everything before
-    unsigned int currentIndexCount = 0;
+    CombineTransformJob job;
+    job.mInputCount = GetNumInputs();
+    job.mMatrices = matrices;
+    job.mNormalMatrices = normalMatrices;
+
+    //the combined mesh has the levels of detail of its most detailed input, the inputs
+    //with fewer levels repeating their last one in the remaining levels
+    int lodCount = 1;
+    int lodIndexCounts[MESH_MAX_LODS];
     unsigned int currentVertexCount = 0;
 
     //go for every single active child mesh and get all the counts.
@@ -103,40 +141,92 @@ void CombineTransformOperator::GenerateData()
     {
         bool updated = false;
         MeshData* inputData = static_cast<MeshData *>(&(*GetInput(i)->GetUpdatedData(updated)));
+        job.mInputs[i] = inputData;
         //TODO: Work on checking compatible format when combining.
         if (inputData != nullptr)
         {
-            indexSummedCounts[i] = currentIndexCount;
-            vertexSummedCounts[i] = currentVertexCount;
-            currentIndexCount += inputData->GetIndexCount();
+            job.mVertexSummedCounts[i] = currentVertexCount; //holds counts of everything before
             currentVertexCount += inputData->GetVertexCount();
+            lodCount = (inputData->GetLodCount() > lodCount) ? inputData->GetLodCount() : lodCount;
         }
     }
 
+    unsigned int currentIndexCount = 0;
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        lodIndexCounts[lod] = 0;
+        for (unsigned i = 0; i < GetNumInputs(); ++i)
+        {
+            const MeshData* inputData = job.mInputs[i];
+            if (inputData != nullptr)
+            {
+                const int inputLod = (lod < inputData->GetLodCount()) ? lod : inputData->GetLodCount() - 1;
+                lodIndexCounts[lod] += inputData->GetLodIndexCount(inputLod);
+            }
+        }
+        currentIndexCount += lodIndexCounts[lod];
+    }
+
     meshData->AllocateIndexes(currentIndexCount);
     meshData->AllocateVertexes(currentVertexCount);
+    job.mOutputVertex = meshData->GetStream<StdVertex>(0);
+    unsigned int* outputIndices = meshData->GetIndexBuffer();
 
-    StdVertex* outputVertData = meshData->GetStream<StdVertex>(0);
-    unsigned short* outputIndices = meshData->GetIndexBuffer();
+    //the indices are copied here, grouped by level of detail, the vertices of all the inputs are transformed in parallel
+    unsigned int* currentIndexOutput = outputIndices;
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        for (unsigned i = 0; i < GetNumInputs(); ++i)
+        {
+            const MeshData* inputData = job.mInputs[i];
+            if (inputData != nullptr)
+            {
+                const int inputLod = (lod < inputData->GetLodCount()) ? lod : inputData->GetLodCount() - 1;
+                const int inputLodIndexCount = inputData->GetLodIndexCount(inputLod);
+                inputData->GetIndexes(currentIndexOutput, inputData->GetLodIndexOffset(inputLod), inputLodIndexCount, job.mVertexSummedCounts[i]);
+                currentIndexOutput += inputLodIndexCount;
+            }
+        }
+    }
+    meshData->SetLodIndexCounts(lodIndexCounts, lodCount);
 
-    //go for every single active child mesh and get all the counts.
-    for (unsigned i = 0; i < GetNumInputs(); ++i)
+    if (currentVertexCount > 0)
     {
-        bool updated = false;
-        MeshData* inputData = static_cast<MeshData *>(&(*GetInput(i)->GetUpdatedData(updated)));
-        Math::Mat44& targetTransform = matrices[i];
-        Math::Mat33& targetNormalTransform = normalMatrices[i];
-        if (inputData != nullptr)
+        Core::ParallelFor(currentVertexCount, COMBINE_TRANSFORM_MIN_VERTEXES_PER_TASK, CombineTransformVertexRange, &job);
+    }
+
+    //the bounds are the union of the transformed bounds of the inputs, so the vertices are not read again
+    Math::AxisAlignedBoundingBox boundingBox;
+    Math::BoundingSphere boundingSphere;
+    bool hasBounds = false;
+    bool areBoundsValid = true;
+    for (unsigned i = 0; i < GetNumInputs() && areBoundsValid; ++i)
+    {
+        const MeshData* inputData = job.mInputs[i];
+        if (inputData != nullptr && inputData->GetVertexCount() > 0)
         {
-            const StdVertex* inputVertData = inputData->GetStream<StdVertex>(0);
-            StdVertex* currentMeshOutput = outputVertData + vertexSummedCounts[i];
-            TransformAppendMesh(inputVertData, currentMeshOutput, inputData->GetVertexCount(), targetTransform, targetNormalTransform);
-            
-            const unsigned short* inputIndices = inputData->GetIndexBuffer();
-            unsigned short* currentIndexOutput = outputIndices + indexSummedCounts[i];
-            AppendIndices(inputIndices, currentIndexOutput, inputData->GetIndexCount(), vertexSummedCounts[i]);
+            areBoundsValid = inputData->AreBoundsValid();
+            Math::AxisAlignedBoundingBox inputBox(inputData->GetBoundingBox());
+            Math::BoundingSphere inputSphere(inputData->GetBoundingSphere());
+            inputBox.Transform(matrices[i]);
+            inputSphere.Transform(matrices[i]);
+            if (hasBounds)
+            {
+                boundingBox.SetMinMax(Math::Min(boundingBox.GetMin(), inputBox.GetMin()), Math::Max(boundingBox.GetMax(), inputBox.GetMax()));
+                boundingSphere.Union(inputSphere);
+            }
+            else
+            {
+                boundingBox = inputBox;
+                boundingSphere = inputSphere;
+                hasBounds = true;
+            }
         }
     }
+    if (hasBounds && areBoundsValid)
+    {
+        meshData->SetBounds(boundingBox, boundingSphere);
+    }
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
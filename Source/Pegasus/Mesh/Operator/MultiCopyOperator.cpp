@@ -10,10 +10,58 @@
 //! \brief	MultiCopyOperator
 #include "Pegasus/Mesh/Operator/MultiCopyOperator.h"
 #include "Pegasus/Math/Quaternion.h"
+#include "Pegasus/Math/BatchTransform.h"
+#include "Pegasus/Core/WorkerPool.h"
 
 namespace Pegasus {
 namespace Mesh {
 
+//! Maximum number of copies
+static const int MULTI_COPY_MAX_FACTOR = 64;
+
+//! Minimum number of vertices transformed by each task of the copies
+static const unsigned int MULTI_COPY_MIN_VERTEXES_PER_TASK = 4096;
+
+//! Number of vertices transformed by each batch of a task, the positions, normals and uvs being
+//! written by separate passes that have to find the vertices in the cache
+static const unsigned int MULTI_COPY_VERTEXES_PER_BATCH = 256;
+
+//! Parameters of the transformation of the copies
+struct MultiCopyJob
+{
+    const StdVertex * mInputVertex;                     //!< Vertices of the first copy, source of the other ones
+    StdVertex * mOutputVertex;                          //!< Vertices of all the copies
+    unsigned int mVertexCount;                          //!< Number of vertices per copy
+    const Math::Mat44 * mMatrices;                      //!< Transform of each copy
+    const Math::Mat33 * mNormalMatrices;                //!< Normal transform of each copy
+};
+
+//! Transform a range of vertices of the copies, split at the copy boundaries and in batches
+//! \param userData MultiCopyJob
+//! \param begin First vertex, counting from the second copy
+//! \param end Vertex after the last one, counting from the second copy
+static void MultiCopyVertexRange(void * userData, unsigned int begin, unsigned int end)
+{
+    const MultiCopyJob * job = static_cast<const MultiCopyJob *>(userData);
+    while (begin < end)
+    {
+        const unsigned int copy = 1 + begin / job->mVertexCount;
+        const unsigned int first = begin % job->mVertexCount;
+        unsigned int count = (end - begin < job->mVertexCount - first) ? end - begin : job->mVertexCount - first;
+        count = (count < MULTI_COPY_VERTEXES_PER_BATCH) ? count : MULTI_COPY_VERTEXES_PER_BATCH;
+
+        const StdVertex * src = job->mInputVertex + first;
+        StdVertex * dst = job->mOutputVertex + copy * job->mVertexCount + first;
+        Math::TransformPositions(&dst->position, sizeof(StdVertex), &src->position, sizeof(StdVertex), count, job->mMatrices[copy]);
+        Math::TransformNormals(&dst->normal, sizeof(StdVertex), &src->normal, sizeof(StdVertex), count, job->mNormalMatrices[copy], false);
+        for (unsigned int v = 0; v < count; ++v)
+        {
+            dst[v].uv = src[v].uv;
+        }
+        begin += count;
+    }
+}
+
 
 //! Property implementations
 BEGIN_IMPLEMENT_PROPERTIES(MultiCopyOperator)
@@ -45,44 +93,36 @@ void MultiCopyOperator::GenerateData()
 {
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
 
-    //generate matrices
+    //generate matrices, one per copy
+    Math::Mat44 matrices[MULTI_COPY_MAX_FACTOR];
+    Math::Mat33 normalMatrices[MULTI_COPY_MAX_FACTOR];
     Math::Mat44 mat = Math::MAT44_IDENTITY;
     Math::Mat33 normMat = Math::MAT33_IDENTITY;
 
     int iterCount = GetMultiCopyFactor();
-    if (iterCount <= 1 || iterCount > 64)
+    if (iterCount <= 1 || iterCount > MULTI_COPY_MAX_FACTOR)
     {
         PG_LOG('ERR_', "MultiCopyFactor not allowed to be below 1 or above 64.");
         iterCount = 1;
     }
     bool updated = false;
     MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
-    const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
-    const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
 
     MeshDataRef meshData = GetData();
     PG_ASSERT(meshData != nullptr); 
     meshData->AllocateVertexes(inputMesh->GetVertexCount() * iterCount);
     meshData->AllocateIndexes(inputMesh->GetIndexCount() * iterCount);
     StdVertex* outputVertex = meshData->GetStream<StdVertex>(0);
-    unsigned short* outputIndexes = meshData->GetIndexBuffer();
+    unsigned int* outputIndexes = meshData->GetIndexBuffer();
+
+    //the first copy, with the identity transform, is the input mesh unpacked if needed, and the source of the other copies
+    const StdVertex* inputVertex = outputVertex;
+    inputMesh->GetStdVertexes(outputVertex, 0, inputMesh->GetVertexCount());
 
     for (int i = 0; i < iterCount; ++i)
     {
-        //transform current mesh
-        for (int v = 0; v < inputMesh->GetVertexCount(); ++v)
-        {
-            int vIdx = i*inputMesh->GetVertexCount() + v;
-            Math::Mult44_41(outputVertex[vIdx].position, mat, inputVertex[v].position);
-            Math::Mult33_31(outputVertex[vIdx].normal, normMat, inputVertex[v].normal);
-            outputVertex[vIdx].uv = inputVertex[v].uv;
-        }
-
-        for (int k = 0; k < inputMesh->GetIndexCount(); ++k)
-        {
-           int kIdx =  i*inputMesh->GetIndexCount() + k; 
-           outputIndexes[kIdx] = inputIndexes[k] + i*inputMesh->GetVertexCount();
-        }
+        matrices[i] = mat;
+        normalMatrices[i] = normMat;
 
         //prepare transforms for next iteration
         Math::Mat44 newTransform;
@@ -119,6 +159,50 @@ void MultiCopyOperator::GenerateData()
         Math::Mult33_33(normMat, normMat, newNormTransform);
     }
 
+    //the indices of the copies are grouped by level of detail, so each level draws all the copies
+    int lodIndexCounts[MESH_MAX_LODS];
+    int outputIndexCount = 0;
+    for (int lod = 0; lod < inputMesh->GetLodCount(); ++lod)
+    {
+        const int lodIndexOffset = inputMesh->GetLodIndexOffset(lod);
+        const int lodIndexCount = inputMesh->GetLodIndexCount(lod);
+        for (int i = 0; i < iterCount; ++i)
+        {
+            inputMesh->GetIndexes(outputIndexes + outputIndexCount, lodIndexOffset, lodIndexCount, i*inputMesh->GetVertexCount());
+            outputIndexCount += lodIndexCount;
+        }
+        lodIndexCounts[lod] = lodIndexCount * iterCount;
+    }
+    meshData->SetLodIndexCounts(lodIndexCounts, inputMesh->GetLodCount());
+
+    //transform the copies after the first one, already in place, in parallel
+    if (iterCount > 1 && inputMesh->GetVertexCount() > 0)
+    {
+        MultiCopyJob job;
+        job.mInputVertex = inputVertex;
+        job.mOutputVertex = outputVertex;
+        job.mVertexCount = static_cast<unsigned int>(inputMesh->GetVertexCount());
+        job.mMatrices = matrices;
+        job.mNormalMatrices = normalMatrices;
+        Core::ParallelFor(job.mVertexCount * (iterCount - 1), MULTI_COPY_MIN_VERTEXES_PER_TASK, MultiCopyVertexRange, &job);
+    }
+
+    //the bounds are the union of the transformed bounds of the input, so the vertices are not read again
+    if (inputMesh->AreBoundsValid() && inputMesh->GetVertexCount() > 0)
+    {
+        Math::AxisAlignedBoundingBox boundingBox(inputMesh->GetBoundingBox());
+        Math::BoundingSphere boundingSphere(inputMesh->GetBoundingSphere());
+        for (int i = 1; i < iterCount; ++i)
+        {
+            Math::AxisAlignedBoundingBox copyBox(inputMesh->GetBoundingBox());
+            Math::BoundingSphere copySphere(inputMesh->GetBoundingSphere());
+            copyBox.Transform(matrices[i]);
+            copySphere.Transform(matrices[i]);
+            boundingBox.SetMinMax(Math::Min(boundingBox.GetMin(), copyBox.GetMin()), Math::Max(boundingBox.GetMax(), copyBox.GetMax()));
+            boundingSphere.Union(copySphere);
+        }
+        meshData->SetBounds(boundingBox, boundingSphere);
+    }
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
@@ -0,0 +1,177 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimplifyOperator.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  SimplifyOperator
+#include "Pegasus/Mesh/Operator/SimplifyOperator.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+//! Size of the vertex cache the triangles of each level are reordered for
+static const int SIMPLIFY_VERTEX_CACHE_SIZE = 32;
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(SimplifyOperator)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodCount)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodTriangleRatio)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodMaxError)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodNormalWeight)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodUvWeight)
+END_IMPLEMENT_PROPERTIES(SimplifyOperator)
+
+
+SimplifyOperator::SimplifyOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+              Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshOperator(nodeAllocator, nodeDataAllocator),
+  mLodCount(0)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(SimplifyOperator)
+        INIT_PROPERTY(LodCount)
+        INIT_PROPERTY(LodTriangleRatio)
+        INIT_PROPERTY(LodMaxError)
+        INIT_PROPERTY(LodNormalWeight)
+        INIT_PROPERTY(LodUvWeight)
+    END_INIT_PROPERTIES()
+
+    for (int l = 0; l < MESH_MAX_LODS; ++l)
+    {
+        mLodTriangleCounts[l] = 0;
+        mLodErrors[l] = 0.0f;
+    }
+}
+
+SimplifyOperator::~SimplifyOperator()
+{
+}
+
+void SimplifyOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    int lodCount = GetLodCount();
+    if (lodCount < 1 || lodCount > MESH_MAX_LODS)
+    {
+        PG_LOG('ERR_', "LodCount not allowed to be below 1 or above %d.", MESH_MAX_LODS);
+        lodCount = lodCount < 1 ? 1 : MESH_MAX_LODS;
+    }
+    float triangleRatio = GetLodTriangleRatio();
+    if (triangleRatio <= 0.0f || triangleRatio >= 1.0f)
+    {
+        PG_LOG('ERR_', "LodTriangleRatio has to be between 0 and 1 excluded, using 0.5.");
+        triangleRatio = 0.5f;
+    }
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    const int vertexCount = inputMesh->GetVertexCount();
+
+    // Only the most detailed level of the input is simplified
+    const int indexCount = inputMesh->GetLodIndexCount(0);
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+    meshData->CopyContent(*inputMesh);
+
+    // The errors are measured on the attributes of the standard vertex, which has to be the only stream
+    bool isStandardLayout = inputMesh->IsPacked() || inputMesh->GetStreamStride(0) == sizeof(StdVertex);
+    for (int s = 1; s < MESH_MAX_STREAMS; ++s)
+    {
+        isStandardLayout = isStandardLayout && inputMesh->GetStreamStride(s) == 0;
+    }
+    if (!isStandardLayout || GetConfiguration().GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE
+        || !GetConfiguration().GetIsIndexed() || (indexCount % 3) != 0)
+    {
+        PG_LOG('ERR_', "SimplifyOperator only simplifies indexed triangle lists with the standard vertex layout, the input mesh is copied as is.");
+        mLodCount = 0;
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_FAIL);
+        return;
+    }
+
+    Alloc::IAllocator * allocator = GetNodeAllocator();
+    StdVertex * unpackedVertex = nullptr;
+    const StdVertex * inputVertex = nullptr;
+    if (inputMesh->IsPacked())
+    {
+        unpackedVertex = PG_NEW_ARRAY(allocator, -1, "SimplifyOperator::unpackedVertex", Alloc::PG_MEM_TEMP, StdVertex, vertexCount);
+        inputMesh->GetStdVertexes(unpackedVertex, 0, vertexCount);
+        inputVertex = unpackedVertex;
+    }
+    else
+    {
+        inputVertex = inputMesh->GetStream<StdVertex>(0);
+    }
+
+    // Every level is simplified from the input triangles, so its error is measured against the input
+    unsigned int * lodIndexes[MESH_MAX_LODS];
+    int lodIndexCounts[MESH_MAX_LODS];
+    lodIndexes[0] = PG_NEW_ARRAY(allocator, -1, "SimplifyOperator::lodIndexes", Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    lodIndexCounts[0] = indexCount;
+    inputMesh->GetIndexes(lodIndexes[0], 0, indexCount, 0);
+    mLodTriangleCounts[0] = indexCount / 3;
+    mLodErrors[0] = 0.0f;
+    mLodCount = 1;
+
+    unsigned int * simplified = PG_NEW_ARRAY(allocator, -1, "SimplifyOperator::simplified", Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    float targetTriangleCount = static_cast<float>(indexCount / 3);
+    int totalIndexCount = indexCount;
+    while (mLodCount < lodCount)
+    {
+        targetTriangleCount *= triangleRatio;
+        float error = 0.0f;
+        const int simplifiedCount = SimplifyMesh(simplified, lodIndexes[0], indexCount, inputVertex, vertexCount,
+                                                 3 * static_cast<int>(targetTriangleCount), GetLodMaxError(),
+                                                 GetLodNormalWeight(), GetLodUvWeight(), &error, allocator);
+
+        // Stop when the error bound prevents any further simplification
+        if (simplifiedCount == 0 || simplifiedCount >= lodIndexCounts[mLodCount - 1])
+        {
+            break;
+        }
+
+        lodIndexes[mLodCount] = PG_NEW_ARRAY(allocator, -1, "SimplifyOperator::lodIndexes", Alloc::PG_MEM_TEMP, unsigned int, simplifiedCount);
+        OptimizeVertexCache(lodIndexes[mLodCount], simplified, simplifiedCount, vertexCount, SIMPLIFY_VERTEX_CACHE_SIZE, allocator);
+        lodIndexCounts[mLodCount] = simplifiedCount;
+        mLodTriangleCounts[mLodCount] = simplifiedCount / 3;
+        mLodErrors[mLodCount] = error;
+        totalIndexCount += simplifiedCount;
+        ++mLodCount;
+    }
+    PG_DELETE_ARRAY(allocator, simplified);
+    if (unpackedVertex != nullptr)
+    {
+        PG_DELETE_ARRAY(allocator, unpackedVertex);
+    }
+
+    // The levels are stored one after the other, the input level first and unchanged
+    meshData->AllocateIndexes(totalIndexCount);
+    unsigned int * outputIndexes = meshData->GetIndexBuffer();
+    for (int l = 0; l < mLodCount; ++l)
+    {
+        for (int i = 0; i < lodIndexCounts[l]; ++i)
+        {
+            *outputIndexes++ = lodIndexes[l][i];
+        }
+        PG_DELETE_ARRAY(allocator, lodIndexes[l]);
+    }
+    meshData->SetLodIndexCounts(lodIndexCounts, mLodCount);
+
+    for (int l = 1; l < mLodCount; ++l)
+    {
+        PG_LOG('MESH', "Simplification level %d: %d -> %d triangles, error %.5f", l, mLodTriangleCounts[0], mLodTriangleCounts[l], mLodErrors[l]);
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+}
+}
@@ -0,0 +1,143 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VertexCacheOperator.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  VertexCacheOperator
+#include "Pegasus/Mesh/Operator/VertexCacheOperator.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(VertexCacheOperator)
+    IMPLEMENT_PROPERTY(VertexCacheOperator, VertexCacheSize)
+END_IMPLEMENT_PROPERTIES(VertexCacheOperator)
+
+
+VertexCacheOperator::VertexCacheOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+              Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshOperator(nodeAllocator, nodeDataAllocator),
+  mInputACMR(0.0f),
+  mOutputACMR(0.0f)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(VertexCacheOperator)
+        INIT_PROPERTY(VertexCacheSize)
+    END_INIT_PROPERTIES()
+}
+
+VertexCacheOperator::~VertexCacheOperator()
+{
+}
+
+void VertexCacheOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    int cacheSize = GetVertexCacheSize();
+    if (cacheSize < 4 || cacheSize > MESH_OPTIMIZER_MAX_CACHE_SIZE)
+    {
+        PG_LOG('ERR_', "VertexCacheSize not allowed to be below 4 or above %d.", MESH_OPTIMIZER_MAX_CACHE_SIZE);
+        cacheSize = cacheSize < 4 ? 4 : MESH_OPTIMIZER_MAX_CACHE_SIZE;
+    }
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    const int indexCount = inputMesh->GetIndexCount();
+    const int vertexCount = inputMesh->GetVertexCount();
+
+    const int lodCount = inputMesh->GetLodCount();
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+
+    bool areTriangleLists = true;
+    int lodIndexCounts[MESH_MAX_LODS];
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        lodIndexCounts[lod] = inputMesh->GetLodIndexCount(lod);
+        areTriangleLists = areTriangleLists && (lodIndexCounts[lod] % 3) == 0;
+    }
+
+    if (GetConfiguration().GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE
+        || !GetConfiguration().GetIsIndexed() || !areTriangleLists)
+    {
+        PG_LOG('ERR_', "VertexCacheOperator only reorders indexed triangle lists, the input mesh is copied as is.");
+        meshData->CopyContent(*inputMesh);
+        mInputACMR = mOutputACMR = 0.0f;
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_FAIL);
+        return;
+    }
+
+    // The input indices are widened to 32-bit and the output ones stay in 32-bit until FinalizeData()
+    Alloc::IAllocator * allocator = GetNodeAllocator();
+    unsigned int * inputIndexes = PG_NEW_ARRAY(allocator, -1, "VertexCacheOperator::inputIndexes", Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    unsigned int * remap = PG_NEW_ARRAY(allocator, -1, "VertexCacheOperator::remap", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    inputMesh->GetIndexes(inputIndexes, 0, indexCount, 0);
+    mInputACMR = ComputeACMR(inputIndexes, indexCount, vertexCount, cacheSize, allocator);
+
+    // Each level of detail is reordered on its own, then the vertices shared by the levels
+    // are renumbered in their order of first use, the most detailed level first
+    meshData->AllocateIndexes(indexCount);
+    unsigned int * outputIndexes = meshData->GetIndexBuffer();
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        const int lodIndexOffset = inputMesh->GetLodIndexOffset(lod);
+        OptimizeVertexCache(outputIndexes + lodIndexOffset, inputIndexes + lodIndexOffset, lodIndexCounts[lod], vertexCount, cacheSize, allocator);
+    }
+    meshData->SetLodIndexCounts(lodIndexCounts, lodCount);
+    const int usedVertexCount = OptimizeVertexFetch(remap, outputIndexes, indexCount, vertexCount);
+
+    // Move the used vertices of every stream to their new position
+    meshData->AllocateVertexes(usedVertexCount);
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int stride = inputMesh->GetStreamStride(s);
+        if (s == 0 && inputMesh->IsPacked())
+        {
+            // Unpacked, to be packed again by FinalizeData()
+            StdVertex * outputVertex = meshData->GetStream<StdVertex>(0);
+            for (int v = 0; v < vertexCount; ++v)
+            {
+                if (remap[v] < static_cast<unsigned int>(usedVertexCount))
+                {
+                    inputMesh->GetStdVertexes(outputVertex + remap[v], v, 1);
+                }
+            }
+        }
+        else if (stride > 0)
+        {
+            PG_ASSERTSTR(meshData->GetStreamStride(s) == stride, "The input and output meshes must have the same input layout");
+            const char * inputVertex = static_cast<const char *>(inputMesh->GetStream<void>(s));
+            char * outputVertex = static_cast<char *>(meshData->GetStream<void>(s));
+            for (int v = 0; v < vertexCount; ++v)
+            {
+                if (remap[v] < static_cast<unsigned int>(usedVertexCount))
+                {
+                    Pegasus::Utils::Memcpy(outputVertex + remap[v] * stride, inputVertex + v * stride, stride);
+                }
+            }
+        }
+    }
+
+    mOutputACMR = ComputeACMR(outputIndexes, indexCount, usedVertexCount, cacheSize, allocator);
+    PG_LOG('MESH', "Vertex cache optimization of %d triangles: ACMR %.3f -> %.3f, %d unused vertices removed",
+           indexCount / 3, mInputACMR, mOutputACMR, vertexCount - usedVertexCount);
+
+    PG_DELETE_ARRAY(allocator, remap);
+    PG_DELETE_ARRAY(allocator, inputIndexes);
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+}
+}
@@ -0,0 +1,173 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VertexWeldOperator.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  VertexWeldOperator
+#include "Pegasus/Mesh/Operator/VertexWeldOperator.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(VertexWeldOperator)
+    IMPLEMENT_PROPERTY(VertexWeldOperator, WeldPositionTolerance)
+    IMPLEMENT_PROPERTY(VertexWeldOperator, WeldNormalTolerance)
+    IMPLEMENT_PROPERTY(VertexWeldOperator, WeldUvTolerance)
+END_IMPLEMENT_PROPERTIES(VertexWeldOperator)
+
+
+VertexWeldOperator::VertexWeldOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+              Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshOperator(nodeAllocator, nodeDataAllocator),
+  mInputVertexCount(0),
+  mOutputVertexCount(0)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(VertexWeldOperator)
+        INIT_PROPERTY(WeldPositionTolerance)
+        INIT_PROPERTY(WeldNormalTolerance)
+        INIT_PROPERTY(WeldUvTolerance)
+    END_INIT_PROPERTIES()
+}
+
+VertexWeldOperator::~VertexWeldOperator()
+{
+}
+
+void VertexWeldOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    float positionTolerance = GetWeldPositionTolerance();
+    float normalTolerance = GetWeldNormalTolerance();
+    float uvTolerance = GetWeldUvTolerance();
+    if (positionTolerance <= 0.0f || normalTolerance <= 0.0f || uvTolerance <= 0.0f)
+    {
+        PG_LOG('ERR_', "Weld tolerances not allowed to be 0 or below, using the default ones.");
+        positionTolerance = 0.0001f;
+        normalTolerance = 0.001f;
+        uvTolerance = 0.0001f;
+    }
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    const int indexCount = inputMesh->GetIndexCount();
+    const int vertexCount = inputMesh->GetVertexCount();
+    mInputVertexCount = vertexCount;
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+
+    // The welding compares the attributes of the standard vertex, which has to be the only stream
+    bool isStandardLayout = inputMesh->IsPacked() || inputMesh->GetStreamStride(0) == sizeof(StdVertex);
+    for (int s = 1; s < MESH_MAX_STREAMS; ++s)
+    {
+        isStandardLayout = isStandardLayout && inputMesh->GetStreamStride(s) == 0;
+    }
+    if (!isStandardLayout || !GetConfiguration().GetIsIndexed())
+    {
+        PG_LOG('ERR_', "VertexWeldOperator only welds indexed meshes with the standard vertex layout, the input mesh is copied as is.");
+        meshData->CopyContent(*inputMesh);
+        mOutputVertexCount = vertexCount;
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_FAIL);
+        return;
+    }
+
+    Alloc::IAllocator * allocator = GetNodeAllocator();
+    unsigned int * remap = PG_NEW_ARRAY(allocator, -1, "VertexWeldOperator::remap", Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    StdVertex * unpackedVertex = nullptr;
+    const StdVertex * inputVertex = nullptr;
+    if (inputMesh->IsPacked())
+    {
+        unpackedVertex = PG_NEW_ARRAY(allocator, -1, "VertexWeldOperator::unpackedVertex", Alloc::PG_MEM_TEMP, StdVertex, vertexCount);
+        inputMesh->GetStdVertexes(unpackedVertex, 0, vertexCount);
+        inputVertex = unpackedVertex;
+    }
+    else
+    {
+        inputVertex = inputMesh->GetStream<StdVertex>(0);
+    }
+    mOutputVertexCount = WeldVertexes(remap, inputVertex, vertexCount, positionTolerance, normalTolerance, uvTolerance, allocator);
+
+    // The first vertex of each welded group is kept, the groups being numbered in the order of their first vertex
+    meshData->AllocateVertexes(mOutputVertexCount);
+    StdVertex * outputVertex = meshData->GetStream<StdVertex>(0);
+    int nextVertex = 0;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        if (remap[v] == static_cast<unsigned int>(nextVertex))
+        {
+            outputVertex[nextVertex++] = inputVertex[v];
+        }
+    }
+    PG_ASSERT(nextVertex == mOutputVertexCount);
+    if (unpackedVertex != nullptr)
+    {
+        PG_DELETE_ARRAY(allocator, unpackedVertex);
+    }
+
+    // Remap the indices, dropping the triangles that lost their area, level of detail by level of detail
+    unsigned int * indexes = PG_NEW_ARRAY(allocator, -1, "VertexWeldOperator::indexes", Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    inputMesh->GetIndexes(indexes, 0, indexCount, 0);
+    const int lodCount = inputMesh->GetLodCount();
+    int lodIndexCounts[MESH_MAX_LODS];
+    int outputIndexCount = 0;
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        const int lodBegin = inputMesh->GetLodIndexOffset(lod);
+        const int lodEnd = lodBegin + inputMesh->GetLodIndexCount(lod);
+        const int lodOutputBegin = outputIndexCount;
+        if (GetConfiguration().GetMeshPrimitiveType() == MeshConfiguration::TRIANGLE)
+        {
+            for (int i = lodBegin; i + 2 < lodEnd; i += 3)
+            {
+                const unsigned int a = remap[indexes[i]];
+                const unsigned int b = remap[indexes[i + 1]];
+                const unsigned int c = remap[indexes[i + 2]];
+                if (a != b && b != c && c != a)
+                {
+                    indexes[outputIndexCount++] = a;
+                    indexes[outputIndexCount++] = b;
+                    indexes[outputIndexCount++] = c;
+                }
+            }
+        }
+        else
+        {
+            for (int i = lodBegin; i < lodEnd; ++i)
+            {
+                indexes[outputIndexCount++] = remap[indexes[i]];
+            }
+        }
+        lodIndexCounts[lod] = outputIndexCount - lodOutputBegin;
+    }
+
+    meshData->AllocateIndexes(outputIndexCount);
+    if (outputIndexCount > 0)
+    {
+        Pegasus::Utils::Memcpy(meshData->GetIndexBuffer(), indexes, outputIndexCount * sizeof(unsigned int));
+    }
+    meshData->SetLodIndexCounts(lodIndexCounts, lodCount);
+
+    PG_LOG('MESH', "Vertex welding: %d -> %d vertices (%d -> %d bytes), %d collapsed triangles removed",
+           vertexCount, mOutputVertexCount,
+           vertexCount * static_cast<int>(sizeof(StdVertex)), mOutputVertexCount * static_cast<int>(sizeof(StdVertex)),
+           (indexCount - outputIndexCount) / 3);
+
+    PG_DELETE_ARRAY(allocator, indexes);
+    PG_DELETE_ARRAY(allocator, remap);
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+}
+}
@@ -58,18 +58,24 @@ void WaveFieldOperator::GenerateData()
     
     bool updated = false;
     MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
-    const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
-    const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
 
     MeshDataRef meshData = GetData();
     PG_ASSERT(meshData != nullptr); 
     meshData->AllocateVertexes(inputMesh->GetVertexCount());
     meshData->AllocateIndexes(inputMesh->GetIndexCount());
     StdVertex* outputVertex = meshData->GetStream<StdVertex>(0);
-    unsigned short* outputIndexes = meshData->GetIndexBuffer();
 
-    //copy indexes, which are exact replicas.
-    Utils::Memcpy(outputIndexes, inputIndexes, sizeof(unsigned short)*meshData->GetIndexCount());
+    //copy vertexes, unpacked if needed, then displaced in place
+    inputMesh->GetStdVertexes(outputVertex, 0, inputMesh->GetVertexCount());
+
+    //copy indexes, which are exact replicas, with their levels of detail.
+    inputMesh->GetIndexes(meshData->GetIndexBuffer(), 0, inputMesh->GetIndexCount(), 0);
+    int lodIndexCounts[MESH_MAX_LODS];
+    for (int lod = 0; lod < inputMesh->GetLodCount(); ++lod)
+    {
+        lodIndexCounts[lod] = inputMesh->GetLodIndexCount(lod);
+    }
+    meshData->SetLodIndexCounts(lodIndexCounts, inputMesh->GetLodCount());
 
     //setup FFT waves
     Math::Vec3 waveParams[NumOfWaves];
@@ -81,7 +87,7 @@ void WaveFieldOperator::GenerateData()
     bool isRadial = GetWFIsRadial() > 0;
     for (int v = 0; v < meshData->GetVertexCount(); ++v)
     {
-        const Math::Vec4& p4 = inputVertex[v].position;
+        const Math::Vec4& p4 = outputVertex[v].position;
         Math::Vec3 p3(p4.x,p4.y,p4.z);
 
         float t = Math::Dot(p3, timeDir);
@@ -108,11 +114,9 @@ void WaveFieldOperator::GenerateData()
             }
             waveDispDir = radialDisp;
         }
-        outputVertex[v].position = inputVertex[v].position + Math::Vec4(d*waveDispDir,0.0f);
+        outputVertex[v].position = p4 + Math::Vec4(d*waveDispDir,0.0f);
 
         //todo, reconstruct normals
-        outputVertex[v].normal = inputVertex[v].normal;
-        outputVertex[v].uv = inputVertex[v].uv;
     }
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
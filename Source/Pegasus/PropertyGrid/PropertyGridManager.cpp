@@ -16,6 +16,13 @@ namespace Pegasus {
 namespace PropertyGrid {
 
 
+//! Number of class and enum infos allocated up front. The registered classes keep the address
+//! of their info from the static initialization on (sClassInfo), so the tables are never relocated
+static const unsigned int MAX_NUM_CLASS_INFOS = 256;
+static const unsigned int MAX_NUM_ENUM_INFOS = 64;
+
+//----------------------------------------------------------------------------------------
+
 PropertyGridManager::PropertyGridManager()
 :   mClassInfos(&PropertyGridStaticAllocator::GetInstance()),
     mEnumInfos(&PropertyGridStaticAllocator::GetInstance()),
@@ -25,6 +32,8 @@ PropertyGridManager::PropertyGridManager()
 ,   mProxy()
 #endif
 {
+    mClassInfos.Reserve(MAX_NUM_CLASS_INFOS);
+    mEnumInfos.Reserve(MAX_NUM_ENUM_INFOS);
 }
 
 //----------------------------------------------------------------------------------------
@@ -65,6 +74,10 @@ void PropertyGridManager::BeginDeclareProperties(const char * className, const c
 
 void PropertyGridManager::ResolveInternalClassHierarchy()
 {
+    // The classes are declared before main(), when the assertions are not reported yet
+    PG_ASSERTSTR(mClassInfos.GetSize() <= MAX_NUM_CLASS_INFOS, "Too many property grid classes (%u), increase MAX_NUM_CLASS_INFOS", mClassInfos.GetSize());
+    PG_ASSERTSTR(mEnumInfos.GetSize() <= MAX_NUM_ENUM_INFOS, "Too many property grid enums (%u), increase MAX_NUM_ENUM_INFOS", mEnumInfos.GetSize());
+
     // Resolve the links between the classes (to know who is the parent class of each class)
     for (unsigned int ci = 0; ci < mClassInfos.GetSize(); ++ci)
     {
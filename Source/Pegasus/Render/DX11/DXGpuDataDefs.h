@@ -18,6 +18,7 @@
 #include "Pegasus/Graph/NodeGPUData.h"
 #include "Pegasus/Shader/Shared/ShaderDefs.h"
 #include "Pegasus/Mesh/MeshInputLayout.h"
+#include "Pegasus/Mesh/MeshData.h"
 #include "Pegasus/Render/Render.h"
 
 #define MAX_UNIFORM_NAME 64
@@ -126,6 +127,7 @@ struct DXMeshGPUData
     D3D_PRIMITIVE_TOPOLOGY mTopology;
     bool mIsIndexed;
     bool mIsIndirect;
+    DXGI_FORMAT mIndexFormat;
     
     // buffer description
     DXBufferGPUData mVertexStreams[MESH_MAX_STREAMS];
@@ -148,6 +150,11 @@ struct DXMeshGPUData
 
     int mIndexCount;
     int mVertexCount;
+
+    // ranges of the indices drawn for each level of detail
+    int mLodIndexOffsets[Mesh::MESH_MAX_LODS];
+    int mLodIndexCounts[Mesh::MESH_MAX_LODS];
+    int mLodCount;
 };
 
 
@@ -91,8 +91,10 @@ Pegasus::Render::DXMeshGPUData* DXMeshFactory::GetOrAllocateGPUData(Pegasus::Mes
         meshGpuData->mTopology = D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST;
         meshGpuData->mIsIndexed = false;
         meshGpuData->mIsIndirect = false;
+        meshGpuData->mIndexFormat = DXGI_FORMAT_R16_UINT;
         meshGpuData->mVertexCount = 0;
         meshGpuData->mIndexCount = 0;
+        meshGpuData->mLodCount = 0;
 
         for (unsigned i = 0; i < MESH_MAX_STREAMS; ++i)
         {
@@ -136,7 +138,8 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
     ID3D11Device * device;
     Pegasus::Render::GetDeviceAndContext(&device, &context);
     const Pegasus::Mesh::MeshConfiguration& configuration = nodeData->GetConfiguration();
-    const Pegasus::Mesh::MeshInputLayout&   meshInputLayout = configuration.GetInputLayout();
+    //layout of the vertices as stored, the packed layout for packed meshes, decoded by the shaders
+    const Pegasus::Mesh::MeshInputLayout&   meshInputLayout = nodeData->GetInputLayout();
     Pegasus::Render::DXMeshGPUData*   meshGpuData = GetOrAllocateGPUData(nodeData);
     meshGpuData->mIsIndexed = configuration.GetIsIndexed();
     meshGpuData->mIsIndirect = configuration.GetIsDrawIndirect();
@@ -215,15 +218,29 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
     {
         Pegasus::Render::DXBufferGPUData& bufferData = meshGpuData->mIndexStream;
         D3D11_BUFFER_DESC& streamDesc = bufferData.mDesc;
-        unsigned streamByteSize = nodeData->GetIndexCount() * sizeof(unsigned short);
+        unsigned streamByteSize = nodeData->GetIndexCount() * nodeData->GetIndexStride();
+        const DXGI_FORMAT indexFormat = nodeData->GetIndexStride() == sizeof(unsigned int) ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT;
 
-        if (bufferData.mBuffer != nullptr && (streamByteSize > streamDesc.ByteWidth || (streamDesc.Usage == D3D11_USAGE_DEFAULT && !isCompute)))
+        //the views of compute index buffers depend on the index format
+        if (bufferData.mBuffer != nullptr && (streamByteSize > streamDesc.ByteWidth || (streamDesc.Usage == D3D11_USAGE_DEFAULT && !isCompute)
+                                              || (isCompute && indexFormat != meshGpuData->mIndexFormat)))
         {
             bufferData.mBuffer = nullptr;
+            bufferData.mUav = nullptr;
+            bufferData.mSrv = nullptr;
         }
+        meshGpuData->mIndexFormat = indexFormat;
 
         meshGpuData->mIndexCount = nodeData->GetIndexCount();
         PG_ASSERTSTR( nodeData->GetIndexCount() != 0, "Cannot pass 0 size index buffer. Forgot to call AllocIndices on meshData?");
+
+        //all the levels of detail are uploaded, each draw covering one of them
+        meshGpuData->mLodCount = nodeData->GetLodCount();
+        for (int lod = 0; lod < meshGpuData->mLodCount; ++lod)
+        {
+            meshGpuData->mLodIndexOffsets[lod] = nodeData->GetLodIndexOffset(lod);
+            meshGpuData->mLodIndexCounts[lod] = nodeData->GetLodIndexCount(lod);
+        }
         if (bufferData.mBuffer == nullptr)
         {
             Pegasus::Render::DXCreateBuffer(
@@ -231,7 +248,7 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
                 streamByteSize,
                 meshGpuData->mIndexCount,
                 configuration.GetIsDynamic(),
-                isCompute ? nullptr : nodeData->GetIndexBuffer(),
+                isCompute ? nullptr : const_cast<void*>(nodeData->GetIndexData()),
                 (D3D11_BIND_FLAG)(D3D11_BIND_INDEX_BUFFER | (isCompute ? (D3D11_BIND_UNORDERED_ACCESS | D3D11_BIND_SHADER_RESOURCE) : 0)),
                 bufferData
             );
@@ -242,7 +259,7 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
             if (context->Map(bufferData.mBuffer, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource) == S_OK)
             {
                 PG_ASSERTSTR(mappedResource.pData != nullptr, "map returned a null pointer of data!");
-                Pegasus::Utils::Memcpy(mappedResource.pData, nodeData->GetIndexBuffer(), streamByteSize);
+                Pegasus::Utils::Memcpy(mappedResource.pData, nodeData->GetIndexData(), streamByteSize);
                 context->Unmap(bufferData.mBuffer, 0);
             }
             else
@@ -339,7 +339,7 @@ void Pegasus::Render::SetMesh (Pegasus::Mesh::MeshInOut mesh)
             PG_ASSERT(meshGpuData->mIndexStream.mBuffer != nullptr);
             context->IASetIndexBuffer(
                 meshGpuData->mIndexStream.mBuffer,
-                DXGI_FORMAT_R16_UINT,
+                meshGpuData->mIndexFormat,
                 0 //offset
             );
         }
@@ -661,7 +661,7 @@ void Pegasus::Render::SetPrimitiveMode(Pegasus::Render::PrimitiveMode mode)
 /////////////   DRAW FUNCTION IMPLEMENTATION      /////////////////////////////
 ///////////////////////////////////////////////////////////////////////////////
 
-static void DrawInternal(unsigned int instanceCount)
+static void DrawInternal(unsigned int instanceCount, unsigned int lod)
 {
     ID3D11DeviceContext * context;
     ID3D11Device * device;
@@ -694,12 +694,15 @@ static void DrawInternal(unsigned int instanceCount)
         }   
         else
         {
+            //the levels of detail missing in the mesh are replaced by its last one
+            PG_ASSERT(mesh->mLodCount > 0);
+            const int lodIndex = (lod < static_cast<unsigned int>(mesh->mLodCount)) ? static_cast<int>(lod) : mesh->mLodCount - 1;
             if (instanceCount > 0)
             {
                 context->DrawIndexedInstanced(
-                    mesh->mIndexCount,
+                    mesh->mLodIndexCounts[lodIndex],
                     instanceCount,
-                    0,
+                    mesh->mLodIndexOffsets[lodIndex],
                     0,
                     0
                 );
@@ -707,8 +710,8 @@ static void DrawInternal(unsigned int instanceCount)
             else
             {
                 context->DrawIndexed(
-                    mesh->mIndexCount,
-                    0,
+                    mesh->mLodIndexCounts[lodIndex],
+                    mesh->mLodIndexOffsets[lodIndex],
                     0
                 );
             }
@@ -738,14 +741,19 @@ static void DrawInternal(unsigned int instanceCount)
 
 void Pegasus::Render::Draw()
 {
-    DrawInternal(0);
+    DrawInternal(0, 0);
+}
+
+void Pegasus::Render::DrawLod(unsigned int lod)
+{
+    DrawInternal(0, lod);
 }
 
 void Pegasus::Render::DrawInstanced(unsigned int instanceCount)
 {
     if (instanceCount > 0)
     {
-        DrawInternal(instanceCount);
+        DrawInternal(instanceCount, 0);
     }
 }
 
@@ -841,6 +849,7 @@ void Pegasus::Render::DXCreateBuffer(
     const bool isIndex = (bindFlags & D3D11_BIND_INDEX_BUFFER) != 0;
     const bool isStructured = (extraMiscFlags & D3D11_RESOURCE_MISC_BUFFER_STRUCTURED) != 0;
 	const bool isRaw = isCompute && !isIndex && !isStructured;
+    const bool isIndex32 = isIndex && (bufferSize == elementCount * (int)sizeof(unsigned int));
     PG_ASSERTSTR((isStructured && ((bufferSize % elementCount) == 0)) || !isStructured, "Structured buffer byte size is not a multiple of its stride.");
 
     D3D11_BUFFER_DESC& desc = outBuffer.mDesc;
@@ -862,7 +871,7 @@ void Pegasus::Render::DXCreateBuffer(
     if (isCompute && outBuffer.mBuffer != nullptr)
     {
         D3D11_UNORDERED_ACCESS_VIEW_DESC& uavDesc = outBuffer.mUavDesc;
-        uavDesc.Format =  isIndex ? DXGI_FORMAT_R16_UINT : isRaw ? DXGI_FORMAT_R32_TYPELESS : DXGI_FORMAT_UNKNOWN;
+        uavDesc.Format =  isIndex ? (isIndex32 ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT) : isRaw ? DXGI_FORMAT_R32_TYPELESS : DXGI_FORMAT_UNKNOWN;
         uavDesc.ViewDimension = D3D11_UAV_DIMENSION_BUFFER;
         uavDesc.Buffer.FirstElement = 0;
         uavDesc.Buffer.NumElements = isRaw ? (UINT)desc.ByteWidth/4 : elementCount;
@@ -877,10 +886,10 @@ void Pegasus::Render::DXCreateBuffer(
         D3D11_SHADER_RESOURCE_VIEW_DESC& srvDesc = outBuffer.mSrvDesc;
         if (isIndex)
         {
-            srvDesc.Format = DXGI_FORMAT_R16_UINT;
+            srvDesc.Format = isIndex32 ? DXGI_FORMAT_R32_UINT : DXGI_FORMAT_R16_UINT;
             srvDesc.ViewDimension = D3D_SRV_DIMENSION_BUFFEREX;
             srvDesc.BufferEx.FirstElement = 0;
-            srvDesc.BufferEx.NumElements = (UINT)desc.ByteWidth/2;
+            srvDesc.BufferEx.NumElements = (UINT)desc.ByteWidth/(isIndex32 ? 4 : 2);
             srvDesc.BufferEx.Flags = 0;
         }
         else if (isStructured)
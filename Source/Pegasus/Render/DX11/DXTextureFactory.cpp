@@ -104,7 +104,7 @@ void DXTextureFactory::Get2DConfigTranslation(const Pegasus::Texture::TextureCon
 
     d3dDesc.Width = config.GetWidth();
     d3dDesc.Height = config.GetHeight();
-    d3dDesc.MipLevels = 1;
+    d3dDesc.MipLevels = config.GetNumMipLevels();
     d3dDesc.ArraySize = config.GetNumLayers();
     d3dDesc.Format = GetDxFormat(config.GetPixelFormat());
     d3dDesc.SampleDesc.Count = 1;
@@ -140,7 +140,8 @@ void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
     Get2DConfigTranslation(config, translation);
 	bool doMap = true;
 
-	if (texGpuData->mTexture == nullptr)	
+	// Dynamic textures are limited to one mip level, so textures with a mip chain are always immutable
+	if (texGpuData->mTexture == nullptr || translation.MipLevels > 1)
 	{
         PG_ASSERT(texGpuData->mSrv == nullptr);
 		translation.Usage = D3D11_USAGE_IMMUTABLE;
@@ -153,18 +154,23 @@ void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
 	}
 
     
-    if (texGpuData->mDesc.Usage == D3D11_USAGE_IMMUTABLE || ShouldRebuildTexture(translation, texGpuData->mDesc))
+    if (texGpuData->mDesc.Usage == D3D11_USAGE_IMMUTABLE || translation.Usage == D3D11_USAGE_IMMUTABLE || ShouldRebuildTexture(translation, texGpuData->mDesc))
     {
 		doMap = false;
         texGpuData->mTexture = nullptr;
         texGpuData->mSrv = nullptr;
 
-        D3D11_SUBRESOURCE_DATA srd; 
-        srd.pSysMem = nodeData->GetLayerImageData(0);
-        srd.SysMemPitch = translation.Width * config.GetNumBytesPerPixel();
-        srd.SysMemSlicePitch = 0;        
+        // One subresource per mip level, stored contiguously in the layer data
+        PG_ASSERTSTR(translation.MipLevels <= D3D11_REQ_MIP_LEVELS, "Too many mip levels (%d) for a D3D11 texture", translation.MipLevels);
+        D3D11_SUBRESOURCE_DATA srd[D3D11_REQ_MIP_LEVELS]; 
+        for (unsigned int level = 0; level < translation.MipLevels; ++level)
+        {
+            srd[level].pSysMem = nodeData->GetLayerImageData(0) + config.GetMipOffset(level);
+            srd[level].SysMemPitch = config.GetMipWidth(level) * config.GetNumBytesPerPixel();
+            srd[level].SysMemSlicePitch = 0;
+        }
 
-        VALID_DECLARE(device->CreateTexture2D(&translation, &srd, &texGpuData->mTexture));
+        VALID_DECLARE(device->CreateTexture2D(&translation, srd, &texGpuData->mTexture));
         
         D3D11_SHADER_RESOURCE_VIEW_DESC& srvDesc = texGpuData->mSrvDesc;
         srvDesc.Format = translation.Format;
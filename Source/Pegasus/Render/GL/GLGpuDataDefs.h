@@ -20,6 +20,7 @@
 #include "Pegasus/Graph/NodeGPUData.h"
 #include "Pegasus/Shader/Shared/ShaderDefs.h"
 #include "Pegasus/Mesh/MeshInputLayout.h"
+#include "Pegasus/Mesh/MeshData.h"
 #include "../Source/Pegasus/Render/GL/GLEWStaticInclude.h"
 #include "../Source/Pegasus/Render/GL/GLShaderReflect.h"
 
@@ -65,8 +66,12 @@ struct OGLMeshGPUData
     struct DrawState {
         bool mIsIndexed;
         int  mIndexCount;
+        GLenum mIndexType;
         int  mVertexCount;
         GLuint mPrimitive;
+        int  mLodIndexOffsets[Mesh::MESH_MAX_LODS]; //! first index of each level of detail
+        int  mLodIndexCounts[Mesh::MESH_MAX_LODS];  //! index count of each level of detail
+        int  mLodCount;
     } mDrawState;
 
     struct VAOEntry {
@@ -58,7 +58,9 @@ Pegasus::Render::OGLMeshGPUData * GLMeshFactory::AllocateGPUData(Pegasus::Mesh::
     // setup the draw state
     meshGPUData->mDrawState.mIsIndexed = false;
     meshGPUData->mDrawState.mIndexCount  = 0;
+    meshGPUData->mDrawState.mLodCount = 0;
     meshGPUData->mDrawState.mVertexCount = 0;
+    meshGPUData->mDrawState.mIndexType = GL_UNSIGNED_SHORT;
     meshGPUData->mDrawState.mPrimitive = GL_TRIANGLES; // defaulting to triangles
 
     // setting up empty VAO table
@@ -162,24 +164,34 @@ void GLMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
 
     if (meshConfig.GetIsIndexed())
     {
+        const GLenum indexType = nodeData->GetIndexStride() == sizeof(unsigned int) ? GL_UNSIGNED_INT : GL_UNSIGNED_SHORT;
         gpuData->mDrawState.mIsIndexed = true;
         gpuData->mDrawState.mIndexCount = nodeData->GetIndexCount();
+        gpuData->mDrawState.mLodCount = nodeData->GetLodCount();
+        for (int lod = 0; lod < gpuData->mDrawState.mLodCount; ++lod)
+        {
+            gpuData->mDrawState.mLodIndexOffsets[lod] = nodeData->GetLodIndexOffset(lod);
+            gpuData->mDrawState.mLodIndexCounts[lod] = nodeData->GetLodIndexCount(lod);
+        }
         if (gpuData->mIndexBuffer == GL_INVALID_INDEX)
         {
             glGenBuffers(1, &gpuData->mIndexBuffer);
         }
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, gpuData->mIndexBuffer);
-        if (newlyAllocated)
+
+        //the byte size changes with the index type, so the buffer is reallocated
+        if (newlyAllocated || indexType != gpuData->mDrawState.mIndexType)
         {
-            glBufferData(GL_ELEMENT_ARRAY_BUFFER, sizeof(short) * nodeData->GetIndexCount(), 
-                         nodeData->GetIndexBuffer(),
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, nodeData->GetIndexStride() * nodeData->GetIndexCount(), 
+                         nodeData->GetIndexData(),
                          meshConfig.GetIsDynamic() ? GL_DYNAMIC_DRAW : GL_STATIC_DRAW);
         }
         else
         {
-            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, sizeof(short) * nodeData->GetIndexCount(), 
-                            nodeData->GetIndexBuffer());
+            glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, nodeData->GetIndexStride() * nodeData->GetIndexCount(), 
+                            nodeData->GetIndexData());
         }
+        gpuData->mDrawState.mIndexType = indexType;
     }
     else
     {
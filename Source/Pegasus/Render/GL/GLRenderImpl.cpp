@@ -434,6 +434,11 @@ void Pegasus::Render::SetDepthClearValue(float d)
 ///////////////////////////////////////////////////////////////////////////////
 
 void Pegasus::Render::Draw()
+{
+    DrawLod(0);
+}
+
+void Pegasus::Render::DrawLod(unsigned int lod)
 {
     if (gOGLState.mDispatchedMeshGPUData == nullptr)
     {
@@ -444,7 +449,12 @@ void Pegasus::Render::Draw()
     
     if (drawState.mIsIndexed)
     {
-        glDrawElements(drawState.mPrimitive, drawState.mIndexCount, GL_UNSIGNED_SHORT, (void*)0x0);
+        //the levels of detail missing in the mesh are replaced by its last one
+        PG_ASSERT(drawState.mLodCount > 0);
+        const int lodIndex = (lod < static_cast<unsigned int>(drawState.mLodCount)) ? static_cast<int>(lod) : drawState.mLodCount - 1;
+        const int indexSize = drawState.mIndexType == GL_UNSIGNED_INT ? sizeof(unsigned int) : sizeof(unsigned short);
+        glDrawElements(drawState.mPrimitive, drawState.mLodIndexCounts[lodIndex], drawState.mIndexType,
+                       reinterpret_cast<void*>(static_cast<size_t>(drawState.mLodIndexOffsets[lodIndex] * indexSize)));
     }
     else
     {
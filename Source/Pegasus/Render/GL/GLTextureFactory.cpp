@@ -114,35 +114,41 @@ void GLTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
     PG_ASSERTSTR(texConfig.GetType() == Pegasus::Texture::TextureConfiguration::TYPE_2D,
                  "Unsupported texture format. Only 2D textures are supported for the moment");
 
-    if (newlyAllocated)
+    // One image per mip level, stored contiguously in the layer data
+    const unsigned int numMipLevels = texConfig.GetNumMipLevels();
+    for (unsigned int level = 0; level < numMipLevels; ++level)
     {
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0, 
-            GLPixelFormatTranslation[texConfig.GetPixelFormat()],
-            texConfig.GetWidth(),
-            texConfig.GetHeight(),
-            0,
-            GLPixelFormatTranslation[texConfig.GetPixelFormat()],
-            GL_UNSIGNED_BYTE,
-            texData);
-    }
-    else
-    {
-        glTexSubImage2D(
-            GL_TEXTURE_2D,
-            0,
-            0,
-            0,
-            texConfig.GetWidth(),
-            texConfig.GetHeight(),
-            GLPixelFormatTranslation[texConfig.GetPixelFormat()],
-            GL_UNSIGNED_BYTE,
-            texData);
+        if (newlyAllocated)
+        {
+            glTexImage2D(
+                GL_TEXTURE_2D,
+                level, 
+                GLPixelFormatTranslation[texConfig.GetPixelFormat()],
+                texConfig.GetMipWidth(level),
+                texConfig.GetMipHeight(level),
+                0,
+                GLPixelFormatTranslation[texConfig.GetPixelFormat()],
+                GL_UNSIGNED_BYTE,
+                texData + texConfig.GetMipOffset(level));
+        }
+        else
+        {
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                level,
+                0,
+                0,
+                texConfig.GetMipWidth(level),
+                texConfig.GetMipHeight(level),
+                GLPixelFormatTranslation[texConfig.GetPixelFormat()],
+                GL_UNSIGNED_BYTE,
+                texData + texConfig.GetMipOffset(level));
+        }
     }
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, static_cast<GLint>(numMipLevels - 1));
 
-    // Default filter
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    // Default filter, trilinear when the mip levels are provided
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (numMipLevels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
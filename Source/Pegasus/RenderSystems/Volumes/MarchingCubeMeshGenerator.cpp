@@ -69,7 +69,7 @@ void MarchingCubeMeshGenerator::GenerateData()
 
     const Case& caseEl = caseTable->GetCase(caseSignature);
     meshData->AllocateIndexes(caseEl.triangleCount * 3);
-    unsigned short* idx = meshData->GetIndexBuffer();
+    unsigned int* idx = meshData->GetIndexBuffer();
     for (int i = 0; i < caseEl.triangleCount*3; ++i)
     {
         idx[i] = caseEl.triangles[i];
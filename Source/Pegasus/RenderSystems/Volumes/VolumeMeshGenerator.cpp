@@ -0,0 +1,602 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VolumeMeshGenerator.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  CPU marching cubes generator of the terrain volume meshes.
+
+#include "Pegasus/RenderSystems/Volumes/VolumeMeshGenerator.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+#include "Pegasus/RenderSystems/Volumes/VolumesSystem.h"
+#include "Pegasus/RenderSystems/Volumes/CaseTable.h"
+#include "Pegasus/Mesh/Shared/MeshEvent.h"
+#include "Pegasus/Core/WorkerPool.h"
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace Pegasus;
+using namespace Pegasus::Mesh;
+using namespace Pegasus::RenderSystems;
+using namespace Pegasus::Math;
+
+extern RenderSystems::VolumesSystem* gVolumesSystem;
+
+//! Density separating the inside of the terrain from the outside, MID_POINT in VolumesCommon.h
+static const float VOLUME_ISO_LEVEL = 0.5f;
+
+//! Number of planes of the grid processed by each task
+static const unsigned int VOLUME_PLANES_PER_SLAB = 8;
+
+// The density function is written once with the 4-lane type below, one lane per grid point.
+// The SSE2 and scalar versions of each operation give the same bits,
+// so the generated meshes do not depend on the instruction set.
+
+//! Four floating point numbers, one per grid point
+struct Float4
+{
+#if PEGASUS_ENABLE_SSE2
+    __m128 v;
+#else
+    float v[4];
+#endif
+};
+
+#if PEGASUS_ENABLE_SSE2
+
+static inline Float4 MakeFloat4(__m128 v) { Float4 r; r.v = v; return r; }
+static inline Float4 SetFloat4(float a) { return MakeFloat4(_mm_set1_ps(a)); }
+static inline Float4 SetFloat4(float a, float b, float c, float d) { return MakeFloat4(_mm_setr_ps(a, b, c, d)); }
+
+static inline Float4 operator + (Float4 a, Float4 b) { return MakeFloat4(_mm_add_ps(a.v, b.v)); }
+static inline Float4 operator - (Float4 a, Float4 b) { return MakeFloat4(_mm_sub_ps(a.v, b.v)); }
+static inline Float4 operator * (Float4 a, Float4 b) { return MakeFloat4(_mm_mul_ps(a.v, b.v)); }
+
+//! Round to the nearest integer, the halves being rounded up
+static inline Float4 Round(Float4 a)
+{
+    const __m128 b = _mm_add_ps(a.v, _mm_set1_ps(0.5f));
+    const __m128i truncated = _mm_cvttps_epi32(b);
+    const __m128 isAbove = _mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), b);
+    return MakeFloat4(_mm_cvtepi32_ps(_mm_add_epi32(truncated, _mm_castps_si128(isAbove))));
+}
+
+//! Negate the lanes where the integer a is odd
+static inline Float4 NegateIfOdd(Float4 x, Float4 a)
+{
+    const __m128i sign = _mm_slli_epi32(_mm_cvttps_epi32(a.v), 31);
+    return MakeFloat4(_mm_xor_ps(x.v, _mm_castsi128_ps(sign)));
+}
+
+static inline void StoreFloat4(float a[4], Float4 b) { _mm_storeu_ps(a, b.v); }
+
+#else
+
+static inline Float4 SetFloat4(float a) { Float4 r; r.v[0] = r.v[1] = r.v[2] = r.v[3] = a; return r; }
+static inline Float4 SetFloat4(float a, float b, float c, float d) { Float4 r; r.v[0] = a; r.v[1] = b; r.v[2] = c; r.v[3] = d; return r; }
+
+#define PEGASUS_VOLUME_LANES(expr) Float4 r; for (unsigned int l = 0; l < 4; ++l) { r.v[l] = (expr); } return r;
+
+static inline Float4 operator + (Float4 a, Float4 b) { PEGASUS_VOLUME_LANES(a.v[l] + b.v[l]) }
+static inline Float4 operator - (Float4 a, Float4 b) { PEGASUS_VOLUME_LANES(a.v[l] - b.v[l]) }
+static inline Float4 operator * (Float4 a, Float4 b) { PEGASUS_VOLUME_LANES(a.v[l] * b.v[l]) }
+
+//! Round to the nearest integer, the halves being rounded up
+static inline Float4 Round(Float4 a)
+{
+    PEGASUS_VOLUME_LANES(static_cast<float>(static_cast<int>(a.v[l] + 0.5f) - ((static_cast<float>(static_cast<int>(a.v[l] + 0.5f)) > a.v[l] + 0.5f) ? 1 : 0)))
+}
+
+//! Negate the lanes where the integer a is odd
+static inline Float4 NegateIfOdd(Float4 x, Float4 a) { PEGASUS_VOLUME_LANES((static_cast<int>(a.v[l]) & 1) ? -x.v[l] : x.v[l]) }
+
+static inline void StoreFloat4(float a[4], Float4 b) { for (unsigned int l = 0; l < 4; ++l) { a[l] = b.v[l]; } }
+
+#undef PEGASUS_VOLUME_LANES
+
+#endif  // PEGASUS_ENABLE_SSE2
+
+//! Sine, with an error below 4e-6 for the arguments up to a few thousands
+static inline Float4 Sin(Float4 x)
+{
+    // Reduced to [-pi/2, pi/2] by removing k * pi in 3 parts, so the reduction is exact for the small k,
+    // sin(x) being (-1)^k sin(x - k * pi)
+    const Float4 k = Round(x * SetFloat4(0.318309886f));
+    Float4 r = x - k * SetFloat4(3.140625f);
+    r = r - k * SetFloat4(9.67025757e-4f);
+    r = r - k * SetFloat4(6.27711415e-7f);
+    const Float4 r2 = r * r;
+    Float4 p = SetFloat4(2.75573192e-6f);
+    p = p * r2 + SetFloat4(-1.98412698e-4f);
+    p = p * r2 + SetFloat4(8.33333333e-3f);
+    p = p * r2 + SetFloat4(-1.66666667e-1f);
+    return NegateIfOdd(r + r * r2 * p, k);
+}
+
+//! Cosine, with the same error as Sin()
+static inline Float4 Cos(Float4 x)
+{
+    return Sin(x + SetFloat4(1.57079633f));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Grid point owning an edge of a cell, and direction of the edge (0 for x, 1 for y, 2 for z).
+//! The cell edges are numbered as in CaseTable, the same remapping as meshProducer.cs
+struct VolumeEdgeOwner
+{
+    unsigned char mX;                       //!< Offset of the point from the first corner of the cell
+    unsigned char mY;                       //!< Offset of the point from the first corner of the cell
+    unsigned char mZ;                       //!< Offset of the point from the first corner of the cell
+    unsigned char mAxis;                    //!< Direction of the edge
+};
+
+static const VolumeEdgeOwner sEdgeOwners[12] =
+{
+    { 0, 0, 0, 0 },
+    { 1, 0, 0, 1 },
+    { 0, 1, 0, 0 },
+    { 0, 0, 0, 1 },
+    { 0, 0, 1, 0 },
+    { 1, 0, 1, 1 },
+    { 0, 1, 1, 0 },
+    { 0, 0, 1, 1 },
+    { 0, 0, 0, 2 },
+    { 1, 0, 0, 2 },
+    { 1, 1, 0, 2 },
+    { 0, 1, 0, 2 }
+};
+
+//! Number of vertices owned by a point for each mask of crossed edges
+static const unsigned char sEdgeMaskVertexCounts[8] = { 0, 1, 1, 2, 1, 2, 2, 3 };
+
+//! Parameters of the evaluation of the densities
+struct VolumeDensityJob
+{
+    float * mDensities;                     //!< Densities of the grid points, outer layer included
+    int mSampleCount;                       //!< Number of points per dimension
+    float mCellSize;                        //!< Distance between the points
+    Vec3 mOrigin;                           //!< Position of the first point
+    float mScale;                           //!< Factor applied to the densities
+};
+
+//! Parameters of the polygonization, shared by the counting and the writing passes
+struct VolumePolygonizeJob
+{
+    const CaseTable * mCaseTable;           //!< Triangles of each case
+    const float * mDensities;               //!< Densities of the grid points, outer layer included
+    unsigned char * mInsides;               //!< 1 for the grid points inside the terrain, outer layer included
+    int mGridSize;                          //!< Number of cells per dimension
+    float mCellSize;                        //!< Size of the cells
+    Vec3 mGridOffset;                       //!< Position of the first grid point
+    unsigned int * mRowVertexOffsets;       //!< First vertex of each row of points, in z then y order
+    unsigned int * mRowIndexOffsets;        //!< First index of each row of cells, in z then y order
+    unsigned int * mPlaneFirstVertexes;     //!< First vertex of each point of 2 planes per slab
+    unsigned char * mPlaneEdgeMasks;        //!< Crossed edges of each point of 2 planes per slab
+    StdVertex * mVertexes;                  //!< Output vertices
+    unsigned int * mIndexes;                //!< Output indices
+};
+
+//! Get the density of a grid point
+//! \param job the polygonization
+//! \param x the coordinate of the point, -1 to gridSize + 1
+//! \param y the coordinate of the point, -1 to gridSize + 1
+//! \param z the coordinate of the point, -1 to gridSize + 1
+static inline float GetDensity(const VolumePolygonizeJob * job, int x, int y, int z)
+{
+    const int sampleCount = job->mGridSize + 3;
+    return job->mDensities[((z + 1) * sampleCount + (y + 1)) * sampleCount + (x + 1)];
+}
+
+//! Get the codes of the columns of a row of cells, for the points 0 to gridSize + 1 of the row.
+//! Each code has one bit per point of the column inside the terrain: (y, z), (y + 1, z), (y, z + 1) and (y + 1, z + 1)
+//! \param job the polygonization
+//! \param y the row
+//! \param z the plane
+//! \param codes receives the gridSize + 2 codes
+static void GetColumnCodes(const VolumePolygonizeJob * job, int y, int z, unsigned char * codes)
+{
+    const int sampleCount = job->mGridSize + 3;
+    const int planeSize = sampleCount * sampleCount;
+    const unsigned char * insides = job->mInsides + ((z + 1) * sampleCount + (y + 1)) * sampleCount + 1;
+    for (int x = 0; x <= job->mGridSize + 1; ++x)
+    {
+        codes[x] = insides[x] | (insides[x + sampleCount] << 1) | (insides[x + planeSize] << 2) | (insides[x + sampleCount + planeSize] << 3);
+    }
+}
+
+//! Get the case of a cell, one bit per corner inside the terrain
+//! \param left the code of the column of the first corner of the cell
+//! \param right the code of the next column
+static inline unsigned int GetCellCase(unsigned int left, unsigned int right)
+{
+    return (left & 1) | ((left & 2) << 2) | ((left & 4) << 2) | ((left & 8) << 4)
+         | ((right & 1) << 1) | ((right & 2) << 1) | ((right & 4) << 3) | ((right & 8) << 3);
+}
+
+//! Get the edges starting from a grid point crossed by the surface
+//! \param codes the column codes of the row of the point
+//! \param x the point
+//! \param validEdges the edges inside the grid, bit 0 for x, 1 for y and 2 for z
+//! \return Bit 0 for the edge along x, 1 along y and 2 along z
+static inline unsigned char GetEdgeMask(const unsigned char * codes, int x, unsigned int validEdges)
+{
+    const unsigned int code = codes[x];
+    const unsigned int mask = ((code ^ codes[x + 1]) & 1) | (((code ^ (code >> 1)) & 1) << 1) | (((code ^ (code >> 2)) & 1) << 2);
+    return static_cast<unsigned char>(mask & validEdges);
+}
+
+//! Get the edges of the points of a row inside the grid, the last point having no x edge
+static inline unsigned int GetValidEdges(int gridSize, int y, int z)
+{
+    return 1 | (y < gridSize ? 2 : 0) | (z < gridSize ? 4 : 0);
+}
+
+//! Get the density gradient at a grid point, with central differences
+static inline Vec3 GetGradient(const VolumePolygonizeJob * job, int x, int y, int z)
+{
+    return Vec3(GetDensity(job, x + 1, y, z) - GetDensity(job, x - 1, y, z),
+                GetDensity(job, x, y + 1, z) - GetDensity(job, x, y - 1, z),
+                GetDensity(job, x, y, z + 1) - GetDensity(job, x, y, z - 1));
+}
+
+//! Evaluate the densities of a range of planes of the grid
+//! \param userData VolumeDensityJob
+//! \param begin First plane
+//! \param end Plane after the last one
+static void VolumeDensityPlaneRange(void * userData, unsigned int begin, unsigned int end)
+{
+    const VolumeDensityJob * job = static_cast<const VolumeDensityJob *>(userData);
+    const int sampleCount = job->mSampleCount;
+    for (unsigned int z = begin; z < end; ++z)
+    {
+        for (int y = 0; y < sampleCount; ++y)
+        {
+            VolumeMeshGenerator::EvaluateDensityRow(job->mDensities + (z * sampleCount + y) * sampleCount, sampleCount,
+                                                    job->mOrigin.x, job->mCellSize, job->mOrigin.y + y * job->mCellSize,
+                                                    job->mOrigin.z + z * job->mCellSize, job->mScale);
+        }
+    }
+}
+
+//! Classify the grid points of a range of planes inside or outside the terrain
+//! \param userData VolumePolygonizeJob
+//! \param begin First plane
+//! \param end Plane after the last one
+static void VolumeInsidePlaneRange(void * userData, unsigned int begin, unsigned int end)
+{
+    const VolumePolygonizeJob * job = static_cast<const VolumePolygonizeJob *>(userData);
+    const unsigned int planeSize = (job->mGridSize + 3) * (job->mGridSize + 3);
+    for (unsigned int i = begin * planeSize; i < end * planeSize; ++i)
+    {
+        job->mInsides[i] = (job->mDensities[i] > VOLUME_ISO_LEVEL) ? 1 : 0;
+    }
+}
+
+//! Count the vertices of each row of points and the indices of each row of cells, for a range of planes
+//! \param userData VolumePolygonizeJob
+//! \param begin First plane
+//! \param end Plane after the last one
+static void VolumeCountPlaneRange(void * userData, unsigned int begin, unsigned int end)
+{
+    const VolumePolygonizeJob * job = static_cast<const VolumePolygonizeJob *>(userData);
+    const int gridSize = job->mGridSize;
+    unsigned char codes[VolumeMeshGenerator::MAX_GRID_SIZE + 2];
+    for (int z = static_cast<int>(begin); z < static_cast<int>(end); ++z)
+    {
+        for (int y = 0; y <= gridSize; ++y)
+        {
+            GetColumnCodes(job, y, z, codes);
+            const unsigned int validEdges = GetValidEdges(gridSize, y, z);
+            unsigned int vertexCount = 0;
+            for (int x = 0; x < gridSize; ++x)
+            {
+                vertexCount += sEdgeMaskVertexCounts[GetEdgeMask(codes, x, validEdges)];
+            }
+            vertexCount += sEdgeMaskVertexCounts[GetEdgeMask(codes, gridSize, validEdges & 6)];
+            job->mRowVertexOffsets[z * (gridSize + 1) + y] = vertexCount;
+
+            if (y < gridSize && z < gridSize)
+            {
+                unsigned int indexCount = 0;
+                for (int x = 0; x < gridSize; ++x)
+                {
+                    indexCount += 3 * job->mCaseTable->GetCase(GetCellCase(codes[x], codes[x + 1])).triangleCount;
+                }
+                job->mRowIndexOffsets[z * gridSize + y] = indexCount;
+            }
+        }
+    }
+}
+
+//! Find the crossed edges of the points of a plane, and number their vertices
+//! \param job the polygonization
+//! \param z the plane
+//! \param firstVertexes receives the first vertex of each point
+//! \param edgeMasks receives the crossed edges of each point
+static void NumberPlaneVertexes(const VolumePolygonizeJob * job, int z, unsigned int * firstVertexes, unsigned char * edgeMasks)
+{
+    const int gridSize = job->mGridSize;
+    unsigned char codes[VolumeMeshGenerator::MAX_GRID_SIZE + 2];
+    for (int y = 0; y <= gridSize; ++y)
+    {
+        GetColumnCodes(job, y, z, codes);
+        const unsigned int validEdges = GetValidEdges(gridSize, y, z);
+        unsigned int vertex = job->mRowVertexOffsets[z * (gridSize + 1) + y];
+        for (int x = 0; x <= gridSize; ++x)
+        {
+            const int point = y * (gridSize + 1) + x;
+            edgeMasks[point] = GetEdgeMask(codes, x, (x < gridSize) ? validEdges : (validEdges & 6));
+            firstVertexes[point] = vertex;
+            vertex += sEdgeMaskVertexCounts[edgeMasks[point]];
+        }
+    }
+}
+
+//! Write the vertices of the crossed edges of a plane, at the iso level crossing
+//! \param job the polygonization
+//! \param z the plane
+//! \param firstVertexes first vertex of each point
+//! \param edgeMasks crossed edges of each point
+static void WritePlaneVertexes(const VolumePolygonizeJob * job, int z, const unsigned int * firstVertexes, const unsigned char * edgeMasks)
+{
+    const int gridSize = job->mGridSize;
+    const float uvScale = 1.0f / static_cast<float>(gridSize);
+    for (int y = 0; y <= gridSize; ++y)
+    {
+        for (int x = 0; x <= gridSize; ++x)
+        {
+            const int point = y * (gridSize + 1) + x;
+            const unsigned char mask = edgeMasks[point];
+            if (mask == 0)
+            {
+                continue;
+            }
+            StdVertex * vertex = job->mVertexes + firstVertexes[point];
+            const float density = GetDensity(job, x, y, z);
+            const Vec3 gradient = GetGradient(job, x, y, z);
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                if ((mask & (1 << axis)) == 0)
+                {
+                    continue;
+                }
+                const int nx = x + (axis == 0 ? 1 : 0);
+                const int ny = y + (axis == 1 ? 1 : 0);
+                const int nz = z + (axis == 2 ? 1 : 0);
+                const float t = (VOLUME_ISO_LEVEL - density) / (GetDensity(job, nx, ny, nz) - density);
+                Vec3 cell(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+                cell.v[axis] += t;
+
+                // The density decreases outside the terrain
+                Vec3 normal = -Lerp(gradient, GetGradient(job, nx, ny, nz), t);
+                const float lengthSquared = Dot(normal, normal);
+                normal = (lengthSquared > 0.0f) ? normal * (1.0f / Sqrt(lengthSquared)) : Vec3(0.0f, 1.0f, 0.0f);
+
+                vertex->position = Vec4(cell * job->mCellSize + job->mGridOffset, 1.0f);
+                vertex->normal = normal;
+                vertex->uv = Vec2(cell.x * uvScale, cell.z * uvScale);
+                ++vertex;
+            }
+        }
+    }
+}
+
+//! Write the triangles of the cells of a plane
+//! \param job the polygonization
+//! \param z the plane
+//! \param firstVertexes first vertex of each point, for the planes z and z + 1
+//! \param edgeMasks crossed edges of each point, for the planes z and z + 1
+static void WritePlaneTriangles(const VolumePolygonizeJob * job, int z, const unsigned int * const firstVertexes[2], const unsigned char * const edgeMasks[2])
+{
+    const int gridSize = job->mGridSize;
+    unsigned char codes[VolumeMeshGenerator::MAX_GRID_SIZE + 2];
+    for (int y = 0; y < gridSize; ++y)
+    {
+        unsigned int * indexes = job->mIndexes + job->mRowIndexOffsets[z * gridSize + y];
+        GetColumnCodes(job, y, z, codes);
+        for (int x = 0; x < gridSize; ++x)
+        {
+            const Case & cellCase = job->mCaseTable->GetCase(GetCellCase(codes[x], codes[x + 1]));
+            for (int i = 0; i < 3 * cellCase.triangleCount; ++i)
+            {
+                const VolumeEdgeOwner & owner = sEdgeOwners[static_cast<int>(cellCase.triangles[i])];
+                const int point = (y + owner.mY) * (gridSize + 1) + x + owner.mX;
+                const unsigned char mask = edgeMasks[owner.mZ][point];
+                PG_ASSERT((mask & (1 << owner.mAxis)) != 0);
+
+                // The vertices of a point are stored in the order of the axes
+                *indexes++ = firstVertexes[owner.mZ][point] + sEdgeMaskVertexCounts[mask & ((1 << owner.mAxis) - 1)];
+            }
+        }
+    }
+}
+
+//! Write the vertices and the triangles of a range of slabs of planes
+//! \param userData VolumePolygonizeJob
+//! \param begin First slab
+//! \param end Slab after the last one
+static void VolumePolygonizeSlabRange(void * userData, unsigned int begin, unsigned int end)
+{
+    const VolumePolygonizeJob * job = static_cast<const VolumePolygonizeJob *>(userData);
+    const int gridSize = job->mGridSize;
+    const int planeSize = (gridSize + 1) * (gridSize + 1);
+    for (unsigned int slab = begin; slab < end; ++slab)
+    {
+        // The numbering of the first plane of the next slab is computed by both slabs
+        unsigned int * firstVertexes[2] = { job->mPlaneFirstVertexes + slab * 2 * planeSize, job->mPlaneFirstVertexes + (slab * 2 + 1) * planeSize };
+        unsigned char * edgeMasks[2] = { job->mPlaneEdgeMasks + slab * 2 * planeSize, job->mPlaneEdgeMasks + (slab * 2 + 1) * planeSize };
+        const int firstPlane = static_cast<int>(slab * VOLUME_PLANES_PER_SLAB);
+        const int endPlane = (firstPlane + static_cast<int>(VOLUME_PLANES_PER_SLAB) < gridSize + 1) ? firstPlane + static_cast<int>(VOLUME_PLANES_PER_SLAB) : gridSize + 1;
+        NumberPlaneVertexes(job, firstPlane, firstVertexes[0], edgeMasks[0]);
+        for (int z = firstPlane; z < endPlane; ++z)
+        {
+            WritePlaneVertexes(job, z, firstVertexes[0], edgeMasks[0]);
+            if (z < gridSize)
+            {
+                NumberPlaneVertexes(job, z + 1, firstVertexes[1], edgeMasks[1]);
+                WritePlaneTriangles(job, z, firstVertexes, edgeMasks);
+
+                unsigned int * swapVertexes = firstVertexes[0];
+                firstVertexes[0] = firstVertexes[1];
+                firstVertexes[1] = swapVertexes;
+                unsigned char * swapMasks = edgeMasks[0];
+                edgeMasks[0] = edgeMasks[1];
+                edgeMasks[1] = swapMasks;
+            }
+        }
+    }
+}
+
+//! Turn counts into offsets, the element after the last one receiving the total
+//! \param counts the counts, count + 1 elements
+//! \param count the number of counts
+static void ComputeOffsets(unsigned int * counts, int count)
+{
+    unsigned int offset = 0;
+    for (int i = 0; i < count; ++i)
+    {
+        const unsigned int c = counts[i];
+        counts[i] = offset;
+        offset += c;
+    }
+    counts[count] = offset;
+}
+
+//----------------------------------------------------------------------------------------
+
+BEGIN_IMPLEMENT_PROPERTIES(VolumeMeshGenerator)
+    IMPLEMENT_PROPERTY(VolumeMeshGenerator, GridSize)
+    IMPLEMENT_PROPERTY(VolumeMeshGenerator, CellSize)
+    IMPLEMENT_PROPERTY(VolumeMeshGenerator, GridOffset)
+END_IMPLEMENT_PROPERTIES(VolumeMeshGenerator)
+
+VolumeMeshGenerator::VolumeMeshGenerator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                                         Pegasus::Alloc::IAllocator* nodeDataAllocator) : MeshGenerator(nodeAllocator, nodeDataAllocator)
+{
+    BEGIN_INIT_PROPERTIES(VolumeMeshGenerator)
+        INIT_PROPERTY(GridSize)
+        INIT_PROPERTY(CellSize)
+        INIT_PROPERTY(GridOffset)
+    END_INIT_PROPERTIES()
+}
+
+VolumeMeshGenerator::~VolumeMeshGenerator()
+{
+}
+
+void VolumeMeshGenerator::EvaluateDensityRow(float * densities, int count, float x, float step, float y, float z, float scale)
+{
+    // Same function as density3d.cs, the terms that only depend on y and z being shared by the row
+    const float py = y - 3.0f;
+    const float pz = z - 1.0f;
+    float rowTerms[4];
+    StoreFloat4(rowTerms, Sin(SetFloat4(0.05f * pz)) + SetFloat4(0.1f) * Sin(SetFloat4(0.02f * pz * pz)));
+    const Float4 rowY = SetFloat4(py + rowTerms[0]);
+    const Float4 rowYSquared = SetFloat4(py * py);
+    const Float4 scale4 = SetFloat4(scale);
+
+    float lanes[4];
+    for (int i = 0; i < count; i += 4)
+    {
+        const float fi = static_cast<float>(i);
+        const Float4 px = SetFloat4(x + fi * step, x + (fi + 1.0f) * step, x + (fi + 2.0f) * step, x + (fi + 3.0f) * step) - SetFloat4(1.0f);
+        const Float4 sampleY = rowY + SetFloat4(0.1f) * Cos(SetFloat4(0.5f) * px) - Sin(SetFloat4(0.1f) * (rowYSquared - px));
+        const Float4 density = scale4 * (SetFloat4(3.0f) - sampleY);
+        if (i + 4 <= count)
+        {
+            StoreFloat4(densities + i, density);
+        }
+        else
+        {
+            StoreFloat4(lanes, density);
+            for (int l = 0; i + l < count; ++l)
+            {
+                densities[i + l] = lanes[l];
+            }
+        }
+    }
+}
+
+void VolumeMeshGenerator::Polygonize(Mesh::MeshData * meshData, const CaseTable * caseTable, const float * densities,
+                                     int gridSize, float cellSize, const Math::Vec3 & gridOffset, Alloc::IAllocator * allocator)
+{
+    const int rowVertexCount = (gridSize + 1) * (gridSize + 1);
+    const int rowIndexCount = gridSize * gridSize;
+    const unsigned int slabCount = (gridSize + VOLUME_PLANES_PER_SLAB) / VOLUME_PLANES_PER_SLAB;
+
+    VolumePolygonizeJob job;
+    job.mCaseTable = caseTable;
+    job.mDensities = densities;
+    job.mGridSize = gridSize;
+    job.mCellSize = cellSize;
+    job.mGridOffset = gridOffset;
+    job.mRowVertexOffsets = PG_NEW_ARRAY(allocator, -1, "VolumeMeshGenerator::rowVertexOffsets", Alloc::PG_MEM_TEMP, unsigned int, rowVertexCount + 1);
+    job.mRowIndexOffsets = PG_NEW_ARRAY(allocator, -1, "VolumeMeshGenerator::rowIndexOffsets", Alloc::PG_MEM_TEMP, unsigned int, rowIndexCount + 1);
+    job.mPlaneFirstVertexes = PG_NEW_ARRAY(allocator, -1, "VolumeMeshGenerator::planeFirstVertexes", Alloc::PG_MEM_TEMP, unsigned int, slabCount * 2 * rowVertexCount);
+    job.mPlaneEdgeMasks = PG_NEW_ARRAY(allocator, -1, "VolumeMeshGenerator::planeEdgeMasks", Alloc::PG_MEM_TEMP, unsigned char, slabCount * 2 * rowVertexCount);
+    job.mInsides = PG_NEW_ARRAY(allocator, -1, "VolumeMeshGenerator::insides", Alloc::PG_MEM_TEMP, unsigned char, (gridSize + 3) * (gridSize + 3) * (gridSize + 3));
+
+    // The rows are counted in parallel, then the vertices and triangles of every row have a known place
+    // and the slabs are written in parallel
+    Core::ParallelFor(gridSize + 3, VOLUME_PLANES_PER_SLAB, VolumeInsidePlaneRange, &job);
+    Core::ParallelFor(gridSize + 1, VOLUME_PLANES_PER_SLAB, VolumeCountPlaneRange, &job);
+    ComputeOffsets(job.mRowVertexOffsets, rowVertexCount);
+    ComputeOffsets(job.mRowIndexOffsets, rowIndexCount);
+
+    meshData->AllocateVertexes(static_cast<int>(job.mRowVertexOffsets[rowVertexCount]));
+    meshData->AllocateIndexes(static_cast<int>(job.mRowIndexOffsets[rowIndexCount]));
+    job.mVertexes = meshData->GetStream<StdVertex>(0);
+    job.mIndexes = meshData->GetIndexBuffer();
+    Core::ParallelFor(slabCount, 1, VolumePolygonizeSlabRange, &job);
+
+    PG_DELETE_ARRAY(allocator, job.mInsides);
+    PG_DELETE_ARRAY(allocator, job.mPlaneEdgeMasks);
+    PG_DELETE_ARRAY(allocator, job.mPlaneFirstVertexes);
+    PG_DELETE_ARRAY(allocator, job.mRowIndexOffsets);
+    PG_DELETE_ARRAY(allocator, job.mRowVertexOffsets);
+}
+
+void VolumeMeshGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    int gridSize = GetGridSize();
+    if (gridSize < 1 || gridSize > MAX_GRID_SIZE)
+    {
+        PG_LOG('ERR_', "GridSize not allowed to be below 1 or above %d.", MAX_GRID_SIZE);
+        gridSize = gridSize < 1 ? 1 : MAX_GRID_SIZE;
+    }
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+
+    // The outer layer of points is only used by the gradients of the normals.
+    // The densities are scaled by the cell size like on the GPU
+    Alloc::IAllocator * allocator = GetNodeAllocator();
+    VolumeDensityJob densityJob;
+    densityJob.mSampleCount = gridSize + 3;
+    densityJob.mCellSize = GetCellSize();
+    densityJob.mOrigin = GetGridOffset() - Vec3(GetCellSize());
+    densityJob.mScale = GetCellSize();
+    densityJob.mDensities = PG_NEW_ARRAY(allocator, -1, "VolumeMeshGenerator::densities", Alloc::PG_MEM_TEMP, float,
+                                         densityJob.mSampleCount * densityJob.mSampleCount * densityJob.mSampleCount);
+    Core::ParallelFor(densityJob.mSampleCount, VOLUME_PLANES_PER_SLAB, VolumeDensityPlaneRange, &densityJob);
+
+    Polygonize(&(*meshData), gVolumesSystem->GetCaseTable(), densityJob.mDensities, gridSize, GetCellSize(), GetGridOffset(), allocator);
+    PG_DELETE_ARRAY(allocator, densityJob.mDensities);
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
@@ -15,6 +15,7 @@
 #include "Pegasus/Mesh/MeshManager.h"
 #include "Pegasus/RenderSystems/Volumes/MarchingCubeMeshGenerator.h"
 #include "Pegasus/RenderSystems/Volumes/Terrain3dGenerator.h"
+#include "Pegasus/RenderSystems/Volumes/VolumeMeshGenerator.h"
 #include "Pegasus/RenderSystems/Volumes/Terrain3d.h"
 #include "Pegasus/Core/IApplicationContext.h"
 #include "Pegasus/Core/Formats.h"
@@ -215,6 +216,7 @@ void VolumesSystem::OnRegisterCustomMeshNodes(Pegasus::Mesh::MeshManager* meshMa
 {
     meshManager->RegisterMeshNode("MarchingCubeMeshGenerator", MarchingCubeMeshGenerator::CreateNode);
     meshManager->RegisterMeshNode("Terrain3dGenerator", Terrain3dGenerator::CreateNode);
+    meshManager->RegisterMeshNode("VolumeMeshGenerator", VolumeMeshGenerator::CreateNode);
 }
 
 #if PEGASUS_ENABLE_PROXIES
@@ -10,12 +10,28 @@
 //! \brief	Texture generator that fills the image with a constant color
 
 #include "Pegasus/Texture/Generator/ConstantColorGenerator.h"
+#include "Pegasus/Texture/TextureKernels.h"
 #include "Pegasus/Math/Types.h"
-#include "Pegasus/Utils/Memset.h"
 
 namespace Pegasus {
 namespace Texture {
 
+//! Parameters of the fill kernel
+struct ConstantColorJob
+{
+    TextureData * mData;
+    unsigned int mWidth;
+    unsigned int mColor32;
+};
+
+//! Fill rows of a layer with the constant color
+static void ConstantColorRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const ConstantColorJob * job = static_cast<const ConstantColorJob *>(userData);
+    unsigned char * rowData = job->mData->GetLayerImageData(layer) + beginRow * job->mWidth * 4;
+    FillPixels32(rowData, job->mColor32, (endRow - beginRow) * job->mWidth);
+}
+
 
 BEGIN_IMPLEMENT_PROPERTIES(ConstantColorGenerator)
     IMPLEMENT_PROPERTY(ConstantColorGenerator, Color)
@@ -43,31 +59,24 @@ void ConstantColorGenerator::GenerateData()
     TextureData * data = static_cast<TextureData *>(&(*dataRef));
     PG_ASSERT(data != nullptr);
 
-    const Math::PUInt32 color32 = GetColor().rgba32;
-    
     const TextureConfiguration & configuration = GetConfiguration();
     const unsigned int numBytesPerPixel = configuration.GetNumBytesPerPixel();
-    const unsigned int numLayers = configuration.GetNumLayers();
-    const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
-    
-    unsigned char * layerData;
-    unsigned int layer;
-
-    // For each layer
-    for (layer = 0; layer < numLayers; ++layer)
+
+    switch (numBytesPerPixel)
     {
-        layerData = data->GetLayerImageData(layer);
-
-        switch (numBytesPerPixel)
-        {
-            case 4:
-                // For each pixel, copy the constant color
-                Utils::Memset32(layerData, color32, numBytesPerLayer);
-                break;
-
-            default:
-                PG_FAILSTR("Unsupported number of bytes per pixel (%d) for ConstantColorGenerator", numBytesPerPixel);
-        }
+        case 4:
+            {
+                // For each pixel of each layer, copy the constant color
+                ConstantColorJob job;
+                job.mData = data;
+                job.mWidth = configuration.GetWidth();
+                job.mColor32 = static_cast<unsigned int>(GetColor().rgba32);
+                ParallelForRows(configuration, ConstantColorRows, &job);
+            }
+            break;
+
+        default:
+            PG_FAILSTR("Unsupported number of bytes per pixel (%d) for ConstantColorGenerator", numBytesPerPixel);
     }
 
     PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
@@ -12,10 +12,131 @@
 #include "Pegasus/Texture/Generator/GradientGenerator.h"
 #include "Pegasus/Math/Plane.h"
 #include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/TextureKernels.h"
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace Pegasus {
 namespace Texture {
 
+//! Parameters of the gradient kernel
+struct GradientJob
+{
+    TextureData * mData;
+    unsigned int mWidth;
+    unsigned int mHeight;
+    float mWidthRcp;
+    float mHeightRcp;
+    float mDepthRcp;
+    Math::Plane mPlane0;                //!< Plane of the points using color0
+    float mPlaneNormalLengthRcp;        //!< Inverse of the distance between the two planes
+    Math::ColorRGBA mColor0F;
+    Math::ColorRGBA mColorDiffF;        //!< color1 - color0
+};
+
+//! Compute the color of one pixel of the gradient
+//! \param job Parameters of the gradient
+//! \param x Normalized X coordinate of the pixel
+//! \param distanceY Y term of the distance from the first plane
+//! \param distanceZ Z term of the distance from the first plane
+//! \return Color of the pixel
+static inline unsigned int GradientPixel(const GradientJob & job, float x, float distanceY, float distanceZ)
+{
+    // Compute the distance from the first plane
+    // (no need to compute the distance from the second plane,
+    //  as we know they are parallel and we know the distance between them).
+    // Same order of operations as Plane::DistanceOfPoint()
+    const float distance0 = job.mPlane0.GetNormal().x * x + distanceY + distanceZ + job.mPlane0.GetOriginDistance();
+
+    // Scale the distance from the first plane (so a point in the second plane
+    // has a distance of 0 from the first plane) to obtain a lerp factor.
+    // Clamp the result to clamp the gradient.
+    const float lerpFactor = Math::Saturate(distance0 * job.mPlaneNormalLengthRcp);
+
+    // Apply linear interpolation to the color, and convert the color to 8 bits
+    const Math::Color8RGBA color(job.mColor0F + lerpFactor * job.mColorDiffF);
+    return static_cast<unsigned int>(color.rgba32);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute rows of a layer of the gradient
+static void GradientRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const GradientJob & job = *static_cast<const GradientJob *>(userData);
+    const unsigned int width = job.mWidth;
+    const Math::Vec3 & planeNormal = job.mPlane0.GetNormal();
+    unsigned int * rowData32 = reinterpret_cast<unsigned int *>(job.mData->GetLayerImageData(layer)) + beginRow * width;
+
+#if PEGASUS_ENABLE_SSE2
+    // Constants of the 4-pixel path, which performs the scalar operations in the same order
+    // (no fused multiply-add), so both paths give the same bits
+    const __m128 half4 = _mm_set1_ps(0.5f);
+    const __m128 zero4 = _mm_setzero_ps();
+    const __m128 one4 = _mm_set1_ps(1.0f);
+    const __m128 scale4 = _mm_set1_ps(255.0f);
+    const __m128 widthRcp4 = _mm_set1_ps(job.mWidthRcp);
+    const __m128 normalX4 = _mm_set1_ps(planeNormal.x);
+    const __m128 planeD4 = _mm_set1_ps(job.mPlane0.GetOriginDistance());
+    const __m128 lengthRcp4 = _mm_set1_ps(job.mPlaneNormalLengthRcp);
+    const __m128 color04 = _mm_setr_ps(job.mColor0F.red, job.mColor0F.green, job.mColor0F.blue, job.mColor0F.alpha);
+    const __m128 colorDiff4 = _mm_setr_ps(job.mColorDiffF.red, job.mColorDiffF.green, job.mColorDiffF.blue, job.mColorDiffF.alpha);
+    const __m128i xStep4 = _mm_set1_epi32(4);
+#endif
+
+    for (unsigned int row = beginRow; row < endRow; ++row)
+    {
+        // Compute the coordinates in normalized space, the Y and Z terms of the distance are constant along a row
+        const unsigned int z = row / job.mHeight;
+        const unsigned int y = row - z * job.mHeight;
+        const float distanceY = planeNormal.y * ((static_cast<float>(y) + 0.5f) * job.mHeightRcp);
+        const float distanceZ = planeNormal.z * ((static_cast<float>(z) + 0.5f) * job.mDepthRcp);
+        unsigned int x = 0;
+
+#if PEGASUS_ENABLE_SSE2
+        const __m128 distanceY4 = _mm_set1_ps(distanceY);
+        const __m128 distanceZ4 = _mm_set1_ps(distanceZ);
+        __m128i x4 = _mm_setr_epi32(0, 1, 2, 3);
+        for (; x + 4 <= width; x += 4)
+        {
+            const __m128 currentX4 = _mm_mul_ps(_mm_add_ps(_mm_cvtepi32_ps(x4), half4), widthRcp4);
+            x4 = _mm_add_epi32(x4, xStep4);
+
+            const __m128 distance04 = _mm_add_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(normalX4, currentX4), distanceY4), distanceZ4), planeD4);
+            const __m128 lerpFactor4 = _mm_min_ps(_mm_max_ps(_mm_mul_ps(distance04, lengthRcp4), zero4), one4);
+
+            // One RGBA color per pixel, clamped and scaled to [0, 255] so truncation is the floor
+            __m128i pixels[4];
+            pixels[0] = _mm_shuffle_epi32(_mm_castps_si128(lerpFactor4), _MM_SHUFFLE(0, 0, 0, 0));
+            pixels[1] = _mm_shuffle_epi32(_mm_castps_si128(lerpFactor4), _MM_SHUFFLE(1, 1, 1, 1));
+            pixels[2] = _mm_shuffle_epi32(_mm_castps_si128(lerpFactor4), _MM_SHUFFLE(2, 2, 2, 2));
+            pixels[3] = _mm_shuffle_epi32(_mm_castps_si128(lerpFactor4), _MM_SHUFFLE(3, 3, 3, 3));
+            for (unsigned int p = 0; p < 4; ++p)
+            {
+                const __m128 colorF4 = _mm_add_ps(color04, _mm_mul_ps(_mm_castsi128_ps(pixels[p]), colorDiff4));
+                pixels[p] = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_max_ps(colorF4, zero4), one4), scale4));
+            }
+
+            // Pack the 16 components to bytes, in memory order
+            const __m128i pixels8 = _mm_packus_epi16(_mm_packs_epi32(pixels[0], pixels[1]), _mm_packs_epi32(pixels[2], pixels[3]));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(rowData32 + x), pixels8);
+        }
+#endif
+
+        for (; x < width; ++x)
+        {
+            const float currentX = (static_cast<float>(x) + 0.5f) * job.mWidthRcp;
+            rowData32[x] = GradientPixel(job, currentX, distanceY, distanceZ);
+        }
+
+        rowData32 += width;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 
 BEGIN_IMPLEMENT_PROPERTIES(GradientGenerator)
     IMPLEMENT_PROPERTY(GradientGenerator, Color0)
@@ -54,13 +175,9 @@ void GradientGenerator::GenerateData()
 
     const TextureConfiguration & configuration = GetConfiguration();
     const unsigned int width = configuration.GetWidth();
-    const float widthRcp = 1.0f / static_cast<float>(width);
     const unsigned int height = configuration.GetHeight();
-    const float heightRcp = 1.0f / static_cast<float>(height);
     const unsigned int depth = configuration.GetDepth();
-    const float depthRcp = 1.0f / static_cast<float>(depth);
     const unsigned int numBytesPerPixel = configuration.GetNumBytesPerPixel();
-    const unsigned int numLayers = configuration.GetNumLayers();
 
     // To calculate the gradient, we consider two parallel planes,
     // the first one for which all points use color0, and the second one for color1.
@@ -78,61 +195,30 @@ void GradientGenerator::GenerateData()
     planeNormal *= planeNormalLengthRcp;
     const Math::Plane plane0(planeNormal, point0);
 
-    Math::PUInt32 * layerData32;
-    unsigned int layer, x, y, z;
-    Math::Vec3 currentPoint;
-    float distance0, lerpFactor;
-    Math::ColorRGBA colorF;
-    Math::Color8RGBA color;
-
-    // For each layer
-    for (layer = 0; layer < numLayers; ++layer)
+    switch (numBytesPerPixel)
     {
-        switch (numBytesPerPixel)
-        {
-            case 4:
-                {
-                    layerData32 = reinterpret_cast<Math::PUInt32 *>(data->GetLayerImageData(layer));
-
-                    // For each pixel, compute the coordinates in normalized space
-                    for (z = 0; z < depth; ++z)
-                    {
-                        currentPoint.z = (static_cast<float>(z) + 0.5f) * depthRcp;
-                        for (y = 0; y < height; ++y)
-                        {
-                            currentPoint.y = (static_cast<float>(y) + 0.5f) * heightRcp;
-                            for (x = 0; x < width; ++x)
-                            {
-                                currentPoint.x = (static_cast<float>(x) + 0.5f) * widthRcp;
-
-                                // Compute the distance from the first plane
-                                // (no need to compute the distance from the second plane,
-                                //  as we know they are parallel and we know the distance between them)
-                                distance0 = plane0.DistanceOfPoint(currentPoint);
-
-                                // Scale the distance from the first plane (so a point in the second plane
-                                // has a distance of 0 from the first plane) to obtain a lerp factor.
-                                // Clamp the result to clamp the gradient.
-                                lerpFactor = Math::Saturate(distance0 * planeNormalLengthRcp);
-
-                                // Apply linear interpolation to the color
-                                colorF = color0F + lerpFactor * colorDiffF;
-
-                                // Convert the color to 8 bits
-                                color = colorF;
-
-                                // Store the pixel
-                                *layerData32++ = color.rgba32;
-                            }
-                        }
-                    }
-                }
-                break;
-                
-            default:
-                PG_FAILSTR("Unsupported number of bytes per pixel (%d) for GradientGenerator", numBytesPerPixel);
-        }
+        case 4:
+            {
+                // Each row of each layer is computed independently, on the worker pool
+                GradientJob job;
+                job.mData = data;
+                job.mWidth = width;
+                job.mHeight = height;
+                job.mWidthRcp = 1.0f / static_cast<float>(width);
+                job.mHeightRcp = 1.0f / static_cast<float>(height);
+                job.mDepthRcp = 1.0f / static_cast<float>(depth);
+                job.mPlane0 = plane0;
+                job.mPlaneNormalLengthRcp = planeNormalLengthRcp;
+                job.mColor0F = color0F;
+                job.mColorDiffF = colorDiffF;
+                ParallelForRows(configuration, GradientRows, &job);
+            }
+            break;
+
+        default:
+            PG_FAILSTR("Unsupported number of bytes per pixel (%d) for GradientGenerator", numBytesPerPixel);
     }
+
     PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
 }
 
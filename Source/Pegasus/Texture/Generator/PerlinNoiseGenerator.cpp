@@ -0,0 +1,72 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PerlinNoiseGenerator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture generator that renders Perlin noise
+
+#include "Pegasus/Texture/Generator/PerlinNoiseGenerator.h"
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/TextureNoise.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(PerlinNoiseGenerator)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Seed)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Frequency)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, NumOctaves)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Lacunarity)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Gain)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Color0)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Color1)
+END_IMPLEMENT_PROPERTIES(PerlinNoiseGenerator)
+
+//----------------------------------------------------------------------------------------
+
+void PerlinNoiseGenerator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(PerlinNoiseGenerator)
+        INIT_PROPERTY(Seed)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(NumOctaves)
+        INIT_PROPERTY(Lacunarity)
+        INIT_PROPERTY(Gain)
+        INIT_PROPERTY(Color0)
+        INIT_PROPERTY(Color1)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void PerlinNoiseGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    NoiseParameters parameters;
+    parameters.mType = NOISE_PERLIN;
+    parameters.mSeed = GetSeed();
+    parameters.mFrequency = GetFrequency();
+    parameters.mNumOctaves = GetNumOctaves();
+    parameters.mLacunarity = GetLacunarity();
+    parameters.mGain = GetGain();
+    parameters.mColor0 = GetColor0();
+    parameters.mColor1 = GetColor1();
+    GenerateNoise(data, GetConfiguration(), parameters);
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -10,9 +10,10 @@
 //! \brief	Texture generator that renders randomly located pixels
 
 #include "Pegasus/Texture/Generator/PixelsGenerator.h"
+#include "Pegasus/Texture/TextureKernels.h"
+#include "Pegasus/Core/WorkerPool.h"
 #include "Pegasus/Math/Types.h"
-#include "Pegasus/Utils/Memset.h"
-#include <stdlib.h>
+#include "Pegasus/Utils/Random.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -29,26 +30,57 @@ END_IMPLEMENT_PROPERTIES(PixelsGenerator)
 
 namespace Internal {
 
-//! \todo Implement PG_STATIC_ASSERT
-// PG_STATIC_ASSERT(RAND_MAX == 0x7FFF);
+//! Minimum number of random pixels drawn from each stream of random numbers
+static const unsigned int MIN_PIXELS_PER_STREAM = 4096;
 
-//! Number of bits to shift to have a division by RAND_MAX + 1
-static const unsigned int RAND_MAX_SHIFT = 15;
+//! Maximum number of streams of random numbers per layer
+static const unsigned int MAX_NUM_STREAMS = 64;
 
-//! Choose a random pixel in the texture, given its dimensions
-//! \param width  Width of the texture in pixels  (0 < width  < 65536)
-//! \param height Height of the texture in pixels (0 < height < 65536)
-//! \param depth  Depth of the texture in pixels  (0 < depth  < 65536)
-//! \return Offset into the linear texture, in pixels
-static inline unsigned int ChooseRandomPixel(unsigned int width,
-                                             unsigned int height,
-                                             unsigned int depth)
+//! Parameters of the pixels kernels
+struct PixelsJob
 {
-    const unsigned int px = (static_cast<unsigned int>(rand()) * width ) >> RAND_MAX_SHIFT;
-    const unsigned int py = (static_cast<unsigned int>(rand()) * height) >> RAND_MAX_SHIFT;
-    const unsigned int pz = (static_cast<unsigned int>(rand()) * depth ) >> RAND_MAX_SHIFT;
+    TextureData * mData;
+    unsigned int mWidth;
+    unsigned int mHeight;
+    unsigned int mDepth;
+    unsigned int mBackColor32;
+    unsigned int mColor32;
+    unsigned int mNumPixels;                        //!< Number of random pixels per layer
+    unsigned int mNumRows;                          //!< Number of rows per layer, (depth * height)
+    unsigned int mNumStreams;                       //!< Number of streams, each one drawing in its own band of rows
+    unsigned int mLayer;                            //!< Layer receiving the random pixels
+    Utils::Random mStreams[MAX_NUM_STREAMS];        //!< Non-overlapping streams of random numbers of the layer
+};
+
+//! Fill rows of a layer with the background color
+static void BackgroundRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const PixelsJob * job = static_cast<const PixelsJob *>(userData);
+    unsigned char * rowData = job->mData->GetLayerImageData(layer) + beginRow * job->mWidth * 4;
+    FillPixels32(rowData, job->mBackColor32, (endRow - beginRow) * job->mWidth);
+}
 
-    return (pz * height + py) * width + px;
+//! Render the random pixels of a range of streams.
+//! Each stream draws in its own band of rows, with a number of pixels proportional to the size of the band,
+//! so the streams running concurrently never write the same pixel
+static void RandomPixelsStreams(void * userData, unsigned int beginStream, unsigned int endStream)
+{
+    PixelsJob * job = static_cast<PixelsJob *>(userData);
+    unsigned int * layerData32 = reinterpret_cast<unsigned int *>(job->mData->GetLayerImageData(job->mLayer));
+    for (unsigned int s = beginStream; s < endStream; ++s)
+    {
+        Utils::Random & random = job->mStreams[s];
+        const unsigned int beginRow = static_cast<unsigned int>(static_cast<unsigned long long>(job->mNumRows) * s / job->mNumStreams);
+        const unsigned int endRow = static_cast<unsigned int>(static_cast<unsigned long long>(job->mNumRows) * (s + 1) / job->mNumStreams);
+        const unsigned int beginPixel = static_cast<unsigned int>(static_cast<unsigned long long>(job->mNumPixels) * beginRow / job->mNumRows);
+        const unsigned int endPixel = static_cast<unsigned int>(static_cast<unsigned long long>(job->mNumPixels) * endRow / job->mNumRows);
+        for (unsigned int p = beginPixel; p < endPixel; ++p)
+        {
+            const unsigned int px = random.NextUInt32(job->mWidth);
+            const unsigned int row = beginRow + random.NextUInt32(endRow - beginRow);
+            layerData32[row * job->mWidth + px] = job->mColor32;
+        }
+    }
 }
 
 }   // namespace Internal
@@ -77,48 +109,57 @@ void PixelsGenerator::GenerateData()
     TextureData * data = static_cast<TextureData *>(&(*dataRef));
     PG_ASSERT(data != nullptr);
 
-    const Math::PUInt32 backColor32 = GetBackgroundColor().rgba32;
-    const Math::PUInt32 color0_32 = GetColor0().rgba32;
-    
     const TextureConfiguration & configuration = GetConfiguration();
-    const unsigned int width  = configuration.GetWidth ();
-    const unsigned int height = configuration.GetHeight();
-    const unsigned int depth  = configuration.GetDepth ();
     const unsigned int numBytesPerPixel = configuration.GetNumBytesPerPixel();
     const unsigned int numLayers = configuration.GetNumLayers();
-    const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
-
-    const unsigned int numPixelsToRender = GetNumPixels();
-
-    // Initialize the random number generator
-    srand(GetSeed());
 
-    unsigned char * layerData;
-    Math::PUInt32 * layerData32;
-    unsigned int layer, p;
-
-    // For each layer
-    for (layer = 0; layer < numLayers; ++layer)
+    switch (numBytesPerPixel)
     {
-        layerData = data->GetLayerImageData(layer);
-
-        switch (numBytesPerPixel)
-        {
-            case 4:
-                // For each background pixel, copy the background color
-                layerData32 = reinterpret_cast<Math::PUInt32 *>(layerData);
-                Utils::Memset32(layerData32, backColor32, numBytesPerLayer);
+        case 4:
+            {
+                Internal::PixelsJob job;
+                job.mData = data;
+                job.mWidth  = configuration.GetWidth ();
+                job.mHeight = configuration.GetHeight();
+                job.mDepth  = configuration.GetDepth ();
+                job.mBackColor32 = static_cast<unsigned int>(GetBackgroundColor().rgba32);
+                job.mColor32 = static_cast<unsigned int>(GetColor0().rgba32);
+                job.mNumPixels = GetNumPixels();
+
+                // For each background pixel of each layer, copy the background color
+                ParallelForRows(configuration, Internal::BackgroundRows, &job);
+
+                // The random pixels of each layer are split into streams drawing in disjoint bands of rows,
+                // each stream starting 2^64 numbers after the previous one. The split only depends on the number
+                // of pixels and on the resolution, so the result does not depend on the number of threads
+                job.mNumRows = job.mHeight * job.mDepth;
+                unsigned int numStreams = (job.mNumPixels + Internal::MIN_PIXELS_PER_STREAM - 1) / Internal::MIN_PIXELS_PER_STREAM;
+                if (numStreams > Internal::MAX_NUM_STREAMS)
+                {
+                    numStreams = Internal::MAX_NUM_STREAMS;
+                }
+                if (numStreams > job.mNumRows)
+                {
+                    numStreams = job.mNumRows;
+                }
+                job.mNumStreams = numStreams;
 
-                // For each random pixel
-                for (p = 0; p < numPixelsToRender; ++p)
+                Utils::Random random(GetSeed());
+                for (unsigned int layer = 0; layer < numLayers; ++layer)
                 {
-                    layerData32[Internal::ChooseRandomPixel(width, height, depth)] = color0_32;
+                    job.mLayer = layer;
+                    for (unsigned int s = 0; s < numStreams; ++s)
+                    {
+                        job.mStreams[s] = random;
+                        random.Jump();
+                    }
+                    Core::ParallelFor(numStreams, 1, Internal::RandomPixelsStreams, &job);
                 }
+            }
             break;
 
-            default:
-                PG_FAILSTR("Unsupported number of bytes per pixel (%d) for PixelsGenerator", numBytesPerPixel);
-        }
+        default:
+            PG_FAILSTR("Unsupported number of bytes per pixel (%d) for PixelsGenerator", numBytesPerPixel);
     }
 
     PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
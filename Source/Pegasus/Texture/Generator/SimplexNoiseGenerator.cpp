@@ -0,0 +1,72 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimplexNoiseGenerator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture generator that renders simplex noise
+
+#include "Pegasus/Texture/Generator/SimplexNoiseGenerator.h"
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/TextureNoise.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(SimplexNoiseGenerator)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, Seed)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, Frequency)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, NumOctaves)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, Lacunarity)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, Gain)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, Color0)
+    IMPLEMENT_PROPERTY(SimplexNoiseGenerator, Color1)
+END_IMPLEMENT_PROPERTIES(SimplexNoiseGenerator)
+
+//----------------------------------------------------------------------------------------
+
+void SimplexNoiseGenerator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(SimplexNoiseGenerator)
+        INIT_PROPERTY(Seed)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(NumOctaves)
+        INIT_PROPERTY(Lacunarity)
+        INIT_PROPERTY(Gain)
+        INIT_PROPERTY(Color0)
+        INIT_PROPERTY(Color1)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void SimplexNoiseGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    NoiseParameters parameters;
+    parameters.mType = NOISE_SIMPLEX;
+    parameters.mSeed = GetSeed();
+    parameters.mFrequency = GetFrequency();
+    parameters.mNumOctaves = GetNumOctaves();
+    parameters.mLacunarity = GetLacunarity();
+    parameters.mGain = GetGain();
+    parameters.mColor0 = GetColor0();
+    parameters.mColor1 = GetColor1();
+    GenerateNoise(data, GetConfiguration(), parameters);
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
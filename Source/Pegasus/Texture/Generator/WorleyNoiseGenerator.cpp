@@ -0,0 +1,72 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WorleyNoiseGenerator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture generator that renders Worley (cellular) noise
+
+#include "Pegasus/Texture/Generator/WorleyNoiseGenerator.h"
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/TextureNoise.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(WorleyNoiseGenerator)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, Seed)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, Frequency)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, NumOctaves)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, Lacunarity)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, Gain)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, Color0)
+    IMPLEMENT_PROPERTY(WorleyNoiseGenerator, Color1)
+END_IMPLEMENT_PROPERTIES(WorleyNoiseGenerator)
+
+//----------------------------------------------------------------------------------------
+
+void WorleyNoiseGenerator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(WorleyNoiseGenerator)
+        INIT_PROPERTY(Seed)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(NumOctaves)
+        INIT_PROPERTY(Lacunarity)
+        INIT_PROPERTY(Gain)
+        INIT_PROPERTY(Color0)
+        INIT_PROPERTY(Color1)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void WorleyNoiseGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    NoiseParameters parameters;
+    parameters.mType = NOISE_WORLEY;
+    parameters.mSeed = GetSeed();
+    parameters.mFrequency = GetFrequency();
+    parameters.mNumOctaves = GetNumOctaves();
+    parameters.mLacunarity = GetLacunarity();
+    parameters.mGain = GetGain();
+    parameters.mColor0 = GetColor0();
+    parameters.mColor1 = GetColor1();
+    GenerateNoise(data, GetConfiguration(), parameters);
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -11,7 +11,7 @@
 
 #include "Pegasus/Texture/Shared/TextureEventDefs.h"
 #include "Pegasus/Texture/Operator/AddOperator.h"
-#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Texture/TextureKernels.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -41,68 +41,11 @@ void AddOperator::GenerateData()
     TextureData * data = static_cast<TextureData *>(&(*dataRef));
     PG_ASSERT(data != nullptr);
 
-    const TextureConfiguration & configuration = GetConfiguration();
-    const unsigned int numLayers = configuration.GetNumLayers();
-    const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
-
-    unsigned char * layerData;
-    const TextureData * inputData;
-    const unsigned char * inputLayerData;
-    unsigned int layer, b;
-    unsigned short addedValue;
-    bool updated;
-
-    // Copy the first input texture
-    for (layer = 0; layer < numLayers; ++layer)
-    {
-        //! \todo Use a simpler syntax
-        updated = false;
-        inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
-        inputLayerData = inputData->GetLayerImageData(layer);
-        layerData = data->GetLayerImageData(layer);
-
-        Utils::Memcpy(layerData, inputLayerData, numBytesPerLayer);
-    }
-
-    // For each extra input texture to add
-    const unsigned int numInputs = GetNumInputs();
-    unsigned int input;
-    for (input = 1; input < numInputs; ++input)
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    const unsigned int numInputs = GetUpdatedInputData(inputData);
+    if (numInputs > 0)
     {
-        //! \todo Use a simpler syntax
-        updated = false;
-        inputData = static_cast<TextureData *>(&(*GetInput(input)->GetUpdatedData(updated)));
-
-        for (layer = 0; layer < numLayers; ++layer)
-        {
-            inputLayerData = inputData->GetLayerImageData(layer);
-            layerData = data->GetLayerImageData(layer);
-
-            if (GetClamp())
-            {
-                // For each component of each pixel, perform the addition
-                for (b = 0; b < numBytesPerLayer; ++b)
-                {
-                    // Add the values and clamp
-                    addedValue = static_cast<unsigned short>(layerData[b]) + static_cast<unsigned short>(inputLayerData[b]);
-                    if (addedValue > 255)
-                    {
-                        addedValue = 255;
-                    }
-                    layerData[b] = static_cast<unsigned char>(addedValue);
-                }
-            }
-            else
-            {
-                // For each component of each pixel, perform the addition
-                for (b = 0; b < numBytesPerLayer; ++b)
-                {
-                    // Cannot use += on unsigned chars with no masking.
-                    // When overflowing, the runtime can detect the loss of data
-                    layerData[b] = static_cast<unsigned char>((layerData[b] + inputLayerData[b]) & 0xFF);
-                }
-            }
-        }
+        BlendTextures(data, inputData, numInputs, GetClamp() ? BLEND_ADD_SATURATE : BLEND_ADD);
     }
 
     PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
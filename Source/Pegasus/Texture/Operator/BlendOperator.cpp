@@ -0,0 +1,65 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlendOperator.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Base class of the texture operators combining an arbitrary number of textures with a blend mode
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BlendOperator::BlendOperator(BlendMode blendMode, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
+:   TextureOperator(nodeAllocator, nodeDataAllocator),
+    mBlendMode(blendMode)
+{
+    PG_ASSERTSTR(blendMode < NUM_BLEND_MODES, "Invalid blend mode (%d)", blendMode);
+}
+
+//----------------------------------------------------------------------------------------
+
+BlendOperator::BlendOperator(BlendMode blendMode, const TextureConfiguration & configuration,
+                             Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
+:   TextureOperator(configuration, nodeAllocator, nodeDataAllocator),
+    mBlendMode(blendMode)
+{
+    PG_ASSERTSTR(blendMode < NUM_BLEND_MODES, "Invalid blend mode (%d)", blendMode);
+}
+
+//----------------------------------------------------------------------------------------
+
+BlendOperator::~BlendOperator()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlendOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    const unsigned int numInputs = GetUpdatedInputData(inputData);
+    if (numInputs > 0)
+    {
+        BlendTextures(data, inputData, numInputs, mBlendMode);
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
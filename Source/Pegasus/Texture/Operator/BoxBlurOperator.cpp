@@ -0,0 +1,56 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BoxBlurOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that blurs a texture with a box filter
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/BoxBlurOperator.h"
+#include "Pegasus/Texture/TextureFilters.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(BoxBlurOperator)
+    IMPLEMENT_PROPERTY(BoxBlurOperator, Radius)
+END_IMPLEMENT_PROPERTIES(BoxBlurOperator)
+
+//----------------------------------------------------------------------------------------
+
+void BoxBlurOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(BoxBlurOperator)
+        INIT_PROPERTY(Radius)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoxBlurOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    if (GetUpdatedInputData(inputData) == 1)
+    {
+        const unsigned int radius = (GetRadius() < FILTER_MAX_RADIUS) ? GetRadius() : FILTER_MAX_RADIUS;
+        BoxBlurTexture(data, inputData[0], radius, GetNodeDataAllocator());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,138 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ConvolutionOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that convolves a texture with a 3x3 or 5x5 kernel
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/ConvolutionOperator.h"
+#include "Pegasus/Texture/TextureFilters.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(ConvolutionOperator)
+    IMPLEMENT_PROPERTY(ConvolutionOperator, Kernel)
+    IMPLEMENT_PROPERTY(ConvolutionOperator, Row0)
+    IMPLEMENT_PROPERTY(ConvolutionOperator, Row1)
+    IMPLEMENT_PROPERTY(ConvolutionOperator, Row2)
+    IMPLEMENT_PROPERTY(ConvolutionOperator, Scale)
+    IMPLEMENT_PROPERTY(ConvolutionOperator, Bias)
+END_IMPLEMENT_PROPERTIES(ConvolutionOperator)
+
+//----------------------------------------------------------------------------------------
+
+//! Weights of the 3x3 preset kernels, from CONVOLUTION_SHARPEN_3X3
+static const float sPresetKernels3x3[][9] =
+{
+    {  0.0f, -1.0f,  0.0f,
+      -1.0f,  5.0f, -1.0f,
+       0.0f, -1.0f,  0.0f },
+
+    { -1.0f, -1.0f, -1.0f,
+      -1.0f,  8.0f, -1.0f,
+      -1.0f, -1.0f, -1.0f },
+
+    { -2.0f, -1.0f,  0.0f,
+      -1.0f,  1.0f,  1.0f,
+       0.0f,  1.0f,  2.0f }
+};
+
+//! Binomial weights of the 5x5 Gaussian kernel, to be divided by 256
+static const float sBinomialKernel5x5[25] =
+{
+    1.0f,  4.0f,  6.0f,  4.0f, 1.0f,
+    4.0f, 16.0f, 24.0f, 16.0f, 4.0f,
+    6.0f, 24.0f, 36.0f, 24.0f, 6.0f,
+    4.0f, 16.0f, 24.0f, 16.0f, 4.0f,
+    1.0f,  4.0f,  6.0f,  4.0f, 1.0f
+};
+
+//----------------------------------------------------------------------------------------
+
+void ConvolutionOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(ConvolutionOperator)
+        INIT_PROPERTY(Kernel)
+        INIT_PROPERTY(Row0)
+        INIT_PROPERTY(Row1)
+        INIT_PROPERTY(Row2)
+        INIT_PROPERTY(Scale)
+        INIT_PROPERTY(Bias)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConvolutionOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    // Weights of the selected kernel, with the scale applied
+    float kernel[FILTER_MAX_KERNEL_SIZE * FILTER_MAX_KERNEL_SIZE];
+    unsigned int size = 3;
+    const float scale = GetScale();
+    switch (GetKernel())
+    {
+        case CONVOLUTION_SHARPEN_3X3:
+        case CONVOLUTION_EDGES_3X3:
+        case CONVOLUTION_EMBOSS_3X3:
+            for (unsigned int w = 0; w < 9; ++w)
+            {
+                kernel[w] = scale * sPresetKernels3x3[GetKernel() - CONVOLUTION_SHARPEN_3X3][w];
+            }
+            break;
+
+        case CONVOLUTION_GAUSSIAN_5X5:
+            size = 5;
+            for (unsigned int w = 0; w < 25; ++w)
+            {
+                kernel[w] = scale * sBinomialKernel5x5[w] * (1.0f / 256.0f);
+            }
+            break;
+
+        case CONVOLUTION_UNSHARP_5X5:
+            size = 5;
+            for (unsigned int w = 0; w < 25; ++w)
+            {
+                kernel[w] = -scale * sBinomialKernel5x5[w] * (1.0f / 256.0f);
+            }
+            kernel[12] += 2.0f * scale;
+            break;
+
+        default:
+            {
+                const Math::Vec3 rows[3] = { GetRow0(), GetRow1(), GetRow2() };
+                for (unsigned int r = 0; r < 3; ++r)
+                {
+                    kernel[r * 3    ] = scale * rows[r].x;
+                    kernel[r * 3 + 1] = scale * rows[r].y;
+                    kernel[r * 3 + 2] = scale * rows[r].z;
+                }
+            }
+            break;
+    }
+
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    if (GetUpdatedInputData(inputData) == 1)
+    {
+        ConvolveTexture(data, inputData[0], kernel, size, GetBias());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
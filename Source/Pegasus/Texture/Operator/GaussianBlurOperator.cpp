@@ -0,0 +1,55 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GaussianBlurOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that blurs a texture with a Gaussian filter
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/GaussianBlurOperator.h"
+#include "Pegasus/Texture/TextureFilters.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(GaussianBlurOperator)
+    IMPLEMENT_PROPERTY(GaussianBlurOperator, Sigma)
+END_IMPLEMENT_PROPERTIES(GaussianBlurOperator)
+
+//----------------------------------------------------------------------------------------
+
+void GaussianBlurOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(GaussianBlurOperator)
+        INIT_PROPERTY(Sigma)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void GaussianBlurOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    if (GetUpdatedInputData(inputData) == 1)
+    {
+        GaussianBlurTexture(data, inputData[0], GetSigma(), GetNodeDataAllocator());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,46 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LerpOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that interpolates between two textures using a mask texture
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/LerpOperator.h"
+#include "Pegasus/Texture/TextureKernels.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+void LerpOperator::InitProperties()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void LerpOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    if (GetUpdatedInputData(inputData) == 3)
+    {
+        LerpTextures(data, inputData[0], inputData[1], inputData[2]);
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,24 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MaxOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that keeps the maximum of an arbitrary number of textures
+
+#include "Pegasus/Texture/Operator/MaxOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+void MaxOperator::InitProperties()
+{
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
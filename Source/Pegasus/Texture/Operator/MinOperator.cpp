@@ -0,0 +1,24 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MinOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that keeps the minimum of an arbitrary number of textures
+
+#include "Pegasus/Texture/Operator/MinOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+void MinOperator::InitProperties()
+{
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
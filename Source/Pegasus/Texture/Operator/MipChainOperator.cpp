@@ -0,0 +1,105 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MipChainOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that builds the mip chain of its input texture
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/MipChainOperator.h"
+#include "Pegasus/Texture/TextureMips.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(MipChainOperator)
+    IMPLEMENT_PROPERTY(MipChainOperator, KaiserFilter)
+END_IMPLEMENT_PROPERTIES(MipChainOperator)
+
+//----------------------------------------------------------------------------------------
+
+void MipChainOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(MipChainOperator)
+        INIT_PROPERTY(KaiserFilter)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void MipChainOperator::GetMipChainConfiguration(TextureConfiguration & configuration) const
+{
+    const TextureConfiguration & operatorConfiguration = GetConfiguration();
+    if (operatorConfiguration.GetNumMipLevels() > 1)
+    {
+        configuration = operatorConfiguration;
+    }
+    else
+    {
+        configuration = TextureConfiguration(operatorConfiguration.GetType(),
+                                             operatorConfiguration.GetPixelFormat(),
+                                             operatorConfiguration.GetWidth(),
+                                             operatorConfiguration.GetHeight(),
+                                             operatorConfiguration.GetDepth(),
+                                             operatorConfiguration.GetNumLayers(),
+                                             0);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+Graph::NodeData * MipChainOperator::AllocateData() const
+{
+    TextureConfiguration configuration;
+    GetMipChainConfiguration(configuration);
+    return PG_NEW(GetNodeDataAllocator(), -1, "MipChainOperator::TextureData", Pegasus::Alloc::PG_MEM_TEMP)
+                  TextureData(configuration, GetNodeDataAllocator());
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long MipChainOperator::HashConfiguration(unsigned long long key) const
+{
+    TextureConfiguration configuration;
+    GetMipChainConfiguration(configuration);
+    return configuration.Hash(key);
+}
+
+//----------------------------------------------------------------------------------------
+
+void MipChainOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    const TextureData * inputData[MAX_NUM_INPUTS];
+    if (GetUpdatedInputData(inputData) == 1)
+    {
+        // Level 0 is at the start of each layer, whatever the number of levels of the input
+        const TextureConfiguration & configuration = data->GetConfiguration();
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numBytes = configuration.GetNumBytesPerMip(0);
+        for (unsigned int layer = 0; layer < numLayers; ++layer)
+        {
+            Utils::Memcpy(data->GetLayerImageData(layer), inputData[0]->GetLayerImageData(layer), numBytes);
+        }
+
+        GenerateMipChain(data, GetKaiserFilter() ? MIP_FILTER_KAISER : MIP_FILTER_BOX);
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,24 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MultiplyOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that multiplies an arbitrary number of textures together
+
+#include "Pegasus/Texture/Operator/MultiplyOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+void MultiplyOperator::InitProperties()
+{
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,24 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ScreenOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that screens an arbitrary number of textures together
+
+#include "Pegasus/Texture/Operator/ScreenOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+void ScreenOperator::InitProperties()
+{
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
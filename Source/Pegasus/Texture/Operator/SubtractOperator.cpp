@@ -0,0 +1,24 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SubtractOperator.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that subtracts textures from the first input texture
+
+#include "Pegasus/Texture/Operator/SubtractOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+void SubtractOperator::InitProperties()
+{
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -107,6 +107,10 @@ void Texture::SetOperatorInput(TextureOperatorIn textureOperator)
 TextureDataReturn Texture::GetUpdatedTextureData()
 {
     PG_ASSERT(mFactory);
+
+    // Shared subgraphs are evaluated once, by the scheduler then by the pull of the data
+    Graph::EvaluationPass evaluationPass;
+    EvaluateInputGraph();
     bool updated = false;
     TextureDataRef textureData = Graph::OutputNode::GetUpdatedData(updated);
     if (textureData->IsGPUDataDirty())
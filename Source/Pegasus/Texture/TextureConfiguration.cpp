@@ -11,6 +11,7 @@
 //!         between nodes to link them
 
 #include "Pegasus/Texture/TextureConfiguration.h"
+#include "Pegasus/Utils/Hash.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -23,6 +24,7 @@ TextureConfiguration::TextureConfiguration()
 ,   mHeight(256)
 ,   mDepth(1)
 ,   mNumLayers(1)
+,   mNumMipLevels(1)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -36,7 +38,8 @@ TextureConfiguration::TextureConfiguration(Type type,
                                            unsigned int width,
                                            unsigned int height,
                                            unsigned int depth,
-                                           unsigned int numLayers)
+                                           unsigned int numLayers,
+                                           unsigned int numMipLevels)
 #if PEGASUS_ENABLE_PROXIES
 :   mProxy(this)
 #endif
@@ -142,6 +145,22 @@ TextureConfiguration::TextureConfiguration(Type type,
         PG_ASSERTSTR(numLayers == 1, "Invalid number of layers for a non-array texture (%d), it must be == 1", numLayers);
         mNumLayers = 1;
     }
+
+    // Number of mip levels
+    const unsigned int maxNumMipLevels = GetMaxNumMipLevels(mWidth, mHeight, mDepth);
+    if (numMipLevels == 0)
+    {
+        mNumMipLevels = maxNumMipLevels;
+    }
+    else if (numMipLevels <= maxNumMipLevels)
+    {
+        mNumMipLevels = numMipLevels;
+    }
+    else
+    {
+        PG_FAILSTR("Invalid number of mip levels for a texture (%d), it must be <= %d", numMipLevels, maxNumMipLevels);
+        mNumMipLevels = maxNumMipLevels;
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -164,6 +183,7 @@ TextureConfiguration & TextureConfiguration::operator=(const TextureConfiguratio
     PG_ASSERT(other.mHeight >= 1);
     PG_ASSERT(other.mDepth >= 1);
     PG_ASSERT(other.mNumLayers >= 1);
+    PG_ASSERT(other.mNumMipLevels >= 1);
 
     mType = other.mType;
     mPixelFormat = other.mPixelFormat;
@@ -171,6 +191,7 @@ TextureConfiguration & TextureConfiguration::operator=(const TextureConfiguratio
     mHeight = other.mHeight;
     mDepth = other.mDepth;
     mNumLayers = other.mNumLayers;
+    mNumMipLevels = other.mNumMipLevels;
 
     return *this;
 }
@@ -193,6 +214,34 @@ unsigned int TextureConfiguration::GetNumBytesPerPixel() const
 
 //----------------------------------------------------------------------------------------
 
+unsigned int TextureConfiguration::GetMaxNumMipLevels(unsigned int width, unsigned int height, unsigned int depth)
+{
+    unsigned int size = (width > height) ? width : height;
+    size = (size > depth) ? size : depth;
+    unsigned int numMipLevels = 1;
+    while (size > 1)
+    {
+        size >>= 1;
+        ++numMipLevels;
+    }
+    return numMipLevels;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int TextureConfiguration::GetMipOffset(unsigned int level) const
+{
+    PG_ASSERTSTR(level <= mNumMipLevels, "Invalid mip level (%d), it must be <= %d", level, mNumMipLevels);
+    unsigned int numPixels = 0;
+    for (unsigned int l = 0; l < level; ++l)
+    {
+        numPixels += GetNumPixelsPerMip(l);
+    }
+    return numPixels * GetNumBytesPerPixel();
+}
+
+//----------------------------------------------------------------------------------------
+
 bool TextureConfiguration::IsCompatible(const TextureConfiguration & configuration) const
 {
     return    (configuration.mType == mType)
@@ -203,6 +252,15 @@ bool TextureConfiguration::IsCompatible(const TextureConfiguration & configurati
            && (configuration.mNumLayers == mNumLayers);
 }
 
+//----------------------------------------------------------------------------------------
+
+unsigned long long TextureConfiguration::Hash(unsigned long long key) const
+{
+    const unsigned int fields[] = { static_cast<unsigned int>(mType), static_cast<unsigned int>(mPixelFormat),
+                                    mWidth, mHeight, mDepth, mNumLayers, mNumMipLevels };
+    return Utils::HashFnv1a64(fields, sizeof(fields), key);
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
@@ -10,6 +10,8 @@
 //! \brief	Texture node data, used by all texture nodes, including generators and operators
 
 #include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Memcpy.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -41,6 +43,61 @@ TextureData::~TextureData()
     PG_DELETE_ARRAY(GetAllocator(), mImageData);
 }
 
+//----------------------------------------------------------------------------------------
+
+bool TextureData::CopyContent(const Graph::NodeData & source)
+{
+    const TextureData & sourceTexture = static_cast<const TextureData &>(source);
+    const TextureConfiguration & sourceConfiguration = sourceTexture.GetConfiguration();
+    if (   (sourceConfiguration.GetNumLayers() != mConfiguration.GetNumLayers())
+        || (sourceConfiguration.GetNumBytesPerLayer() != mConfiguration.GetNumBytesPerLayer()))
+    {
+        PG_FAILSTR("Trying to copy texture data with a different configuration");
+        return false;
+    }
+
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
+    const unsigned int numBytesPerLayer = mConfiguration.GetNumBytesPerLayer();
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        Utils::Memcpy(mImageData[layer], sourceTexture.mImageData[layer], numBytesPerLayer);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool TextureData::WriteContent(Utils::ByteStream & stream) const
+{
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
+    const unsigned int numBytesPerLayer = mConfiguration.GetNumBytesPerLayer();
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        stream.Append(mImageData[layer], static_cast<int>(numBytesPerLayer));
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool TextureData::ReadContent(const void * buffer, unsigned int size)
+{
+    if (size != mConfiguration.GetNumBytes())
+    {
+        return false;
+    }
+
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
+    const unsigned int numBytesPerLayer = mConfiguration.GetNumBytesPerLayer();
+    const unsigned char * layerData = static_cast<const unsigned char *>(buffer);
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        Utils::Memcpy(mImageData[layer], layerData, numBytesPerLayer);
+        layerData += numBytesPerLayer;
+    }
+    return true;
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
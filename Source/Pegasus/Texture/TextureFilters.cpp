@@ -0,0 +1,521 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureFilters.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU image filters (blurs and convolutions) shared by the texture operators
+
+#include "Pegasus/Texture/TextureFilters.h"
+#include "Pegasus/Texture/TextureKernels.h"
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+#include <math.h>
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+// The filters process one RGBA pixel per vector, the 4 components being the 4 lanes.
+// The SSE2 and scalar versions of each operation give the same bits
+// (no fused multiply-add, same rounding, same operation order), so the results do not depend on the instruction set.
+
+//! Number of pixels of a row processed at once, so the intermediate values fit on the stack
+static const unsigned int FILTER_CHUNK_WIDTH = 64;
+
+//! Four floating point components of a pixel
+struct Pixel4
+{
+#if PEGASUS_ENABLE_SSE2
+    __m128 v;
+#else
+    float v[4];
+#endif
+};
+
+//! Four 32-bit integer sums of pixel components
+struct Sum4
+{
+#if PEGASUS_ENABLE_SSE2
+    __m128i v;
+#else
+    unsigned int v[4];
+#endif
+};
+
+#if PEGASUS_ENABLE_SSE2
+
+static inline Pixel4 SplatPixel(float f) { Pixel4 r; r.v = _mm_set1_ps(f); return r; }
+static inline Pixel4 LoadPixel(const float * p) { Pixel4 r; r.v = _mm_loadu_ps(p); return r; }
+static inline void StorePixel(float * p, Pixel4 a) { _mm_storeu_ps(p, a.v); }
+static inline Pixel4 AddPixels(Pixel4 a, Pixel4 b) { Pixel4 r; r.v = _mm_add_ps(a.v, b.v); return r; }
+static inline Pixel4 MulPixels(Pixel4 a, Pixel4 b) { Pixel4 r; r.v = _mm_mul_ps(a.v, b.v); return r; }
+
+//! Expand the 4 bytes of a pixel into 4 32-bit integers
+static inline __m128i ExpandBytes(const unsigned char * p)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bytes = _mm_cvtsi32_si128(*reinterpret_cast<const int *>(p));
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero);
+}
+
+static inline Pixel4 LoadPixelBytes(const unsigned char * p) { Pixel4 r; r.v = _mm_cvtepi32_ps(ExpandBytes(p)); return r; }
+
+//! Round the components of a pixel to the nearest, clamp them to [0, 255] and store them as bytes
+static inline void StorePixelBytes(unsigned char * p, Pixel4 a)
+{
+    __m128 v = _mm_add_ps(a.v, _mm_set1_ps(0.5f));
+    v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+    __m128i i = _mm_cvttps_epi32(v);
+    i = _mm_packs_epi32(i, i);
+    *reinterpret_cast<int *>(p) = _mm_cvtsi128_si32(_mm_packus_epi16(i, i));
+}
+
+static inline Sum4 ZeroSum() { Sum4 r; r.v = _mm_setzero_si128(); return r; }
+static inline Sum4 LoadSum(const unsigned int * p) { Sum4 r; r.v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p)); return r; }
+static inline void StoreSum(unsigned int * p, Sum4 a) { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), a.v); }
+static inline Sum4 AddSums(Sum4 a, Sum4 b) { Sum4 r; r.v = _mm_add_epi32(a.v, b.v); return r; }
+static inline Sum4 SubSums(Sum4 a, Sum4 b) { Sum4 r; r.v = _mm_sub_epi32(a.v, b.v); return r; }
+static inline Sum4 AddSumBytes(Sum4 a, const unsigned char * p) { Sum4 r; r.v = _mm_add_epi32(a.v, ExpandBytes(p)); return r; }
+static inline Sum4 SubSumBytes(Sum4 a, const unsigned char * p) { Sum4 r; r.v = _mm_sub_epi32(a.v, ExpandBytes(p)); return r; }
+static inline Pixel4 SumToPixel(Sum4 a) { Pixel4 r; r.v = _mm_cvtepi32_ps(a.v); return r; }
+
+#else
+
+static inline Pixel4 SplatPixel(float f) { Pixel4 r; for (int l = 0; l < 4; ++l) r.v[l] = f; return r; }
+static inline Pixel4 LoadPixel(const float * p) { Pixel4 r; for (int l = 0; l < 4; ++l) r.v[l] = p[l]; return r; }
+static inline void StorePixel(float * p, Pixel4 a) { for (int l = 0; l < 4; ++l) p[l] = a.v[l]; }
+static inline Pixel4 AddPixels(Pixel4 a, Pixel4 b) { Pixel4 r; for (int l = 0; l < 4; ++l) r.v[l] = a.v[l] + b.v[l]; return r; }
+static inline Pixel4 MulPixels(Pixel4 a, Pixel4 b) { Pixel4 r; for (int l = 0; l < 4; ++l) r.v[l] = a.v[l] * b.v[l]; return r; }
+static inline Pixel4 LoadPixelBytes(const unsigned char * p) { Pixel4 r; for (int l = 0; l < 4; ++l) r.v[l] = static_cast<float>(p[l]); return r; }
+
+//! Round the components of a pixel to the nearest, clamp them to [0, 255] and store them as bytes
+static inline void StorePixelBytes(unsigned char * p, Pixel4 a)
+{
+    for (int l = 0; l < 4; ++l)
+    {
+        float v = a.v[l] + 0.5f;
+        v = (v > 0.0f) ? v : 0.0f;
+        v = (v < 255.0f) ? v : 255.0f;
+        p[l] = static_cast<unsigned char>(v);
+    }
+}
+
+static inline Sum4 ZeroSum() { Sum4 r; for (int l = 0; l < 4; ++l) r.v[l] = 0; return r; }
+static inline Sum4 LoadSum(const unsigned int * p) { Sum4 r; for (int l = 0; l < 4; ++l) r.v[l] = p[l]; return r; }
+static inline void StoreSum(unsigned int * p, Sum4 a) { for (int l = 0; l < 4; ++l) p[l] = a.v[l]; }
+static inline Sum4 AddSums(Sum4 a, Sum4 b) { Sum4 r; for (int l = 0; l < 4; ++l) r.v[l] = a.v[l] + b.v[l]; return r; }
+static inline Sum4 SubSums(Sum4 a, Sum4 b) { Sum4 r; for (int l = 0; l < 4; ++l) r.v[l] = a.v[l] - b.v[l]; return r; }
+static inline Sum4 AddSumBytes(Sum4 a, const unsigned char * p) { Sum4 r; for (int l = 0; l < 4; ++l) r.v[l] = a.v[l] + p[l]; return r; }
+static inline Sum4 SubSumBytes(Sum4 a, const unsigned char * p) { Sum4 r; for (int l = 0; l < 4; ++l) r.v[l] = a.v[l] - p[l]; return r; }
+static inline Pixel4 SumToPixel(Sum4 a) { Pixel4 r; for (int l = 0; l < 4; ++l) r.v[l] = static_cast<float>(static_cast<int>(a.v[l])); return r; }
+
+#endif  // PEGASUS_ENABLE_SSE2
+
+//----------------------------------------------------------------------------------------
+
+//! Clamp a pixel coordinate to a row or a column
+//! \param i Coordinate, can be outside of the texture
+//! \param size Number of pixels of the row or column
+//! \return Coordinate in [0, size - 1]
+static inline unsigned int ClampCoordinate(int i, unsigned int size)
+{
+    return (i < 0) ? 0 : ((static_cast<unsigned int>(i) < size) ? static_cast<unsigned int>(i) : size - 1);
+}
+
+//! Parameters of the filter passes
+struct FilterJob
+{
+    TextureData * mOutput;
+    const TextureData * mInput;
+    void * mIntermediate;                           //!< Result of the horizontal pass, 4 components per pixel
+    unsigned int mWidth;
+    unsigned int mHeight;
+    unsigned int mNumPixelsPerLayer;                //!< Number of pixels of level 0 of a layer
+    unsigned int mNumStripes;                       //!< Number of columns of FILTER_CHUNK_WIDTH pixels of each slice
+    unsigned int mRadius;                           //!< Radius of the blur
+    float mWeights[2 * FILTER_MAX_RADIUS + 1];      //!< Weights of the separable filter, from -radius to +radius
+    const float * mKernel;                          //!< Weights of the convolution kernel
+    unsigned int mKernelSize;                       //!< Size of the convolution kernel
+    float mBias;                                    //!< Bias of the convolution, in bytes
+};
+
+//! Copy level 0 of all the layers of a texture, when the filters do nothing
+static void CopyLevel0(TextureData * output, const TextureData * input)
+{
+    const TextureConfiguration & configuration = output->GetConfiguration();
+    const unsigned int numLayers = configuration.GetNumLayers();
+    const unsigned int numBytes = configuration.GetNumBytesPerMip(0);
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        Utils::Memcpy(output->GetLayerImageData(layer), input->GetLayerImageData(layer), numBytes);
+    }
+}
+
+//! Set up the parameters common to all the filters
+static bool SetupFilterJob(FilterJob & job, TextureData * output, const TextureData * input)
+{
+    PG_ASSERTSTR((output != nullptr) && (input != nullptr) && (output != input), "Invalid textures to filter");
+    const TextureConfiguration & configuration = output->GetConfiguration();
+    if (   (configuration.GetPixelFormat() != Core::FORMAT_RGBA_8_UNORM)
+        || !configuration.IsCompatible(input->GetConfiguration()))
+    {
+        PG_FAILSTR("The texture filters only support RGBA8 textures of the same resolution");
+        return false;
+    }
+
+    job.mOutput = output;
+    job.mInput = input;
+    job.mIntermediate = nullptr;
+    job.mWidth = configuration.GetWidth();
+    job.mHeight = configuration.GetHeight();
+    job.mNumPixelsPerLayer = configuration.GetNumPixelsPerMip(0);
+    job.mNumStripes = (job.mWidth + FILTER_CHUNK_WIDTH - 1) / FILTER_CHUNK_WIDTH;
+    job.mRadius = 0;
+    job.mKernel = nullptr;
+    job.mKernelSize = 0;
+    job.mBias = 0.0f;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Horizontal pass of the Gaussian blur, from the input bytes to the intermediate floats
+static void GaussianRowsH(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const FilterJob * job = static_cast<const FilterJob *>(userData);
+    const unsigned int width = job->mWidth;
+    const unsigned int numTaps = 2 * job->mRadius + 1;
+    const int radius = static_cast<int>(job->mRadius);
+
+    Pixel4 weights[2 * FILTER_MAX_RADIUS + 1];
+    for (unsigned int t = 0; t < numTaps; ++t)
+    {
+        weights[t] = SplatPixel(job->mWeights[t]);
+    }
+
+    // Source pixels of a chunk converted once to floats, with the clamped borders
+    float source[(FILTER_CHUNK_WIDTH + 2 * FILTER_MAX_RADIUS) * 4];
+    for (unsigned int row = beginRow; row < endRow; ++row)
+    {
+        const unsigned char * input = job->mInput->GetLayerImageData(layer) + row * width * 4;
+        float * output = static_cast<float *>(job->mIntermediate) + (layer * job->mNumPixelsPerLayer + row * width) * 4;
+
+        for (unsigned int beginX = 0; beginX < width; beginX += FILTER_CHUNK_WIDTH)
+        {
+            const unsigned int endX = (beginX + FILTER_CHUNK_WIDTH < width) ? beginX + FILTER_CHUNK_WIDTH : width;
+            const unsigned int numSources = endX - beginX + numTaps - 1;
+            for (unsigned int s = 0; s < numSources; ++s)
+            {
+                const unsigned int x = ClampCoordinate(static_cast<int>(beginX + s) - radius, width);
+                StorePixel(source + s * 4, LoadPixelBytes(input + x * 4));
+            }
+
+            for (unsigned int x = beginX; x < endX; ++x)
+            {
+                const float * taps = source + (x - beginX) * 4;
+                Pixel4 sum = MulPixels(weights[0], LoadPixel(taps));
+                for (unsigned int t = 1; t < numTaps; ++t)
+                {
+                    sum = AddPixels(sum, MulPixels(weights[t], LoadPixel(taps + t * 4)));
+                }
+                StorePixel(output + x * 4, sum);
+            }
+        }
+    }
+}
+
+//! Vertical pass of the Gaussian blur, from the intermediate floats to the output bytes
+static void GaussianRowsV(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const FilterJob * job = static_cast<const FilterJob *>(userData);
+    const unsigned int width = job->mWidth;
+    const unsigned int height = job->mHeight;
+    const unsigned int numTaps = 2 * job->mRadius + 1;
+    const int radius = static_cast<int>(job->mRadius);
+    const float * layerData = static_cast<const float *>(job->mIntermediate) + layer * job->mNumPixelsPerLayer * 4;
+
+    Pixel4 weights[2 * FILTER_MAX_RADIUS + 1];
+    for (unsigned int t = 0; t < numTaps; ++t)
+    {
+        weights[t] = SplatPixel(job->mWeights[t]);
+    }
+
+    const float * rows[2 * FILTER_MAX_RADIUS + 1];
+    Pixel4 sums[FILTER_CHUNK_WIDTH];
+    for (unsigned int row = beginRow; row < endRow; ++row)
+    {
+        // Rows of the same slice, clamped to the slice
+        const unsigned int sliceRow = (row / height) * height;
+        const int y = static_cast<int>(row - sliceRow);
+        for (unsigned int t = 0; t < numTaps; ++t)
+        {
+            rows[t] = layerData + (sliceRow + ClampCoordinate(y + static_cast<int>(t) - radius, height)) * width * 4;
+        }
+        unsigned char * output = job->mOutput->GetLayerImageData(layer) + row * width * 4;
+
+        for (unsigned int beginX = 0; beginX < width; beginX += FILTER_CHUNK_WIDTH)
+        {
+            const unsigned int numPixels = (beginX + FILTER_CHUNK_WIDTH < width) ? FILTER_CHUNK_WIDTH : width - beginX;
+            for (unsigned int p = 0; p < numPixels; ++p)
+            {
+                sums[p] = MulPixels(weights[0], LoadPixel(rows[0] + (beginX + p) * 4));
+            }
+            for (unsigned int t = 1; t < numTaps; ++t)
+            {
+                const float * tapRow = rows[t] + beginX * 4;
+                for (unsigned int p = 0; p < numPixels; ++p)
+                {
+                    sums[p] = AddPixels(sums[p], MulPixels(weights[t], LoadPixel(tapRow + p * 4)));
+                }
+            }
+            for (unsigned int p = 0; p < numPixels; ++p)
+            {
+                StorePixelBytes(output + (beginX + p) * 4, sums[p]);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GaussianBlurTexture(TextureData * output, const TextureData * input, float sigma, Alloc::IAllocator * allocator)
+{
+    FilterJob job;
+    if (!SetupFilterJob(job, output, input))
+    {
+        return;
+    }
+
+    const float radius = ceilf(3.0f * sigma);
+    job.mRadius = (radius < static_cast<float>(FILTER_MAX_RADIUS)) ? static_cast<unsigned int>(radius) : FILTER_MAX_RADIUS;
+    if ((sigma < 0.1f) || (job.mRadius == 0))
+    {
+        CopyLevel0(output, input);
+        return;
+    }
+
+    float sum = 0.0f;
+    const float scale = -0.5f / (sigma * sigma);
+    for (unsigned int t = 0; t <= 2 * job.mRadius; ++t)
+    {
+        const float distance = static_cast<float>(static_cast<int>(t) - static_cast<int>(job.mRadius));
+        job.mWeights[t] = expf(distance * distance * scale);
+        sum += job.mWeights[t];
+    }
+    for (unsigned int t = 0; t <= 2 * job.mRadius; ++t)
+    {
+        job.mWeights[t] /= sum;
+    }
+
+    const TextureConfiguration & configuration = output->GetConfiguration();
+    const unsigned int numFloats = configuration.GetNumLayers() * job.mNumPixelsPerLayer * 4;
+    float * intermediate = PG_NEW_ARRAY(allocator, -1, "GaussianBlurTexture::intermediate", Alloc::PG_MEM_TEMP, float, numFloats);
+    job.mIntermediate = intermediate;
+
+    ParallelForRows(configuration, GaussianRowsH, &job);
+    ParallelForRows(configuration, GaussianRowsV, &job);
+
+    PG_DELETE_ARRAY(allocator, intermediate);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Horizontal pass of the box blur, from the input bytes to the intermediate sums,
+//! each pixel updating the running sum with the entering and leaving pixels
+static void BoxRowsH(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const FilterJob * job = static_cast<const FilterJob *>(userData);
+    const unsigned int width = job->mWidth;
+    const int radius = static_cast<int>(job->mRadius);
+
+    for (unsigned int row = beginRow; row < endRow; ++row)
+    {
+        const unsigned char * input = job->mInput->GetLayerImageData(layer) + row * width * 4;
+        unsigned int * output = static_cast<unsigned int *>(job->mIntermediate) + (layer * job->mNumPixelsPerLayer + row * width) * 4;
+
+        Sum4 sum = ZeroSum();
+        for (int x = -radius; x <= radius; ++x)
+        {
+            sum = AddSumBytes(sum, input + ClampCoordinate(x, width) * 4);
+        }
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            StoreSum(output + x * 4, sum);
+            sum = AddSumBytes(sum, input + ClampCoordinate(static_cast<int>(x) + radius + 1, width) * 4);
+            sum = SubSumBytes(sum, input + ClampCoordinate(static_cast<int>(x) - radius, width) * 4);
+        }
+    }
+}
+
+//! Vertical pass of the box blur, from the intermediate sums to the output bytes.
+//! The running sums go down the columns, so the work is split in vertical stripes
+//! \param begin First stripe, the stripes being indexed by ((layer * depth + z) * mNumStripes + stripe)
+//! \param end Stripe after the last one
+static void BoxStripesV(void * userData, unsigned int begin, unsigned int end)
+{
+    const FilterJob * job = static_cast<const FilterJob *>(userData);
+    const unsigned int width = job->mWidth;
+    const unsigned int height = job->mHeight;
+    const int radius = static_cast<int>(job->mRadius);
+    const unsigned int numSlicesPerLayer = job->mNumPixelsPerLayer / (width * height);
+    const float size = static_cast<float>(2 * job->mRadius + 1);
+    const Pixel4 scale = SplatPixel(1.0f / (size * size));
+
+    Sum4 sums[FILTER_CHUNK_WIDTH];
+    for (unsigned int index = begin; index < end; ++index)
+    {
+        const unsigned int stripe = index % job->mNumStripes;
+        const unsigned int slice = index / job->mNumStripes;
+        const unsigned int layer = slice / numSlicesPerLayer;
+        const unsigned int sliceRow = (slice - layer * numSlicesPerLayer) * height;
+        const unsigned int beginX = stripe * FILTER_CHUNK_WIDTH;
+        const unsigned int numPixels = (beginX + FILTER_CHUNK_WIDTH < width) ? FILTER_CHUNK_WIDTH : width - beginX;
+
+        const unsigned int * columns = static_cast<const unsigned int *>(job->mIntermediate)
+                                     + (layer * job->mNumPixelsPerLayer + sliceRow * width + beginX) * 4;
+        unsigned char * output = job->mOutput->GetLayerImageData(layer) + (sliceRow * width + beginX) * 4;
+
+        for (unsigned int p = 0; p < numPixels; ++p)
+        {
+            sums[p] = ZeroSum();
+        }
+        for (int y = -radius; y <= radius; ++y)
+        {
+            const unsigned int * row = columns + ClampCoordinate(y, height) * width * 4;
+            for (unsigned int p = 0; p < numPixels; ++p)
+            {
+                sums[p] = AddSums(sums[p], LoadSum(row + p * 4));
+            }
+        }
+
+        for (unsigned int y = 0; y < height; ++y)
+        {
+            unsigned char * outputRow = output + y * width * 4;
+            const unsigned int * enteringRow = columns + ClampCoordinate(static_cast<int>(y) + radius + 1, height) * width * 4;
+            const unsigned int * leavingRow = columns + ClampCoordinate(static_cast<int>(y) - radius, height) * width * 4;
+            for (unsigned int p = 0; p < numPixels; ++p)
+            {
+                StorePixelBytes(outputRow + p * 4, MulPixels(SumToPixel(sums[p]), scale));
+                sums[p] = SubSums(AddSums(sums[p], LoadSum(enteringRow + p * 4)), LoadSum(leavingRow + p * 4));
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BoxBlurTexture(TextureData * output, const TextureData * input, unsigned int radius, Alloc::IAllocator * allocator)
+{
+    FilterJob job;
+    if (!SetupFilterJob(job, output, input))
+    {
+        return;
+    }
+
+    PG_ASSERTSTR(radius <= FILTER_MAX_RADIUS, "Invalid box blur radius (%d), it must be <= %d", radius, FILTER_MAX_RADIUS);
+    job.mRadius = (radius < FILTER_MAX_RADIUS) ? radius : FILTER_MAX_RADIUS;
+    if (job.mRadius == 0)
+    {
+        CopyLevel0(output, input);
+        return;
+    }
+
+    const TextureConfiguration & configuration = output->GetConfiguration();
+    const unsigned int numSums = configuration.GetNumLayers() * job.mNumPixelsPerLayer * 4;
+    unsigned int * intermediate = PG_NEW_ARRAY(allocator, -1, "BoxBlurTexture::intermediate", Alloc::PG_MEM_TEMP, unsigned int, numSums);
+    job.mIntermediate = intermediate;
+
+    ParallelForRows(configuration, BoxRowsH, &job);
+
+    // One task per stripe of each slice, the stripes being long enough to amortize the tasks
+    const unsigned int numStripes = configuration.GetNumLayers() * configuration.GetDepth() * job.mNumStripes;
+    Core::ParallelFor(numStripes, 1, BoxStripesV, &job);
+
+    PG_DELETE_ARRAY(allocator, intermediate);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Convolve rows of the input into rows of the output
+static void ConvolveRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const FilterJob * job = static_cast<const FilterJob *>(userData);
+    const unsigned int width = job->mWidth;
+    const unsigned int height = job->mHeight;
+    const unsigned int size = job->mKernelSize;
+    const int halfSize = static_cast<int>(size / 2);
+    const unsigned char * layerData = job->mInput->GetLayerImageData(layer);
+
+    Pixel4 weights[FILTER_MAX_KERNEL_SIZE * FILTER_MAX_KERNEL_SIZE];
+    for (unsigned int w = 0; w < size * size; ++w)
+    {
+        weights[w] = SplatPixel(job->mKernel[w]);
+    }
+    const Pixel4 bias = SplatPixel(job->mBias);
+
+    const unsigned char * rows[FILTER_MAX_KERNEL_SIZE];
+    unsigned int columns[FILTER_MAX_KERNEL_SIZE];
+    for (unsigned int row = beginRow; row < endRow; ++row)
+    {
+        const unsigned int sliceRow = (row / height) * height;
+        const int y = static_cast<int>(row - sliceRow);
+        for (unsigned int ky = 0; ky < size; ++ky)
+        {
+            rows[ky] = layerData + (sliceRow + ClampCoordinate(y + static_cast<int>(ky) - halfSize, height)) * width * 4;
+        }
+        unsigned char * output = job->mOutput->GetLayerImageData(layer) + row * width * 4;
+
+        for (unsigned int x = 0; x < width; ++x)
+        {
+            for (unsigned int kx = 0; kx < size; ++kx)
+            {
+                columns[kx] = ClampCoordinate(static_cast<int>(x + kx) - halfSize, width) * 4;
+            }
+
+            Pixel4 sum = bias;
+            for (unsigned int ky = 0; ky < size; ++ky)
+            {
+                for (unsigned int kx = 0; kx < size; ++kx)
+                {
+                    sum = AddPixels(sum, MulPixels(weights[ky * size + kx], LoadPixelBytes(rows[ky] + columns[kx])));
+                }
+            }
+            StorePixelBytes(output + x * 4, sum);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void ConvolveTexture(TextureData * output, const TextureData * input, const float * kernel, unsigned int size, float bias)
+{
+    FilterJob job;
+    if (!SetupFilterJob(job, output, input))
+    {
+        return;
+    }
+
+    PG_ASSERTSTR(kernel != nullptr, "Invalid convolution kernel");
+    if ((size != 3) && (size != 5))
+    {
+        PG_FAILSTR("Invalid convolution kernel size (%d), it must be 3 or 5", size);
+        return;
+    }
+
+    job.mKernel = kernel;
+    job.mKernelSize = size;
+    job.mBias = bias * 255.0f;
+    ParallelForRows(output->GetConfiguration(), ConvolveRows, &job);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
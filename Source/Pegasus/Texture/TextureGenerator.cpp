@@ -10,6 +10,7 @@
 //! \brief	Base texture generator node class
 
 #include "Pegasus/Texture/TextureGenerator.h"
+#include "Pegasus/Texture/TextureMips.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -86,6 +87,18 @@ Graph::NodeData * TextureGenerator::AllocateData() const
                     TextureData(mConfiguration, GetNodeDataAllocator());
 }
 
+//----------------------------------------------------------------------------------------
+
+void TextureGenerator::FinalizeData()
+{
+    if (mConfiguration.GetNumMipLevels() > 1)
+    {
+        //! \todo Use a simpler syntax
+        Graph::NodeDataRef dataRef = GetData();
+        GenerateMipChain(static_cast<TextureData *>(&(*dataRef)), MIP_FILTER_BOX);
+    }
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
@@ -0,0 +1,339 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureKernels.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU kernels shared by the texture generators and operators
+
+#include "Pegasus/Texture/TextureKernels.h"
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+//! Kernel run by ParallelForRows(), with the size of the layers to split the global row range
+struct RowJob
+{
+    RowKernelFunc mFunc;
+    void * mUserData;
+    unsigned int mNumRowsPerLayer;
+};
+
+//! Split a range of rows spanning several layers into ranges of one layer
+//! \param userData RowJob
+//! \param begin First row, counting the rows of the previous layers
+//! \param end Row after the last one, counting the rows of the previous layers
+static void RowRangeTask(void * userData, unsigned int begin, unsigned int end)
+{
+    const RowJob * job = static_cast<const RowJob *>(userData);
+    while (begin < end)
+    {
+        const unsigned int layer = begin / job->mNumRowsPerLayer;
+        const unsigned int layerBegin = layer * job->mNumRowsPerLayer;
+        const unsigned int layerEnd = (end < layerBegin + job->mNumRowsPerLayer) ? end : layerBegin + job->mNumRowsPerLayer;
+        job->mFunc(job->mUserData, layer, begin - layerBegin, layerEnd - layerBegin);
+        begin = layerEnd;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void ParallelForRows(const TextureConfiguration & configuration, RowKernelFunc func, void * userData)
+{
+    PG_ASSERTSTR(func != nullptr, "Invalid texture kernel");
+
+    RowJob job;
+    job.mFunc = func;
+    job.mUserData = userData;
+    job.mNumRowsPerLayer = configuration.GetHeight() * configuration.GetDepth();
+
+    const unsigned int numBytesPerRow = configuration.GetWidth() * configuration.GetNumBytesPerPixel();
+    const unsigned int numRows = configuration.GetNumLayers() * job.mNumRowsPerLayer;
+    if (numBytesPerRow == 0 || numRows == 0)
+    {
+        return;
+    }
+
+    const unsigned int grainSize = (KERNEL_MIN_BYTES_PER_TASK + numBytesPerRow - 1) / numBytesPerRow;
+    Core::ParallelFor(numRows, grainSize, RowRangeTask, &job);
+}
+
+//----------------------------------------------------------------------------------------
+
+void FillPixels32(unsigned char * destination, unsigned int value, unsigned int numPixels)
+{
+    unsigned int p = 0;
+
+#if PEGASUS_ENABLE_SSE2
+    // 4 pixels per store, the rows are not guaranteed to be 16 bytes aligned
+    const __m128i value4 = _mm_set1_epi32(static_cast<int>(value));
+    for (; p + 4 <= numPixels; p += 4)
+    {
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + p * 4), value4);
+    }
+#endif
+
+    unsigned int * destination32 = reinterpret_cast<unsigned int *>(destination);
+    for (; p < numPixels; ++p)
+    {
+        destination32[p] = value;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Divide a product of two bytes by 255, rounded to the nearest (exact for x <= 255 * 255)
+//! \param x Product to divide
+//! \return x / 255 rounded
+static inline unsigned int Div255(unsigned int x)
+{
+    x += 128;
+    return (x + (x >> 8)) >> 8;
+}
+
+#if PEGASUS_ENABLE_SSE2
+
+//! Divide 8 products of two bytes by 255, rounded to the nearest, same formula as Div255()
+//! \param x 16-bit products to divide
+//! \return 16-bit results
+static inline __m128i Div255x8(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_set1_epi16(128));
+    return _mm_srli_epi16(_mm_add_epi16(x, _mm_srli_epi16(x, 8)), 8);
+}
+
+//! Multiply 16 pairs of bytes and divide the products by 255
+//! \param a First factors
+//! \param b Second factors
+//! \return a * b / 255, rounded to the nearest
+static inline __m128i MultiplyBytes16(__m128i a, __m128i b)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low = Div255x8(_mm_mullo_epi16(_mm_unpacklo_epi8(a, zero), _mm_unpacklo_epi8(b, zero)));
+    const __m128i high = Div255x8(_mm_mullo_epi16(_mm_unpackhi_epi8(a, zero), _mm_unpackhi_epi8(b, zero)));
+    return _mm_packus_epi16(low, high);
+}
+
+//! Combine 16 pairs of bytes
+//! \param a Current values
+//! \param b New values
+//! \param mode Operation to apply
+//! \return Results of the operation
+static inline __m128i BlendBytes16(__m128i a, __m128i b, BlendMode mode)
+{
+    const __m128i ones = _mm_set1_epi8(-1);
+    switch (mode)
+    {
+        case BLEND_ADD:             return _mm_add_epi8(a, b);
+        case BLEND_ADD_SATURATE:    return _mm_adds_epu8(a, b);
+        case BLEND_SUBTRACT:        return _mm_subs_epu8(a, b);
+        case BLEND_MULTIPLY:        return MultiplyBytes16(a, b);
+        case BLEND_SCREEN:          return _mm_xor_si128(MultiplyBytes16(_mm_xor_si128(a, ones), _mm_xor_si128(b, ones)), ones);
+        case BLEND_MIN:             return _mm_min_epu8(a, b);
+        case BLEND_MAX:             return _mm_max_epu8(a, b);
+        default:                    return a;
+    }
+}
+
+#endif  // PEGASUS_ENABLE_SSE2
+
+//! Combine a pair of bytes
+//! \param a Current value
+//! \param b New value
+//! \param mode Operation to apply
+//! \return Result of the operation
+static inline unsigned int BlendByte(unsigned int a, unsigned int b, BlendMode mode)
+{
+    switch (mode)
+    {
+        // Masked, so the runtime checks do not report the wrap around as a loss of data
+        case BLEND_ADD:             return (a + b) & 0xFF;
+        case BLEND_ADD_SATURATE:    return (a + b > 255) ? 255 : a + b;
+        case BLEND_SUBTRACT:        return (a > b) ? a - b : 0;
+        case BLEND_MULTIPLY:        return Div255(a * b);
+        case BLEND_SCREEN:          return 255 - Div255((255 - a) * (255 - b));
+        case BLEND_MIN:             return (a < b) ? a : b;
+        case BLEND_MAX:             return (a > b) ? a : b;
+        default:                    return a;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Combine bytes with other bytes, with the mode known at compile time so the loops contain no branch
+template <BlendMode MODE>
+static void BlendBytesWithMode(unsigned char * destination, const unsigned char * source, unsigned int numBytes)
+{
+    unsigned int b = 0;
+
+#if PEGASUS_ENABLE_SSE2
+    for (; b + 16 <= numBytes; b += 16)
+    {
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(destination + b));
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + b));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + b), BlendBytes16(d, s, MODE));
+    }
+#endif
+
+    for (; b < numBytes; ++b)
+    {
+        destination[b] = static_cast<unsigned char>(BlendByte(destination[b], source[b], MODE));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlendBytes(unsigned char * destination, const unsigned char * source, unsigned int numBytes, BlendMode mode)
+{
+    switch (mode)
+    {
+        case BLEND_ADD:             BlendBytesWithMode<BLEND_ADD>(destination, source, numBytes);             break;
+        case BLEND_ADD_SATURATE:    BlendBytesWithMode<BLEND_ADD_SATURATE>(destination, source, numBytes);    break;
+        case BLEND_SUBTRACT:        BlendBytesWithMode<BLEND_SUBTRACT>(destination, source, numBytes);        break;
+        case BLEND_MULTIPLY:        BlendBytesWithMode<BLEND_MULTIPLY>(destination, source, numBytes);        break;
+        case BLEND_SCREEN:          BlendBytesWithMode<BLEND_SCREEN>(destination, source, numBytes);          break;
+        case BLEND_MIN:             BlendBytesWithMode<BLEND_MIN>(destination, source, numBytes);             break;
+        case BLEND_MAX:             BlendBytesWithMode<BLEND_MAX>(destination, source, numBytes);             break;
+
+        default:
+            PG_FAILSTR("Invalid blend mode (%d)", mode);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void LerpBytes(unsigned char * destination, const unsigned char * source, const unsigned char * mask, unsigned int numBytes)
+{
+    unsigned int b = 0;
+
+#if PEGASUS_ENABLE_SSE2
+    // a * (255 - mask) + b * mask <= 255 * 255, so the sums fit in 16 bits
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i ones = _mm_set1_epi8(-1);
+    for (; b + 16 <= numBytes; b += 16)
+    {
+        const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i *>(destination + b));
+        const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + b));
+        const __m128i m = _mm_loadu_si128(reinterpret_cast<const __m128i *>(mask + b));
+        const __m128i mInv = _mm_xor_si128(m, ones);
+        const __m128i low = Div255x8(_mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(d, zero), _mm_unpacklo_epi8(mInv, zero)),
+                                                   _mm_mullo_epi16(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(m, zero))));
+        const __m128i high = Div255x8(_mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(d, zero), _mm_unpackhi_epi8(mInv, zero)),
+                                                    _mm_mullo_epi16(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(m, zero))));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + b), _mm_packus_epi16(low, high));
+    }
+#endif
+
+    for (; b < numBytes; ++b)
+    {
+        const unsigned int m = mask[b];
+        destination[b] = static_cast<unsigned char>(Div255(destination[b] * (255 - m) + source[b] * m));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Parameters of BlendRows()
+struct BlendJob
+{
+    TextureData * mOutput;
+    const TextureData * const * mInputs;
+    unsigned int mNumInputs;
+    unsigned int mNumBytesPerRow;
+    BlendMode mMode;
+};
+
+//! Combine the rows of the input textures into the rows of the output texture
+static void BlendRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const BlendJob * job = static_cast<const BlendJob *>(userData);
+    const unsigned int offset = beginRow * job->mNumBytesPerRow;
+    const unsigned int numBytes = (endRow - beginRow) * job->mNumBytesPerRow;
+    unsigned char * rowData = job->mOutput->GetLayerImageData(layer) + offset;
+
+    // Copy the first input texture, then combine the other ones while the rows are in the cache
+    const unsigned char * firstRowData = job->mInputs[0]->GetLayerImageData(layer) + offset;
+    if (firstRowData != rowData)
+    {
+        Utils::Memcpy(rowData, firstRowData, numBytes);
+    }
+    for (unsigned int input = 1; input < job->mNumInputs; ++input)
+    {
+        BlendBytes(rowData, job->mInputs[input]->GetLayerImageData(layer) + offset, numBytes, job->mMode);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlendTextures(TextureData * output, const TextureData * const * inputs, unsigned int numInputs, BlendMode mode)
+{
+    PG_ASSERTSTR(output != nullptr, "Invalid output texture to blend into");
+    PG_ASSERTSTR((inputs != nullptr) && (numInputs > 0), "At least one texture is required to blend");
+
+    const TextureConfiguration & configuration = output->GetConfiguration();
+    BlendJob job;
+    job.mOutput = output;
+    job.mInputs = inputs;
+    job.mNumInputs = numInputs;
+    job.mNumBytesPerRow = configuration.GetWidth() * configuration.GetNumBytesPerPixel();
+    job.mMode = mode;
+    ParallelForRows(configuration, BlendRows, &job);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Parameters of LerpRows()
+struct LerpJob
+{
+    TextureData * mOutput;
+    const TextureData * mInput0;
+    const TextureData * mInput1;
+    const TextureData * mMask;
+    unsigned int mNumBytesPerRow;
+};
+
+//! Interpolate the rows of the two input textures into the rows of the output texture
+static void LerpRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const LerpJob * job = static_cast<const LerpJob *>(userData);
+    const unsigned int offset = beginRow * job->mNumBytesPerRow;
+    const unsigned int numBytes = (endRow - beginRow) * job->mNumBytesPerRow;
+    unsigned char * rowData = job->mOutput->GetLayerImageData(layer) + offset;
+
+    const unsigned char * input0RowData = job->mInput0->GetLayerImageData(layer) + offset;
+    if (input0RowData != rowData)
+    {
+        Utils::Memcpy(rowData, input0RowData, numBytes);
+    }
+    LerpBytes(rowData, job->mInput1->GetLayerImageData(layer) + offset, job->mMask->GetLayerImageData(layer) + offset, numBytes);
+}
+
+//----------------------------------------------------------------------------------------
+
+void LerpTextures(TextureData * output, const TextureData * input0, const TextureData * input1, const TextureData * mask)
+{
+    PG_ASSERTSTR(output != nullptr, "Invalid output texture to interpolate into");
+    PG_ASSERTSTR((input0 != nullptr) && (input1 != nullptr) && (mask != nullptr), "Invalid textures to interpolate");
+
+    const TextureConfiguration & configuration = output->GetConfiguration();
+    LerpJob job;
+    job.mOutput = output;
+    job.mInput0 = input0;
+    job.mInput1 = input1;
+    job.mMask = mask;
+    job.mNumBytesPerRow = configuration.GetWidth() * configuration.GetNumBytesPerPixel();
+    ParallelForRows(configuration, LerpRows, &job);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
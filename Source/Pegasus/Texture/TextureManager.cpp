@@ -14,10 +14,23 @@
 
 #include "Pegasus/Texture/Generator/ConstantColorGenerator.h"
 #include "Pegasus/Texture/Generator/GradientGenerator.h"
+#include "Pegasus/Texture/Generator/PerlinNoiseGenerator.h"
 #include "Pegasus/Texture/Generator/PixelsGenerator.h"
+#include "Pegasus/Texture/Generator/SimplexNoiseGenerator.h"
 #include "Pegasus/Texture/Generator/TexCustomGenerator.h"
+#include "Pegasus/Texture/Generator/WorleyNoiseGenerator.h"
 
 #include "Pegasus/Texture/Operator/AddOperator.h"
+#include "Pegasus/Texture/Operator/BoxBlurOperator.h"
+#include "Pegasus/Texture/Operator/ConvolutionOperator.h"
+#include "Pegasus/Texture/Operator/GaussianBlurOperator.h"
+#include "Pegasus/Texture/Operator/LerpOperator.h"
+#include "Pegasus/Texture/Operator/MaxOperator.h"
+#include "Pegasus/Texture/Operator/MinOperator.h"
+#include "Pegasus/Texture/Operator/MipChainOperator.h"
+#include "Pegasus/Texture/Operator/MultiplyOperator.h"
+#include "Pegasus/Texture/Operator/ScreenOperator.h"
+#include "Pegasus/Texture/Operator/SubtractOperator.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -159,11 +172,24 @@ void TextureManager::RegisterAllTextureNodes()
     REGISTER_TEXTURE_NODE(GradientGenerator);
     REGISTER_TEXTURE_NODE(PixelsGenerator);
     REGISTER_TEXTURE_NODE(TexCustomGenerator);
+    REGISTER_TEXTURE_NODE(PerlinNoiseGenerator);
+    REGISTER_TEXTURE_NODE(SimplexNoiseGenerator);
+    REGISTER_TEXTURE_NODE(WorleyNoiseGenerator);
 
     // Register the operator nodes
     // IMPORTANT! Add here every texture operator node that is created
     //            and update the list of #includes above
     REGISTER_TEXTURE_NODE(AddOperator);
+    REGISTER_TEXTURE_NODE(BoxBlurOperator);
+    REGISTER_TEXTURE_NODE(ConvolutionOperator);
+    REGISTER_TEXTURE_NODE(GaussianBlurOperator);
+    REGISTER_TEXTURE_NODE(LerpOperator);
+    REGISTER_TEXTURE_NODE(MaxOperator);
+    REGISTER_TEXTURE_NODE(MinOperator);
+    REGISTER_TEXTURE_NODE(MipChainOperator);
+    REGISTER_TEXTURE_NODE(MultiplyOperator);
+    REGISTER_TEXTURE_NODE(ScreenOperator);
+    REGISTER_TEXTURE_NODE(SubtractOperator);
 }
 
 //----------------------------------------------------------------------------------------
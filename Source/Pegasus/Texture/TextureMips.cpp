@@ -0,0 +1,396 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureMips.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU generation of the mip levels of textures
+
+#include "Pegasus/Texture/TextureMips.h"
+#include "Pegasus/Texture/TextureKernels.h"
+#include "Pegasus/Core/WorkerPool.h"
+
+#include <math.h>
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+//! Maximum number of source pixels per axis contributing to a destination pixel
+static const unsigned int MIP_MAX_NUM_TAPS = 6;
+
+//! Number of destination pixels of a row filtered at once, so the vertical sums fit on the stack
+static const unsigned int MIP_CHUNK_WIDTH = 64;
+
+//! Maximum number of components per pixel (RGBA)
+static const unsigned int MIP_MAX_NUM_COMPONENTS = 4;
+
+//! Parameter of the Kaiser window, higher values reduce the ringing but blur more
+static const float MIP_KAISER_ALPHA = 4.0f;
+
+//! Half width of the Kaiser window, in destination pixels
+static const float MIP_KAISER_RADIUS = 1.5f;
+
+//! Source pixels contributing to the destination pixels along one axis.
+//! Destination pixel i reads the source pixels (mScale * i + mFirstOffset + tap), clamped to the level
+struct MipAxis
+{
+    unsigned int mScale;                    //!< 2 for a reduced axis, 1 for an axis of size 1
+    int mFirstOffset;                       //!< Offset of the first tap
+    unsigned int mNumTaps;                  //!< Number of source pixels per destination pixel
+    float mWeights[MIP_MAX_NUM_TAPS];       //!< Normalized weights of the taps
+};
+
+//! Parameters of MipRows(), for one level of all the layers
+struct MipJob
+{
+    TextureData * mData;
+    unsigned int mSrcOffset;                //!< Offset of the source level in the layer data, in bytes
+    unsigned int mDstOffset;                //!< Offset of the destination level in the layer data, in bytes
+    unsigned int mSrcWidth, mSrcHeight, mSrcDepth;
+    unsigned int mDstWidth, mDstHeight, mDstDepth;
+    unsigned int mNumComponents;            //!< 4 for RGBA8 pixels, 1 for float pixels
+    bool mIsFloat;                          //!< True for float components, false for byte components
+    bool mIsBox2x2;                         //!< True to use BoxRowRGBA8()
+    MipAxis mAxes[3];                       //!< Taps along X, Y and Z
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Modified Bessel function of the first kind of order 0, used by the Kaiser window
+//! \param x Input value
+//! \return I0(x)
+static float BesselI0(float x)
+{
+    // Power series, converges quickly for the small values of the window
+    const float halfX = 0.5f * x;
+    float sum = 1.0f;
+    float term = 1.0f;
+    for (unsigned int k = 1; k < 32; ++k)
+    {
+        term *= halfX / static_cast<float>(k);
+        const float term2 = term * term;
+        sum += term2;
+        if (term2 < sum * 1.0e-8f)
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+//! Compute the normalized weights of the Kaiser-windowed sinc filter halving a level,
+//! for the 6 source pixels at -1.25, -0.75, -0.25, 0.25, 0.75, 1.25 destination pixels from the center
+//! \param weights Array receiving the MIP_MAX_NUM_TAPS weights
+static void ComputeKaiserWeights(float weights[MIP_MAX_NUM_TAPS])
+{
+    const float pi = 3.14159265358979f;
+    const float windowScale = 1.0f / BesselI0(MIP_KAISER_ALPHA);
+    float sum = 0.0f;
+    for (unsigned int t = 0; t < MIP_MAX_NUM_TAPS; ++t)
+    {
+        const float distance = (static_cast<float>(t) - 2.5f) * 0.5f;
+        const float piDistance = pi * distance;
+        const float sinc = sinf(piDistance) / piDistance;
+        const float ratio = distance / MIP_KAISER_RADIUS;
+        const float window = BesselI0(MIP_KAISER_ALPHA * sqrtf(1.0f - ratio * ratio)) * windowScale;
+        weights[t] = sinc * window;
+        sum += weights[t];
+    }
+    for (unsigned int t = 0; t < MIP_MAX_NUM_TAPS; ++t)
+    {
+        weights[t] /= sum;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Set up the taps of one axis
+//! \param axis Axis to set up
+//! \param srcSize Size of the source level along the axis
+//! \param dstSize Size of the destination level along the axis
+//! \param filterWeights Weights of the filter halving the axis
+//! \param numFilterTaps Number of weights of the filter (even)
+static void SetupMipAxis(MipAxis & axis, unsigned int srcSize, unsigned int dstSize,
+                         const float * filterWeights, unsigned int numFilterTaps)
+{
+    if (srcSize == dstSize)
+    {
+        // Axis of size 1, not filtered
+        axis.mScale = 1;
+        axis.mFirstOffset = 0;
+        axis.mNumTaps = 1;
+        axis.mWeights[0] = 1.0f;
+    }
+    else
+    {
+        // Odd sizes are rounded down, the last source pixel only contributes through the wider filters
+        axis.mScale = 2;
+        axis.mFirstOffset = 1 - static_cast<int>(numFilterTaps / 2);
+        axis.mNumTaps = numFilterTaps;
+        for (unsigned int t = 0; t < numFilterTaps; ++t)
+        {
+            axis.mWeights[t] = filterWeights[t];
+        }
+    }
+}
+
+//! Get the index of the source pixel of a tap, clamped to the level
+//! \param axis Axis of the tap
+//! \param index Index of the destination pixel along the axis
+//! \param tap Index of the tap
+//! \param srcSize Size of the source level along the axis
+//! \return Index of the source pixel along the axis
+static inline unsigned int GetMipSourceIndex(const MipAxis & axis, unsigned int index, unsigned int tap, unsigned int srcSize)
+{
+    const int srcIndex = static_cast<int>(axis.mScale * index + tap) + axis.mFirstOffset;
+    if (srcIndex < 0)
+    {
+        return 0;
+    }
+    return (static_cast<unsigned int>(srcIndex) < srcSize) ? static_cast<unsigned int>(srcIndex) : srcSize - 1;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Average each 2x2 block of RGBA8 pixels of two source rows into one destination pixel,
+//! (a + b + c + d + 2) / 4 per component
+//! \param destination First destination pixel
+//! \param row0 First source row
+//! \param row1 Second source row
+//! \param dstWidth Number of destination pixels, the source rows having twice as many
+static void BoxRowRGBA8(unsigned char * destination, const unsigned char * row0, const unsigned char * row1, unsigned int dstWidth)
+{
+    unsigned int x = 0;
+
+#if PEGASUS_ENABLE_SSE2
+    // 4 destination pixels per iteration, with 16-bit sums
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i two = _mm_set1_epi16(2);
+    for (; x + 4 <= dstWidth; x += 4)
+    {
+        const __m128i a0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x * 8));
+        const __m128i a1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row0 + x * 8 + 16));
+        const __m128i b0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x * 8));
+        const __m128i b1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(row1 + x * 8 + 16));
+
+        // Vertical sums, two source pixels per register
+        const __m128i s0 = _mm_add_epi16(_mm_unpacklo_epi8(a0, zero), _mm_unpacklo_epi8(b0, zero));
+        const __m128i s1 = _mm_add_epi16(_mm_unpackhi_epi8(a0, zero), _mm_unpackhi_epi8(b0, zero));
+        const __m128i s2 = _mm_add_epi16(_mm_unpacklo_epi8(a1, zero), _mm_unpacklo_epi8(b1, zero));
+        const __m128i s3 = _mm_add_epi16(_mm_unpackhi_epi8(a1, zero), _mm_unpackhi_epi8(b1, zero));
+
+        // Horizontal sums of the pairs of source pixels, two destination pixels per register
+        __m128i d01 = _mm_add_epi16(_mm_unpacklo_epi64(s0, s1), _mm_unpackhi_epi64(s0, s1));
+        __m128i d23 = _mm_add_epi16(_mm_unpacklo_epi64(s2, s3), _mm_unpackhi_epi64(s2, s3));
+        d01 = _mm_srli_epi16(_mm_add_epi16(d01, two), 2);
+        d23 = _mm_srli_epi16(_mm_add_epi16(d23, two), 2);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + x * 4), _mm_packus_epi16(d01, d23));
+    }
+#endif
+
+    for (; x < dstWidth; ++x)
+    {
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            const unsigned int sum = row0[x * 8 + c] + row0[x * 8 + 4 + c] + row1[x * 8 + c] + row1[x * 8 + 4 + c];
+            destination[x * 4 + c] = static_cast<unsigned char>((sum + 2) >> 2);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Filter one destination row with the separable taps of the job: the source rows are first summed
+//! into a chunk of columns, then the columns are summed into the destination pixels
+//! \param job Parameters of the level
+//! \param destination First destination pixel of the row
+//! \param source First pixel of the source level
+//! \param y Index of the destination row in its slice
+//! \param z Index of the destination slice
+static void FilterMipRow(const MipJob & job, unsigned char * destination, const unsigned char * source, unsigned int y, unsigned int z)
+{
+    const MipAxis & axisX = job.mAxes[0];
+    const MipAxis & axisY = job.mAxes[1];
+    const MipAxis & axisZ = job.mAxes[2];
+    const unsigned int numComponents = job.mNumComponents;
+    const unsigned int numBytesPerPixel = job.mIsFloat ? 4 : numComponents;
+    const unsigned int numBytesPerSrcRow = job.mSrcWidth * numBytesPerPixel;
+
+    // Source rows contributing to the destination row, with their combined weights
+    const unsigned char * rows[MIP_MAX_NUM_TAPS * MIP_MAX_NUM_TAPS];
+    float rowWeights[MIP_MAX_NUM_TAPS * MIP_MAX_NUM_TAPS];
+    unsigned int numRows = 0;
+    for (unsigned int tz = 0; tz < axisZ.mNumTaps; ++tz)
+    {
+        const unsigned int srcZ = GetMipSourceIndex(axisZ, z, tz, job.mSrcDepth);
+        for (unsigned int ty = 0; ty < axisY.mNumTaps; ++ty)
+        {
+            const unsigned int srcY = GetMipSourceIndex(axisY, y, ty, job.mSrcHeight);
+            rows[numRows] = source + (srcZ * job.mSrcHeight + srcY) * numBytesPerSrcRow;
+            rowWeights[numRows] = axisZ.mWeights[tz] * axisY.mWeights[ty];
+            ++numRows;
+        }
+    }
+
+    float columns[(2 * MIP_CHUNK_WIDTH + MIP_MAX_NUM_TAPS) * MIP_MAX_NUM_COMPONENTS];
+    for (unsigned int beginX = 0; beginX < job.mDstWidth; beginX += MIP_CHUNK_WIDTH)
+    {
+        const unsigned int endX = (beginX + MIP_CHUNK_WIDTH < job.mDstWidth) ? beginX + MIP_CHUNK_WIDTH : job.mDstWidth;
+
+        // Vertical sums of the source columns read by the chunk, before clamping
+        const int beginColumn = static_cast<int>(axisX.mScale * beginX) + axisX.mFirstOffset;
+        const int endColumn = static_cast<int>(axisX.mScale * (endX - 1) + axisX.mNumTaps) + axisX.mFirstOffset;
+        for (int column = beginColumn; column < endColumn; ++column)
+        {
+            const unsigned int srcX = (column < 0) ? 0
+                                    : ((static_cast<unsigned int>(column) < job.mSrcWidth) ? static_cast<unsigned int>(column) : job.mSrcWidth - 1);
+            float * sums = columns + (column - beginColumn) * numComponents;
+            for (unsigned int c = 0; c < numComponents; ++c)
+            {
+                sums[c] = 0.0f;
+            }
+            for (unsigned int r = 0; r < numRows; ++r)
+            {
+                const unsigned char * pixel = rows[r] + srcX * numBytesPerPixel;
+                const float weight = rowWeights[r];
+                if (job.mIsFloat)
+                {
+                    sums[0] += weight * *reinterpret_cast<const float *>(pixel);
+                }
+                else
+                {
+                    for (unsigned int c = 0; c < numComponents; ++c)
+                    {
+                        sums[c] += weight * static_cast<float>(pixel[c]);
+                    }
+                }
+            }
+        }
+
+        // Horizontal sums of the columns into the destination pixels
+        for (unsigned int x = beginX; x < endX; ++x)
+        {
+            float pixel[MIP_MAX_NUM_COMPONENTS] = { 0.0f, 0.0f, 0.0f, 0.0f };
+            const float * sums = columns + (axisX.mScale * x - axisX.mScale * beginX) * numComponents;
+            for (unsigned int t = 0; t < axisX.mNumTaps; ++t)
+            {
+                for (unsigned int c = 0; c < numComponents; ++c)
+                {
+                    pixel[c] += axisX.mWeights[t] * sums[t * numComponents + c];
+                }
+            }
+
+            unsigned char * dstPixel = destination + x * numBytesPerPixel;
+            if (job.mIsFloat)
+            {
+                *reinterpret_cast<float *>(dstPixel) = pixel[0];
+            }
+            else
+            {
+                // Rounded to the nearest, the negative lobes of the wider filters can overshoot
+                for (unsigned int c = 0; c < numComponents; ++c)
+                {
+                    const float value = pixel[c] + 0.5f;
+                    dstPixel[c] = (value <= 0.0f) ? 0 : ((value >= 255.0f) ? 255 : static_cast<unsigned char>(value));
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute a range of destination rows of a level, the rows of all the layers being indexed
+//! by ((layer * depth + z) * height + y)
+static void MipRows(void * userData, unsigned int begin, unsigned int end)
+{
+    const MipJob * job = static_cast<const MipJob *>(userData);
+    const unsigned int numBytesPerPixel = job->mIsFloat ? 4 : job->mNumComponents;
+    const unsigned int numBytesPerDstRow = job->mDstWidth * numBytesPerPixel;
+    const unsigned int numRowsPerLayer = job->mDstHeight * job->mDstDepth;
+
+    for (unsigned int row = begin; row < end; ++row)
+    {
+        const unsigned int layer = row / numRowsPerLayer;
+        const unsigned int layerRow = row - layer * numRowsPerLayer;
+        unsigned char * layerData = job->mData->GetLayerImageData(layer);
+        const unsigned char * source = layerData + job->mSrcOffset;
+        unsigned char * destination = layerData + job->mDstOffset + layerRow * numBytesPerDstRow;
+
+        if (job->mIsBox2x2)
+        {
+            const unsigned char * row0 = source + (2 * layerRow) * job->mSrcWidth * 4;
+            BoxRowRGBA8(destination, row0, row0 + job->mSrcWidth * 4, job->mDstWidth);
+        }
+        else
+        {
+            FilterMipRow(*job, destination, source, layerRow % job->mDstHeight, layerRow / job->mDstHeight);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GenerateMipChain(TextureData * data, MipFilter filter)
+{
+    PG_ASSERTSTR(data != nullptr, "Invalid texture to generate the mip levels of");
+    PG_ASSERTSTR(filter < NUM_MIP_FILTERS, "Invalid mip filter (%d)", filter);
+
+    const TextureConfiguration & configuration = data->GetConfiguration();
+    const unsigned int numMipLevels = configuration.GetNumMipLevels();
+    if (numMipLevels <= 1)
+    {
+        return;
+    }
+
+    static const float boxWeights[2] = { 0.5f, 0.5f };
+    float kaiserWeights[MIP_MAX_NUM_TAPS];
+    const float * filterWeights = boxWeights;
+    unsigned int numFilterTaps = 2;
+    if (filter == MIP_FILTER_KAISER)
+    {
+        ComputeKaiserWeights(kaiserWeights);
+        filterWeights = kaiserWeights;
+        numFilterTaps = MIP_MAX_NUM_TAPS;
+    }
+
+    MipJob job;
+    job.mData = data;
+    job.mIsFloat = (configuration.GetPixelFormat() == Core::FORMAT_R32_FLOAT);
+    job.mNumComponents = job.mIsFloat ? 1 : 4;
+
+    // Each level reads the previous one, so only the rows of a level are computed in parallel
+    for (unsigned int level = 1; level < numMipLevels; ++level)
+    {
+        job.mSrcOffset = configuration.GetMipOffset(level - 1);
+        job.mDstOffset = configuration.GetMipOffset(level);
+        job.mSrcWidth = configuration.GetMipWidth(level - 1);
+        job.mSrcHeight = configuration.GetMipHeight(level - 1);
+        job.mSrcDepth = configuration.GetMipDepth(level - 1);
+        job.mDstWidth = configuration.GetMipWidth(level);
+        job.mDstHeight = configuration.GetMipHeight(level);
+        job.mDstDepth = configuration.GetMipDepth(level);
+        SetupMipAxis(job.mAxes[0], job.mSrcWidth, job.mDstWidth, filterWeights, numFilterTaps);
+        SetupMipAxis(job.mAxes[1], job.mSrcHeight, job.mDstHeight, filterWeights, numFilterTaps);
+        SetupMipAxis(job.mAxes[2], job.mSrcDepth, job.mDstDepth, filterWeights, numFilterTaps);
+        job.mIsBox2x2 = (filter == MIP_FILTER_BOX) && !job.mIsFloat
+                     && (job.mSrcWidth == 2 * job.mDstWidth) && (job.mSrcHeight == 2 * job.mDstHeight) && (job.mSrcDepth == 1);
+
+        const unsigned int numBytesPerDstRow = job.mDstWidth * configuration.GetNumBytesPerPixel();
+        const unsigned int numRows = configuration.GetNumLayers() * job.mDstHeight * job.mDstDepth;
+        const unsigned int grainSize = (KERNEL_MIN_BYTES_PER_TASK + numBytesPerDstRow - 1) / numBytesPerDstRow;
+        Core::ParallelFor(numRows, grainSize, MipRows, &job);
+    }
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
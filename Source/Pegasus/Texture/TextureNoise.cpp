@@ -0,0 +1,465 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureNoise.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU procedural noise kernels shared by the noise texture generators
+
+#include "Pegasus/Texture/TextureNoise.h"
+#include "Pegasus/Texture/TextureKernels.h"
+
+#if PEGASUS_ENABLE_SSE2
+#include <emmintrin.h>
+#else
+#include <math.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+// The noise functions are written once with the 4-lane types below.
+// The SSE2 and scalar versions of each operation give the same bits
+// (no fused multiply-add, same rounding, same operand order for min and max),
+// so the generated textures do not depend on the instruction set.
+
+//! Four 32-bit integers, one per pixel. Masks have all their bits set or cleared
+struct Int4
+{
+#if PEGASUS_ENABLE_SSE2
+    __m128i v;
+#else
+    unsigned int v[4];
+#endif
+};
+
+//! Four floating point numbers, one per pixel
+struct Float4
+{
+#if PEGASUS_ENABLE_SSE2
+    __m128 v;
+#else
+    float v[4];
+#endif
+};
+
+#if PEGASUS_ENABLE_SSE2
+
+static inline Int4 MakeInt4(__m128i v) { Int4 r; r.v = v; return r; }
+static inline Float4 MakeFloat4(__m128 v) { Float4 r; r.v = v; return r; }
+
+static inline Int4 SetInt4(unsigned int a) { return MakeInt4(_mm_set1_epi32(static_cast<int>(a))); }
+static inline Float4 SetFloat4(float a) { return MakeFloat4(_mm_set1_ps(a)); }
+
+static inline Int4 operator + (Int4 a, Int4 b) { return MakeInt4(_mm_add_epi32(a.v, b.v)); }
+static inline Int4 operator & (Int4 a, Int4 b) { return MakeInt4(_mm_and_si128(a.v, b.v)); }
+static inline Int4 operator | (Int4 a, Int4 b) { return MakeInt4(_mm_or_si128(a.v, b.v)); }
+static inline Int4 operator ^ (Int4 a, Int4 b) { return MakeInt4(_mm_xor_si128(a.v, b.v)); }
+static inline Int4 operator ~ (Int4 a) { return MakeInt4(_mm_xor_si128(a.v, _mm_set1_epi32(-1))); }
+static inline Int4 operator >> (Int4 a, int shift) { return MakeInt4(_mm_srli_epi32(a.v, shift)); }
+
+//! Low 32 bits of the products, SSE2 only multiplies the even lanes
+static inline Int4 operator * (Int4 a, Int4 b)
+{
+    const __m128i even = _mm_mul_epu32(a.v, b.v);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a.v, 32), _mm_srli_epi64(b.v, 32));
+    return MakeInt4(_mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                       _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0))));
+}
+
+static inline Int4 Equal(Int4 a, Int4 b) { return MakeInt4(_mm_cmpeq_epi32(a.v, b.v)); }
+static inline Int4 Less(Int4 a, Int4 b) { return MakeInt4(_mm_cmplt_epi32(a.v, b.v)); }
+
+static inline Float4 operator + (Float4 a, Float4 b) { return MakeFloat4(_mm_add_ps(a.v, b.v)); }
+static inline Float4 operator - (Float4 a, Float4 b) { return MakeFloat4(_mm_sub_ps(a.v, b.v)); }
+static inline Float4 operator * (Float4 a, Float4 b) { return MakeFloat4(_mm_mul_ps(a.v, b.v)); }
+static inline Float4 Min(Float4 a, Float4 b) { return MakeFloat4(_mm_min_ps(a.v, b.v)); }
+static inline Float4 Max(Float4 a, Float4 b) { return MakeFloat4(_mm_max_ps(a.v, b.v)); }
+static inline Float4 Sqrt(Float4 a) { return MakeFloat4(_mm_sqrt_ps(a.v)); }
+
+static inline Int4 GreaterEqual(Float4 a, Float4 b) { return MakeInt4(_mm_castps_si128(_mm_cmpge_ps(a.v, b.v))); }
+
+//! Select a where the mask is set, b elsewhere
+static inline Float4 Select(Int4 mask, Float4 a, Float4 b)
+{
+    const __m128 maskF = _mm_castsi128_ps(mask.v);
+    return MakeFloat4(_mm_or_ps(_mm_and_ps(maskF, a.v), _mm_andnot_ps(maskF, b.v)));
+}
+
+static inline Float4 ToFloat(Int4 a) { return MakeFloat4(_mm_cvtepi32_ps(a.v)); }
+
+//! Truncate towards zero
+static inline Int4 Truncate(Float4 a) { return MakeInt4(_mm_cvttps_epi32(a.v)); }
+
+//! Round towards minus infinity
+static inline Int4 Floor(Float4 a)
+{
+    const __m128i truncated = _mm_cvttps_epi32(a.v);
+    const __m128 isAbove = _mm_cmpgt_ps(_mm_cvtepi32_ps(truncated), a.v);
+    return MakeInt4(_mm_add_epi32(truncated, _mm_castps_si128(isAbove)));
+}
+
+static inline Float4 LoadFloat4(const float a[4]) { return MakeFloat4(_mm_loadu_ps(a)); }
+static inline void StoreInt4(unsigned int a[4], Int4 b) { _mm_storeu_si128(reinterpret_cast<__m128i *>(a), b.v); }
+
+#else
+
+static inline Int4 SetInt4(unsigned int a) { Int4 r; r.v[0] = r.v[1] = r.v[2] = r.v[3] = a; return r; }
+static inline Float4 SetFloat4(float a) { Float4 r; r.v[0] = r.v[1] = r.v[2] = r.v[3] = a; return r; }
+
+#define PEGASUS_NOISE_LANES(type, expr) type r; for (unsigned int l = 0; l < 4; ++l) { r.v[l] = (expr); } return r;
+
+static inline Int4 operator + (Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, a.v[l] + b.v[l]) }
+static inline Int4 operator & (Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, a.v[l] & b.v[l]) }
+static inline Int4 operator | (Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, a.v[l] | b.v[l]) }
+static inline Int4 operator ^ (Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, a.v[l] ^ b.v[l]) }
+static inline Int4 operator ~ (Int4 a) { PEGASUS_NOISE_LANES(Int4, ~a.v[l]) }
+static inline Int4 operator >> (Int4 a, int shift) { PEGASUS_NOISE_LANES(Int4, a.v[l] >> shift) }
+static inline Int4 operator * (Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, a.v[l] * b.v[l]) }
+
+static inline Int4 Equal(Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, (a.v[l] == b.v[l]) ? 0xFFFFFFFF : 0) }
+static inline Int4 Less(Int4 a, Int4 b) { PEGASUS_NOISE_LANES(Int4, (static_cast<int>(a.v[l]) < static_cast<int>(b.v[l])) ? 0xFFFFFFFF : 0) }
+
+static inline Float4 operator + (Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Float4, a.v[l] + b.v[l]) }
+static inline Float4 operator - (Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Float4, a.v[l] - b.v[l]) }
+static inline Float4 operator * (Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Float4, a.v[l] * b.v[l]) }
+static inline Float4 Min(Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Float4, (a.v[l] < b.v[l]) ? a.v[l] : b.v[l]) }
+static inline Float4 Max(Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Float4, (a.v[l] > b.v[l]) ? a.v[l] : b.v[l]) }
+static inline Float4 Sqrt(Float4 a) { PEGASUS_NOISE_LANES(Float4, sqrtf(a.v[l])) }
+
+static inline Int4 GreaterEqual(Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Int4, (a.v[l] >= b.v[l]) ? 0xFFFFFFFF : 0) }
+
+//! Select a where the mask is set, b elsewhere
+static inline Float4 Select(Int4 mask, Float4 a, Float4 b) { PEGASUS_NOISE_LANES(Float4, (mask.v[l] != 0) ? a.v[l] : b.v[l]) }
+
+static inline Float4 ToFloat(Int4 a) { PEGASUS_NOISE_LANES(Float4, static_cast<float>(static_cast<int>(a.v[l]))) }
+
+//! Truncate towards zero
+static inline Int4 Truncate(Float4 a) { PEGASUS_NOISE_LANES(Int4, static_cast<unsigned int>(static_cast<int>(a.v[l]))) }
+
+//! Round towards minus infinity
+static inline Int4 Floor(Float4 a)
+{
+    PEGASUS_NOISE_LANES(Int4, static_cast<unsigned int>(static_cast<int>(a.v[l]) - ((static_cast<float>(static_cast<int>(a.v[l])) > a.v[l]) ? 1 : 0)))
+}
+
+static inline Float4 LoadFloat4(const float a[4]) { PEGASUS_NOISE_LANES(Float4, a[l]) }
+static inline void StoreInt4(unsigned int a[4], Int4 b) { for (unsigned int l = 0; l < 4; ++l) { a[l] = b.v[l]; } }
+
+#undef PEGASUS_NOISE_LANES
+
+#endif  // PEGASUS_ENABLE_SSE2
+
+//----------------------------------------------------------------------------------------
+
+//! Hash the coordinates of a lattice point, giving uniformly distributed bits
+static inline Int4 HashLattice(Int4 x, Int4 y, Int4 z, Int4 seed)
+{
+    Int4 h = seed ^ (x * SetInt4(0x8DA6B343)) ^ (y * SetInt4(0xD8163841)) ^ (z * SetInt4(0xCB1AB31F));
+    h = h ^ (h >> 16);
+    h = h * SetInt4(0x7FEB352D);
+    h = h ^ (h >> 15);
+    h = h * SetInt4(0x846CA68B);
+    return h ^ (h >> 16);
+}
+
+//! Dot product of a vector with one of the 12 edge gradients of Ken Perlin's improved noise
+//! \param h Hash of the lattice point, the 4 lower bits select the gradient
+static inline Float4 Gradient(Int4 h, Float4 x, Float4 y, Float4 z)
+{
+    const Int4 h15 = h & SetInt4(15);
+    const Float4 u = Select(Less(h15, SetInt4(8)), x, y);
+    const Float4 v = Select(Less(h15, SetInt4(4)), y, Select(Equal(h15, SetInt4(12)) | Equal(h15, SetInt4(14)), x, z));
+    const Float4 zero = SetFloat4(0.0f);
+    return Select(Equal(h & SetInt4(1), SetInt4(0)), u, zero - u) + Select(Equal(h & SetInt4(2), SetInt4(0)), v, zero - v);
+}
+
+//! Quintic interpolation curve 6t^5 - 15t^4 + 10t^3
+static inline Float4 Fade(Float4 t)
+{
+    return t * t * t * (t * (t * SetFloat4(6.0f) - SetFloat4(15.0f)) + SetFloat4(10.0f));
+}
+
+static inline Float4 Lerp(Float4 a, Float4 b, Float4 t)
+{
+    return a + t * (b - a);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Improved Perlin noise
+//! \return Noise values in [-1, 1]
+static Float4 PerlinNoise(Float4 x, Float4 y, Float4 z, Int4 seed)
+{
+    const Int4 ix = Floor(x);
+    const Int4 iy = Floor(y);
+    const Int4 iz = Floor(z);
+    const Int4 ix1 = ix + SetInt4(1);
+    const Int4 iy1 = iy + SetInt4(1);
+    const Int4 iz1 = iz + SetInt4(1);
+
+    // Position relative to the 8 corners of the cell
+    const Float4 one = SetFloat4(1.0f);
+    const Float4 fx = x - ToFloat(ix);
+    const Float4 fy = y - ToFloat(iy);
+    const Float4 fz = z - ToFloat(iz);
+    const Float4 gx = fx - one;
+    const Float4 gy = fy - one;
+    const Float4 gz = fz - one;
+
+    const Float4 n000 = Gradient(HashLattice(ix,  iy,  iz,  seed), fx, fy, fz);
+    const Float4 n100 = Gradient(HashLattice(ix1, iy,  iz,  seed), gx, fy, fz);
+    const Float4 n010 = Gradient(HashLattice(ix,  iy1, iz,  seed), fx, gy, fz);
+    const Float4 n110 = Gradient(HashLattice(ix1, iy1, iz,  seed), gx, gy, fz);
+    const Float4 n001 = Gradient(HashLattice(ix,  iy,  iz1, seed), fx, fy, gz);
+    const Float4 n101 = Gradient(HashLattice(ix1, iy,  iz1, seed), gx, fy, gz);
+    const Float4 n011 = Gradient(HashLattice(ix,  iy1, iz1, seed), fx, gy, gz);
+    const Float4 n111 = Gradient(HashLattice(ix1, iy1, iz1, seed), gx, gy, gz);
+
+    const Float4 u = Fade(fx);
+    const Float4 v = Fade(fy);
+    const Float4 w = Fade(fz);
+    return Lerp(Lerp(Lerp(n000, n100, u), Lerp(n010, n110, u), v),
+                Lerp(Lerp(n001, n101, u), Lerp(n011, n111, u), v), w);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Contribution of a corner of a simplex
+static inline Float4 SimplexCorner(Int4 h, Float4 x, Float4 y, Float4 z)
+{
+    const Float4 t = Max(SetFloat4(0.6f) - x * x - y * y - z * z, SetFloat4(0.0f));
+    const Float4 t2 = t * t;
+    return t2 * t2 * Gradient(h, x, y, z);
+}
+
+//! Simplex noise, after Stefan Gustavson's reference implementation
+//! \return Noise values in [-1, 1]
+static Float4 SimplexNoise(Float4 x, Float4 y, Float4 z, Int4 seed)
+{
+    static const float F3 = 1.0f / 3.0f;
+    static const float G3 = 1.0f / 6.0f;
+
+    // Skew the space to find the cube containing the point, made of 6 simplices
+    const Float4 s = (x + y + z) * SetFloat4(F3);
+    const Int4 i = Floor(x + s);
+    const Int4 j = Floor(y + s);
+    const Int4 k = Floor(z + s);
+    const Float4 t = ToFloat(i + j + k) * SetFloat4(G3);
+    const Float4 x0 = x - (ToFloat(i) - t);
+    const Float4 y0 = y - (ToFloat(j) - t);
+    const Float4 z0 = z - (ToFloat(k) - t);
+
+    // Order of the coordinates, giving the second and third corners of the simplex
+    const Int4 xy = GreaterEqual(x0, y0);
+    const Int4 yz = GreaterEqual(y0, z0);
+    const Int4 xz = GreaterEqual(x0, z0);
+    const Int4 one = SetInt4(1);
+    const Int4 i1 = xy & xz & one;
+    const Int4 j1 = ~xy & yz & one;
+    const Int4 k1 = ~xz & ~yz & one;
+    const Int4 i2 = (xy | xz) & one;
+    const Int4 j2 = (~xy | yz) & one;
+    const Int4 k2 = (~xz | ~yz) & one;
+
+    const Float4 x1 = x0 - ToFloat(i1) + SetFloat4(G3);
+    const Float4 y1 = y0 - ToFloat(j1) + SetFloat4(G3);
+    const Float4 z1 = z0 - ToFloat(k1) + SetFloat4(G3);
+    const Float4 x2 = x0 - ToFloat(i2) + SetFloat4(2.0f * G3);
+    const Float4 y2 = y0 - ToFloat(j2) + SetFloat4(2.0f * G3);
+    const Float4 z2 = z0 - ToFloat(k2) + SetFloat4(2.0f * G3);
+    const Float4 x3 = x0 - SetFloat4(1.0f - 3.0f * G3);
+    const Float4 y3 = y0 - SetFloat4(1.0f - 3.0f * G3);
+    const Float4 z3 = z0 - SetFloat4(1.0f - 3.0f * G3);
+
+    const Float4 n0 = SimplexCorner(HashLattice(i, j, k, seed), x0, y0, z0);
+    const Float4 n1 = SimplexCorner(HashLattice(i + i1, j + j1, k + k1, seed), x1, y1, z1);
+    const Float4 n2 = SimplexCorner(HashLattice(i + i2, j + j2, k + k2, seed), x2, y2, z2);
+    const Float4 n3 = SimplexCorner(HashLattice(i + one, j + one, k + one, seed), x3, y3, z3);
+
+    // Scale the result to cover [-1, 1]
+    return Max(Min((n0 + n1 + n2 + n3) * SetFloat4(32.0f), SetFloat4(1.0f)), SetFloat4(-1.0f));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Worley (cellular) noise, one feature point per lattice cell
+//! \return Distance to the closest feature point, clamped to 1 and remapped to [-1, 1]
+static Float4 WorleyNoise(Float4 x, Float4 y, Float4 z, Int4 seed)
+{
+    const Int4 ix = Floor(x);
+    const Int4 iy = Floor(y);
+    const Int4 iz = Floor(z);
+    const Float4 fx = x - ToFloat(ix);
+    const Float4 fy = y - ToFloat(iy);
+    const Float4 fz = z - ToFloat(iz);
+
+    // The closest feature point is in the cell of the point or in one of its 26 neighbors.
+    // Each coordinate of a feature point uses 10 bits of the hash of its cell
+    const Int4 mask10 = SetInt4(1023);
+    const Float4 scale10 = SetFloat4(1.0f / 1024.0f);
+    Float4 minDistance2 = SetFloat4(3.0f);
+    for (int dz = -1; dz <= 1; ++dz)
+    {
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                const Int4 h = HashLattice(ix + SetInt4(static_cast<unsigned int>(dx)),
+                                           iy + SetInt4(static_cast<unsigned int>(dy)),
+                                           iz + SetInt4(static_cast<unsigned int>(dz)), seed);
+                const Float4 px = ToFloat(h & mask10) * scale10 + SetFloat4(static_cast<float>(dx)) - fx;
+                const Float4 py = ToFloat((h >> 10) & mask10) * scale10 + SetFloat4(static_cast<float>(dy)) - fy;
+                const Float4 pz = ToFloat((h >> 20) & mask10) * scale10 + SetFloat4(static_cast<float>(dz)) - fz;
+                minDistance2 = Min(minDistance2, px * px + py * py + pz * pz);
+            }
+        }
+    }
+
+    const Float4 one = SetFloat4(1.0f);
+    return Min(Sqrt(minDistance2), one) * SetFloat4(2.0f) - one;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Parameters of the noise kernel
+struct NoiseJob
+{
+    TextureData * mData;
+    NoiseType mType;
+    unsigned int mWidth;
+    unsigned int mHeight;
+    float mScaleX;                      //!< Frequency divided by the width, lattice units per pixel
+    float mScaleY;
+    float mScaleZ;
+    unsigned int mSeed;
+    unsigned int mNumOctaves;
+    float mLacunarity;
+    float mGain;
+    float mAmplitudeSumRcp;             //!< Normalization of the fractal sum to [-1, 1]
+    unsigned int mPalette[256];         //!< Colors of the quantized noise values
+};
+
+//! Compute rows of a layer of the noise
+static void NoiseRows(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow)
+{
+    const NoiseJob & job = *static_cast<const NoiseJob *>(userData);
+    const unsigned int width = job.mWidth;
+    unsigned int * rowData32 = reinterpret_cast<unsigned int *>(job.mData->GetLayerImageData(layer)) + beginRow * width;
+
+    // Decorrelate the layers and the octaves
+    Int4 octaveSeeds[NOISE_MAX_NUM_OCTAVES];
+    for (unsigned int o = 0; o < job.mNumOctaves; ++o)
+    {
+        octaveSeeds[o] = SetInt4(job.mSeed + layer * 0x632BE5ABu + o * 0x9E3779B9u);
+    }
+
+    for (unsigned int row = beginRow; row < endRow; ++row)
+    {
+        const unsigned int z = row / job.mHeight;
+        const unsigned int y = row - z * job.mHeight;
+        const float rowY = (static_cast<float>(y) + 0.5f) * job.mScaleY;
+        const float rowZ = (static_cast<float>(z) + 0.5f) * job.mScaleZ;
+
+        // Groups of 4 pixels, the last group repeats the last pixel of the row
+        for (unsigned int x = 0; x < width; x += 4)
+        {
+            float pixelX[4];
+            for (unsigned int l = 0; l < 4; ++l)
+            {
+                const unsigned int px = (x + l < width) ? (x + l) : (width - 1);
+                pixelX[l] = (static_cast<float>(px) + 0.5f) * job.mScaleX;
+            }
+
+            // Fractal sum of the octaves (fBm)
+            Float4 cx = LoadFloat4(pixelX);
+            Float4 cy = SetFloat4(rowY);
+            Float4 cz = SetFloat4(rowZ);
+            const Float4 lacunarity = SetFloat4(job.mLacunarity);
+            Float4 sum = SetFloat4(0.0f);
+            float amplitude = 1.0f;
+            for (unsigned int o = 0; o < job.mNumOctaves; ++o)
+            {
+                Float4 value;
+                switch (job.mType)
+                {
+                    case NOISE_PERLIN:  value = PerlinNoise(cx, cy, cz, octaveSeeds[o]);   break;
+                    case NOISE_SIMPLEX: value = SimplexNoise(cx, cy, cz, octaveSeeds[o]);  break;
+                    default:            value = WorleyNoise(cx, cy, cz, octaveSeeds[o]);   break;
+                }
+                sum = sum + value * SetFloat4(amplitude);
+                cx = cx * lacunarity;
+                cy = cy * lacunarity;
+                cz = cz * lacunarity;
+                amplitude *= job.mGain;
+            }
+
+            // Quantize [-1, 1] to the palette indices
+            const Float4 t = sum * SetFloat4(job.mAmplitudeSumRcp * 127.5f) + SetFloat4(128.0f);
+            unsigned int indices[4];
+            StoreInt4(indices, Truncate(Min(Max(t, SetFloat4(0.0f)), SetFloat4(255.0f))));
+            const unsigned int numPixels = (width - x < 4) ? (width - x) : 4;
+            for (unsigned int l = 0; l < numPixels; ++l)
+            {
+                rowData32[x + l] = job.mPalette[indices[l]];
+            }
+        }
+
+        rowData32 += width;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GenerateNoise(TextureData * data, const TextureConfiguration & configuration, const NoiseParameters & parameters)
+{
+    PG_ASSERT(data != nullptr);
+    PG_ASSERT(parameters.mType < NUM_NOISE_TYPES);
+    if (configuration.GetNumBytesPerPixel() != 4)
+    {
+        PG_FAILSTR("Unsupported number of bytes per pixel (%d) for the noise generators", configuration.GetNumBytesPerPixel());
+        return;
+    }
+
+    NoiseJob job;
+    job.mData = data;
+    job.mType = parameters.mType;
+    job.mWidth = configuration.GetWidth();
+    job.mHeight = configuration.GetHeight();
+    job.mScaleX = parameters.mFrequency / static_cast<float>(configuration.GetWidth());
+    job.mScaleY = parameters.mFrequency / static_cast<float>(configuration.GetHeight());
+    job.mScaleZ = parameters.mFrequency / static_cast<float>(configuration.GetDepth());
+    job.mSeed = parameters.mSeed;
+    job.mNumOctaves = (parameters.mNumOctaves < 1) ? 1
+                    : ((parameters.mNumOctaves > NOISE_MAX_NUM_OCTAVES) ? NOISE_MAX_NUM_OCTAVES : parameters.mNumOctaves);
+    job.mLacunarity = parameters.mLacunarity;
+    job.mGain = parameters.mGain;
+
+    // Sum of the absolute amplitudes, so negative gains stay in range
+    float amplitudeSum = 0.0f;
+    float amplitude = 1.0f;
+    for (unsigned int o = 0; o < job.mNumOctaves; ++o)
+    {
+        amplitudeSum += (amplitude < 0.0f) ? -amplitude : amplitude;
+        amplitude *= parameters.mGain;
+    }
+    job.mAmplitudeSumRcp = 1.0f / amplitudeSum;
+
+    // The noise values are quantized to 8 bits, so the colors are computed once
+    const Math::ColorRGBA color0F(ToColorRGBA(parameters.mColor0));
+    const Math::ColorRGBA colorDiffF(ToColorRGBA(parameters.mColor1) - color0F);
+    for (unsigned int p = 0; p < 256; ++p)
+    {
+        const Math::Color8RGBA color(color0F + (static_cast<float>(p) * (1.0f / 255.0f)) * colorDiffF);
+        job.mPalette[p] = static_cast<unsigned int>(color.rgba32);
+    }
+
+    ParallelForRows(configuration, NoiseRows, &job);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
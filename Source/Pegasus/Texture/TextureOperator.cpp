@@ -10,6 +10,7 @@
 //! \brief	Base texture operator node class
 
 #include "Pegasus/Texture/TextureOperator.h"
+#include "Pegasus/Texture/TextureMips.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -170,6 +171,33 @@ Graph::NodeData * TextureOperator::AllocateData() const
                   TextureData(mConfiguration, GetNodeDataAllocator());
 }
 
+//----------------------------------------------------------------------------------------
+
+void TextureOperator::FinalizeData()
+{
+    if (mConfiguration.GetNumMipLevels() > 1)
+    {
+        //! \todo Use a simpler syntax
+        Graph::NodeDataRef dataRef = GetData();
+        GenerateMipChain(static_cast<TextureData *>(&(*dataRef)), MIP_FILTER_BOX);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int TextureOperator::GetUpdatedInputData(const TextureData * inputData[MAX_NUM_INPUTS])
+{
+    // Update the input textures on this thread, the kernels of the operators only read their data
+    const unsigned int numInputs = GetNumInputs();
+    for (unsigned int input = 0; input < numInputs; ++input)
+    {
+        //! \todo Use a simpler syntax
+        bool updated = false;
+        inputData[input] = static_cast<TextureData *>(&(*GetInput(input)->GetUpdatedData(updated)));
+    }
+    return numInputs;
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
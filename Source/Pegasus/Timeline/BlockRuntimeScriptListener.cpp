@@ -20,6 +20,7 @@
 #include "Pegasus/PropertyGrid/PropertyGridObject.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus {
 namespace Timeline {
@@ -253,6 +254,21 @@ void BlockRuntimeScriptListener::SetScriptVariable(
 
 }
 
+//! Indexes the object properties of a grid by name. The first property of a name is kept.
+//! The keys are the names owned by the grid, so the index is rebuilt when a property is removed
+static void IndexObjectProperties(const PropertyGrid::PropertyGridObject* propGrid, Utils::HashMap<const char*, unsigned int>& propIndices)
+{
+    propIndices.Reset();
+    for (unsigned int i = 0; i < propGrid->GetNumObjectProperties(); ++i)
+    {
+        const char* name = propGrid->GetObjectPropertyRecord(i).name;
+        if (!propIndices.Contains(name))
+        {
+            propIndices.Insert(name, i);
+        }
+    }
+}
+
 void BlockRuntimeScriptListener::OnStackInitalized(Pegasus::BlockScript::BsVmState& state)
 {
     if (!IsReady())
@@ -283,6 +299,9 @@ void BlockRuntimeScriptListener::OnStackInitalized(Pegasus::BlockScript::BsVmSta
         }
     }
 
+    Utils::HashMap<const char*, unsigned int> propIndices;
+    IndexObjectProperties(mPropGrid, propIndices);
+
     for (int i = 0; i < bsGlobals.Size(); ++i)
     {
         Pegasus::BlockScript::GlobalMapEntry& bsGlobalEntry = bsGlobals[i];
@@ -293,41 +312,40 @@ void BlockRuntimeScriptListener::OnStackInitalized(Pegasus::BlockScript::BsVmSta
         }
 
         //find the target property grid
-        bool foundObject = false;
-        for (unsigned int obPropIndex = 0; !foundObject && obPropIndex < mPropGrid->GetNumObjectProperties(); ++obPropIndex)
+        const unsigned int* foundIndex = propIndices.Find(translation.varName);
+        const bool foundObject = foundIndex != nullptr;
+        if (foundObject)
         {
+            const unsigned int obPropIndex = *foundIndex;
             const PropertyGrid::PropertyRecord& r = mPropGrid->GetObjectPropertyRecord(obPropIndex);
-            if (!Utils::Strcmp(translation.varName, r.name))
+            if (translation.typeEnum == r.type && translation.editorDesc == r.editorDesc)
             {
-                foundObject = true;
-                if (translation.typeEnum == r.type && translation.editorDesc == r.editorDesc)
+                foundInGrid[obPropIndex] = true;
+                mGridToGlobalMap[obPropIndex] = i;                
+                SetScriptVariable(translation, obPropIndex, state, i);
+            }
+            else
+            { 
+                PG_ASSERTSTR(!foundInGrid[obPropIndex], "Cannot attempt to delete an object twice!");
+                mPropGrid->RemoveObjectProperty(obPropIndex);
+                foundInGrid.Delete(obPropIndex);
+
+                mPropGrid->AddObjectProperty(
+                    translation.typeEnum, 
+                    translation.typeSize, 
+                    translation.varName, 
+                    translation.typeName, 
+                    translation.varDefault,
+                    &translation.editorDesc);
+
+                foundInGrid.PushEmpty() = true;
+                foundInGrid[mPropGrid->GetNumObjectProperties() - 1] = true;
+                if (obPropIndex <= mGridToGlobalMap.GetSize())
                 {
-                    foundInGrid[obPropIndex] = true;
-                    mGridToGlobalMap[obPropIndex] = i;                
-                    SetScriptVariable(translation, obPropIndex, state, i);
-                }
-                else
-                { 
-                    PG_ASSERTSTR(!foundInGrid[obPropIndex], "Cannot attempt to delete an object twice!");
-                    mPropGrid->RemoveObjectProperty(obPropIndex);
-                    foundInGrid.Delete(obPropIndex);
-
-                    mPropGrid->AddObjectProperty(
-                        translation.typeEnum, 
-                        translation.typeSize, 
-                        translation.varName, 
-                        translation.typeName, 
-                        translation.varDefault,
-                        &translation.editorDesc);
-
-                    foundInGrid.PushEmpty() = true;
-                    foundInGrid[mPropGrid->GetNumObjectProperties() - 1] = true;
-                    if (obPropIndex <= mGridToGlobalMap.GetSize())
-                    {
-                        mGridToGlobalMap.Delete(obPropIndex);
-                    }
-                    mGridToGlobalMap.PushEmpty() = i;
+                    mGridToGlobalMap.Delete(obPropIndex);
                 }
+                mGridToGlobalMap.PushEmpty() = i;
+                IndexObjectProperties(mPropGrid, propIndices);
             }
         }
 
@@ -344,6 +362,7 @@ void BlockRuntimeScriptListener::OnStackInitalized(Pegasus::BlockScript::BsVmSta
             int outputIndex = (int)mPropGrid->GetNumObjectProperties() - 1;
             foundInGrid.PushEmpty() = true;
             mGridToGlobalMap.PushEmpty() = i;
+            propIndices.Insert(mPropGrid->GetObjectPropertyRecord(outputIndex).name, outputIndex);
         }
     }
 
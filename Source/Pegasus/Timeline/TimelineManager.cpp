@@ -44,6 +44,7 @@ TimelineManager::TimelineManager(Alloc::IAllocator * allocator, Core::IApplicati
 :   mAllocator(allocator)
 ,   mAppContext(appContext)
 ,   mNumRegisteredBlocks(0)
+,   mRegisteredBlockIndices(allocator)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -112,6 +113,12 @@ void TimelineManager::RegisterBlock(const char * className, CreateBlockFunc crea
         return;
     }
 
+    if (mRegisteredBlockIndices.Contains(className))
+    {
+        PG_FAILSTR("Trying to register the block class %s but it is already registered", className);
+        return;
+    }
+
     // After the parameters have been validated, register the class
     BlockEntry & entry = mRegisteredBlocks[mNumRegisteredBlocks];
 #if PEGASUS_COMPILER_MSVC
@@ -134,6 +141,7 @@ void TimelineManager::RegisterBlock(const char * className, CreateBlockFunc crea
 #endif  // PEGASUS_COMPILER_MSVC
 
     entry.createBlockFunc = createBlockFunc;
+    mRegisteredBlockIndices.Insert(entry.className, mNumRegisteredBlocks);
     ++mNumRegisteredBlocks;
 }
 
@@ -248,18 +256,15 @@ unsigned int TimelineManager::GetRegisteredBlockIndex(const char * className) co
         return mNumRegisteredBlocks;
     }
 
-    unsigned int index;
-    for (index = 0; index < mNumRegisteredBlocks; ++index)
+    const unsigned int * index = mRegisteredBlockIndices.Find(className);
+    if (index != nullptr)
     {
-        if (Pegasus::Utils::Strcmp(mRegisteredBlocks[index].className, className) == 0)
-        {
-            // Block found
-            return index;
-        }
+        // Block found
+        PG_ASSERT(*index < mNumRegisteredBlocks);
+        return *index;
     }
 
     // Block not found
-    PG_ASSERT(index == mNumRegisteredBlocks);
     return mNumRegisteredBlocks;
 }
 
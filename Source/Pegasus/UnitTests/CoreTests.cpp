@@ -0,0 +1,384 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CoreTests.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Core package, implementation
+
+#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/UnitTests/CoreTests.h"
+#include "Pegasus/UnitTests/TestFiles.h"
+#include "Pegasus/Core/AsyncLoader.h"
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Utils/String.h"
+
+static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
+
+//! Number of items of the largest ParallelFor() range of the tests
+static const unsigned int PARALLEL_FOR_MAX_COUNT = 4096;
+
+//! Number of times each item of the ParallelFor() ranges has been processed
+static volatile int sParallelForVisits[PARALLEL_FOR_MAX_COUNT];
+
+//! Range function counting the visits of each item
+static void CountVisits(void * userData, unsigned int begin, unsigned int end)
+{
+    for (unsigned int i = begin; i < end; ++i)
+    {
+        Pegasus::Core::AtomicAdd(&sParallelForVisits[i], 1);
+    }
+}
+
+//! Runs Core::ParallelFor() and checks that each item of the range is processed exactly once
+static bool CheckParallelFor(unsigned int count, unsigned int grainSize)
+{
+    for (unsigned int i = 0; i < PARALLEL_FOR_MAX_COUNT; ++i)
+    {
+        sParallelForVisits[i] = 0;
+    }
+    Pegasus::Core::ParallelFor(count, grainSize, CountVisits, nullptr);
+    for (unsigned int i = 0; i < PARALLEL_FOR_MAX_COUNT; ++i)
+    {
+        if (sParallelForVisits[i] != ((i < count) ? 1 : 0)) return false;
+    }
+    return true;
+}
+
+//! Checks ParallelFor() on empty ranges, single chunks, partial last chunks and grain sizes of 0
+static bool CheckParallelForRanges()
+{
+    return CheckParallelFor(0, 0)
+        && CheckParallelFor(1, 0)
+        && CheckParallelFor(7, 3)
+        && CheckParallelFor(1000, 0)
+        && CheckParallelFor(1000, 7)
+        && CheckParallelFor(1000, 5000)
+        && CheckParallelFor(PARALLEL_FOR_MAX_COUNT, 64);
+}
+
+bool UNIT_TEST_WorkerPool1()
+{
+    // Every item is processed once, with the worker pool and on the calling thread without it
+    Pegasus::Core::WorkerPool::CreateInstance(&sGlobalAllocator);
+    bool match = CheckParallelForRanges();
+    Pegasus::Core::WorkerPool::DestroyInstance();
+    match = match && CheckParallelForRanges();
+    return match;
+}
+
+//! Number of tasks submitted by the test, and of subtasks submitted by each task
+static const unsigned int NESTED_TASK_COUNT = 32;
+static const unsigned int NESTED_SUBTASK_COUNT = 16;
+
+//! Number of items of the ParallelFor() run by each task
+static const unsigned int NESTED_RANGE_COUNT = 100;
+
+//! Number of subtasks run and of items processed by the nested ParallelFor() calls
+static volatile int sSubtaskCount = 0;
+static volatile int sNestedItemCount = 0;
+
+//! Subtask counting its run
+static void NestedSubtask(void * userData)
+{
+    Pegasus::Core::AtomicAdd(&sSubtaskCount, 1);
+}
+
+//! Range function counting the processed items
+static void CountNestedItems(void * userData, unsigned int begin, unsigned int end)
+{
+    Pegasus::Core::AtomicAdd(&sNestedItemCount, static_cast<int>(end - begin));
+}
+
+//! Task submitting subtasks to its own group and waiting for them, then running a ParallelFor()
+static void NestedTask(void * userData)
+{
+    Pegasus::Core::WorkerPool * pool = static_cast<Pegasus::Core::WorkerPool *>(userData);
+    Pegasus::Core::WorkerPool::TaskGroup group;
+    for (unsigned int t = 0; t < NESTED_SUBTASK_COUNT; ++t)
+    {
+        pool->Submit(group, NestedSubtask, nullptr);
+    }
+    pool->Wait(group);
+    pool->ParallelFor(NESTED_RANGE_COUNT, 10, CountNestedItems, nullptr);
+}
+
+bool UNIT_TEST_WorkerPool2()
+{
+    // Tasks waiting for the tasks they submit, the waiting threads running the queued tasks
+    Pegasus::Core::WorkerPool * pool = Pegasus::Core::WorkerPool::CreateInstance(&sGlobalAllocator);
+    sSubtaskCount = 0;
+    sNestedItemCount = 0;
+    Pegasus::Core::WorkerPool::TaskGroup group;
+    for (unsigned int t = 0; t < NESTED_TASK_COUNT; ++t)
+    {
+        pool->Submit(group, NestedTask, pool);
+    }
+    pool->Wait(group);
+    const bool match = (group.mPendingCount == 0)
+                    && (sSubtaskCount == NESTED_TASK_COUNT * NESTED_SUBTASK_COUNT)
+                    && (sNestedItemCount == NESTED_TASK_COUNT * NESTED_RANGE_COUNT);
+    Pegasus::Core::WorkerPool::DestroyInstance();
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Number of files loaded by the asynchronous loader tests, and size of each file
+static const unsigned int ASYNC_FILE_COUNT = 6;
+static const unsigned int ASYNC_FILE_SIZE = 64 * 1024;
+
+//! Get the name of a file of the asynchronous loader tests
+//! \param index Index of the file
+//! \param path Buffer of Io::IOManager::MAX_FILEPATH_LENGTH characters receiving the name
+static void GetAsyncFileName(unsigned int index, char * path)
+{
+    path[0] = '\0';
+    Pegasus::Utils::Strcat(path, "PegasusAsyncLoader");
+    Pegasus::Utils::Strcat(path, static_cast<int>(index));
+    Pegasus::Utils::Strcat(path, ".bin");
+}
+
+//! Write the files of the asynchronous loader tests, byte b of file i being (b * 7 + i) modulo 256
+//! \param ioManager IO manager of the temporary directory
+//! \return True if written
+static bool WriteAsyncFiles(Pegasus::Io::IOManager * ioManager)
+{
+    static unsigned char sContent[ASYNC_FILE_SIZE];
+    bool match = true;
+    for (unsigned int i = 0; i < ASYNC_FILE_COUNT; ++i)
+    {
+        for (unsigned int b = 0; b < ASYNC_FILE_SIZE; ++b)
+        {
+            sContent[b] = static_cast<unsigned char>((b * 7 + i) & 0xFF);
+        }
+        char path[Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH];
+        GetAsyncFileName(i, path);
+        match = match && WriteTestFile(ioManager, path, sContent, ASYNC_FILE_SIZE);
+    }
+    return match;
+}
+
+//! Check the content of a loaded file written by WriteAsyncFiles()
+//! \param buffer Buffer of the loaded file
+//! \param index Index of the file
+//! \return True if the content matches
+static bool CheckAsyncFile(const Pegasus::Io::FileBuffer & buffer, unsigned int index)
+{
+    const unsigned char * content = reinterpret_cast<const unsigned char *>(buffer.GetBuffer());
+    bool match = (content != nullptr) && (buffer.GetFileSize() == ASYNC_FILE_SIZE);
+    for (unsigned int b = 0; match && (b < ASYNC_FILE_SIZE); ++b)
+    {
+        match = (content[b] == static_cast<unsigned char>((b * 7 + index) & 0xFF));
+    }
+    return match;
+}
+
+//! Submit the loading of a file written by WriteAsyncFiles()
+static Pegasus::Io::AsyncHandle SubmitAsyncFile(Pegasus::Io::AsyncLoader & loader, Pegasus::Io::IOManager * ioManager, unsigned int index,
+                                                Pegasus::Io::AsyncPriority priority = Pegasus::Io::ASYNC_PRIORITY_NORMAL,
+                                                Pegasus::Io::AsyncCallback callback = nullptr, void * userData = nullptr)
+{
+    char path[Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetAsyncFileName(index, path);
+    return loader.Submit(ioManager, path, Pegasus::Io::ASYNC_LOAD_READ, priority, callback, userData);
+}
+
+//! Wait for a request and check the content of its file
+static bool WaitAsyncFile(Pegasus::Io::AsyncLoader & loader, Pegasus::Io::AsyncHandle handle, unsigned int index)
+{
+    Pegasus::Io::FileBuffer buffer;
+    return (loader.Wait(handle, buffer) == Pegasus::Io::ERR_NONE) && CheckAsyncFile(buffer, index);
+}
+
+bool UNIT_TEST_AsyncLoader1()
+{
+    // Handles of a reused slot not matching the handles of the previous requests
+    char rootPath[Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetTestFileDirectory(rootPath);
+    Pegasus::Io::IOManager ioManager(rootPath);
+    bool match = WriteAsyncFiles(&ioManager);
+
+    Pegasus::Io::AsyncLoader loader(&sGlobalAllocator, 1);
+    const Pegasus::Io::AsyncHandle handle1 = SubmitAsyncFile(loader, &ioManager, 0);
+    match = match && (handle1 != Pegasus::Io::ASYNC_INVALID_HANDLE) && WaitAsyncFile(loader, handle1, 0);
+
+    // The slot freed by Wait() is the next one used
+    char path[Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetAsyncFileName(1, path);
+    const Pegasus::Io::AsyncHandle handle2 = loader.Submit(&ioManager, path, Pegasus::Io::ASYNC_LOAD_MAP);
+    match = match && (handle2 != Pegasus::Io::ASYNC_INVALID_HANDLE) && (handle2 != handle1)
+                  && (Pegasus::Utils::Strcmp(loader.GetPath(handle2), path) == 0);
+    Pegasus::Io::FileBuffer mappedBuffer;
+    match = match && (loader.Wait(handle2, mappedBuffer) == Pegasus::Io::ERR_NONE) && CheckAsyncFile(mappedBuffer, 1);
+
+    const Pegasus::Io::AsyncHandle handle3 = loader.Submit(&ioManager, "PegasusAsyncLoaderMissing.bin", Pegasus::Io::ASYNC_LOAD_READ);
+    Pegasus::Io::FileBuffer missingBuffer;
+    match = match && (handle3 != handle1) && (handle3 != handle2)
+                  && (loader.Wait(handle3, missingBuffer) == Pegasus::Io::ERR_FILE_NOT_FOUND) && (missingBuffer.GetBuffer() == nullptr);
+
+    // All the slots in flight, the requests staying queued while paused and loaded by Wait()
+    loader.SetPaused(true);
+    Pegasus::Io::AsyncHandle handles[Pegasus::Io::AsyncLoader::MAX_REQUESTS];
+    for (unsigned int r = 0; r < Pegasus::Io::AsyncLoader::MAX_REQUESTS; ++r)
+    {
+        handles[r] = SubmitAsyncFile(loader, &ioManager, r % ASYNC_FILE_COUNT);
+        match = match && (handles[r] != Pegasus::Io::ASYNC_INVALID_HANDLE) && !loader.IsComplete(handles[r]);
+    }
+    match = match && (SubmitAsyncFile(loader, &ioManager, 0) == Pegasus::Io::ASYNC_INVALID_HANDLE);
+    match = match && WaitAsyncFile(loader, handles[0], 0);
+    for (unsigned int r = 1; r < Pegasus::Io::AsyncLoader::MAX_REQUESTS; ++r)
+    {
+        loader.Cancel(handles[r]);
+    }
+    loader.SetPaused(false);
+
+    // A freed slot getting a new handle each time it is reused
+    const Pegasus::Io::AsyncHandle handle4 = SubmitAsyncFile(loader, &ioManager, 2);
+    match = match && (handle4 != handles[0]) && WaitAsyncFile(loader, handle4, 2);
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Files of the completed requests, in the order of the callbacks
+static unsigned int sCompletionOrder[ASYNC_FILE_COUNT];
+static unsigned int sCompletionCount = 0;
+
+//! Number of completed requests whose file content is wrong
+static unsigned int sCompletionErrorCount = 0;
+
+//! Callback of the asynchronous loader tests, claiming the request
+//! \param userData Loader of the request
+static void RecordCompletion(Pegasus::Io::AsyncHandle handle, Pegasus::Io::IoError error, void * userData)
+{
+    Pegasus::Io::AsyncLoader * loader = static_cast<Pegasus::Io::AsyncLoader *>(userData);
+    const char * path = loader->GetPath(handle);
+    const unsigned int index = static_cast<unsigned int>(path[Pegasus::Utils::Strlen("PegasusAsyncLoader")] - '0');
+    if (sCompletionCount < ASYNC_FILE_COUNT)
+    {
+        sCompletionOrder[sCompletionCount] = index;
+    }
+    ++sCompletionCount;
+    if ((error != Pegasus::Io::ERR_NONE) || !WaitAsyncFile(*loader, handle, index))
+    {
+        ++sCompletionErrorCount;
+    }
+}
+
+bool UNIT_TEST_AsyncLoader2()
+{
+    // Requests submitted together loaded by priority, then in the order of submission
+    char rootPath[Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetTestFileDirectory(rootPath);
+    Pegasus::Io::IOManager ioManager(rootPath);
+    bool match = WriteAsyncFiles(&ioManager);
+
+    Pegasus::Io::AsyncLoader loader(&sGlobalAllocator, 1);
+    static const Pegasus::Io::AsyncPriority sPriorities[ASYNC_FILE_COUNT] =
+    {
+        Pegasus::Io::ASYNC_PRIORITY_LOW, Pegasus::Io::ASYNC_PRIORITY_NORMAL, Pegasus::Io::ASYNC_PRIORITY_HIGH,
+        Pegasus::Io::ASYNC_PRIORITY_LOW, Pegasus::Io::ASYNC_PRIORITY_HIGH, Pegasus::Io::ASYNC_PRIORITY_NORMAL
+    };
+    static const unsigned int sExpectedOrder[ASYNC_FILE_COUNT] = { 2, 4, 1, 5, 0, 3 };
+
+    sCompletionCount = 0;
+    sCompletionErrorCount = 0;
+    loader.SetPaused(true);
+    Pegasus::Io::AsyncHandle handles[ASYNC_FILE_COUNT];
+    for (unsigned int i = 0; i < ASYNC_FILE_COUNT; ++i)
+    {
+        handles[i] = SubmitAsyncFile(loader, &ioManager, i, sPriorities[i], RecordCompletion, &loader);
+    }
+    match = match && (loader.DispatchCallbacks() == 0);
+    loader.SetPaused(false);
+
+    // The single worker takes the whole queue at once, so the last request completes with the others
+    while (!loader.IsComplete(handles[sExpectedOrder[ASYNC_FILE_COUNT - 1]]))
+    {
+    }
+    match = match && (loader.DispatchCallbacks() == ASYNC_FILE_COUNT) && (sCompletionErrorCount == 0);
+    for (unsigned int i = 0; i < ASYNC_FILE_COUNT; ++i)
+    {
+        match = match && (sCompletionOrder[i] == sExpectedOrder[i]);
+    }
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Number of requests canceled at once by the test, and number of times the test is repeated
+static const unsigned int CANCELED_REQUEST_COUNT = 64;
+static const unsigned int CANCEL_ROUND_COUNT = 8;
+
+//! Name and size of the large file of the test, long enough to load to be canceled while loading
+static const char * LARGE_ASYNC_FILE = "PegasusAsyncLoaderLarge.bin";
+static const unsigned int LARGE_ASYNC_FILE_SIZE = 16 * 1024 * 1024;
+
+bool UNIT_TEST_AsyncLoader3()
+{
+    // Requests canceled while queued, being loaded or loaded, never reported and their slots all freed
+    char rootPath[Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetTestFileDirectory(rootPath);
+    Pegasus::Io::IOManager ioManager(rootPath);
+    bool match = WriteAsyncFiles(&ioManager);
+    unsigned char * largeContent = PG_NEW_ARRAY(&sGlobalAllocator, -1, "large test file", Pegasus::Alloc::PG_MEM_TEMP,
+                                                unsigned char, LARGE_ASYNC_FILE_SIZE);
+    match = match && WriteTestFile(&ioManager, LARGE_ASYNC_FILE, largeContent, LARGE_ASYNC_FILE_SIZE);
+    PG_DELETE_ARRAY(&sGlobalAllocator, largeContent);
+
+    Pegasus::Io::AsyncLoader loader(&sGlobalAllocator, 1);
+    sCompletionCount = 0;
+    sCompletionErrorCount = 0;
+    for (unsigned int round = 0; round < CANCEL_ROUND_COUNT; ++round)
+    {
+        // The large file canceled as soon as the worker takes it from the queue
+        loader.SetPaused(true);
+        const Pegasus::Io::AsyncHandle largeHandle = loader.Submit(&ioManager, LARGE_ASYNC_FILE, Pegasus::Io::ASYNC_LOAD_READ,
+                                                                   Pegasus::Io::ASYNC_PRIORITY_NORMAL, RecordCompletion, &loader);
+        loader.SetPaused(false);
+        while (loader.GetQueuedCount() != 0)
+        {
+        }
+        loader.Cancel(largeHandle);
+
+        // Then requests queued behind it, or loaded if the worker is fast enough
+        Pegasus::Io::AsyncHandle handles[CANCELED_REQUEST_COUNT];
+        for (unsigned int r = 0; r < CANCELED_REQUEST_COUNT; ++r)
+        {
+            handles[r] = SubmitAsyncFile(loader, &ioManager, r % ASYNC_FILE_COUNT, Pegasus::Io::ASYNC_PRIORITY_NORMAL, RecordCompletion, &loader);
+        }
+        for (unsigned int r = 0; r < CANCELED_REQUEST_COUNT; ++r)
+        {
+            loader.Cancel(handles[r]);
+        }
+
+        // Once a request submitted after them is complete, the single worker is done with the canceled ones
+        const Pegasus::Io::AsyncHandle lastHandle = SubmitAsyncFile(loader, &ioManager, 0);
+        while (!loader.IsComplete(lastHandle))
+        {
+        }
+        match = match && WaitAsyncFile(loader, lastHandle, 0) && (loader.DispatchCallbacks() == 0);
+    }
+
+    // No slot lost by the requests canceled in flight
+    loader.SetPaused(true);
+    Pegasus::Io::AsyncHandle handles[Pegasus::Io::AsyncLoader::MAX_REQUESTS];
+    for (unsigned int r = 0; r < Pegasus::Io::AsyncLoader::MAX_REQUESTS; ++r)
+    {
+        handles[r] = SubmitAsyncFile(loader, &ioManager, 0);
+        match = match && (handles[r] != Pegasus::Io::ASYNC_INVALID_HANDLE);
+    }
+    for (unsigned int r = 0; r < Pegasus::Io::AsyncLoader::MAX_REQUESTS; ++r)
+    {
+        if (handles[r] != Pegasus::Io::ASYNC_INVALID_HANDLE)
+        {
+            loader.Cancel(handles[r]);
+        }
+    }
+    return match && (sCompletionCount == 0);
+}
@@ -0,0 +1,774 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphTests.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Graph package, implementation
+
+#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/UnitTests/GraphTests.h"
+#include "Pegasus/UnitTests/TestFiles.h"
+#include "Pegasus/Graph/GeneratorNode.h"
+#include "Pegasus/Graph/OperatorNode.h"
+#include "Pegasus/Graph/GraphScheduler.h"
+#include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/NodeDataCache.h"
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Hash.h"
+
+using namespace Pegasus;
+
+static Memory::MallocFreeAllocator sGlobalAllocator(0);
+
+//! Number of generations of the test nodes, giving the order of the generations
+static volatile int sGenerationCounter = 0;
+
+//! Number of operators generated while an input was not up to date, or generated after them
+static volatile int sOrderErrorCount = 0;
+
+//----------------------------------------------------------------------------------------
+
+//! Data of the test nodes, a single value and the history of its generations
+class TestNodeData : public Graph::NodeData
+{
+public:
+    TestNodeData(Alloc::IAllocator* allocator)
+    :   Graph::NodeData(allocator), mValue(0), mGenerationIndex(-1), mGenerationCount(0) {}
+
+    //! Record a generation of the data
+    void StampGeneration()
+    {
+        mGenerationIndex = Core::AtomicAdd(&sGenerationCounter, 1);
+        ++mGenerationCount;
+    }
+
+    //! Only the value is cached, the history stays the one of the node
+    virtual bool CopyContent(const Graph::NodeData& source)
+    {
+        mValue = static_cast<const TestNodeData&>(source).mValue;
+        return true;
+    }
+
+    virtual unsigned int GetContentSize() const { return sizeof(mValue); }
+
+    virtual bool WriteContent(Utils::ByteStream& stream) const
+    {
+        stream.Append(&mValue, sizeof(mValue));
+        return true;
+    }
+
+    virtual bool ReadContent(const void* buffer, unsigned int size)
+    {
+        if (size != sizeof(mValue))
+        {
+            return false;
+        }
+        mValue = *static_cast<const unsigned int*>(buffer);
+        return true;
+    }
+
+    unsigned int mValue;                //!< Generated value
+    int mGenerationIndex;               //!< Order of the last generation among all the test nodes
+    unsigned int mGenerationCount;      //!< Number of generations of the data
+};
+
+//! Get the data of a test node
+//! \param node Test generator or operator node
+//! \return Data of the node, nullptr if never generated
+static TestNodeData* GetTestData(const Graph::Node* node)
+{
+    Graph::NodeDataRef data = node->GetData();
+    return data;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Generator of a constant value
+class TestGeneratorNode : public Graph::GeneratorNode
+{
+public:
+    TestGeneratorNode(unsigned int value, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
+    :   Graph::GeneratorNode(nodeAllocator, nodeDataAllocator), mValue(value) {}
+
+    virtual const char* GetClassInstanceName() const { return "TestGeneratorNode"; }
+
+    //! Factory function registered in the node manager, generating 0
+    static Graph::NodeReturn CreateNode(Graph::NodeManager* nodeManager, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "TestGeneratorNode", Alloc::PG_MEM_PERM) TestGeneratorNode(0, nodeAllocator, nodeDataAllocator);
+    }
+
+    //! Change the generated value, the node is regenerated by the next evaluation
+    void SetValue(unsigned int value) { mValue = value; InvalidateData(); }
+
+protected:
+    virtual ~TestGeneratorNode() {}
+
+    virtual unsigned long long HashConfiguration(unsigned long long key) const
+    {
+        return Utils::HashFnv1a64(&mValue, sizeof(mValue), key);
+    }
+
+    virtual Graph::NodeData* AllocateData() const
+    {
+        return PG_NEW(GetNodeDataAllocator(), -1, "TestNodeData", Alloc::PG_MEM_TEMP) TestNodeData(GetNodeDataAllocator());
+    }
+
+    virtual void GenerateData()
+    {
+        TestNodeData* data = GetData();
+        data->mValue = mValue;
+        data->StampGeneration();
+    }
+
+private:
+    unsigned int mValue;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Operator hashing the values of its inputs, in the order of the inputs
+class TestOperatorNode : public Graph::OperatorNode
+{
+public:
+    TestOperatorNode(unsigned int seed, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
+    :   Graph::OperatorNode(nodeAllocator, nodeDataAllocator), mSeed(seed) {}
+
+    virtual const char* GetClassInstanceName() const { return "TestOperatorNode"; }
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+    virtual unsigned int GetMaxNumInputNodes() const { return MAX_NUM_INPUTS; }
+
+    //! Factory function registered in the node manager, with a seed of 0
+    static Graph::NodeReturn CreateNode(Graph::NodeManager* nodeManager, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
+    {
+        return PG_NEW(nodeAllocator, -1, "TestOperatorNode", Alloc::PG_MEM_PERM) TestOperatorNode(0, nodeAllocator, nodeDataAllocator);
+    }
+
+    //! Append an input node
+    void AddTestInput(Graph::NodeIn inputNode) { AddInput(inputNode); }
+
+    //! Change the seed of the hash, the node is regenerated by the next evaluation
+    void SetSeed(unsigned int seed) { mSeed = seed; InvalidateData(); }
+
+protected:
+    virtual ~TestOperatorNode() {}
+
+    virtual unsigned long long HashConfiguration(unsigned long long key) const
+    {
+        return Utils::HashFnv1a64(&mSeed, sizeof(mSeed), key);
+    }
+
+    virtual Graph::NodeData* AllocateData() const
+    {
+        return PG_NEW(GetNodeDataAllocator(), -1, "TestNodeData", Alloc::PG_MEM_TEMP) TestNodeData(GetNodeDataAllocator());
+    }
+
+    virtual void GenerateData()
+    {
+        TestNodeData* data = GetData();
+        data->StampGeneration();
+
+        unsigned int value = mSeed;
+        for (unsigned int i = 0; i < GetNumInputs(); ++i)
+        {
+            const TestNodeData* inputData = GetTestData(&(*GetInput(i)));
+            if (inputData->IsDirty() || (inputData->mGenerationIndex >= data->mGenerationIndex))
+            {
+                Core::AtomicAdd(&sOrderErrorCount, 1);
+            }
+            value = value * 31 + inputData->mValue;
+        }
+        data->mValue = value;
+    }
+
+private:
+    unsigned int mSeed;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Graph of 6 generators feeding 2 layers of operators sharing their inputs, then a root operator
+class TestGraph
+{
+public:
+    enum
+    {
+        NUM_GENERATORS = 6,
+        NUM_OPERATORS1 = 4,
+        NUM_OPERATORS2 = 2,
+        NUM_NODES = NUM_GENERATORS + NUM_OPERATORS1 + NUM_OPERATORS2 + 1
+    };
+
+    TestGraph()
+    {
+        unsigned int n = 0;
+        for (unsigned int g = 0; g < NUM_GENERATORS; ++g)
+        {
+            mGenerators[g] = PG_NEW(&sGlobalAllocator, -1, "TestGeneratorNode", Alloc::PG_MEM_PERM)
+                                TestGeneratorNode(g * 7 + 1, &sGlobalAllocator, &sGlobalAllocator);
+            mNodes[n++] = mGenerators[g];
+        }
+
+        // Each first layer operator reads 3 consecutive generators
+        const unsigned int firstOperator1 = n;
+        for (unsigned int o = 0; o < NUM_OPERATORS1; ++o)
+        {
+            TestOperatorNode* op = CreateOperator(100 + o);
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                op->AddTestInput(mNodes[o + i]);
+            }
+            mNodes[n++] = op;
+        }
+
+        // Each second layer operator reads 3 consecutive operators and the last generator
+        const unsigned int firstOperator2 = n;
+        for (unsigned int o = 0; o < NUM_OPERATORS2; ++o)
+        {
+            TestOperatorNode* op = CreateOperator(200 + o);
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                op->AddTestInput(mNodes[firstOperator1 + o + i]);
+            }
+            op->AddTestInput(mNodes[NUM_GENERATORS - 1]);
+            mNodes[n++] = op;
+        }
+
+        // The root reads both second layer operators and one first layer operator directly
+        TestOperatorNode* root = CreateOperator(300);
+        root->AddTestInput(mNodes[firstOperator2]);
+        root->AddTestInput(mNodes[firstOperator2 + 1]);
+        root->AddTestInput(mNodes[firstOperator1]);
+        mNodes[n++] = root;
+    }
+
+    //! Evaluate the graph with a scheduler, then pull the data of the root, as the textures do
+    //! \param scheduler Scheduler evaluating the graph
+    void Evaluate(Graph::GraphScheduler& scheduler)
+    {
+        Graph::EvaluationPass evaluationPass;
+        Graph::Node* root = &(*mNodes[NUM_NODES - 1]);
+        scheduler.Evaluate(root);
+        bool updated = false;
+        (void) root->GetUpdatedDataInPass(updated);
+    }
+
+    //! Test if a node depends on another one
+    //! \param node Node to test
+    //! \param input Possible input of the node, directly or through other nodes
+    //! \return True if \a node is \a input or reads it
+    static bool DependsOn(const Graph::Node* node, const Graph::Node* input)
+    {
+        if (node == input)
+        {
+            return true;
+        }
+        for (unsigned int i = 0; i < node->GetNumInputs(); ++i)
+        {
+            if (DependsOn(&(*node->GetInput(i)), input))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    TestGeneratorNode* mGenerators[NUM_GENERATORS];     //!< Generators of the graph, owned by \a mNodes
+    Graph::NodeRef mNodes[NUM_NODES];                   //!< Nodes of the graph, inputs first, the root last
+
+private:
+    static TestOperatorNode* CreateOperator(unsigned int seed)
+    {
+        return PG_NEW(&sGlobalAllocator, -1, "TestOperatorNode", Alloc::PG_MEM_PERM)
+                    TestOperatorNode(seed, &sGlobalAllocator, &sGlobalAllocator);
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Evaluate a test graph and check that the expected nodes are generated once, after their inputs
+//! \param graph Graph to evaluate
+//! \param scheduler Scheduler evaluating the graph
+//! \param expectedCounts Expected number of generations of each node after the evaluation
+//! \return True if the generations match
+static bool CheckEvaluation(TestGraph& graph, Graph::GraphScheduler& scheduler, const unsigned int* expectedCounts)
+{
+    sOrderErrorCount = 0;
+    graph.Evaluate(scheduler);
+
+    bool match = (sOrderErrorCount == 0) && (scheduler.GetLastVisitedNodeCount() == TestGraph::NUM_NODES);
+    for (unsigned int n = 0; n < TestGraph::NUM_NODES; ++n)
+    {
+        const TestNodeData* data = GetTestData(&(*graph.mNodes[n]));
+        match = match && (data != nullptr) && !data->IsDirty() && (data->mGenerationCount == expectedCounts[n]);
+    }
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool UNIT_TEST_GraphScheduler1()
+{
+    // Inputs generated before the nodes reading them, and only the nodes depending on a change regenerated
+    Core::WorkerPool::CreateInstance(&sGlobalAllocator);
+    Graph::GraphScheduler scheduler(&sGlobalAllocator);
+    TestGraph graph;
+
+    unsigned int expectedCounts[TestGraph::NUM_NODES];
+    for (unsigned int n = 0; n < TestGraph::NUM_NODES; ++n)
+    {
+        expectedCounts[n] = 1;
+    }
+    bool match = CheckEvaluation(graph, scheduler, expectedCounts)
+              && (scheduler.GetLastGeneratedNodeCount() == TestGraph::NUM_NODES);
+
+    // Changing a generator read by several operators
+    graph.mGenerators[2]->SetValue(1000);
+    unsigned int dependentCount = 0;
+    for (unsigned int n = 0; n < TestGraph::NUM_NODES; ++n)
+    {
+        if (TestGraph::DependsOn(&(*graph.mNodes[n]), graph.mGenerators[2]))
+        {
+            ++expectedCounts[n];
+            ++dependentCount;
+        }
+    }
+    match = match && CheckEvaluation(graph, scheduler, expectedCounts)
+                  && (scheduler.GetLastGeneratedNodeCount() == dependentCount);
+
+    // Nothing regenerated without any change
+    match = match && CheckEvaluation(graph, scheduler, expectedCounts)
+                  && (scheduler.GetLastGeneratedNodeCount() == 0);
+
+    Core::WorkerPool::DestroyInstance();
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compare the values of two test graphs
+//! \return True if all the nodes have the same value
+static bool CompareGraphs(const TestGraph& graph1, const TestGraph& graph2)
+{
+    for (unsigned int n = 0; n < TestGraph::NUM_NODES; ++n)
+    {
+        if (GetTestData(&(*graph1.mNodes[n]))->mValue != GetTestData(&(*graph2.mNodes[n]))->mValue)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool UNIT_TEST_GraphScheduler2()
+{
+    // Parallel evaluation giving the same values as the serial one (without worker pool)
+    Graph::GraphScheduler scheduler(&sGlobalAllocator);
+    TestGraph serialGraph;
+    TestGraph parallelGraph;
+    sOrderErrorCount = 0;
+
+    serialGraph.Evaluate(scheduler);
+    Core::WorkerPool::CreateInstance(&sGlobalAllocator);
+    parallelGraph.Evaluate(scheduler);
+    bool match = CompareGraphs(serialGraph, parallelGraph);
+
+    // Changing two generators, in the parallel graph first
+    parallelGraph.mGenerators[0]->SetValue(12345);
+    parallelGraph.mGenerators[5]->SetValue(678);
+    parallelGraph.Evaluate(scheduler);
+    Core::WorkerPool::DestroyInstance();
+    serialGraph.mGenerators[0]->SetValue(12345);
+    serialGraph.mGenerators[5]->SetValue(678);
+    serialGraph.Evaluate(scheduler);
+    match = match && CompareGraphs(serialGraph, parallelGraph);
+
+    return match && (sOrderErrorCount == 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool UNIT_TEST_EvaluationPass1()
+{
+    // Diamond: a generator read by two operators, both read by the root
+    TestGeneratorNode* generator = PG_NEW(&sGlobalAllocator, -1, "TestGeneratorNode", Alloc::PG_MEM_PERM)
+                                        TestGeneratorNode(5, &sGlobalAllocator, &sGlobalAllocator);
+    Graph::NodeRef generatorRef = generator;
+    TestOperatorNode* left = PG_NEW(&sGlobalAllocator, -1, "TestOperatorNode", Alloc::PG_MEM_PERM)
+                                TestOperatorNode(1, &sGlobalAllocator, &sGlobalAllocator);
+    Graph::NodeRef leftRef = left;
+    TestOperatorNode* right = PG_NEW(&sGlobalAllocator, -1, "TestOperatorNode", Alloc::PG_MEM_PERM)
+                                TestOperatorNode(2, &sGlobalAllocator, &sGlobalAllocator);
+    Graph::NodeRef rightRef = right;
+    TestOperatorNode* root = PG_NEW(&sGlobalAllocator, -1, "TestOperatorNode", Alloc::PG_MEM_PERM)
+                                TestOperatorNode(3, &sGlobalAllocator, &sGlobalAllocator);
+    Graph::NodeRef rootRef = root;
+    left->AddTestInput(generatorRef);
+    right->AddTestInput(generatorRef);
+    root->AddTestInput(leftRef);
+    root->AddTestInput(rightRef);
+
+    // Each node evaluated once, the generator visited through both operators
+    bool updated = false;
+    {
+        Graph::EvaluationPass evaluationPass;
+        (void) root->GetUpdatedDataInPass(updated);
+    }
+    bool match = updated
+              && (Graph::EvaluationPass::GetVisitCount() == 5)
+              && (Graph::EvaluationPass::GetEvaluationCount() == 4)
+              && (GetTestData(generator)->mGenerationCount == 1)
+              && (GetTestData(left)->mGenerationCount == 1)
+              && (GetTestData(right)->mGenerationCount == 1)
+              && (GetTestData(root)->mGenerationCount == 1);
+
+    // The generator regenerated for the first operator still reports it to the second one,
+    // which has clean data but has to regenerate it from the new input
+    generator->SetValue(6);
+    updated = false;
+    {
+        Graph::EvaluationPass evaluationPass;
+        (void) root->GetUpdatedDataInPass(updated);
+    }
+    match = match && updated
+                  && (Graph::EvaluationPass::GetEvaluationCount() == 4)
+                  && (GetTestData(generator)->mGenerationCount == 2)
+                  && (GetTestData(left)->mGenerationCount == 2)
+                  && (GetTestData(right)->mGenerationCount == 2)
+                  && (GetTestData(root)->mGenerationCount == 2)
+                  && (GetTestData(right)->mValue == 2 * 31 + 6);
+
+    // Nothing updated by a pass without any change
+    updated = false;
+    {
+        Graph::EvaluationPass evaluationPass;
+        (void) root->GetUpdatedDataInPass(updated);
+    }
+    match = match && !updated && (GetTestData(root)->mGenerationCount == 2);
+
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Create data to add to a node data cache
+//! \param value Value of the data
+//! \return Reference to the new data
+static Graph::NodeDataRef CreateCachedData(unsigned int value)
+{
+    TestNodeData* data = PG_NEW(&sGlobalAllocator, -1, "TestNodeData", Alloc::PG_MEM_TEMP) TestNodeData(&sGlobalAllocator);
+    data->mValue = value;
+    return data;
+}
+
+//! Look for a key in a node data cache
+//! \param cache Cache to look into
+//! \param key Content key to look for
+//! \param expectedValue Expected value of the cached data
+//! \return True if the key is cached in memory with the expected value
+static bool FindCachedValue(Graph::NodeDataCache& cache, Graph::NodeDataCache::Key key, unsigned int expectedValue)
+{
+    Graph::NodeDataRef dataRef = CreateCachedData(0);
+    TestNodeData* data = dataRef;
+    return (cache.Find(key, *data) == Graph::NodeDataCache::FIND_MEMORY_HIT) && (data->mValue == expectedValue);
+}
+
+//! Test if a key is missing from a node data cache
+//! \return True if the key is not found
+static bool IsCacheMiss(Graph::NodeDataCache& cache, Graph::NodeDataCache::Key key)
+{
+    Graph::NodeDataRef dataRef = CreateCachedData(0);
+    return cache.Find(key, *dataRef) == Graph::NodeDataCache::FIND_MISS;
+}
+
+bool UNIT_TEST_NodeDataCache1()
+{
+    // Least recently used entries evicted first, a lookup making an entry the most recently used
+    Graph::NodeDataCache cache(&sGlobalAllocator);
+    cache.SetMemoryBudget(300);
+    cache.Insert(1, CreateCachedData(10), 100);
+    cache.Insert(2, CreateCachedData(20), 100);
+    cache.Insert(3, CreateCachedData(30), 100);
+    bool match = (cache.GetEntryCount() == 3) && (cache.GetMemorySize() == 300) && (cache.GetEvictionCount() == 0);
+
+    match = match && FindCachedValue(cache, 1, 10);
+    cache.Insert(4, CreateCachedData(40), 100);
+    match = match && (cache.GetEntryCount() == 3) && (cache.GetEvictionCount() == 1)
+                  && IsCacheMiss(cache, 2)
+                  && FindCachedValue(cache, 3, 30)
+                  && FindCachedValue(cache, 4, 40)
+                  && FindCachedValue(cache, 1, 10);
+    match = match && (cache.GetHitCount() == 4) && (cache.GetMissCount() == 1) && (cache.GetFileHitCount() == 0);
+
+    // A larger entry evicts as many entries as needed, from the least recently used (3 then 4)
+    cache.Insert(5, CreateCachedData(50), 200);
+    match = match && (cache.GetEntryCount() == 2) && (cache.GetMemorySize() == 300) && (cache.GetEvictionCount() == 3)
+                  && IsCacheMiss(cache, 3)
+                  && IsCacheMiss(cache, 4)
+                  && FindCachedValue(cache, 1, 10)
+                  && FindCachedValue(cache, 5, 50);
+    match = match && (cache.GetHitCount() == 6) && (cache.GetMissCount() == 3);
+
+    cache.ResetStatistics();
+    match = match && (cache.GetHitCount() == 0) && (cache.GetMissCount() == 0) && (cache.GetEvictionCount() == 0)
+                  && (cache.GetEntryCount() == 2);
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool UNIT_TEST_NodeDataCache2()
+{
+    // Inserting a key already cached replaces its data and its size, without eviction
+    Graph::NodeDataCache cache(&sGlobalAllocator);
+    cache.SetMemoryBudget(1000);
+    cache.Insert(7, CreateCachedData(1), 100);
+    cache.Insert(7, CreateCachedData(2), 250);
+    bool match = (cache.GetEntryCount() == 1) && (cache.GetMemorySize() == 250) && (cache.GetEvictionCount() == 0)
+              && FindCachedValue(cache, 7, 2);
+
+    // Data larger than the budget, or empty, is not cached
+    cache.SetMemoryBudget(300);
+    cache.Insert(8, CreateCachedData(3), 301);
+    cache.Insert(9, CreateCachedData(4), 0);
+    match = match && cache.CanStore(300) && !cache.CanStore(301) && !cache.CanStore(0)
+                  && (cache.GetEntryCount() == 1) && IsCacheMiss(cache, 8) && IsCacheMiss(cache, 9);
+
+    // A budget of 0 empties the cache and disables it
+    cache.SetMemoryBudget(0);
+    match = match && (cache.GetEntryCount() == 0) && (cache.GetMemorySize() == 0) && (cache.GetEvictionCount() == 1)
+                  && !cache.CanStore(1) && IsCacheMiss(cache, 7);
+    cache.Insert(10, CreateCachedData(5), 100);
+    match = match && (cache.GetEntryCount() == 0) && IsCacheMiss(cache, 10);
+
+    // Enabled again
+    cache.SetMemoryBudget(100);
+    cache.Insert(10, CreateCachedData(5), 100);
+    match = match && (cache.GetEntryCount() == 1) && FindCachedValue(cache, 10, 5);
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Generator read by an operator, created by a node manager so they use its data cache
+class CachedTestGraph
+{
+public:
+    CachedTestGraph(Graph::NodeManager& nodeManager, unsigned int value, unsigned int seed)
+    {
+        mGeneratorRef = nodeManager.CreateNode("TestGeneratorNode");
+        mGenerator = mGeneratorRef;
+        mGenerator->SetValue(value);
+        mOperatorRef = nodeManager.CreateNode("TestOperatorNode");
+        mOperator = mOperatorRef;
+        mOperator->SetSeed(seed);
+        mOperator->AddTestInput(mGeneratorRef);
+    }
+
+    //! Pull the data of the operator
+    //! \return Value of the operator
+    unsigned int Evaluate()
+    {
+        Graph::EvaluationPass evaluationPass;
+        bool updated = false;
+        (void) mOperator->GetUpdatedDataInPass(updated);
+        return GetTestData(mOperator)->mValue;
+    }
+
+    //! Get the number of calls to GenerateData() of the generator and of the operator
+    unsigned int GetGenerationCount() const
+    {
+        return GetTestData(mGenerator)->mGenerationCount + GetTestData(mOperator)->mGenerationCount;
+    }
+
+    TestGeneratorNode* mGenerator;          //!< Generator, owned by \a mGeneratorRef
+    TestOperatorNode* mOperator;            //!< Operator reading the generator, owned by \a mOperatorRef
+    Graph::NodeRef mGeneratorRef;
+    Graph::NodeRef mOperatorRef;
+};
+
+bool UNIT_TEST_NodeDataCache3()
+{
+    // Content keys depending only on the class, the configuration and the inputs of the nodes,
+    // so an identical graph is restored from the cache without generating anything
+    Graph::NodeManager nodeManager(&sGlobalAllocator, &sGlobalAllocator);
+    nodeManager.RegisterNode("TestGeneratorNode", TestGeneratorNode::CreateNode);
+    nodeManager.RegisterNode("TestOperatorNode", TestOperatorNode::CreateNode);
+    Graph::NodeDataCache* cache = nodeManager.GetDataCache();
+
+    bool match = true;
+    {
+        CachedTestGraph graph1(nodeManager, 5, 1);
+        const unsigned int value = graph1.Evaluate();
+        match = (value == 1 * 31 + 5) && (graph1.GetGenerationCount() == 2)
+             && (cache->GetMissCount() == 2) && (cache->GetHitCount() == 0) && (cache->GetEntryCount() == 2);
+
+        CachedTestGraph graph2(nodeManager, 5, 1);
+        match = match && (graph2.Evaluate() == value) && (graph2.GetGenerationCount() == 0)
+                      && (cache->GetMissCount() == 2) && (cache->GetHitCount() == 2);
+
+        // Another seed changes the key of the operator only
+        CachedTestGraph graph3(nodeManager, 5, 2);
+        match = match && (graph3.Evaluate() == 2 * 31 + 5)
+                      && (GetTestData(graph3.mGenerator)->mGenerationCount == 0)
+                      && (GetTestData(graph3.mOperator)->mGenerationCount == 1)
+                      && (cache->GetMissCount() == 3) && (cache->GetHitCount() == 3);
+
+        // Another value changes the key of the generator, and the key of the operator through its input
+        CachedTestGraph graph4(nodeManager, 6, 1);
+        match = match && (graph4.Evaluate() == 1 * 31 + 6) && (graph4.GetGenerationCount() == 2)
+                      && (cache->GetMissCount() == 5) && (cache->GetHitCount() == 3);
+
+        // Changing the value of an existing graph back to a cached content
+        graph4.mGenerator->SetValue(5);
+        match = match && (graph4.Evaluate() == value) && (graph4.GetGenerationCount() == 2)
+                      && (cache->GetMissCount() == 5) && (cache->GetHitCount() == 5)
+                      && (cache->GetEntryCount() == 5);
+    }
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Name of the cache files written by the tests, in the directory given by GetTestFileDirectory()
+static const char* CACHE_TEST_FILE = "PegasusUnitTests.pgc";
+static const char* CACHE_TEST_FILE2 = "PegasusUnitTests2.pgc";
+
+bool UNIT_TEST_NodeDataCache4()
+{
+    // Entries saved then read back from the file after the memory is cleared, as on the next run
+    char rootPath[Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetTestFileDirectory(rootPath);
+    Io::IOManager ioManager(rootPath);
+
+    Graph::NodeDataCache cache(&sGlobalAllocator);
+    cache.Insert(1, CreateCachedData(10), 100);
+    cache.Insert(2, CreateCachedData(20), 100);
+    bool match = (cache.Save(&ioManager, CACHE_TEST_FILE) == Io::ERR_NONE);
+
+    cache.Clear();
+    match = match && (cache.GetEntryCount() == 0) && (cache.GetFileEntryCount() == 0) && IsCacheMiss(cache, 1);
+    match = match && (cache.Load(&ioManager, CACHE_TEST_FILE) == Io::ERR_NONE)
+                  && (cache.GetEntryCount() == 0) && (cache.GetFileEntryCount() == 2);
+
+    // Read from the file, then cached in memory by the node as after a generation
+    cache.ResetStatistics();
+    Graph::NodeDataRef dataRef = CreateCachedData(0);
+    TestNodeData* data = dataRef;
+    match = match && (cache.Find(1, *data) == Graph::NodeDataCache::FIND_FILE_HIT) && (data->mValue == 10)
+                  && (cache.GetHitCount() == 1) && (cache.GetFileHitCount() == 1);
+    cache.Insert(1, CreateCachedData(10), 100);
+    match = match && FindCachedValue(cache, 1, 10) && (cache.GetFileHitCount() == 1) && IsCacheMiss(cache, 3);
+
+    // Saving again keeps the file entry that has not been used
+    match = match && (cache.Save(&ioManager, CACHE_TEST_FILE2) == Io::ERR_NONE);
+    Graph::NodeDataCache nextCache(&sGlobalAllocator);
+    match = match && (nextCache.Load(&ioManager, CACHE_TEST_FILE2) == Io::ERR_NONE) && (nextCache.GetFileEntryCount() == 2)
+                  && (nextCache.Find(2, *data) == Graph::NodeDataCache::FIND_FILE_HIT) && (data->mValue == 20);
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool UNIT_TEST_NodeDataCache5()
+{
+    // The content keys do not change between runs, so a graph rebuilt by the next run
+    // (another node manager) is read from the saved file without generating anything
+    char rootPath[Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetTestFileDirectory(rootPath);
+    Io::IOManager ioManager(rootPath);
+
+    bool match = true;
+    unsigned int value = 0;
+    {
+        Graph::NodeManager nodeManager(&sGlobalAllocator, &sGlobalAllocator);
+        nodeManager.RegisterNode("TestGeneratorNode", TestGeneratorNode::CreateNode);
+        nodeManager.RegisterNode("TestOperatorNode", TestOperatorNode::CreateNode);
+        CachedTestGraph graph(nodeManager, 5, 1);
+        value = graph.Evaluate();
+        match = (graph.GetGenerationCount() == 2)
+             && (nodeManager.GetDataCache()->Save(&ioManager, CACHE_TEST_FILE) == Io::ERR_NONE);
+    }
+    {
+        Graph::NodeManager nodeManager(&sGlobalAllocator, &sGlobalAllocator);
+        nodeManager.RegisterNode("TestGeneratorNode", TestGeneratorNode::CreateNode);
+        nodeManager.RegisterNode("TestOperatorNode", TestOperatorNode::CreateNode);
+        Graph::NodeDataCache* cache = nodeManager.GetDataCache();
+        match = match && (cache->Load(&ioManager, CACHE_TEST_FILE) == Io::ERR_NONE);
+
+        CachedTestGraph graph(nodeManager, 5, 1);
+        match = match && (graph.Evaluate() == value) && (graph.GetGenerationCount() == 0)
+                      && (cache->GetFileHitCount() == 2) && (cache->GetMissCount() == 0);
+
+        // Another seed is not in the file
+        CachedTestGraph otherGraph(nodeManager, 5, 2);
+        match = match && (otherGraph.Evaluate() == 2 * 31 + 5)
+                      && (GetTestData(otherGraph.mOperator)->mGenerationCount == 1)
+                      && (cache->GetMissCount() == 1);
+    }
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Size of the header of the cache files (magic, version, entry count and padding)
+static const unsigned int CACHE_FILE_HEADER_SIZE = 16;
+
+//! Load a corrupted copy of a cache file
+//! \param ioManager IO manager of the temporary directory
+//! \param file Content of a valid cache file, corrupted then restored by the function
+//! \param size Size of the corrupted file in bytes
+//! \param offset Offset of the corrupted byte, or size to only truncate the file
+//! \return True if the file is rejected, leaving the cache empty
+static bool CheckCorruptedCacheFile(Io::IOManager& ioManager, Io::FileBuffer& file, unsigned int size, unsigned int offset)
+{
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(file.GetBuffer());
+    if (offset < size)
+    {
+        bytes[offset] ^= 0xFF;
+    }
+    bool match = WriteTestFile(&ioManager, CACHE_TEST_FILE2, bytes, size);
+    if (offset < size)
+    {
+        bytes[offset] ^= 0xFF;
+    }
+
+    // The cache had loaded a valid file first, the corrupted one replaces it
+    Graph::NodeDataCache cache(&sGlobalAllocator);
+    match = match && (cache.Load(&ioManager, CACHE_TEST_FILE) == Io::ERR_NONE) && (cache.GetFileEntryCount() == 2);
+    match = match && (cache.Load(&ioManager, CACHE_TEST_FILE2) == Io::ERR_READING_FILE)
+                  && (cache.GetFileEntryCount() == 0) && (cache.GetEntryCount() == 0)
+                  && IsCacheMiss(cache, 1) && IsCacheMiss(cache, 2);
+    return match;
+}
+
+bool UNIT_TEST_NodeDataCache6()
+{
+    // Truncated files, and files of another format or version, are ignored
+    char rootPath[Io::IOManager::MAX_FILEPATH_LENGTH];
+    GetTestFileDirectory(rootPath);
+    Io::IOManager ioManager(rootPath);
+
+    Graph::NodeDataCache savedCache(&sGlobalAllocator);
+    savedCache.Insert(1, CreateCachedData(10), 100);
+    savedCache.Insert(2, CreateCachedData(20), 100);
+    Io::FileBuffer file;
+    bool match = (savedCache.Save(&ioManager, CACHE_TEST_FILE) == Io::ERR_NONE)
+              && (ioManager.OpenFileToBuffer(CACHE_TEST_FILE, file, true, &sGlobalAllocator) == Io::ERR_NONE);
+    const unsigned int fileSize = static_cast<unsigned int>(file.GetFileSize());
+    match = match && (fileSize > CACHE_FILE_HEADER_SIZE);
+
+    // Content and table of entries truncated, header truncated, wrong magic, wrong version
+    match = match && CheckCorruptedCacheFile(ioManager, file, fileSize - 1, fileSize - 1);
+    match = match && CheckCorruptedCacheFile(ioManager, file, CACHE_FILE_HEADER_SIZE + 4, CACHE_FILE_HEADER_SIZE + 4);
+    match = match && CheckCorruptedCacheFile(ioManager, file, CACHE_FILE_HEADER_SIZE - 1, CACHE_FILE_HEADER_SIZE - 1);
+    match = match && CheckCorruptedCacheFile(ioManager, file, fileSize, 0);
+    match = match && CheckCorruptedCacheFile(ioManager, file, fileSize, 4);
+    return match;
+}
@@ -0,0 +1,529 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshTests.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Mesh package, implementation
+
+#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/UnitTests/MeshTests.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Graph/NodeDataCache.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Random.h"
+
+#include <math.h>
+
+static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
+
+static Pegasus::Mesh::MeshDataReturn CreateMeshData(Pegasus::Mesh::MeshConfiguration::IndexFormat indexFormat,
+                                                    Pegasus::Mesh::MeshConfiguration::VertexFormat vertexFormat = Pegasus::Mesh::MeshConfiguration::VERTEX_STANDARD,
+                                                    Pegasus::Mesh::MeshInputLayout::LayoutUsageBitMask layoutMask = Pegasus::Mesh::MeshInputLayout::USE_POSITION | Pegasus::Mesh::MeshInputLayout::USE_UV | Pegasus::Mesh::MeshInputLayout::USE_NORMAL)
+{
+    Pegasus::Mesh::MeshInputLayout inputLayout;
+    inputLayout.GenerateEditorLayout(layoutMask);
+    Pegasus::Mesh::MeshConfiguration configuration;
+    configuration.SetInputLayout(inputLayout);
+    configuration.SetIndexFormat(indexFormat);
+    configuration.SetVertexFormat(vertexFormat);
+    return PG_NEW(&sGlobalAllocator, -1, "MeshData", Pegasus::Alloc::PG_MEM_TEMP)
+               Pegasus::Mesh::MeshData(configuration, Pegasus::Graph::Node::STANDARD, &sGlobalAllocator);
+}
+
+//! Builds a grid of (size + 1)^2 vertices and size^2 quads
+static void BuildGrid(Pegasus::Mesh::MeshData * meshData, int size)
+{
+    const int rowVertexCount = size + 1;
+    meshData->AllocateVertexes(rowVertexCount * rowVertexCount);
+    meshData->AllocateIndexes(size * size * 6);
+
+    Pegasus::Mesh::StdVertex * vertices = meshData->GetStream<Pegasus::Mesh::StdVertex>(0);
+    for (int y = 0; y < rowVertexCount; ++y)
+    {
+        for (int x = 0; x < rowVertexCount; ++x)
+        {
+            Pegasus::Mesh::StdVertex & v = vertices[y * rowVertexCount + x];
+            v.position = Pegasus::Math::Vec4((float)x, 0.0f, (float)y, 1.0f);
+            v.normal = Pegasus::Math::Vec3(0.0f, 1.0f, 0.0f);
+            v.uv = Pegasus::Math::Vec2((float)x / (float)size, (float)y / (float)size);
+        }
+    }
+
+    unsigned int * indices = meshData->GetIndexBuffer();
+    for (int y = 0; y < size; ++y)
+    {
+        for (int x = 0; x < size; ++x)
+        {
+            const unsigned int a = y * rowVertexCount + x;
+            const unsigned int c = a + rowVertexCount;
+            *indices++ = a;
+            *indices++ = c;
+            *indices++ = c + 1;
+            *indices++ = c + 1;
+            *indices++ = a + 1;
+            *indices++ = a;
+        }
+    }
+}
+
+//! Checks the indices of a grid built by BuildGrid()
+static bool CheckGrid(const Pegasus::Mesh::MeshData * meshData, int size)
+{
+    const int rowVertexCount = size + 1;
+    bool match = meshData->GetIndexCount() == size * size * 6;
+    for (int q = 0; match && q < size * size; ++q)
+    {
+        const unsigned int a = (q / size) * rowVertexCount + (q % size);
+        match = meshData->GetIndex(q * 6) == a && meshData->GetIndex(q * 6 + 2) == a + rowVertexCount + 1;
+    }
+    return match;
+}
+
+bool UNIT_TEST_MeshData1()
+{
+    // A small mesh is narrowed to 16-bit indices, then widened again when more indices are pushed
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), 16);
+    bool match = meshData->GetIndexStride() == sizeof(unsigned int);
+    meshData->FinalizeIndexFormat();
+    match = match && meshData->GetIndexStride() == sizeof(unsigned short) && CheckGrid(&(*meshData), 16);
+
+    meshData->PushIndex(70000);
+    match = match && meshData->GetIndexStride() == sizeof(unsigned int) && meshData->GetIndex(16 * 16 * 6) == 70000;
+    match = match && meshData->GetIndexBuffer()[16 * 16 * 6 - 1] == meshData->GetIndex(16 * 16 * 6 - 1);
+
+    // Forced 32-bit indices are kept
+    Pegasus::Mesh::MeshDataRef meshData32 = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_32);
+    BuildGrid(&(*meshData32), 16);
+    meshData32->FinalizeIndexFormat();
+    match = match && meshData32->GetIndexStride() == sizeof(unsigned int) && CheckGrid(&(*meshData32), 16);
+    return match;
+}
+
+bool UNIT_TEST_MeshData2()
+{
+    // More than one million vertices, addressed by 32-bit indices
+    const int size = 1024;
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), size);
+    meshData->FinalizeIndexFormat();
+
+    bool match = meshData->GetVertexCount() == (size + 1) * (size + 1) && meshData->GetVertexCount() > 1000000;
+    match = match && meshData->GetIndexStride() == sizeof(unsigned int) && CheckGrid(&(*meshData), size);
+
+    // The last quad addresses the last vertex
+    const int indexCount = meshData->GetIndexCount();
+    match = match && meshData->GetIndex(indexCount - 4) == (unsigned int)(meshData->GetVertexCount() - 1);
+
+    // Appending with an offset, as done by the operators combining meshes
+    unsigned int appended[6];
+    meshData->GetIndexes(appended, indexCount - 6, 6, 1000);
+    match = match && appended[2] == (unsigned int)(meshData->GetVertexCount() - 1 + 1000);
+    return match;
+}
+
+bool UNIT_TEST_MeshData3()
+{
+    // The index format survives the copies and the serialization of the node data cache
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), 8);
+    meshData->FinalizeIndexFormat();
+
+    Pegasus::Mesh::MeshDataRef copy = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    bool match = copy->CopyContent(*meshData) && copy->GetIndexStride() == sizeof(unsigned short) && CheckGrid(&(*copy), 8);
+
+    Pegasus::Utils::ByteStream stream(&sGlobalAllocator);
+    match = match && meshData->WriteContent(stream) && stream.GetSize() == (int)(6 * sizeof(int) + meshData->GetContentSize());
+
+    Pegasus::Mesh::MeshDataRef readData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*readData), 300);
+    match = match && readData->ReadContent(stream.GetBuffer(), stream.GetSize());
+    match = match && readData->GetIndexStride() == sizeof(unsigned short) && readData->GetVertexCount() == 81 && CheckGrid(&(*readData), 8);
+
+    // Truncated content is rejected
+    match = match && !readData->ReadContent(stream.GetBuffer(), stream.GetSize() - 2);
+    return match;
+}
+
+bool UNIT_TEST_MeshData4()
+{
+    // Reserved streams are not reallocated by the pushes, and the bulk pushes match the single ones
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    Pegasus::Mesh::MeshDataRef reference = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*reference), 64);
+
+    const int vertexCount = reference->GetVertexCount();
+    const int indexCount = reference->GetIndexCount();
+    meshData->ReserveVertexes(vertexCount);
+    meshData->ReserveIndexes(indexCount);
+    const void * vertexBuffer = meshData->GetStream<void>(0);
+    const void * indexBuffer = meshData->GetIndexData();
+
+    const Pegasus::Mesh::StdVertex * vertices = reference->GetStream<Pegasus::Mesh::StdVertex>(0);
+    const unsigned int * indices = reference->GetIndexBuffer();
+    bool match = meshData->PushVertex(vertices[0], 0) == 0 && meshData->GetVertexCount() == 1 && meshData->GetIndexCount() == 0;
+    match = match && meshData->PushVertexes(vertices + 1, vertexCount - 1, 0) == 1;
+    meshData->PushIndex(indices[0]);
+    meshData->PushIndexes(indices + 1, indexCount - 1, 0);
+
+    match = match && meshData->GetVertexCount() == vertexCount && meshData->GetStream<void>(0) == vertexBuffer;
+    match = match && meshData->GetIndexCount() == indexCount && meshData->GetIndexData() == indexBuffer && CheckGrid(&(*meshData), 64);
+    match = match && meshData->GetStream<Pegasus::Mesh::StdVertex>(0)[vertexCount - 1].position.x == 64.0f;
+
+    // Appending a copy of the grid with a vertex offset
+    const unsigned int offset = meshData->PushVertexes(vertices, vertexCount, 0);
+    meshData->PushIndexes(indices, indexCount, offset);
+    match = match && offset == (unsigned int)vertexCount && meshData->GetIndex(2 * indexCount - 4) == (unsigned int)(2 * vertexCount - 1);
+    return match;
+}
+
+//! Checks the vertices of a mesh against reference ones, within tolerances
+static bool CheckVertexes(const Pegasus::Mesh::MeshData * meshData, const Pegasus::Mesh::StdVertex * reference,
+                          float positionTolerance, float normalTolerance, float uvTolerance)
+{
+    bool match = true;
+    for (int v = 0; match && v < meshData->GetVertexCount(); ++v)
+    {
+        Pegasus::Mesh::StdVertex vertex;
+        meshData->GetStdVertexes(&vertex, v, 1);
+        const Pegasus::Mesh::StdVertex & expected = reference[v];
+        const float normalDot = vertex.normal.x * expected.normal.x + vertex.normal.y * expected.normal.y + vertex.normal.z * expected.normal.z;
+        match = fabsf(vertex.position.x - expected.position.x) <= positionTolerance
+             && fabsf(vertex.position.y - expected.position.y) <= positionTolerance
+             && fabsf(vertex.position.z - expected.position.z) <= positionTolerance
+             && vertex.position.w == 1.0f
+             && normalDot >= 1.0f - normalTolerance
+             && fabsf(vertex.uv.x - expected.uv.x) <= uvTolerance
+             && fabsf(vertex.uv.y - expected.uv.y) <= uvTolerance;
+    }
+    return match;
+}
+
+bool UNIT_TEST_MeshData5()
+{
+    // Grid with normals all around the sphere, packed then read back, copied and serialized
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO, Pegasus::Mesh::MeshConfiguration::VERTEX_PACKED);
+    Pegasus::Mesh::MeshDataRef reference = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), 32);
+    BuildGrid(&(*reference), 32);
+    const int vertexCount = meshData->GetVertexCount();
+    Pegasus::Mesh::StdVertex * vertices = meshData->GetStream<Pegasus::Mesh::StdVertex>(0);
+    Pegasus::Mesh::StdVertex * referenceVertices = reference->GetStream<Pegasus::Mesh::StdVertex>(0);
+    Pegasus::Utils::Random random(7);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        const float z = 2.0f * random.NextFloat() - 1.0f;
+        const float angle = 6.2831853f * random.NextFloat();
+        const float radius = sqrtf(1.0f - z * z);
+        vertices[v].position.y = 100.0f * random.NextFloat() - 50.0f;
+        vertices[v].normal = Pegasus::Math::Vec3(radius * cosf(angle), radius * sinf(angle), z);
+        vertices[v].uv.x = 4.0f * vertices[v].uv.x - 2.0f;
+        referenceVertices[v] = vertices[v];
+    }
+
+    // Standard meshes are left as is
+    reference->FinalizeVertexFormat();
+    bool match = !reference->IsPacked() && reference->GetStreamStride(0) == sizeof(Pegasus::Mesh::StdVertex);
+
+    meshData->FinalizeIndexFormat();
+    meshData->FinalizeVertexFormat();
+    match = match && meshData->IsPacked() && meshData->GetStreamStride(0) == sizeof(Pegasus::Mesh::PackedVertex) && sizeof(Pegasus::Mesh::PackedVertex) == 16;
+    match = match && meshData->GetInputLayout().GetAttributeCount() == 3 && meshData->GetInputLayout().GetAttributeDesc(1).mType == Pegasus::Core::FORMAT_RG16_SNORM;
+    match = match && meshData->GetPositionDecodeOffset().y <= -49.0f && meshData->GetPositionDecodeScale().x == 32.0f;
+
+    // Positions within half a step of 100 / 65535, normals within 0.1 degree, uvs within half a step of 1 / 1024
+    match = match && CheckVertexes(&(*meshData), referenceVertices, 0.001f, 0.000001f, 0.0005f) && CheckGrid(&(*meshData), 32);
+
+    Pegasus::Mesh::MeshDataRef copy = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO, Pegasus::Mesh::MeshConfiguration::VERTEX_PACKED);
+    match = match && copy->CopyContent(*meshData) && copy->IsPacked() && CheckVertexes(&(*copy), referenceVertices, 0.001f, 0.000001f, 0.0005f);
+
+    Pegasus::Utils::ByteStream stream(&sGlobalAllocator);
+    match = match && meshData->WriteContent(stream) && stream.GetSize() == (int)(6 * sizeof(int) + 6 * sizeof(float) + meshData->GetContentSize());
+    Pegasus::Mesh::MeshDataRef readData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO, Pegasus::Mesh::MeshConfiguration::VERTEX_PACKED);
+    BuildGrid(&(*readData), 8);
+    match = match && readData->ReadContent(stream.GetBuffer(), stream.GetSize()) && readData->IsPacked();
+    match = match && readData->GetVertexCount() == vertexCount && CheckVertexes(&(*readData), referenceVertices, 0.001f, 0.000001f, 0.0005f);
+    match = match && !readData->ReadContent(stream.GetBuffer(), stream.GetSize() - 4);
+
+    // Rebuilding the vertices goes back to the input layout
+    readData->AllocateVertexes(4);
+    match = match && !readData->IsPacked() && readData->GetStreamStride(0) == sizeof(Pegasus::Mesh::StdVertex);
+    return match;
+}
+
+bool UNIT_TEST_MeshData6()
+{
+    // Levels of detail sharing the vertices, kept by the copies and the serialization, reset by the index allocations
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), 8);
+    const int lodIndexCounts[] = { 8 * 8 * 6 - 60, 48, 12 };
+    meshData->SetLodIndexCounts(lodIndexCounts, 3);
+    meshData->FinalizeIndexFormat();
+    bool match = meshData->GetLodCount() == 3 && meshData->GetLodIndexOffset(1) == 8 * 8 * 6 - 60 && meshData->GetLodIndexCount(1) == 48
+                 && meshData->GetLodIndexOffset(2) == 8 * 8 * 6 - 12 && meshData->GetLodIndexCount(2) == 12;
+
+    Pegasus::Mesh::MeshDataRef copy = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    match = match && copy->CopyContent(*meshData) && copy->GetLodCount() == 3 && copy->GetLodIndexCount(0) == 8 * 8 * 6 - 60;
+
+    Pegasus::Utils::ByteStream stream(&sGlobalAllocator);
+    match = match && meshData->WriteContent(stream) && stream.GetSize() == (int)(8 * sizeof(int) + meshData->GetContentSize());
+    Pegasus::Mesh::MeshDataRef readData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    match = match && readData->ReadContent(stream.GetBuffer(), stream.GetSize()) && CheckGrid(&(*readData), 8);
+    match = match && readData->GetLodCount() == 3 && readData->GetLodIndexOffset(2) == 8 * 8 * 6 - 12 && readData->GetLodIndexCount(2) == 12;
+    match = match && !readData->ReadContent(stream.GetBuffer(), stream.GetSize() - 4);
+
+    meshData->AllocateIndexes(6);
+    match = match && meshData->GetLodCount() == 1 && meshData->GetLodIndexOffset(0) == 0 && meshData->GetLodIndexCount(0) == 6;
+    return match;
+}
+
+bool UNIT_TEST_MeshData7()
+{
+    // Bounds computed from the positions, kept by the copies and the serialization, reset by the vertex allocations
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), 8);
+    meshData->GetStream<Pegasus::Mesh::StdVertex>(0)[10].position.y = 3.0f;
+    bool match = !meshData->AreBoundsValid();
+    meshData->FinalizeBounds();
+    const Pegasus::Math::AxisAlignedBoundingBox & box = meshData->GetBoundingBox();
+    const Pegasus::Math::BoundingSphere & sphere = meshData->GetBoundingSphere();
+    match = match && meshData->AreBoundsValid();
+    match = match && box.GetMin().x == 0.0f && box.GetMin().y == 0.0f && box.GetMin().z == 0.0f;
+    match = match && box.GetMax().x == 8.0f && box.GetMax().y == 3.0f && box.GetMax().z == 8.0f;
+    match = match && sphere.GetCenter().x == 4.0f && sphere.GetCenter().y == 1.5f && sphere.GetCenter().z == 4.0f;
+    match = match && fabsf(sphere.GetRadius() - sqrtf(34.25f)) < 0.0001f;
+
+    Pegasus::Mesh::MeshDataRef copy = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    match = match && copy->CopyContent(*meshData) && copy->AreBoundsValid() && copy->GetBoundingBox().GetMax().y == 3.0f;
+
+    Pegasus::Utils::ByteStream stream(&sGlobalAllocator);
+    match = match && meshData->WriteContent(stream) && stream.GetSize() == (int)(6 * sizeof(int) + 10 * sizeof(float) + meshData->GetContentSize());
+    Pegasus::Mesh::MeshDataRef readData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    match = match && readData->ReadContent(stream.GetBuffer(), stream.GetSize()) && readData->AreBoundsValid();
+    match = match && readData->GetBoundingBox().GetMax().z == 8.0f && readData->GetBoundingSphere().GetRadius() == sphere.GetRadius();
+
+    // Culling against the clip space, the box crossing the clip space then moved away from it along x
+    Pegasus::Math::Mat44 clipMatrix = Pegasus::Math::MAT44_IDENTITY;
+    match = match && !box.IsOutsideClipSpace(clipMatrix);
+    clipMatrix.m14 = 1.5f;
+    match = match && box.IsOutsideClipSpace(clipMatrix);
+
+    // Bounds transformed analytically by a rotation of 90 degrees around y, a scale of 2 and a translation
+    Pegasus::Math::Mat44 transform = Pegasus::Math::MAT44_IDENTITY;
+    transform.m11 = 0.0f;   transform.m13 = 2.0f;   transform.m14 = 1.0f;
+    transform.m22 = 2.0f;
+    transform.m31 = -2.0f;  transform.m33 = 0.0f;
+    Pegasus::Math::AxisAlignedBoundingBox transformedBox(box);
+    Pegasus::Math::BoundingSphere transformedSphere(sphere);
+    transformedBox.Transform(transform);
+    transformedSphere.Transform(transform);
+    match = match && transformedBox.GetMin().x == 1.0f && transformedBox.GetMax().x == 17.0f && transformedBox.GetMax().y == 6.0f;
+    match = match && transformedBox.GetMin().z == -16.0f && transformedBox.GetMax().z == 0.0f;
+    match = match && transformedSphere.GetCenter().x == 9.0f && transformedSphere.GetCenter().z == -8.0f;
+    match = match && transformedSphere.GetRadius() == 2.0f * sphere.GetRadius();
+    transformedSphere.Union(sphere);
+    match = match && transformedSphere.GetRadius() > 2.0f * sphere.GetRadius();
+
+    meshData->SetBounds(transformedBox, transformedSphere);
+    match = match && meshData->AreBoundsValid() && meshData->GetBoundingBox().GetMax().x == 17.0f;
+    meshData->FinalizeBounds();
+    match = match && meshData->GetBoundingBox().GetMax().x == 17.0f;
+    meshData->AllocateVertexes(0);
+    match = match && !meshData->AreBoundsValid();
+    meshData->FinalizeBounds();
+    match = match && meshData->GetBoundingBox().HasZeroSize() && meshData->GetBoundingSphere().GetRadius() == 0.0f;
+
+    // No bounds without positions
+    Pegasus::Mesh::MeshDataRef noPositionData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO, Pegasus::Mesh::MeshConfiguration::VERTEX_STANDARD,
+                                                               Pegasus::Mesh::MeshInputLayout::USE_UV | Pegasus::Mesh::MeshInputLayout::USE_NORMAL);
+    noPositionData->AllocateVertexes(4);
+    noPositionData->FinalizeBounds();
+    match = match && !noPositionData->AreBoundsValid();
+    return match;
+}
+
+bool UNIT_TEST_MeshData8()
+{
+    // Restored from the memory of the node data cache into a mesh of another size
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*meshData), 8);
+    meshData->FinalizeIndexFormat();
+    Pegasus::Mesh::MeshDataRef copy = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    bool match = copy->CopyContent(*meshData);
+
+    Pegasus::Graph::NodeDataCache cache(&sGlobalAllocator);
+    cache.Insert(1, &(*copy), copy->GetContentSize());
+    Pegasus::Mesh::MeshDataRef cachedData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_AUTO);
+    BuildGrid(&(*cachedData), 20);
+    match = match && cache.Find(1, *cachedData) == Pegasus::Graph::NodeDataCache::FIND_MEMORY_HIT;
+    match = match && cachedData->GetVertexCount() == 81 && cachedData->GetIndexStride() == sizeof(unsigned short) && CheckGrid(&(*cachedData), 8);
+    match = match && cache.GetMemorySize() == meshData->GetContentSize();
+    return match;
+}
+
+bool UNIT_TEST_MeshOptimizer1()
+{
+    // Grid whose triangles are shuffled, then reordered for the vertex cache and the vertex fetches
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_32);
+    BuildGrid(&(*meshData), 24);
+    const int vertexCount = meshData->GetVertexCount();
+    const int indexCount = meshData->GetIndexCount();
+    const int triangleCount = indexCount / 3;
+
+    unsigned int * indices = meshData->GetIndexBuffer();
+    Pegasus::Utils::Random random(42);
+    for (int t = triangleCount - 1; t > 0; --t)
+    {
+        const int other = static_cast<int>(random.NextUInt32(static_cast<unsigned int>(t + 1)));
+        for (int c = 0; c < 3; ++c)
+        {
+            const unsigned int index = indices[t * 3 + c];
+            indices[t * 3 + c] = indices[other * 3 + c];
+            indices[other * 3 + c] = index;
+        }
+    }
+
+    unsigned int * optimized = PG_NEW_ARRAY(&sGlobalAllocator, -1, "optimized", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    unsigned int * remap = PG_NEW_ARRAY(&sGlobalAllocator, -1, "remap", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, vertexCount + 1);
+    const float inputACMR = Pegasus::Mesh::ComputeACMR(indices, indexCount, vertexCount, 16, &sGlobalAllocator);
+    Pegasus::Mesh::OptimizeVertexCache(optimized, indices, indexCount, vertexCount, 32, &sGlobalAllocator);
+    const float outputACMR = Pegasus::Mesh::ComputeACMR(optimized, indexCount, vertexCount, 16, &sGlobalAllocator);
+    bool match = inputACMR > 2.0f && outputACMR < 0.8f;
+
+    // Every input triangle is emitted once, with the same corner order
+    for (int t = 0; match && t < triangleCount; ++t)
+    {
+        int found = 0;
+        for (int o = 0; o < triangleCount; ++o)
+        {
+            found += optimized[o * 3] == indices[t * 3] && optimized[o * 3 + 1] == indices[t * 3 + 1] && optimized[o * 3 + 2] == indices[t * 3 + 2];
+        }
+        match = found == 1;
+    }
+
+    // The vertices are numbered in their order of first use, the unused one goes last
+    for (int i = 0; i < indexCount; ++i)
+    {
+        indices[i] = optimized[i];
+    }
+    const int usedVertexCount = Pegasus::Mesh::OptimizeVertexFetch(remap, optimized, indexCount, vertexCount + 1);
+    match = match && usedVertexCount == vertexCount && remap[vertexCount] == (unsigned int)vertexCount;
+    unsigned int nextVertex = 0;
+    for (int i = 0; match && i < indexCount; ++i)
+    {
+        match = optimized[i] == remap[indices[i]] && optimized[i] <= nextVertex;
+        nextVertex += optimized[i] == nextVertex;
+    }
+    match = match && Pegasus::Mesh::ComputeACMR(optimized, indexCount, vertexCount, 16, &sGlobalAllocator) == outputACMR;
+
+    PG_DELETE_ARRAY(&sGlobalAllocator, remap);
+    PG_DELETE_ARRAY(&sGlobalAllocator, optimized);
+    return match;
+}
+
+bool UNIT_TEST_MeshOptimizer2()
+{
+    // Grid of quads with 4 vertices each, slightly jittered, a quad in the middle having another normal
+    const int size = 16;
+    const int vertexCount = size * size * 4;
+    Pegasus::Mesh::StdVertex * vertices = PG_NEW_ARRAY(&sGlobalAllocator, -1, "vertices", Pegasus::Alloc::PG_MEM_TEMP, Pegasus::Mesh::StdVertex, vertexCount);
+    unsigned int * remap = PG_NEW_ARRAY(&sGlobalAllocator, -1, "remap", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, vertexCount);
+    for (int q = 0; q < size * size; ++q)
+    {
+        for (int c = 0; c < 4; ++c)
+        {
+            const float jitter = static_cast<float>((q * 4 + c) % 7) * 0.000001f;
+            const int x = (q % size) + (c & 1);
+            const int y = (q / size) + (c >> 1);
+            Pegasus::Mesh::StdVertex & v = vertices[q * 4 + c];
+            v.position = Pegasus::Math::Vec4((float)x + jitter, 0.0f, (float)y - jitter, 1.0f);
+            v.normal = Pegasus::Math::Vec3(0.0f, q == size * size / 2 + size / 2 ? -1.0f : 1.0f, 0.0f);
+            v.uv = Pegasus::Math::Vec2((float)x / (float)size, (float)y / (float)size);
+        }
+    }
+
+    const int weldedCount = Pegasus::Mesh::WeldVertexes(remap, vertices, vertexCount, 0.0001f, 0.001f, 0.0001f, &sGlobalAllocator);
+    bool match = weldedCount == (size + 1) * (size + 1) + 4 && remap[0] == 0 && remap[vertexCount - 1] == (unsigned int)(weldedCount - 1);
+
+    // The welded vertices are numbered in the order of their first vertex, and only equal vertices are welded
+    unsigned int * firstVertices = PG_NEW_ARRAY(&sGlobalAllocator, -1, "firstVertices", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, weldedCount);
+    int nextVertex = 0;
+    for (int v = 0; match && v < vertexCount; ++v)
+    {
+        match = remap[v] <= (unsigned int)nextVertex;
+        if (match && remap[v] == (unsigned int)nextVertex)
+        {
+            firstVertices[nextVertex++] = v;
+        }
+        const Pegasus::Mesh::StdVertex & first = vertices[firstVertices[remap[v]]];
+        match = match && first.normal.y == vertices[v].normal.y
+                      && first.position.x - vertices[v].position.x < 0.0001f && vertices[v].position.x - first.position.x < 0.0001f
+                      && first.position.z - vertices[v].position.z < 0.0001f && vertices[v].position.z - first.position.z < 0.0001f;
+    }
+    match = match && nextVertex == weldedCount;
+
+    PG_DELETE_ARRAY(&sGlobalAllocator, firstVertices);
+    PG_DELETE_ARRAY(&sGlobalAllocator, remap);
+    PG_DELETE_ARRAY(&sGlobalAllocator, vertices);
+    return match;
+}
+
+bool UNIT_TEST_MeshOptimizer3()
+{
+    // Flat grid simplified without error, its border and its area being kept
+    const int size = 32;
+    Pegasus::Mesh::MeshDataRef meshData = CreateMeshData(Pegasus::Mesh::MeshConfiguration::INDEX_32);
+    BuildGrid(&(*meshData), size);
+    const int vertexCount = meshData->GetVertexCount();
+    const int indexCount = meshData->GetIndexCount();
+    const Pegasus::Mesh::StdVertex * vertices = meshData->GetStream<Pegasus::Mesh::StdVertex>(0);
+
+    unsigned int * simplified = PG_NEW_ARRAY(&sGlobalAllocator, -1, "simplified", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, indexCount);
+    float error = 1.0f;
+    const int targetIndexCount = indexCount / 4;
+    const int simplifiedCount = Pegasus::Mesh::SimplifyMesh(simplified, meshData->GetIndexBuffer(), indexCount, vertices, vertexCount,
+                                                            targetIndexCount, 0.01f, 0.5f, 0.5f, &error, &sGlobalAllocator);
+    bool match = simplifiedCount <= targetIndexCount && simplifiedCount > 0 && simplifiedCount % 3 == 0 && error < 0.001f;
+
+    // The triangles keep their orientation and cover the grid, the border vertices being used
+    float area = 0.0f;
+    bool * usedVertices = PG_NEW_ARRAY(&sGlobalAllocator, -1, "usedVertices", Pegasus::Alloc::PG_MEM_TEMP, bool, vertexCount);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        usedVertices[v] = false;
+    }
+    for (int i = 0; match && i < simplifiedCount; i += 3)
+    {
+        const Pegasus::Math::Vec4 & a = vertices[simplified[i]].position;
+        const Pegasus::Math::Vec4 & b = vertices[simplified[i + 1]].position;
+        const Pegasus::Math::Vec4 & c = vertices[simplified[i + 2]].position;
+        const float normalY = (b.z - a.z) * (c.x - a.x) - (b.x - a.x) * (c.z - a.z);
+        match = normalY > 0.0f;
+        area += 0.5f * normalY;
+        usedVertices[simplified[i]] = usedVertices[simplified[i + 1]] = usedVertices[simplified[i + 2]] = true;
+    }
+    match = match && fabsf(area - (float)(size * size)) < 0.01f;
+    for (int x = 0; match && x <= size; ++x)
+    {
+        match = usedVertices[x] && usedVertices[size * (size + 1) + x] && usedVertices[x * (size + 1)] && usedVertices[x * (size + 1) + size];
+    }
+
+    // A tight error bound stops the simplification of a curved grid before the target
+    Pegasus::Mesh::StdVertex * curvedVertices = meshData->GetStream<Pegasus::Mesh::StdVertex>(0);
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        curvedVertices[v].position.y = sinf(curvedVertices[v].position.x * 0.4f) * cosf(curvedVertices[v].position.z * 0.3f) * 2.0f;
+    }
+    const int curvedCount = Pegasus::Mesh::SimplifyMesh(simplified, meshData->GetIndexBuffer(), indexCount, vertices, vertexCount,
+                                                        targetIndexCount, 0.002f, 0.5f, 0.5f, &error, &sGlobalAllocator);
+    match = match && curvedCount > targetIndexCount && curvedCount < indexCount && error <= 0.002f;
+
+    PG_DELETE_ARRAY(&sGlobalAllocator, usedVertices);
+    PG_DELETE_ARRAY(&sGlobalAllocator, simplified);
+    return match;
+}
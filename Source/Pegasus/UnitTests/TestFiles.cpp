@@ -0,0 +1,49 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TestFiles.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Location of the files written by the unit tests, implementation
+
+#include "Pegasus/UnitTests/TestFiles.h"
+#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
+
+#if PEGASUS_PLATFORM_WINDOWS
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#else
+#include <stdlib.h>
+#endif
+
+static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
+
+void GetTestFileDirectory(char * path)
+{
+#if PEGASUS_PLATFORM_WINDOWS
+    // Already ends with a backslash
+    if (GetTempPathA(Pegasus::Io::IOManager::MAX_FILEPATH_LENGTH, path) == 0)
+    {
+        path[0] = '\0';
+    }
+#else
+    const char * tempDirectory = getenv("TMPDIR");
+    path[0] = '\0';
+    Pegasus::Utils::Strcat(path, (tempDirectory != nullptr) ? tempDirectory : "/tmp");
+    Pegasus::Utils::Strcat(path, "/");
+#endif
+}
+
+bool WriteTestFile(Pegasus::Io::IOManager * ioManager, const char * relativePath, const void * content, unsigned int size)
+{
+    char * buffer = PG_NEW_ARRAY(&sGlobalAllocator, -1, "test file", Pegasus::Alloc::PG_MEM_TEMP, char, size);
+    Pegasus::Utils::Memcpy(buffer, content, size);
+    Pegasus::Io::FileBuffer fileBuffer;
+    fileBuffer.OwnBuffer(&sGlobalAllocator, buffer, static_cast<int>(size));
+    return ioManager->SaveFileToBuffer(relativePath, fileBuffer) == Pegasus::Io::ERR_NONE;
+}
@@ -0,0 +1,325 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureTests.cpp
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Texture package, implementation
+
+#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/UnitTests/TextureTests.h"
+#include "Pegasus/Texture/TextureKernels.h"
+#include "Pegasus/Texture/Generator/PixelsGenerator.h"
+#include "Pegasus/Texture/Generator/PerlinNoiseGenerator.h"
+#include "Pegasus/Texture/Generator/SimplexNoiseGenerator.h"
+#include "Pegasus/Texture/Generator/WorleyNoiseGenerator.h"
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Graph/NodeDataCache.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Hash.h"
+
+static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
+
+//! Number of times the golden pairs are repeated, so the SSE2 blocks of 16 bytes and the scalar tail are both checked
+static const unsigned int GOLDEN_REPEAT_COUNT = 5;
+
+//! Number of golden values of each operation
+static const unsigned int GOLDEN_VALUE_COUNT = 8;
+
+//! Current values a, new values b and interpolation factors of the golden values
+static const unsigned char sGoldenA[GOLDEN_VALUE_COUNT]    = { 0, 255, 128, 200,  17, 255,   1, 100 };
+static const unsigned char sGoldenB[GOLDEN_VALUE_COUNT]    = { 0, 255,  64, 100, 250,   1, 255, 200 };
+static const unsigned char sGoldenMask[GOLDEN_VALUE_COUNT] = { 0, 255, 128,  64, 200,   1, 254, 100 };
+
+//! Expected results of BlendBytes() for each blend mode, in the order of the BlendMode enum
+static const unsigned char sGoldenBlend[Pegasus::Texture::NUM_BLEND_MODES][GOLDEN_VALUE_COUNT] =
+{
+    {   0, 254, 192,  44,  11,   0,   0,  44 },     // BLEND_ADD
+    {   0, 255, 192, 255, 255, 255, 255, 255 },     // BLEND_ADD_SATURATE
+    {   0,   0,  64, 100,   0, 254,   0,   0 },     // BLEND_SUBTRACT
+    {   0, 255,  32,  78,  17,   1,   1,  78 },     // BLEND_MULTIPLY
+    {   0, 255, 160, 222, 250, 255, 255, 222 },     // BLEND_SCREEN
+    {   0, 255,  64, 100,  17,   1,   1, 100 },     // BLEND_MIN
+    {   0, 255, 128, 200, 250, 255, 255, 200 }      // BLEND_MAX
+};
+
+//! Expected results of LerpBytes()
+static const unsigned char sGoldenLerp[GOLDEN_VALUE_COUNT] = { 0, 255, 96, 175, 200, 254, 254, 139 };
+
+//! FNV-1a hashes of the golden images of BlendTextures() with 3 inputs, for each blend mode
+static const unsigned int sGoldenBlendImageHashes[Pegasus::Texture::NUM_BLEND_MODES] =
+{
+    0xf04245c5u,    // BLEND_ADD
+    0x2b1cd8e5u,    // BLEND_ADD_SATURATE
+    0x6bc16c3du,    // BLEND_SUBTRACT
+    0xa16782d5u,    // BLEND_MULTIPLY
+    0xc9d0f6f5u,    // BLEND_SCREEN
+    0x0577e9c5u,    // BLEND_MIN
+    0xa98df3d5u     // BLEND_MAX
+};
+
+//! FNV-1a hash of the golden image of LerpTextures()
+static const unsigned int sGoldenLerpImageHash = 0xec8c1c05u;
+
+//! Size of the golden images, in RGBA8 pixels
+static const unsigned int GOLDEN_IMAGE_WIDTH = 32;
+static const unsigned int GOLDEN_IMAGE_HEIGHT = 8;
+
+//! Fills a buffer with the golden pairs repeated GOLDEN_REPEAT_COUNT times
+static void FillGoldenBytes(unsigned char * destination, const unsigned char * values)
+{
+    for (unsigned int b = 0; b < GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT; ++b)
+    {
+        destination[b] = values[b % GOLDEN_VALUE_COUNT];
+    }
+}
+
+//! Checks a buffer against golden values repeated GOLDEN_REPEAT_COUNT times
+static bool CheckGoldenBytes(const unsigned char * bytes, const unsigned char * values)
+{
+    for (unsigned int b = 0; b < GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT; ++b)
+    {
+        if (bytes[b] != values[b % GOLDEN_VALUE_COUNT]) return false;
+    }
+    return true;
+}
+
+//! Creates a golden image input, byte i being (i * multiplier + offset) modulo 256
+static Pegasus::Texture::TextureDataReturn CreateGoldenImage(unsigned int multiplier, unsigned int offset)
+{
+    Pegasus::Texture::TextureConfiguration configuration(Pegasus::Texture::TextureConfiguration::TYPE_2D,
+                                                         Pegasus::Core::FORMAT_RGBA_8_UNORM,
+                                                         GOLDEN_IMAGE_WIDTH, GOLDEN_IMAGE_HEIGHT, 1, 1);
+    Pegasus::Texture::TextureDataRef textureData = PG_NEW(&sGlobalAllocator, -1, "TextureData", Pegasus::Alloc::PG_MEM_TEMP)
+                                                       Pegasus::Texture::TextureData(configuration, &sGlobalAllocator);
+    unsigned char * image = textureData->GetLayerImageData(0);
+    for (unsigned int b = 0; b < configuration.GetNumBytes(); ++b)
+    {
+        image[b] = static_cast<unsigned char>((b * multiplier + offset) & 0xFF);
+    }
+    return textureData;
+}
+
+//! Hashes the pixels of a golden image
+static unsigned int HashImage(const Pegasus::Texture::TextureData * textureData)
+{
+    return Pegasus::Utils::HashFnv1a(textureData->GetLayerImageData(0), textureData->GetConfiguration().GetNumBytes());
+}
+
+bool UNIT_TEST_TextureKernels1()
+{
+    // Golden values of every blend mode, through the SSE2 and scalar paths
+    unsigned char source[GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT];
+    unsigned char destination[GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT];
+    FillGoldenBytes(source, sGoldenB);
+    bool match = true;
+    for (int mode = 0; mode < Pegasus::Texture::NUM_BLEND_MODES; ++mode)
+    {
+        FillGoldenBytes(destination, sGoldenA);
+        Pegasus::Texture::BlendBytes(destination, source, GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT, static_cast<Pegasus::Texture::BlendMode>(mode));
+        match = match && CheckGoldenBytes(destination, sGoldenBlend[mode]);
+    }
+    return match;
+}
+
+bool UNIT_TEST_TextureKernels2()
+{
+    // Golden values of the interpolation by a mask, 0 keeping a and 255 giving b
+    unsigned char source[GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT];
+    unsigned char mask[GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT];
+    unsigned char destination[GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT];
+    FillGoldenBytes(source, sGoldenB);
+    FillGoldenBytes(mask, sGoldenMask);
+    FillGoldenBytes(destination, sGoldenA);
+    Pegasus::Texture::LerpBytes(destination, source, mask, GOLDEN_VALUE_COUNT * GOLDEN_REPEAT_COUNT);
+    return CheckGoldenBytes(destination, sGoldenLerp);
+}
+
+bool UNIT_TEST_TextureKernels3()
+{
+    // Golden images of the blend of 3 textures, ((input0 op input1) op input2), for every blend mode
+    Pegasus::Texture::TextureDataRef input0 = CreateGoldenImage(7, 0);
+    Pegasus::Texture::TextureDataRef input1 = CreateGoldenImage(13, 5);
+    Pegasus::Texture::TextureDataRef input2 = CreateGoldenImage(29, 101);
+    Pegasus::Texture::TextureDataRef output = CreateGoldenImage(0, 0);
+    const Pegasus::Texture::TextureData * inputs[] = { &(*input0), &(*input1), &(*input2) };
+    bool match = true;
+    for (int mode = 0; mode < Pegasus::Texture::NUM_BLEND_MODES; ++mode)
+    {
+        Pegasus::Texture::BlendTextures(&(*output), inputs, 3, static_cast<Pegasus::Texture::BlendMode>(mode));
+        match = match && HashImage(&(*output)) == sGoldenBlendImageHashes[mode];
+    }
+
+    // The output can be the first input, the operators blending in place
+    Pegasus::Texture::TextureDataRef inPlace = CreateGoldenImage(7, 0);
+    inputs[0] = &(*inPlace);
+    Pegasus::Texture::BlendTextures(&(*inPlace), inputs, 3, Pegasus::Texture::BLEND_SCREEN);
+    match = match && HashImage(&(*inPlace)) == sGoldenBlendImageHashes[Pegasus::Texture::BLEND_SCREEN];
+    return match;
+}
+
+bool UNIT_TEST_TextureKernels4()
+{
+    // Golden image of the interpolation of 2 textures by a mask texture, in a new texture and in place
+    Pegasus::Texture::TextureDataRef input0 = CreateGoldenImage(7, 0);
+    Pegasus::Texture::TextureDataRef input1 = CreateGoldenImage(13, 5);
+    Pegasus::Texture::TextureDataRef mask = CreateGoldenImage(29, 101);
+    Pegasus::Texture::TextureDataRef output = CreateGoldenImage(0, 0);
+    Pegasus::Texture::LerpTextures(&(*output), &(*input0), &(*input1), &(*mask));
+    bool match = HashImage(&(*output)) == sGoldenLerpImageHash;
+    Pegasus::Texture::LerpTextures(&(*input0), &(*input0), &(*input1), &(*mask));
+    match = match && HashImage(&(*input0)) == sGoldenLerpImageHash;
+    return match;
+}
+
+//! Number of layers of the texture arrays of the node data cache tests
+static const unsigned int CACHED_TEXTURE_NUM_LAYERS = 3;
+
+//! Creates a texture array whose byte i of layer l is (i * multiplier + l) modulo 256
+static Pegasus::Texture::TextureDataReturn CreateCachedTexture(unsigned int multiplier)
+{
+    Pegasus::Texture::TextureConfiguration configuration(Pegasus::Texture::TextureConfiguration::TYPE_2D_ARRAY,
+                                                         Pegasus::Core::FORMAT_RGBA_8_UNORM,
+                                                         GOLDEN_IMAGE_WIDTH, GOLDEN_IMAGE_HEIGHT, 1, CACHED_TEXTURE_NUM_LAYERS);
+    Pegasus::Texture::TextureDataRef textureData = PG_NEW(&sGlobalAllocator, -1, "TextureData", Pegasus::Alloc::PG_MEM_TEMP)
+                                                       Pegasus::Texture::TextureData(configuration, &sGlobalAllocator);
+    for (unsigned int layer = 0; layer < CACHED_TEXTURE_NUM_LAYERS; ++layer)
+    {
+        unsigned char * image = textureData->GetLayerImageData(layer);
+        for (unsigned int b = 0; b < configuration.GetNumBytesPerLayer(); ++b)
+        {
+            image[b] = static_cast<unsigned char>((b * multiplier + layer) & 0xFF);
+        }
+    }
+    return textureData;
+}
+
+//! Checks the layers of a texture array against the content given by CreateCachedTexture()
+static bool CheckCachedTexture(const Pegasus::Texture::TextureData * textureData, unsigned int multiplier)
+{
+    bool match = true;
+    for (unsigned int layer = 0; layer < CACHED_TEXTURE_NUM_LAYERS; ++layer)
+    {
+        const unsigned char * image = textureData->GetLayerImageData(layer);
+        for (unsigned int b = 0; b < textureData->GetConfiguration().GetNumBytesPerLayer(); ++b)
+        {
+            match = match && image[b] == static_cast<unsigned char>((b * multiplier + layer) & 0xFF);
+        }
+    }
+    return match;
+}
+
+bool UNIT_TEST_TextureData1()
+{
+    // All the layers kept by the copies and the serialization of the node data cache
+    Pegasus::Texture::TextureDataRef textureData = CreateCachedTexture(7);
+    bool match = textureData->GetContentSize() == CACHED_TEXTURE_NUM_LAYERS * GOLDEN_IMAGE_WIDTH * GOLDEN_IMAGE_HEIGHT * 4;
+
+    Pegasus::Texture::TextureDataRef copy = CreateCachedTexture(0);
+    match = match && copy->CopyContent(*textureData) && CheckCachedTexture(&(*copy), 7);
+
+    Pegasus::Utils::ByteStream stream(&sGlobalAllocator);
+    match = match && textureData->WriteContent(stream) && stream.GetSize() == (int)textureData->GetContentSize();
+    Pegasus::Texture::TextureDataRef readData = CreateCachedTexture(0);
+    match = match && readData->ReadContent(stream.GetBuffer(), stream.GetSize()) && CheckCachedTexture(&(*readData), 7);
+
+    // Truncated content is rejected
+    match = match && !readData->ReadContent(stream.GetBuffer(), stream.GetSize() - 1);
+
+    // Restored from the memory of the cache into data with a different content
+    Pegasus::Graph::NodeDataCache cache(&sGlobalAllocator);
+    cache.Insert(1, &(*copy), copy->GetContentSize());
+    Pegasus::Texture::TextureDataRef cachedData = CreateCachedTexture(13);
+    match = match && cache.Find(1, *cachedData) == Pegasus::Graph::NodeDataCache::FIND_MEMORY_HIT
+                  && CheckCachedTexture(&(*cachedData), 7)
+                  && cache.GetMemorySize() == textureData->GetContentSize();
+    return match;
+}
+
+//! Configuration of the textures of the generator tests, 2 layers to cover the per-layer streams
+static const Pegasus::Texture::TextureConfiguration sGeneratorConfiguration(Pegasus::Texture::TextureConfiguration::TYPE_2D_ARRAY,
+                                                                            Pegasus::Core::FORMAT_RGBA_8_UNORM,
+                                                                            256, 256, 1, 2);
+
+//! Golden hash of the pixels generator, 65536 pixels per layer with the seed 987654321
+static const unsigned int sGoldenPixelsHash = 0x31a4520cu;
+
+//! Generates the data of a texture generator and hashes all its layers
+static unsigned int HashGeneratedTexture(Pegasus::Texture::TextureGenerator * generator)
+{
+    bool updated = false;
+    Pegasus::Graph::NodeDataRef dataRef = generator->GetUpdatedData(updated);
+    const Pegasus::Texture::TextureData * textureData = static_cast<const Pegasus::Texture::TextureData *>(&(*dataRef));
+    unsigned int hash = Pegasus::Utils::FNV1A_OFFSET_BASIS;
+    for (unsigned int layer = 0; layer < sGeneratorConfiguration.GetNumLayers(); ++layer)
+    {
+        hash = Pegasus::Utils::HashFnv1a(textureData->GetLayerImageData(layer), sGeneratorConfiguration.GetNumBytesPerLayer(), hash);
+    }
+    return hash;
+}
+
+//! Renders the golden texture of the pixels generator
+static unsigned int HashPixelsGenerator()
+{
+    Pegasus::Texture::PixelsGenerator * generator = PG_NEW(&sGlobalAllocator, -1, "PixelsGenerator", Pegasus::Alloc::PG_MEM_TEMP)
+                                                         Pegasus::Texture::PixelsGenerator(sGeneratorConfiguration, &sGlobalAllocator, &sGlobalAllocator);
+    Pegasus::Texture::TextureGeneratorRef generatorRef = generator;
+    generator->SetNumPixels(65536);
+    generator->SetSeed(987654321);
+    return HashGeneratedTexture(generator);
+}
+
+bool UNIT_TEST_PixelsGenerator1()
+{
+    // 16 streams of random pixels per layer, giving the same image on the calling thread and through the worker pool
+    bool match = HashPixelsGenerator() == sGoldenPixelsHash;
+
+    Pegasus::Core::WorkerPool::CreateInstance(&sGlobalAllocator);
+    match = match && HashPixelsGenerator() == sGoldenPixelsHash;
+    Pegasus::Core::WorkerPool::DestroyInstance();
+    return match;
+}
+
+//! Number of octaves of the golden textures of the noise generators
+static const unsigned int GOLDEN_NOISE_OCTAVE_COUNT = 2;
+static const unsigned int sGoldenNoiseOctaves[GOLDEN_NOISE_OCTAVE_COUNT] = { 1, 4 };
+
+//! Golden hashes of the noise generators with the seed 42, for each number of octaves
+static const unsigned int sGoldenPerlinHashes[GOLDEN_NOISE_OCTAVE_COUNT]  = { 0xadb03c0bu, 0x36615ed0u };
+static const unsigned int sGoldenSimplexHashes[GOLDEN_NOISE_OCTAVE_COUNT] = { 0x9555ef0cu, 0x93a61f9fu };
+static const unsigned int sGoldenWorleyHashes[GOLDEN_NOISE_OCTAVE_COUNT]  = { 0x9e530b63u, 0xf928ee6fu };
+
+//! Renders the golden textures of a noise generator and compares them to their hashes
+template <class NoiseGenerator>
+static bool CheckNoiseGenerator(const unsigned int * goldenHashes)
+{
+    bool match = true;
+    for (unsigned int o = 0; o < GOLDEN_NOISE_OCTAVE_COUNT; ++o)
+    {
+        NoiseGenerator * generator = PG_NEW(&sGlobalAllocator, -1, NoiseGenerator::GetClassName(), Pegasus::Alloc::PG_MEM_TEMP)
+                                         NoiseGenerator(sGeneratorConfiguration, &sGlobalAllocator, &sGlobalAllocator);
+        Pegasus::Texture::TextureGeneratorRef generatorRef = generator;
+        generator->SetSeed(42);
+        generator->SetNumOctaves(sGoldenNoiseOctaves[o]);
+        match = match && HashGeneratedTexture(generator) == goldenHashes[o];
+    }
+    return match;
+}
+
+bool UNIT_TEST_PerlinNoiseGenerator1()
+{
+    return CheckNoiseGenerator<Pegasus::Texture::PerlinNoiseGenerator>(sGoldenPerlinHashes);
+}
+
+bool UNIT_TEST_SimplexNoiseGenerator1()
+{
+    return CheckNoiseGenerator<Pegasus::Texture::SimplexNoiseGenerator>(sGoldenSimplexHashes);
+}
+
+bool UNIT_TEST_WorleyNoiseGenerator1()
+{
+    return CheckNoiseGenerator<Pegasus::Texture::WorleyNoiseGenerator>(sGoldenWorleyHashes);
+}
@@ -17,6 +17,9 @@
 #include "Pegasus/Utils/TesselationTable.h"
 #include "Pegasus/Utils/Vector.h"
 #include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Hash.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/Random.h"
 
 static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
 
@@ -445,6 +448,137 @@ bool UNIT_TEST_Vector2()
     return true;
 }
 
+//! Helper type for the vector tests. Tracks live instances and keeps a pointer to itself,
+//! so a bitwise relocation (instead of a move construction) is detected.
+struct VectorTracked
+{
+    static int sLiveCount;
+    VectorTracked() : mValue(0), mSelf(this) { ++sLiveCount; }
+    explicit VectorTracked(int value) : mValue(value), mSelf(this) { ++sLiveCount; }
+    VectorTracked(const VectorTracked& other) : mValue(other.mValue), mSelf(this) { ++sLiveCount; }
+    VectorTracked(VectorTracked&& other) : mValue(other.mValue), mSelf(this) { other.mValue = -1; ++sLiveCount; }
+    ~VectorTracked() { --sLiveCount; }
+    VectorTracked& operator=(const VectorTracked& other) { mValue = other.mValue; return *this; }
+    bool IsValid() const { return mSelf == this; }
+    int mValue;
+    VectorTracked* mSelf;
+};
+
+int VectorTracked::sLiveCount = 0;
+
+bool UNIT_TEST_Vector3()
+{
+    Pegasus::Utils::Vector<int> v(&sGlobalAllocator);
+    v.Reserve(1000);
+    const int* data = v.Data();
+    if (v.GetCapacity() < 1000) return false;
+    for (int i = 0; i < 1000; ++i) v.PushBack(i);
+
+    // No reallocation must have happened after the reservation
+    if (v.Data() != data) return false;
+    for (unsigned int i = 0; i < v.GetSize(); ++i)
+    {
+        if (v[i] != static_cast<int>(i)) return false;
+    }
+    return true;
+}
+
+bool UNIT_TEST_Vector4()
+{
+    VectorTracked::sLiveCount = 0;
+    {
+        Pegasus::Utils::Vector<VectorTracked> v(&sGlobalAllocator);
+        for (int i = 0; i < 500; ++i)
+        {
+            v.EmplaceBack(i);
+        }
+        if (VectorTracked::sLiveCount != 500) return false;
+        for (unsigned int i = 0; i < v.GetSize(); ++i)
+        {
+            if (!v[i].IsValid() || v[i].mValue != static_cast<int>(i)) return false;
+        }
+
+        v.Delete(0);
+        VectorTracked last = v.Pop();
+        if (last.mValue != 499 || v.GetSize() != 498 || VectorTracked::sLiveCount != 499) return false;
+        if (v[0].mValue != 1 || !v[0].IsValid()) return false;
+    }
+    return VectorTracked::sLiveCount == 0;
+}
+
+bool UNIT_TEST_Vector5()
+{
+    VectorTracked::sLiveCount = 0;
+    {
+        Pegasus::Utils::Vector<VectorTracked, 4> v(&sGlobalAllocator);
+        v.EmplaceBack(0);
+        v.EmplaceBack(1);
+        v.EmplaceBack(2);
+
+        // Small lists must stay in the inline buffer
+        const char* vBegin = reinterpret_cast<const char*>(&v);
+        const char* dataPtr = reinterpret_cast<const char*>(v.Data());
+        if (dataPtr < vBegin || dataPtr >= vBegin + sizeof(v)) return false;
+
+        // Spill to the heap
+        for (int i = 3; i < 40; ++i) v.EmplaceBack(i);
+        dataPtr = reinterpret_cast<const char*>(v.Data());
+        if (dataPtr >= vBegin && dataPtr < vBegin + sizeof(v)) return false;
+
+        // Moving a heap vector steals the buffer
+        Pegasus::Utils::Vector<VectorTracked, 4> moved(static_cast<Pegasus::Utils::Vector<VectorTracked, 4>&&>(v));
+        if (v.GetSize() != 0 || moved.Data() != reinterpret_cast<const VectorTracked*>(dataPtr)) return false;
+
+        // Copying an inline vector relocates the elements
+        Pegasus::Utils::Vector<VectorTracked, 4> small(&sGlobalAllocator);
+        small.PushBack(VectorTracked(7));
+        small.PushBack(small[0]);
+        Pegasus::Utils::Vector<VectorTracked, 4> copy(small);
+        if (copy.GetSize() != 2 || copy[0].mValue != 7 || copy[1].mValue != 7 || !copy[1].IsValid()) return false;
+
+        for (unsigned int i = 0; i < moved.GetSize(); ++i)
+        {
+            if (!moved[i].IsValid() || moved[i].mValue != static_cast<int>(i)) return false;
+        }
+        if (VectorTracked::sLiveCount != 44) return false;
+    }
+    return VectorTracked::sLiveCount == 0;
+}
+
+//! Helper type for the vector tests that cannot be copied nor moved, like the classes using PG_DISABLE_COPY
+class VectorNonCopyable
+{
+public:
+    VectorNonCopyable() : mValue(0) { ++sLiveCount; }
+    ~VectorNonCopyable() { --sLiveCount; }
+    static int sLiveCount;
+    int mValue;
+private:
+    PG_DISABLE_COPY(VectorNonCopyable)
+};
+
+int VectorNonCopyable::sLiveCount = 0;
+
+bool UNIT_TEST_Vector6()
+{
+    VectorNonCopyable::sLiveCount = 0;
+    {
+        // The elements are relocated bitwise when the vector grows
+        Pegasus::Utils::Vector<VectorNonCopyable> v(&sGlobalAllocator);
+        for (int i = 0; i < 100; ++i)
+        {
+            v.PushEmpty().mValue = i;
+        }
+        v.Delete(10);
+        if (v.GetSize() != 99 || VectorNonCopyable::sLiveCount != 99) return false;
+        for (unsigned int i = 0; i < v.GetSize(); ++i)
+        {
+            if (v[i].mValue != static_cast<int>(i < 10 ? i : i + 1)) return false;
+        }
+    }
+    return VectorNonCopyable::sLiveCount == 0;
+}
+
 bool UNIT_TEST_ByteStream1()
 {
     Pegasus::Utils::ByteStream bs(&sGlobalAllocator);
@@ -519,3 +653,189 @@ bool UNIT_TEST_HashStr()
 
     return pass;
 }
+
+bool UNIT_TEST_HashFnv1a()
+{
+    // Compile time and runtime hashes must match the reference FNV-1a values
+    static_assert(Pegasus::Utils::HashFnv1aConst("abc") == 0x1a47e90bu, "Invalid compile time FNV-1a hash");
+    static_assert(Pegasus::Utils::HashFnv1aConst("") == Pegasus::Utils::FNV1A_OFFSET_BASIS, "Invalid compile time FNV-1a hash");
+
+    const char* str = "BoxGenerator";
+    const unsigned int constHash = Pegasus::Utils::HashFnv1aConst("BoxGenerator");
+    return Pegasus::Utils::HashFnv1a("abc") == 0x1a47e90bu
+        && Pegasus::Utils::HashFnv1a(str) == constHash
+        && Pegasus::Utils::HashFnv1a(str, Pegasus::Utils::Strlen(str)) == constHash
+        && Pegasus::Utils::HashFnv1a("BoxGenerator2") != constHash
+        && Pegasus::Utils::HashFnv1a64("abc", 3) == 0xe71fa2190541574bull
+        && Pegasus::Utils::HashFnv1a64("bc", 2, Pegasus::Utils::HashFnv1a64("a", 1)) == 0xe71fa2190541574bull
+        && Pegasus::Utils::HashFnv1a64("", 0) == Pegasus::Utils::FNV1A64_OFFSET_BASIS;
+}
+
+bool UNIT_TEST_HashMap1()
+{
+    Pegasus::Utils::HashMap<int, int> map(&sGlobalAllocator);
+    const int count = 10000;
+    for (int i = 0; i < count; ++i)
+    {
+        map.Insert(i * 7, i);
+    }
+    if (map.GetSize() != count) return false;
+
+    // Replace existing values
+    for (int i = 0; i < count; i += 2)
+    {
+        map.Insert(i * 7, -i);
+    }
+    if (map.GetSize() != count) return false;
+
+    // Remove half of the elements, the others must remain reachable
+    for (int i = 0; i < count; i += 2)
+    {
+        if (!map.Remove(i * 7)) return false;
+    }
+    if (map.GetSize() != count / 2 || map.Remove(0)) return false;
+
+    for (int i = 0; i < count; ++i)
+    {
+        const int* value = map.Find(i * 7);
+        if ((i % 2) == 0)
+        {
+            if (value != nullptr) return false;
+        }
+        else if (value == nullptr || *value != i)
+        {
+            return false;
+        }
+    }
+    return !map.Contains(1) && map.Find(count * 7) == nullptr;
+}
+
+bool UNIT_TEST_HashMap2()
+{
+    Pegasus::Utils::HashMap<const char*, unsigned int> map(&sGlobalAllocator);
+    map.Insert("ConstantColorGenerator", 0);
+    map.Insert("GradientGenerator", 1);
+    map.Insert("AddOperator", 2);
+
+    // Lookups compare the content of the strings, not the pointers
+    char key[32];
+    key[0] = '\0';
+    Pegasus::Utils::Strcat(key, "Gradient");
+    Pegasus::Utils::Strcat(key, "Generator");
+    const unsigned int* value = map.Find(key);
+    if (value == nullptr || *value != 1) return false;
+
+    unsigned int visited = 0;
+    for (unsigned int slot = 0; slot < map.GetSlotCount(); ++slot)
+    {
+        if (map.IsSlotUsed(slot))
+        {
+            visited += 1 << map.GetSlotValue(slot);
+        }
+    }
+    return visited == 7 && map.Find("Gradient") == nullptr;
+}
+
+bool UNIT_TEST_HashMap3()
+{
+    VectorTracked::sLiveCount = 0;
+    {
+        Pegasus::Utils::HashMap<unsigned int, VectorTracked> map(&sGlobalAllocator);
+        map.Reserve(100);
+        const unsigned int slotCount = map.GetSlotCount();
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            map.Insert(i, VectorTracked(static_cast<int>(i)));
+        }
+
+        // No rehash after the reservation, values are moved and destroyed properly
+        if (map.GetSlotCount() != slotCount || VectorTracked::sLiveCount != 100) return false;
+        for (unsigned int i = 0; i < 100; i += 3)
+        {
+            map.Remove(i);
+        }
+        for (unsigned int i = 0; i < 100; ++i)
+        {
+            const VectorTracked* value = map.Find(i);
+            if ((i % 3) != 0 && (value == nullptr || value->mValue != static_cast<int>(i) || !value->IsValid())) return false;
+        }
+        if (VectorTracked::sLiveCount != 66) return false;
+    }
+    return VectorTracked::sLiveCount == 0;
+}
+
+bool UNIT_TEST_HashMap4()
+{
+    Pegasus::Utils::HashMap<unsigned int, unsigned int> map(&sGlobalAllocator);
+    Pegasus::Utils::Vector<unsigned int> keys(&sGlobalAllocator);
+    for (unsigned int pass = 0; pass < 3; ++pass)
+    {
+        // Reset keeps the memory, refilling with the same count does not grow
+        const unsigned int slotCount = map.GetSlotCount();
+        const unsigned int capacity = keys.GetCapacity();
+        map.Reset();
+        keys.Reset();
+        if (map.GetSize() != 0 || keys.GetSize() != 0 || map.Contains(pass)) return false;
+        for (unsigned int i = 0; i < 500; ++i)
+        {
+            map.Insert(i * 3 + pass, i);
+            keys.PushBack(i * 3 + pass);
+        }
+        if (pass > 0 && (map.GetSlotCount() != slotCount || keys.GetCapacity() != capacity)) return false;
+        for (unsigned int i = 0; i < keys.GetSize(); ++i)
+        {
+            const unsigned int* value = map.Find(keys[i]);
+            if (value == nullptr || *value != i) return false;
+        }
+    }
+    return map.GetSize() == 500;
+}
+
+bool UNIT_TEST_Random1()
+{
+    // Same sequence for the same seed on every platform, reseeding restarts it
+    const unsigned int expected[4] = { 0x89f4befdu, 0x94e95a78u, 0x7a8293bcu, 0xf0f3ccf8u };
+    Pegasus::Utils::Random random(12345);
+    for (unsigned int pass = 0; pass < 2; ++pass)
+    {
+        for (unsigned int i = 0; i < 4; ++i)
+        {
+            if (random.NextUInt32() != expected[i]) return false;
+        }
+        random.Seed(12345);
+    }
+
+    Pegasus::Utils::Random other(12346);
+    return other.NextUInt32() != expected[0];
+}
+
+bool UNIT_TEST_Random2()
+{
+    // A jumped copy starts a known stream and leaves the original sequence unchanged
+    Pegasus::Utils::Random random(12345);
+    Pegasus::Utils::Random stream(random);
+    stream.Jump();
+    if (stream.NextUInt32() != 0xe88d355bu || stream.NextUInt32() != 0xcc292db9u) return false;
+    return random.NextUInt32() == 0x89f4befdu;
+}
+
+bool UNIT_TEST_Random3()
+{
+    // Ranges, and all the values of a small range are reached
+    Pegasus::Utils::Random random(7);
+    unsigned int counts[10] = { 0 };
+    for (unsigned int i = 0; i < 10000; ++i)
+    {
+        const unsigned int value = random.NextUInt32(10);
+        if (value >= 10) return false;
+        ++counts[value];
+
+        const float f = random.NextFloat();
+        if (f < 0.0f || f >= 1.0f) return false;
+    }
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        if (counts[i] < 800 || counts[i] > 1200) return false;
+    }
+    return random.NextUInt32(1) == 0;
+}
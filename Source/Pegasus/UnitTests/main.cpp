@@ -11,6 +11,13 @@
 //!         any data structure. To run, edit Utils project to generate an executable, and run
 
 #include "Pegasus/UnitTests/UtilsTests.h"
+#include "Pegasus/UnitTests/MeshTests.h"
+#include "Pegasus/UnitTests/TextureTests.h"
+#include "Pegasus/UnitTests/CoreTests.h"
+#include "Pegasus/UnitTests/GraphTests.h"
+#include "Pegasus/PropertyGrid/PropertyGridManager.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Core/Log.h"
 #include <stdio.h>
 
 typedef bool (*TestFunc)(void);
@@ -30,11 +37,27 @@ bool RunTests(TestFunc func, const char * testTitle, int& outSucceses, int& outT
     return result;
 }
 
+#if PEGASUS_ENABLE_LOG
+//! Log handler ignoring the messages of the engine, only the test results are printed
+void LogHandler(Pegasus::Core::LogChannel channel, const char * msg)
+{
+}
+#endif
+
 int main()
 {
     int successes = 0;
     int total = 0;
 
+#if PEGASUS_ENABLE_LOG
+    // The packages log from the tested code, such as the node data cache loading its file
+    Pegasus::Core::LogManager::CreateInstance(Pegasus::Memory::GetGlobalAllocator());
+    Pegasus::Core::LogManager::GetInstance()->RegisterHandler(LogHandler);
+#endif
+
+    // The tests creating nodes need the hierarchy of property grid class metadata, as the application does
+    Pegasus::PropertyGrid::PropertyGridManager::GetInstance().ResolveInternalClassHierarchy();
+
 #define RUN_TEST(name) RunTests(UNIT_TEST_##name, #name, successes, total)
     
     ///////////////////////////////////////////////////////////////////
@@ -88,6 +111,7 @@ int main()
 
     //StringHash
     RUN_TEST(HashStr);
+    RUN_TEST(HashFnv1a);
 
     //Atoi
     RUN_TEST(Atoi1);
@@ -108,13 +132,102 @@ int main()
     //Vector
     RUN_TEST(Vector1);
     RUN_TEST(Vector2);
+    RUN_TEST(Vector3);
+    RUN_TEST(Vector4);
+    RUN_TEST(Vector5);
+    RUN_TEST(Vector6);
 
     //ByteStream
     RUN_TEST(ByteStream1);
     RUN_TEST(ByteStream2);
     RUN_TEST(ByteStream3);    
 
+    //HashMap
+    RUN_TEST(HashMap1);
+    RUN_TEST(HashMap2);
+    RUN_TEST(HashMap3);
+    RUN_TEST(HashMap4);
+
+    //Random
+    RUN_TEST(Random1);
+    RUN_TEST(Random2);
+    RUN_TEST(Random3);
+
+    ///////////////////////////////////////////////////////////////////
+    // UNIT TESTS - add here your MESH package unit tests executions //
+    ///////////////////////////////////////////////////////////////////
+
+    //MeshData
+    RUN_TEST(MeshData1);
+    RUN_TEST(MeshData2);
+    RUN_TEST(MeshData3);
+    RUN_TEST(MeshData4);
+    RUN_TEST(MeshData5);
+    RUN_TEST(MeshData6);
+    RUN_TEST(MeshData7);
+    RUN_TEST(MeshData8);
+
+    //MeshOptimizer
+    RUN_TEST(MeshOptimizer1);
+    RUN_TEST(MeshOptimizer2);
+    RUN_TEST(MeshOptimizer3);
+
+    /////////////////////////////////////////////////////////////////////
+    // UNIT TESTS - add here your TEXTURE package unit tests executions//
+    /////////////////////////////////////////////////////////////////////
+
+    //TextureKernels
+    RUN_TEST(TextureKernels1);
+    RUN_TEST(TextureKernels2);
+    RUN_TEST(TextureKernels3);
+    RUN_TEST(TextureKernels4);
+
+    //TextureData
+    RUN_TEST(TextureData1);
+
+    //TextureGenerator
+    RUN_TEST(PixelsGenerator1);
+    RUN_TEST(PerlinNoiseGenerator1);
+    RUN_TEST(SimplexNoiseGenerator1);
+    RUN_TEST(WorleyNoiseGenerator1);
+
+    //////////////////////////////////////////////////////////////////
+    // UNIT TESTS - add here your CORE package unit tests executions//
+    //////////////////////////////////////////////////////////////////
+
+    //WorkerPool
+    RUN_TEST(WorkerPool1);
+    RUN_TEST(WorkerPool2);
+
+    //AsyncLoader
+    RUN_TEST(AsyncLoader1);
+    RUN_TEST(AsyncLoader2);
+    RUN_TEST(AsyncLoader3);
+
+    ///////////////////////////////////////////////////////////////////
+    // UNIT TESTS - add here your GRAPH package unit tests executions//
+    ///////////////////////////////////////////////////////////////////
+
+    //GraphScheduler
+    RUN_TEST(GraphScheduler1);
+    RUN_TEST(GraphScheduler2);
+
+    //EvaluationPass
+    RUN_TEST(EvaluationPass1);
+
+    //NodeDataCache
+    RUN_TEST(NodeDataCache1);
+    RUN_TEST(NodeDataCache2);
+    RUN_TEST(NodeDataCache3);
+    RUN_TEST(NodeDataCache4);
+    RUN_TEST(NodeDataCache5);
+    RUN_TEST(NodeDataCache6);
+
     ///////////////////////////////////////////////////////////
 
     printf("Final Results: %d out of %d succeeded\n", successes, total);
+
+#if PEGASUS_ENABLE_LOG
+    Pegasus::Core::LogManager::DestroyInstance();
+#endif
 }
@@ -0,0 +1,43 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Hash.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Hashing functions for strings, memory blocks and integers
+
+#include "Pegasus/Utils/Hash.h"
+
+unsigned int Pegasus::Utils::HashFnv1a(const char * str)
+{
+    unsigned int hash = FNV1A_OFFSET_BASIS;
+    unsigned char c;
+    while ((c = static_cast<unsigned char>(*str++)) != '\0')
+    {
+        hash = (hash ^ c) * FNV1A_PRIME;
+    }
+    return hash;
+}
+
+unsigned int Pegasus::Utils::HashFnv1a(const void * data, unsigned int size, unsigned int hash)
+{
+    const unsigned char * bytes = static_cast<const unsigned char *>(data);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * FNV1A_PRIME;
+    }
+    return hash;
+}
+
+unsigned long long Pegasus::Utils::HashFnv1a64(const void * data, unsigned int size, unsigned long long hash)
+{
+    const unsigned char * bytes = static_cast<const unsigned char *>(data);
+    for (unsigned int i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * FNV1A64_PRIME;
+    }
+    return hash;
+}
@@ -0,0 +1,54 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Random.cpp
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Deterministic pseudo-random number generator (xoshiro128**)
+
+#include "Pegasus/Utils/Random.h"
+
+void Pegasus::Utils::Random::Seed(unsigned int seed)
+{
+    // Expand the seed with SplitMix64, as recommended by the authors of xoshiro
+    unsigned long long x = seed;
+    for (unsigned int i = 0; i < 4; i += 2)
+    {
+        x += 0x9e3779b97f4a7c15ull;
+        unsigned long long z = x;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        z ^= z >> 31;
+        mState[i] = static_cast<unsigned int>(z);
+        mState[i + 1] = static_cast<unsigned int>(z >> 32);
+    }
+}
+
+void Pegasus::Utils::Random::Jump()
+{
+    static const unsigned int JUMP[4] = { 0x8764000bu, 0xf542d2d3u, 0x6fa035c3u, 0x77f2db5bu };
+
+    unsigned int state[4] = { 0, 0, 0, 0 };
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        for (unsigned int b = 0; b < 32; ++b)
+        {
+            if (JUMP[i] & (1u << b))
+            {
+                state[0] ^= mState[0];
+                state[1] ^= mState[1];
+                state[2] ^= mState[2];
+                state[3] ^= mState[3];
+            }
+            NextUInt32();
+        }
+    }
+
+    mState[0] = state[0];
+    mState[1] = state[1];
+    mState[2] = state[2];
+    mState[3] = state[3];
+}
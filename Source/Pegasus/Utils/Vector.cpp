@@ -35,21 +35,31 @@ void* BaseVector::PushEmpty()
 {
     if (mDataCount <= mDataSize)
     {
-        const unsigned int PAGE_SIZE = 64;
+        // Geometric growth, to keep the amortized cost of a push constant
+        const unsigned int MIN_CAPACITY = 16;
+        unsigned int newCount = mDataCount + (mDataCount >> 1);
+        Reserve(newCount < MIN_CAPACITY ? MIN_CAPACITY : newCount);
+    }
+
+    return static_cast<char*>(mData) + (mDataSize++) * mElementByteSize;
+}
+
+void BaseVector::Reserve(unsigned int count)
+{
+    if (count > mDataCount)
+    {
         void* oldData = mData;
         
-        mData = PG_NEW_ARRAY(mAlloc, -1, "Vector Page", Alloc::PG_MEM_PERM, char, (mDataCount + PAGE_SIZE)*mElementByteSize);
+        mData = PG_NEW_ARRAY(mAlloc, -1, "Vector Page", Alloc::PG_MEM_PERM, char, count*mElementByteSize);
 
         if (oldData != nullptr)
         {
-            Utils::Memcpy(mData, oldData, mDataCount*mElementByteSize);
+            Utils::Memcpy(mData, oldData, mDataSize*mElementByteSize);
             PG_DELETE_ARRAY(mAlloc,  static_cast<char*>(oldData));
         }
 
-        mDataCount += PAGE_SIZE;
+        mDataCount = count;
     }
-
-    return static_cast<char*>(mData) + (mDataSize++) * mElementByteSize;
 }
 
 void BaseVector::Delete(unsigned int index)
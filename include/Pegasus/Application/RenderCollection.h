@@ -12,6 +12,7 @@
 #ifndef RENDER_COLLECTION_H
 #define RENDER_COLLECTION_H
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
 #include "Pegasus/BlockScript/FunCallback.h"
 #include "Pegasus/PropertyGrid/PropertyGridObject.h"
 #include "Pegasus/Render/Render.h"
@@ -146,7 +147,7 @@ namespace Application
         void NotifyListeners();
 
         GlobalCacheImpl* mImpl;
-        Utils::Vector<IListener*> mListeners;
+        Utils::Vector<IListener*, 4> mListeners;
         Alloc::IAllocator* mAlloc;
     };
 
@@ -157,7 +158,7 @@ namespace Application
         struct PropEntries
         {
             const char* mName;
-            Utils::Vector<const char*> mProperties;
+            Utils::Vector<const char*, 8> mProperties;
         };
 
         //! Constructor
@@ -186,6 +187,9 @@ namespace Application
 
 
         Utils::Vector<PropEntries> mPropLayoutEntries;
+
+        //! Index in mPropLayoutEntries of each class name, for constant time layout lookups
+        Utils::HashMap<const char*, unsigned int> mPropLayoutIndices;
         
         Alloc::IAllocator* mAlloc;
     
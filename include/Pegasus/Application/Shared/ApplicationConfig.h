@@ -60,6 +60,7 @@ struct ApplicationConfig
 public:
     Os::ModuleHandle mModuleHandle; //!< Handle to the module containing this application
     const char* mBasePath; //!< The base path to load all assets from
+    bool mUseNodeDataCacheFile; //!< True to save the generated texture and mesh data when unloading, and reload it when loading
 
     // Debug API
 
@@ -71,7 +72,7 @@ public:
 
     //! Default constructor
     inline ApplicationConfig()
-        : mModuleHandle(0), mBasePath(nullptr)
+        : mModuleHandle(0), mBasePath(nullptr), mUseNodeDataCacheFile(false)
 #if PEGASUS_ENABLE_LOG
           ,mLoghandler(nullptr)
 #endif
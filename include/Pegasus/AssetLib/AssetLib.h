@@ -18,6 +18,11 @@
 #include "Pegasus/Core/Io.h"
 #include "Pegasus/PegasusAssetTypes.h"
 #include "Pegasus/AssetLib/Shared/AssetEvent.h"
+#include "Pegasus/Utils/HashMap.h"
+
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+#include "Pegasus/Core/AsyncLoader.h"
+#endif
 
 #if PEGASUS_ENABLE_PROXIES
 #include "Pegasus/AssetLib/Proxy/AssetLibProxy.h"
@@ -42,6 +47,14 @@ class AssetRuntimeFactory;
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
 class Category;
 #endif
+
+//! Hashing and comparison of asset paths, case insensitive and with both path separators equal
+struct AssetPathKeyTraits
+{
+    static unsigned int Hash(const char* path);
+    static bool Equal(const char* path1, const char* path2);
+};
+
 //! Asset Library class
 class AssetLib
 {
@@ -179,6 +192,17 @@ private:
     // resolves any pending child assets
     void ResolvePendingChildAssets(Asset* asset);
 
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+    // starts loading the file of a child asset on the IO workers, if not loaded or prefetched already
+    void PrefetchAsset(const char* path);
+
+    // releases the prefetched file of an asset, if it was not used
+    void CancelPrefetch(const char* path);
+
+    // takes the prefetched file of an asset, if any. Returns false if the file was not prefetched
+    bool TakePrefetchedAsset(const char* path, Io::FileBuffer& fileBuffer, Io::IoError& err);
+#endif
+
 #if PEGASUS_ENABLE_PROXIES
     AssetLibProxy mProxy;
 #endif
@@ -186,8 +210,14 @@ private:
     AssetBuilder   mBuilder;
     Io::IOManager* mIoMgr;
     Utils::Vector<Asset*> mAssets;
+    Utils::HashMap<const char*, Asset*, AssetPathKeyTraits> mAssetsByPath; //loaded assets, keyed by the path string they own
     Utils::Vector<AssetRuntimeFactory*> mFactories;
 
+#if PEGASUS_ASSETLIB_ENABLE_PREFETCH
+    Io::AsyncLoader mPrefetcher;
+    Utils::HashMap<unsigned int, Io::AsyncHandle> mPrefetches; //in flight prefetches, by hash of the path
+#endif
+
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     Category* mCurrentCategory;
     Utils::Vector<Category*> mCategories;
@@ -0,0 +1,204 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   AsyncLoader.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Asynchronous file loading, on a pool of IO worker threads
+
+#ifndef PEGASUS_CORE_ASYNCLOADER_H
+#define PEGASUS_CORE_ASYNCLOADER_H
+
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/Thread.h"
+
+namespace Pegasus {
+namespace Io {
+
+//! Priority of an asynchronous request, high priority requests are loaded first
+enum AsyncPriority
+{
+    ASYNC_PRIORITY_HIGH = 0,
+    ASYNC_PRIORITY_NORMAL,
+    ASYNC_PRIORITY_LOW,
+    ASYNC_PRIORITY_COUNT
+};
+
+//! How the file of an asynchronous request is loaded
+enum AsyncLoadMode
+{
+    ASYNC_LOAD_READ = 0,    //!< Read into an allocated buffer, with IOManager::OpenFileToBuffer
+    ASYNC_LOAD_MAP          //!< Mapped in memory, with IOManager::MapFileToBuffer. For files released once parsed
+};
+
+//! Handle of an asynchronous request, valid until the request is claimed with Wait() or Cancel()
+typedef unsigned int AsyncHandle;
+
+//! Handle returned when a request cannot be submitted
+const AsyncHandle ASYNC_INVALID_HANDLE = 0xFFFFFFFF;
+
+//! Completion callback of an asynchronous request, called by DispatchCallbacks().
+//! The callback is expected to claim the request, with Wait() (returns immediately) or Cancel()
+//! \param handle Handle of the completed request
+//! \param error Error code of the load
+//! \param userData Pointer given to Submit()
+typedef void (*AsyncCallback)(AsyncHandle handle, IoError error, void* userData);
+
+//----------------------------------------------------------------------------------------
+
+//! Loads files on worker threads. Requests are queued by priority, and the workers
+//! take them in batches so queues of small files do not pay a wake up and a lock per file.
+//! \warning Submit(), Wait(), Cancel() and DispatchCallbacks() are meant to be called by the thread owning the loader
+class AsyncLoader
+{
+public:
+    //! Constructor, starts the worker threads
+    //! \param alloc Allocator used for the loader and the file buffers
+    //! \param workerCount Number of worker threads, 0 to use the default count
+    AsyncLoader(Alloc::IAllocator* alloc, unsigned int workerCount = 0);
+
+    //! Destructor, cancels the queued requests and waits for the workers to finish
+    ~AsyncLoader();
+
+    //! Queues a file to be loaded
+    //! \param ioMgr IO manager to load the file with, has to outlive the request
+    //! \param relativePath Relative path to the file, within the root of the IO manager (copied)
+    //! \param loadMode Whether the file is read or mapped
+    //! \param priority Priority of the request
+    //! \param callback Optional completion callback, called by DispatchCallbacks()
+    //! \param userData Pointer given to the callback
+    //! \return Handle of the request, ASYNC_INVALID_HANDLE if too many requests are in flight
+    AsyncHandle Submit(IOManager* ioMgr, const char* relativePath, AsyncLoadMode loadMode, AsyncPriority priority = ASYNC_PRIORITY_NORMAL,
+                       AsyncCallback callback = nullptr, void* userData = nullptr);
+
+    //! Tests if a request is complete
+    //! \param handle Handle of the request
+    //! \return True if the file is loaded (or failed to load), Wait() would not block
+    bool IsComplete(AsyncHandle handle);
+
+    //! Waits for a request to complete, takes its buffer and releases the handle.
+    //! A request still in the queue is loaded directly by the calling thread
+    //! \param handle Handle of the request
+    //! \param outputBuffer Empty buffer receiving the ownership of the file content
+    //! \return Error code of the load
+    IoError Wait(AsyncHandle handle, FileBuffer& outputBuffer);
+
+    //! Cancels a request and releases the handle. The buffer of a loaded file is destroyed
+    //! \param handle Handle of the request
+    void Cancel(AsyncHandle handle);
+
+    //! Stops the workers from taking queued requests, or lets them continue.
+    //! While paused, the requests are still queued by Submit() and loaded by Wait(),
+    //! so a group of requests can be submitted at once then loaded in the order of their priorities
+    //! \param paused True to pause the workers, the requests already being loaded are finished
+    void SetPaused(bool paused);
+
+    //! Gets the number of requests waiting for a worker
+    //! \return Number of queued requests, all priorities, excluding the requests being loaded
+    unsigned int GetQueuedCount() const;
+
+    //! Calls the callbacks of the completed requests
+    //! \return Number of callbacks called
+    unsigned int DispatchCallbacks();
+
+    //! Gets the path of a request
+    //! \param handle Handle of the request
+    //! \return Relative path given to Submit()
+    const char* GetPath(AsyncHandle handle) const;
+
+    //! Maximum number of requests in flight (queued, loading or waiting to be claimed)
+    static const unsigned int MAX_REQUESTS = 256;
+
+    //! Maximum number of requests taken at once by a worker
+    static const unsigned int MAX_BATCH_SIZE = 8;
+
+    //! Number of workers when 0 is given to the constructor
+    static const unsigned int DEFAULT_WORKER_COUNT = 2;
+
+private:
+    PG_DISABLE_COPY(AsyncLoader)
+
+    //! State of a request slot
+    enum RequestState
+    {
+        STATE_FREE,         //!< Unused slot
+        STATE_QUEUED,       //!< Waiting in a priority queue
+        STATE_LOADING,      //!< Being loaded by a worker or a waiting thread
+        STATE_CANCELED,     //!< Canceled while loading, freed when the load ends
+        STATE_DONE          //!< Loaded, waiting to be claimed
+    };
+
+    //! Slot of a request
+    struct Request
+    {
+        char mPath[IOManager::MAX_FILEPATH_LENGTH];     //!< Relative path of the file
+        IOManager* mIoMgr;                              //!< IO manager loading the file
+        FileBuffer mBuffer;                             //!< Content of the loaded file
+        IoError mError;                                 //!< Result of the load
+        AsyncCallback mCallback;                        //!< Completion callback, can be null
+        void* mUserData;                                //!< Pointer given to the callback
+        unsigned int mGeneration;                       //!< Incremented each time the slot is freed, to detect stale handles
+        RequestState mState;                            //!< State of the slot
+        AsyncLoadMode mLoadMode;                        //!< Whether the file is read or mapped
+        AsyncPriority mPriority;                        //!< Priority queue of the request
+        unsigned int mPrev;                             //!< Previous slot in the list containing the request
+        unsigned int mNext;                             //!< Next slot in the list containing the request
+        bool mInCompletedList;                          //!< True while waiting for its callback
+    };
+
+    //! Doubly linked list of slots, the links are stored in the requests
+    struct RequestList
+    {
+        unsigned int mHead;
+        unsigned int mTail;
+    };
+
+    //! Entry point of the worker threads
+    //! \param userData The loader
+    static void WorkerEntryPoint(void* userData);
+
+    //! Main loop of the worker threads
+    void WorkerLoop();
+
+    //! Loads the file of a request, called without the lock
+    void LoadRequest(Request& request);
+
+    //! Marks a request as loaded and wakes up the waiting threads, called with the lock
+    void CompleteRequest(unsigned int slot);
+
+    //! Gets the slot of a handle, asserts if the handle is stale
+    unsigned int GetSlot(AsyncHandle handle) const;
+
+    //! Frees a slot, called with the lock
+    void FreeSlot(unsigned int slot);
+
+    //! Appends a slot to a list
+    void PushBack(RequestList& list, unsigned int slot);
+
+    //! Removes a slot from a list
+    void Unlink(RequestList& list, unsigned int slot);
+
+    Alloc::IAllocator* mAlloc;                          //!< Allocator of the slots and the buffers
+    Request* mRequests;                                 //!< Request slots
+    unsigned int mFreeSlots[MAX_REQUESTS];              //!< Stack of free slot indices
+    unsigned int mFreeSlotCount;                        //!< Number of free slots
+    RequestList mQueues[ASYNC_PRIORITY_COUNT];          //!< Queued requests for each priority
+    unsigned int mQueuedCount;                          //!< Number of queued requests, all priorities
+    RequestList mCompletedList;                         //!< Completed requests waiting for their callback
+    Core::Thread* mWorkers;                             //!< Worker threads
+    unsigned int mWorkerCount;                          //!< Number of worker threads
+    bool mShutdown;                                     //!< True when the workers have to exit
+    bool mPaused;                                       //!< True when the workers do not take queued requests
+    mutable Core::Mutex mMutex;                         //!< Lock protecting the slots and the lists
+    Core::ConditionVariable mWorkAvailable;             //!< Signaled when requests are queued
+    Core::ConditionVariable mRequestCompleted;          //!< Signaled when requests are loaded
+};
+
+
+} // namespace Io
+} // namespace Pegasus
+
+#endif  // PEGASUS_CORE_ASYNCLOADER_H
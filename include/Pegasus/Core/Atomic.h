@@ -0,0 +1,95 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Atomic.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Atomic integer operations, used by the reference counters shared across threads
+
+#ifndef PEGASUS_CORE_ATOMIC_H
+#define PEGASUS_CORE_ATOMIC_H
+
+#if PEGASUS_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace Pegasus {
+namespace Core {
+
+
+//! Atomically increment an integer, without ordering constraints (relaxed).
+//! Enough for reference counters, since a new reference can only be created from an existing one
+//! \param value Pointer to the integer to increment
+//! \return Value after the increment
+inline int AtomicIncrementRelaxed(volatile int * value)
+{
+#if PEGASUS_COMPILER_MSVC
+    // long is 32 bits on Windows, interlocked operations are full barriers on x86
+    return static_cast<int>(_InterlockedIncrement(reinterpret_cast<volatile long *>(value)));
+#else
+    return __atomic_add_fetch(value, 1, __ATOMIC_RELAXED);
+#endif
+}
+
+//! Atomically decrement an integer, with acquire-release ordering.
+//! The thread bringing a reference counter to 0 sees all the writes done by the other owners
+//! \param value Pointer to the integer to decrement
+//! \return Value after the decrement
+inline int AtomicDecrementAcqRel(volatile int * value)
+{
+#if PEGASUS_COMPILER_MSVC
+    return static_cast<int>(_InterlockedDecrement(reinterpret_cast<volatile long *>(value)));
+#else
+    return __atomic_sub_fetch(value, 1, __ATOMIC_ACQ_REL);
+#endif
+}
+
+//! Atomically add to an integer, with acquire-release ordering
+//! \param value Pointer to the integer to modify
+//! \param amount Value to add
+//! \return Value before the addition
+inline int AtomicAdd(volatile int * value, int amount)
+{
+#if PEGASUS_COMPILER_MSVC
+    return static_cast<int>(_InterlockedExchangeAdd(reinterpret_cast<volatile long *>(value), static_cast<long>(amount)));
+#else
+    return __atomic_fetch_add(value, amount, __ATOMIC_ACQ_REL);
+#endif
+}
+
+//! Atomically compare an integer and replace it if equal, with acquire-release ordering
+//! \param value Pointer to the integer to modify
+//! \param expected Value the integer must have to be replaced
+//! \param desired New value of the integer
+//! \return True if the value was replaced
+inline bool AtomicCompareExchange(volatile int * value, int expected, int desired)
+{
+#if PEGASUS_COMPILER_MSVC
+    return _InterlockedCompareExchange(reinterpret_cast<volatile long *>(value), static_cast<long>(desired), static_cast<long>(expected))
+        == static_cast<long>(expected);
+#else
+    return __atomic_compare_exchange_n(value, &expected, desired, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE);
+#endif
+}
+
+//! Atomically read an integer, with acquire ordering
+//! \param value Pointer to the integer to read
+//! \return Current value of the integer
+inline int AtomicLoad(const volatile int * value)
+{
+#if PEGASUS_COMPILER_MSVC
+    // Aligned 32 bits reads are atomic on x86, volatile reads have acquire semantics with MSVC
+    return *value;
+#else
+    return __atomic_load_n(value, __ATOMIC_ACQUIRE);
+#endif
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_ATOMIC_H
@@ -0,0 +1,90 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   EventRecorder.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Recording of the events dispatched by worker threads, to replay them on the main thread
+
+#ifndef PEGASUS_CORE_EVENTRECORDER_H
+#define PEGASUS_CORE_EVENTRECORDER_H
+
+#include "Pegasus/Core/Shared/EventDefs.h"
+
+#if PEGASUS_USE_EVENTS
+
+namespace Pegasus {
+namespace Alloc {
+    class IAllocator;
+}
+
+namespace Core {
+
+
+//! Keeps the events dispatched while it is the recorder of a thread (see ScopedEventRecording),
+//! until DispatchEvents() sends them to their listeners in the order they were recorded
+class EventRecorder : public IEventRecorder
+{
+public:
+
+    //! Constructor
+    //! \param alloc Allocator of the recorded events
+    explicit EventRecorder(Alloc::IAllocator* alloc);
+
+    //! Destructor, drops the events not dispatched
+    virtual ~EventRecorder();
+
+    //! Allocates the memory of an event to record
+    //! \param size Size of the event in bytes
+    virtual void* AllocateEvent(unsigned int size);
+
+    //! Appends an event constructed in the memory returned by AllocateEvent()
+    //! \param e Event to append
+    virtual void RecordEvent(RecordedEvent* e);
+
+    //! Dispatches the recorded events to their listeners, then drops them
+    //! \warning To be called by the thread the listeners expect the events on
+    void DispatchEvents();
+
+    //! Drops the recorded events without dispatching them
+    void Clear();
+
+    //! Tests if events are recorded
+    //! \return True if no event is waiting to be dispatched
+    inline bool IsEmpty() const { return mHead == nullptr; }
+
+private:
+    PG_DISABLE_COPY(EventRecorder)
+
+    Alloc::IAllocator* mAlloc;          //!< Allocator of the recorded events
+    RecordedEvent* mHead;               //!< First recorded event
+    RecordedEvent* mTail;               //!< Last recorded event
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Makes a recorder the one of the calling thread for the duration of a scope.
+//! Scopes can be nested, the previous recorder is restored at the end of the scope
+class ScopedEventRecording
+{
+public:
+    explicit ScopedEventRecording(IEventRecorder* recorder) : mPrevious(SetThreadEventRecorder(recorder)) {}
+    ~ScopedEventRecording() { SetThreadEventRecorder(mPrevious); }
+
+private:
+    PG_DISABLE_COPY(ScopedEventRecording)
+
+    //! Recorder of the thread before the scope
+    IEventRecorder* mPrevious;
+};
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_USE_EVENTS
+
+#endif  // PEGASUS_CORE_EVENTRECORDER_H
@@ -44,6 +44,18 @@ public:
     //! \param bufferSize Size of the buffer.
     void OwnBuffer(Alloc::IAllocator* bufferAlloc, char * buffer, int bufferSize);
 
+    //! Takes ownership of a memory mapped view of a file, as the contents of this object.
+    //! The view is unmapped by DestroyBuffer(), its pages are copy-on-write so it can be modified
+    //! \param bufferAlloc Allocator to use if the view is replaced by an allocated buffer.
+    //! \param view Address of the mapped view.
+    //! \param viewSize Size of the view, equal to the size of the file.
+    void OwnMappedView(Alloc::IAllocator* bufferAlloc, char * view, int viewSize);
+
+    //! Replaces a mapped view by an allocated copy of its contents, and unmaps the view.
+    //! Does nothing if the buffer is not mapped. Required before keeping the buffer beyond parsing,
+    //! since the file cannot be rewritten while it is mapped
+    void DetachMappedView();
+
     //! Releases ownership of any currently owned buffer
     void ForgetBuffer();
 
@@ -76,12 +88,17 @@ public:
     //! \return allocator
     Alloc::IAllocator* GetAllocator() const { return mAllocator; }
 
+    //! Tells if the buffer is a mapped view of a file rather than an allocated buffer
+    //! \return True if the buffer is mapped.
+    bool IsMapped() const { return mIsMapped; }
+
 private:
 
     Alloc::IAllocator* mAllocator; //!< Allocator used to create the buffer
     char* mBuffer; //!< Contained buffer
     int mFileSize; //!< Size of the file in the buiffer
     int mBufferSize; //!< Size of the buffer
+    bool mIsMapped; //!< True if the buffer is a mapped view of a file, unmapped instead of deleted
 };
 
 //----------------------------------------------------------------------------------------
@@ -112,6 +129,17 @@ public:
     //! \note Buffer must be deallocated by the caller
     IoError OpenFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, bool allocateBuffer = false, Alloc::IAllocator* alloc = nullptr);
 
+    //! Maps a file in memory and hands out the view in an output buffer, without copying the file.
+    //! The view is copy-on-write, so the buffer can be modified without altering the file.
+    //! Falls back to OpenFileToBuffer (with allocation) when mapping is not available.
+    //! \param relativePath Relative path to the file, within the asset root.
+    //! \param outputBuffer Output buffer, empty, receiving the mapped view.
+    //! \param alloc Allocator to use if the buffer has to be allocated.
+    //! \return Error code.
+    //! \note The view must be released by the caller with DestroyBuffer. Call FileBuffer::DetachMappedView
+    //!       before moving the buffer to a longer lived owner (such as an asset) that can save the file
+    IoError MapFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, Alloc::IAllocator* alloc);
+
     //! Utility function that writes binary data to a file
     //! \param relativePath Relative path to the file, within the asset root.
     //! \param inputBuffer the file buffer to dump into the file.
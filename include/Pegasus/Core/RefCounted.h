@@ -13,6 +13,8 @@
 #ifndef PEGASUS_CORE_REFCOUNTED_H
 #define PEGASUS_CORE_REFCOUNTED_H
 
+#include "Pegasus/Core/Atomic.h"
+
 namespace Pegasus {
     namespace Alloc {
         class IAllocator;
@@ -22,6 +24,9 @@ namespace Pegasus {
 namespace Pegasus {
 namespace Core {
 
+//! Base class of reference counted objects.
+//! When PEGASUS_ENABLE_ATOMIC_REFCOUNT is set, the counter is updated atomically
+//! (relaxed increments, acquire-release decrements) so references can be shared across threads
 class RefCounted
 {
 public:
@@ -33,7 +38,11 @@ public:
     virtual ~RefCounted();
 
     //! Increment the reference counter, used by Ref<Node>
+#if PEGASUS_ENABLE_ATOMIC_REFCOUNT
+    inline void AddRef() { AtomicIncrementRelaxed(&mRefCount); }
+#else
     inline void AddRef() { mRefCount++; }
+#endif
 
     //! Decrease the reference counter, and delete the current object
     //! if the counter reaches 0
@@ -46,7 +55,11 @@ public:
 private:
 
     //! Reference counter
+#if PEGASUS_ENABLE_ATOMIC_REFCOUNT
+    volatile int mRefCount;
+#else
     int mRefCount;
+#endif
     
     //! Pointer to allocator
     Alloc::IAllocator* mAllocator;
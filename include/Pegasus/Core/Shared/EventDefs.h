@@ -15,6 +15,8 @@
 
 #if PEGASUS_USE_EVENTS
 
+#include <new>
+
 namespace Pegasus {
 namespace Core {
     //! generic class, used by the user to pass event data around
@@ -25,13 +27,79 @@ namespace Core {
         virtual ~IEventUserData(){}
     };
 
+    //! Event recorded instead of being dispatched, see IEventRecorder
+    class RecordedEvent
+    {
+    public:
+        RecordedEvent() : mNext(nullptr) {}
+        virtual ~RecordedEvent() {}
+
+        //! Dispatches the event to its listener
+        virtual void Dispatch() = 0;
+
+        //! Next recorded event, in the order of the recording
+        RecordedEvent* mNext;
+    };
+
+    //! Recorded event of a given type, keeping a copy of the event
+    template<class E, class L>
+    class TypedRecordedEvent : public RecordedEvent
+    {
+    public:
+        TypedRecordedEvent(IEventUserData* userData, const E& e, L* listener)
+            : mUserData(userData), mEvent(e), mListener(listener) {}
+        virtual ~TypedRecordedEvent() {}
+
+        //! Dispatches the event to its listener
+        virtual void Dispatch() { mListener->OnEvent(mUserData, mEvent); }
+
+    private:
+        IEventUserData* mUserData;
+        E mEvent;
+        L* mListener;
+    };
+
+    //! Receives the events dispatched by a thread instead of the listeners.
+    //! Installed around the work running on worker threads, so the events reach
+    //! the listeners later, from the main thread
+    class IEventRecorder
+    {
+    public:
+        IEventRecorder(){}
+        virtual ~IEventRecorder(){}
+
+        //! Allocates the memory of an event to record
+        //! \param size size of the event in bytes
+        virtual void* AllocateEvent(unsigned int size) = 0;
+
+        //! Appends an event constructed in the memory returned by AllocateEvent()
+        virtual void RecordEvent(RecordedEvent* e) = 0;
+    };
+
+    //! \return the recorder of the calling thread, nullptr when the events are dispatched directly
+    IEventRecorder* GetThreadEventRecorder();
+
+    //! Sets the recorder of the calling thread
+    //! \param recorder the recorder receiving the events, nullptr to dispatch them directly
+    //! \return the previous recorder of the thread, to restore
+    IEventRecorder* SetThreadEventRecorder(IEventRecorder* recorder);
+
     //! \brief internal dispatching function, for internal use only
     template<class E, class L, class S>
     void Internal_DispatchEvent(S* s, E& e, L* l) 
     {
         if (l != nullptr)
         {
-            l->OnEvent(s->GetEventUserData(), e);
+            IEventRecorder* recorder = GetThreadEventRecorder();
+            if (recorder != nullptr)
+            {
+                void* memory = recorder->AllocateEvent(sizeof(TypedRecordedEvent<E, L>));
+                recorder->RecordEvent(new (memory) TypedRecordedEvent<E, L>(s->GetEventUserData(), e, l));
+            }
+            else
+            {
+                l->OnEvent(s->GetEventUserData(), e);
+            }
         }
     }
 
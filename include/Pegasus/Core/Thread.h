@@ -0,0 +1,144 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Threads and synchronization primitives, used by the worker threads of the engine.
+//!         Implemented in Platform/Thread_<platform>.cpp
+
+#ifndef PEGASUS_CORE_THREAD_H
+#define PEGASUS_CORE_THREAD_H
+
+namespace Pegasus {
+namespace Core {
+
+
+//! Size in bytes of the storage of the native objects
+//! (large enough for the Win32 and pthread types, checked in the implementations)
+const unsigned int THREAD_NATIVE_STORAGE_SIZE = 64;
+
+//----------------------------------------------------------------------------------------
+
+//! Mutual exclusion lock, not recursive
+class Mutex
+{
+public:
+    Mutex();
+    ~Mutex();
+
+    //! Waits until the mutex is free and takes it
+    void Lock();
+
+    //! Releases the mutex, has to be called by the thread that locked it
+    void Unlock();
+
+private:
+    PG_DISABLE_COPY(Mutex)
+    friend class ConditionVariable;
+
+    //! Native mutex object
+    alignas(8) char mStorage[THREAD_NATIVE_STORAGE_SIZE];
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Locks a mutex for the duration of a scope
+class ScopedLock
+{
+public:
+    explicit ScopedLock(Mutex& mutex) : mMutex(mutex) { mMutex.Lock(); }
+    ~ScopedLock() { mMutex.Unlock(); }
+
+private:
+    PG_DISABLE_COPY(ScopedLock)
+
+    //! Locked mutex
+    Mutex& mMutex;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Condition variable, to sleep until another thread signals a change of state
+class ConditionVariable
+{
+public:
+    ConditionVariable();
+    ~ConditionVariable();
+
+    //! Atomically releases the mutex and sleeps until woken up, then locks the mutex again
+    //! \param mutex Mutex locked by the calling thread
+    //! \note Wake ups can be spurious, the condition has to be tested again in a loop
+    void Wait(Mutex& mutex);
+
+    //! Wakes up one of the waiting threads
+    void Signal();
+
+    //! Wakes up all the waiting threads
+    void Broadcast();
+
+private:
+    PG_DISABLE_COPY(ConditionVariable)
+
+    //! Native condition variable object
+    alignas(8) char mStorage[THREAD_NATIVE_STORAGE_SIZE];
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Thread of execution, running a function until it returns
+class Thread
+{
+public:
+    //! Function run by a thread
+    //! \param userData Pointer given to Start()
+    typedef void (*ThreadFunc)(void* userData);
+
+    Thread();
+
+    //! Destructor
+    //! \warning The thread has to be joined before destruction
+    ~Thread();
+
+    //! Creates the native thread and starts running a function
+    //! \param func Function to run
+    //! \param userData Pointer given to the function
+    //! \param name Name of the thread, for the debuggers
+    //! \return True if the thread was created
+    bool Start(ThreadFunc func, void* userData, const char* name);
+
+    //! Waits until the function returns and releases the native thread
+    void Join();
+
+    //! \return True if the thread has been started and not joined yet
+    inline bool IsRunning() const { return mIsRunning; }
+
+private:
+    PG_DISABLE_COPY(Thread)
+
+    //! Native thread object
+    alignas(8) char mStorage[THREAD_NATIVE_STORAGE_SIZE];
+
+    //! Function run by the thread
+    ThreadFunc mFunc;
+
+    //! Pointer given to the function
+    void* mUserData;
+
+    //! True between Start() and Join()
+    bool mIsRunning;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! \return Number of hardware threads of the machine (at least 1)
+unsigned int GetHardwareThreadCount();
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_THREAD_H
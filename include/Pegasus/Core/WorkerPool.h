@@ -0,0 +1,133 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WorkerPool.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Pool of worker threads running short CPU tasks
+
+#ifndef PEGASUS_CORE_WORKERPOOL_H
+#define PEGASUS_CORE_WORKERPOOL_H
+
+#include "Pegasus/Core/Singleton.h"
+#include "Pegasus/Core/Thread.h"
+
+namespace Pegasus {
+namespace Core {
+
+
+//! Pool of worker threads, shared by the engine systems to run CPU work in parallel
+//! (graph evaluation, texture and mesh generation).
+//! Tasks are grouped so a caller can wait for the ones it submitted.
+//! A waiting thread runs queued tasks instead of sleeping, so tasks can submit and wait for other tasks.
+class WorkerPool : public Singleton<WorkerPool>
+{
+public:
+
+    //! Function of a task
+    //! \param userData Pointer given to Submit()
+    typedef void (*TaskFunc)(void* userData);
+
+    //! Function processing a range of items, used by ParallelFor()
+    //! \param userData Pointer given to ParallelFor()
+    //! \param begin Index of the first item of the range
+    //! \param end Index after the last item of the range
+    typedef void (*RangeFunc)(void* userData, unsigned int begin, unsigned int end);
+
+    //! Set of tasks a thread can wait for
+    struct TaskGroup
+    {
+        TaskGroup() : mPendingCount(0) {}
+
+        int mPendingCount;      //!< Number of submitted tasks not finished yet, protected by the pool lock
+    };
+
+    //! Constructor, starts one worker per hardware thread except the calling one
+    WorkerPool();
+
+    //! Destructor, waits for the workers to finish
+    virtual ~WorkerPool();
+
+    //! Queues a task
+    //! \param group Group of the task, has to outlive the task
+    //! \param func Function of the task
+    //! \param userData Pointer given to the function
+    void Submit(TaskGroup& group, TaskFunc func, void* userData);
+
+    //! Waits for all the tasks of a group to finish, running queued tasks in the meantime
+    //! \param group Group to wait for
+    void Wait(TaskGroup& group);
+
+    //! Splits a range of items into chunks processed by the workers and the calling thread.
+    //! Returns when all the items are processed
+    //! \param count Number of items
+    //! \param grainSize Number of items processed by each call of the function, 0 for 1
+    //! \param func Function processing a chunk of items
+    //! \param userData Pointer given to the function
+    void ParallelFor(unsigned int count, unsigned int grainSize, RangeFunc func, void* userData);
+
+    //! Gets the number of worker threads
+    //! \return Number of workers, 0 on single core machines (the tasks run in Wait())
+    inline unsigned int GetWorkerCount() const { return mWorkerCount; }
+
+    //! Maximum number of worker threads
+    static const unsigned int MAX_WORKERS = 16;
+
+private:
+    PG_DISABLE_COPY(WorkerPool)
+
+    //! Queued task
+    struct Task
+    {
+        TaskFunc mFunc;
+        void* mUserData;
+        TaskGroup* mGroup;
+    };
+
+    //! Entry point of the worker threads
+    //! \param userData The pool
+    static void WorkerEntryPoint(void* userData);
+
+    //! Main loop of the worker threads
+    void WorkerLoop();
+
+    //! Takes the oldest queued task, called with the lock
+    //! \param task Receives the task
+    //! \return True if a task was queued
+    bool PopTask(Task& task);
+
+    //! Runs a task without the lock, then marks it as finished
+    //! \param task Task to run
+    void RunTask(const Task& task);
+
+    Alloc::IAllocator* mAlloc;                      //!< Allocator of the task queue
+    Task* mTasks;                                   //!< Ring buffer of queued tasks
+    unsigned int mTaskCapacity;                     //!< Size of the ring buffer, power of two
+    unsigned int mTaskHead;                         //!< Index of the oldest queued task
+    unsigned int mTaskCount;                        //!< Number of queued tasks
+    Thread mWorkers[MAX_WORKERS];                   //!< Worker threads
+    unsigned int mWorkerCount;                      //!< Number of running worker threads
+    bool mShutdown;                                 //!< True when the workers have to exit
+    Mutex mMutex;                                   //!< Lock protecting the queue and the group counters
+    ConditionVariable mWorkAvailable;               //!< Signaled when tasks are queued
+    ConditionVariable mTaskCompleted;               //!< Signaled when tasks finish
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Runs WorkerPool::ParallelFor() on the worker pool, or processes the whole range
+//! on the calling thread when the pool does not exist
+//! \param count Number of items
+//! \param grainSize Number of items processed by each call of the function, 0 for 1
+//! \param func Function processing a chunk of items
+//! \param userData Pointer given to the function
+void ParallelFor(unsigned int count, unsigned int grainSize, WorkerPool::RangeFunc func, void* userData);
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_WORKERPOOL_H
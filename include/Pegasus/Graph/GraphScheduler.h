@@ -0,0 +1,152 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphScheduler.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Evaluation of the dirty nodes of a graph, in parallel on the worker pool
+
+#ifndef PEGASUS_GRAPH_GRAPHSCHEDULER_H
+#define PEGASUS_GRAPH_GRAPHSCHEDULER_H
+
+#include "Pegasus/Graph/Node.h"
+#include "Pegasus/Core/WorkerPool.h"
+#include "Pegasus/Core/EventRecorder.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/Vector.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Brings the data of a graph up to date before it is pulled by an output node.
+//! The nodes feeding the evaluated node are sorted topologically, and the ones needing
+//! a regeneration run on the worker pool as soon as all their inputs are up to date,
+//! so independent branches of a graph are generated at the same time.
+//! Each task only writes the data of its own node, the data of the inputs is only read
+//! once generated, so no node data is shared between concurrent writers.
+//! With the events enabled, the events of the tasks are recorded and dispatched by the calling thread
+//! once the graph is evaluated, in the order of a serial evaluation, as the editor listeners expect them on the main thread.
+//! \note Falls back to a serial evaluation in topological order when the worker pool is missing,
+//!       when PEGASUS_GRAPH_PARALLEL_EVALUATION is disabled, or when the graph contains compute nodes
+//!       (their generation needs the render context of the main thread)
+class GraphScheduler
+{
+public:
+
+    //! Constructor
+    //! \param alloc Allocator used for the internal tables
+    GraphScheduler(Alloc::IAllocator* alloc);
+
+    //! Destructor
+    ~GraphScheduler();
+
+    //! Regenerate the dirty nodes of a graph, and the nodes depending on them.
+    //! The graph is updated first (Node::UpdateInPass() on the root), so the changes not propagated yet
+    //! to the dirty flags of the node data are regenerated by the scheduler rather than by the pull of the data
+    //! \param root Node to evaluate, with all its input nodes (typically the input of an output node)
+    //! \note After the call, GetUpdatedData() on the root node returns without generating anything
+    //! \warning To be called by the main thread, while no other thread is using the graph
+    void Evaluate(Node* root);
+
+    //! Get the number of nodes reached by the last evaluation
+    //! \return Number of distinct nodes in the graph of the last evaluated node
+    inline unsigned int GetLastVisitedNodeCount() const { return mLastVisitedNodeCount; }
+
+    //! Get the number of nodes regenerated by the last evaluation
+    //! \return Number of nodes whose GenerateData() has been called
+    inline unsigned int GetLastGeneratedNodeCount() const { return mLastGeneratedNodeCount; }
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The scheduler keeps the tables of the evaluation in progress
+    PG_DISABLE_COPY(GraphScheduler)
+
+    //! Node of the evaluated graph, stored in topological order (inputs first)
+    struct Entry
+    {
+        Node* mNode;                        //!< Node to evaluate
+        GraphScheduler* mScheduler;         //!< Scheduler running the evaluation, for the tasks
+        volatile int mPendingInputs;        //!< Number of inputs not regenerated yet
+        unsigned int mFirstDependent;       //!< First index in \a mDependents of the nodes using this one
+        unsigned int mDependentCount;       //!< Number of nodes using this one and needing a regeneration
+        bool mNeedsGeneration;              //!< True if the node or one of its inputs is dirty
+#if PEGASUS_USE_EVENTS
+        Core::EventRecorder* mEventRecorder;//!< Events dispatched by the generation of the node, for a parallel evaluation
+#endif
+    };
+
+    //! Element of the depth first traversal stack
+    struct StackItem
+    {
+        Node* mNode;                        //!< Node being visited
+        unsigned int mNextInput;            //!< Index of the next input to visit
+    };
+
+    //! Sort the nodes of a graph topologically into \a mEntries
+    //! \param root Node to start from
+    void SortNodes(Node* root);
+
+    //! Find which nodes need a regeneration and link them to the nodes they depend on
+    //! \return Number of nodes needing a regeneration
+    unsigned int BuildDependencies();
+
+    //! Regenerate the data of a node, called by the tasks and by the serial evaluation
+    //! \param entry Entry of the node
+    static void GenerateNode(Entry& entry);
+
+    //! Task regenerating a node, then submitting the dependent nodes whose inputs are all up to date
+    //! \param userData Entry of the node
+    static void GenerateNodeTask(void* userData);
+
+#if PEGASUS_USE_EVENTS
+    //! Give an event recorder to each node needing a regeneration, for a parallel evaluation
+    void AssignEventRecorders();
+
+    //! Dispatch the events recorded by the tasks, in topological order
+    void DispatchRecordedEvents();
+#endif
+
+    //! Allocator of the internal tables
+    Alloc::IAllocator* mAlloc;
+
+    //! Worker pool running the tasks, nullptr for a serial evaluation
+    Core::WorkerPool* mWorkerPool;
+
+    //! Group of the tasks of the current evaluation
+    Core::WorkerPool::TaskGroup mTaskGroup;
+
+    //! Nodes of the evaluated graph, in topological order
+    Utils::Vector<Entry> mEntries;
+
+    //! Indices in \a mEntries of the nodes using each node (ranges defined by the entries)
+    Utils::Vector<unsigned int> mDependents;
+
+    //! Traversal stack of SortNodes()
+    Utils::Vector<StackItem> mStack;
+
+    //! Index in \a mEntries of each visited node
+    Utils::HashMap<Node*, unsigned int> mEntryIndices;
+
+#if PEGASUS_USE_EVENTS
+    //! Event recorders of the nodes regenerated in parallel, kept between evaluations
+    Utils::Vector<Core::EventRecorder*> mEventRecorders;
+#endif
+
+    //! Number of nodes reached by the last evaluation
+    unsigned int mLastVisitedNodeCount;
+
+    //! Number of nodes regenerated by the last evaluation
+    unsigned int mLastGeneratedNodeCount;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_GRAPHSCHEDULER_H
@@ -29,11 +29,15 @@ namespace Pegasus {
 namespace Graph {
 
 class NodeManager;
+class NodeDataCache;
+class GraphScheduler;
 
 //! Base node class for all graph-based systems (textures, meshes, shaders, etc.)
 class Node : public Core::RefCounted, public PropertyGrid::PropertyGridObject
 {
     template<class C> friend class Pegasus::Core::Ref;
+    friend class GraphScheduler;
+    friend class NodeManager;
 
     BEGIN_DECLARE_PROPERTIES_BASE(Node)
     END_DECLARE_PROPERTIES()
@@ -98,6 +102,21 @@ public:
     //! \warning The \a updated output parameter must be set to false by the first caller
     virtual NodeDataReturn GetUpdatedData(bool & updated);
 
+    //! Update the node internal state, at most once per evaluation pass (see EvaluationPass).
+    //! \note Outside of a pass, simply calls Update(). Inside a pass, the first call updates the node
+    //!       and the next ones return the same result, so a node shared by several parents is visited once
+    //! \return True if the node data is dirty or if any input node is
+    bool UpdateInPass();
+
+    //! Return the node up-to-date data, computed at most once per evaluation pass (see EvaluationPass).
+    //! \note Outside of a pass, simply calls GetUpdatedData(). Inside a pass, the next calls
+    //!       return the data of the node without visiting the input nodes again
+    //! \param updated Set to true if the node or any of its input nodes has had the data recomputed
+    //!                during the pass (output parameter, set to false only by the caller)
+    //! \return Reference to the node data
+    //! \warning Not to be used on output nodes, which return the data of their input
+    NodeDataReturn GetUpdatedDataInPass(bool & updated);
+
     //! Deallocate the data of the current node and ask the input nodes to do the same.
     //! Typically used when keeping the graph in memory but not the associated data,
     //! to save memory and to be able to restore the data later
@@ -177,6 +196,32 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Complete the content of the data after GenerateData(), such as building derived data
+    //! shared by all the nodes of a family (mip levels of textures for example)
+    //! \note Not called when the data comes from the node data cache, since the cache stores the completed content
+    //! \note Called by \a RegenerateData(), the default does nothing
+    virtual void FinalizeData() { }
+
+    //! Generate the content of the data, or copy it from the node data cache of the node manager
+    //! when a node of the same class, with the same properties, configuration and inputs generated it before.
+    //! Validates the node data
+    //! \note Called by \a GetUpdatedData() of the generator and operator nodes instead of GenerateData()
+    //! \warning The data has to be allocated, and the inputs up-to-date
+    void RegenerateData();
+
+    //! Test if the data of the node can be stored in the node data cache
+    //! \note Redefine in derived classes returning false for nodes whose data depends on
+    //!       anything other than the property grid, the configuration and the inputs (such as data edited by user code)
+    //! \return True if cacheable, false by default for compute nodes
+    virtual bool IsDataCacheable() const { return GetMode() != COMPUTE; }
+
+    //! Add the state of the node that is not part of the property grid to a content key,
+    //! such as the configuration of the generated data
+    //! \note Redefine in derived classes having such a state, the default adds nothing
+    //! \param key Content key computed so far
+    //! \return Content key including the state of the node
+    virtual unsigned long long HashConfiguration(unsigned long long key) const { return key; }
+
 
     //! Create the data associated with the node
     //! \warning Only calls the default constructor of the node data object,
@@ -199,7 +244,7 @@ protected:
     void InvalidateData();
 
     //! Deallocate the data, set the dirty flag of the node data at the same time
-    inline void ReleaseData() { mData = nullptr; }
+    inline void ReleaseData() { mData = nullptr; mDataEpoch = 0; mContentKey = 0; }
 
 
     //! Maximum number of input nodes
@@ -255,6 +300,11 @@ private:
     // Nodes cannot be copied, only references to them
     PG_DISABLE_COPY(Node)
 
+    //! Compute the content key of the node data, identifying the data the node generates
+    //! \return Hash of the class name, the property grid, the configuration and the content keys of the inputs,
+    //!         0 if an input is not cacheable
+    unsigned long long ComputeContentKey() const;
+
     //! Allocator used for node internal data (except the attached NodeData)
     Alloc::IAllocator* mNodeAllocator;
 
@@ -270,6 +320,24 @@ private:
     //! Data node, used to store optional intermediate node data
     NodeDataRef mData;
 
+    //! Cache of the node manager that created the node, nullptr if none
+    NodeDataCache* mDataCache;
+
+    //! Content key of the current data (see ComputeContentKey()), 0 if unknown or not cacheable
+    unsigned long long mContentKey;
+
+    //! Epoch of the evaluation pass of the last UpdateInPass() call, 0 if none
+    unsigned int mUpdateEpoch;
+
+    //! Result of the last UpdateInPass() call
+    bool mUpdateResult;
+
+    //! Epoch of the evaluation pass of the last GetUpdatedDataInPass() call, 0 if none
+    unsigned int mDataEpoch;
+
+    //! True if the data has been recomputed by the last GetUpdatedDataInPass() call
+    bool mDataUpdated;
+
 #if PEGASUS_ENABLE_PROXIES
 
     //! Proxy associated with the node
@@ -292,6 +360,62 @@ typedef       Pegasus::Core::Ref<Node> & NodeInOut;
 //! Reference to a Node, typically used as the return value of a function
 typedef       Pegasus::Core::Ref<Node>   NodeReturn;
 
+//----------------------------------------------------------------------------------------
+
+//! Scope of an evaluation pass over the graphs, such as the update of all the resources
+//! of a frame or the pull of the data of an output node.
+//! While a pass is open, Node::UpdateInPass() and Node::GetUpdatedDataInPass() run at most once per node,
+//! so subgraphs shared by several nodes (diamonds) are traversed once instead of once per path.
+//! \note Passes can be nested, the inner ones join the outermost one
+//! \warning To be opened and closed by the main thread
+class EvaluationPass
+{
+public:
+
+    //! Constructor, opens a pass if none is open
+    EvaluationPass();
+
+    //! Destructor, closes the pass if opened by this object
+    ~EvaluationPass();
+
+    //! Get the epoch of the open pass
+    //! \return Epoch of the pass, 0 when no pass is open
+    inline static unsigned int GetCurrentEpoch() { return sCurrentEpoch; }
+
+    //! Get the number of node visits of the last outermost pass
+    //! \return Number of calls to UpdateInPass() and GetUpdatedDataInPass()
+    static unsigned int GetVisitCount();
+
+    //! Get the number of node evaluations of the last outermost pass
+    //! \return Number of calls to UpdateInPass() and GetUpdatedDataInPass() that ran
+    //!         Update() or GetUpdatedData(), the other visits returned the result of the pass
+    static unsigned int GetEvaluationCount();
+
+    //! Count a visit of a node in the open pass, called by the nodes
+    //! \param evaluated True if the node has been evaluated, false if the result of the pass has been reused
+    static void CountVisit(bool evaluated);
+
+private:
+
+    // Passes are scopes
+    PG_DISABLE_COPY(EvaluationPass)
+
+    //! True if this object opened the pass
+    bool mIsOutermost;
+
+    //! Epoch of the open pass, 0 when no pass is open
+    static unsigned int sCurrentEpoch;
+
+    //! Epoch of the last opened pass
+    static unsigned int sLastEpoch;
+
+    //! Number of node visits of the last outermost pass
+    static volatile int sVisitCount;
+
+    //! Number of node evaluations of the last outermost pass
+    static volatile int sEvaluationCount;
+};
+
 
 }   // namespace Graph
 }   // namespace Pegasus
@@ -13,8 +13,15 @@
 #define PEGASUS_GRAPH_NODEDATA_H
 
 #include "Pegasus/Core/Ref.h"
+#include "Pegasus/Core/Atomic.h"
 #include "Pegasus/Graph/NodeGPUData.h"
 
+namespace Pegasus {
+namespace Utils {
+    class ByteStream;
+}
+}
+
 namespace Pegasus {
 namespace Graph {
 
@@ -67,6 +74,29 @@ public:
     //! \return External GPU data stored in the node data, can be nullptr if invalid or dirty
     inline const NodeGPUData * GetNodeGPUData () const { return mNodeGPUData; }
 
+    //! Copy the content of another node data of the same type and configuration,
+    //! used to store and restore data in the node data cache
+    //! \note Does not change the dirty flags, and does not copy the GPU data
+    //! \param source Node data to copy the content from
+    //! \return True if copied, false if the data type cannot be copied (the default), which prevents caching
+    virtual bool CopyContent(const NodeData & source) { return false; }
+
+    //! Get the size of the content of the node data, used for the memory budget of the node data cache
+    //! \return Size of the content in bytes, 0 if unknown
+    virtual unsigned int GetContentSize() const { return 0; }
+
+    //! Serialize the content of the node data, used to save the node data cache to disk
+    //! \param stream Stream receiving the content, in the native byte order
+    //! \return True if written, false if the data type cannot be serialized (the default, nothing is written)
+    virtual bool WriteContent(Utils::ByteStream & stream) const { return false; }
+
+    //! Restore the content written by WriteContent(), used to load the node data cache from disk
+    //! \note Does not change the dirty flags
+    //! \param buffer Serialized content
+    //! \param size Size of the serialized content in bytes
+    //! \return True if read, false if the data type cannot be serialized or if the content does not match the configuration
+    virtual bool ReadContent(const void * buffer, unsigned int size) { return false; }
+
     //------------------------------------------------------------------------------------
     
 protected:
@@ -84,7 +114,11 @@ private:
 
 
     //! Increment the reference counter, used by Ref<Node>
+#if PEGASUS_ENABLE_ATOMIC_REFCOUNT
+    inline void AddRef() { Core::AtomicIncrementRelaxed(&mRefCount); }
+#else
     inline void AddRef() { mRefCount++; }
+#endif
 
     //! Get the current reference counter
     //! \return Number of Ref<Node> objects pointing to the current object (>= 0)
@@ -101,8 +135,11 @@ private:
     Alloc::IAllocator * mAllocator;
 
     //! Reference counter
-    //! \todo Use atomic integer
+#if PEGASUS_ENABLE_ATOMIC_REFCOUNT
+    volatile int mRefCount;
+#else
     int mRefCount;
+#endif
 
     //! True when the data is dirty, meaning it will need to be recomputed to be valid
     bool mDirty;
@@ -0,0 +1,238 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataCache.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Content addressed cache of generated node data, shared by the graphs of a node manager
+
+#ifndef PEGASUS_GRAPH_NODEDATACACHE_H
+#define PEGASUS_GRAPH_NODEDATACACHE_H
+
+#include "Pegasus/Graph/NodeData.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Utils/HashMap.h"
+#include "Pegasus/Utils/Vector.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Cache of node data, indexed by the content key of the node that generated it
+//! (class of the node, values of its property grid, configuration and content keys of its inputs).
+//! A node about to regenerate its data first looks for the key in the cache,
+//! and copies the cached content instead of calling GenerateData() when found.
+//! That makes rebuilding identical graphs cheap, for example after a timeline script is recompiled.
+//! The cache keeps its own copies of the data, never attached to GPU data, and evicts
+//! the least recently used entries when the memory budget is exceeded.
+//! The cache can be saved to a pack file with Save() and loaded back with Load() on the next run,
+//! so expensive procedural data is not regenerated at startup. The entries of the file
+//! are read on demand, the first time their key is looked for.
+//! \note Thread safe, nodes generated on the worker pool use the cache concurrently
+class NodeDataCache
+{
+public:
+
+    //! Content key of a node, 0 for nodes whose data cannot be cached
+    typedef unsigned long long Key;
+
+    //! Default memory budget of the cached data in bytes
+    static const unsigned int DEFAULT_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+    //! Version of the cache file format, files of other versions are ignored.
+    //! To be increased each time the content keys or the serialized content of any node data change
+    static const unsigned int FILE_VERSION = 6;
+
+    //! Result of a lookup
+    enum FindResult
+    {
+        FIND_MISS,          //!< Key not found, the data has to be generated
+        FIND_MEMORY_HIT,    //!< Content copied from the data cached in memory
+        FIND_FILE_HIT       //!< Content read from the loaded cache file, not cached in memory yet
+    };
+
+    //! Constructor
+    //! \param alloc Allocator used for the internal tables
+    NodeDataCache(Alloc::IAllocator* alloc);
+
+    //! Destructor, releases the cached data
+    ~NodeDataCache();
+
+    //! Set the maximum size of the cached data, evicts entries if already larger
+    //! \param budget Memory budget in bytes, 0 to disable the cache
+    void SetMemoryBudget(unsigned int budget);
+
+    //! Get the maximum size of the cached data
+    //! \return Memory budget in bytes
+    inline unsigned int GetMemoryBudget() const { return mMemoryBudget; }
+
+    //! Copy the content of a cached entry into node data, and mark the entry as most recently used.
+    //! Falls back to the entries of the loaded cache file when the key is not cached in memory
+    //! \param key Content key of the node
+    //! \param data Node data receiving the cached content, of the same type and configuration as the cached data
+    //! \return FIND_MEMORY_HIT or FIND_FILE_HIT if the key was found and the content copied, counts a hit or a miss
+    FindResult Find(Key key, NodeData& data);
+
+    //! Test if data of a given size can be cached at all
+    //! \param size Size of the data in bytes
+    //! \return True if the size fits in the memory budget
+    bool CanStore(unsigned int size) const;
+
+    //! Add data to the cache, evicting the least recently used entries to stay in the budget
+    //! \param key Content key of the node that generated the data (!= 0)
+    //! \param data Copy of the generated data, owned by the cache from now on (not shared with any node)
+    //! \param size Size of the data in bytes, as returned by NodeData::GetContentSize()
+    //! \note Replaces the entry of a key already present
+    void Insert(Key key, NodeDataIn data, unsigned int size);
+
+    //! Release all the cached data, and the entries of the loaded cache file
+    //! \warning To be called while no graph is evaluated, like Load(), since the file entries are read without the lock
+    void Clear();
+
+    //! Load a cache file written by Save(), replacing the file entries loaded before
+    //! \param ioManager IO manager, the path is relative to its root
+    //! \param relativePath Path of the cache file
+    //! \return ERR_NONE on success, ERR_READING_FILE for a file of another version or a corrupted file
+    //! \warning To be called before any graph is evaluated, the file entries are read without the lock
+    Io::IoError Load(Io::IOManager* ioManager, const char* relativePath);
+
+    //! Save the entries cached in memory, from the most recently used, to a cache file.
+    //! The file entries that have not been used are kept, as long as the file stays in the memory budget
+    //! \param ioManager IO manager, the path is relative to its root
+    //! \param relativePath Path of the cache file
+    //! \return ERR_NONE on success, ERR_WRITING_FILE if the file cannot be written
+    //! \note The entries whose data type does not support NodeData::WriteContent() are skipped
+    Io::IoError Save(Io::IOManager* ioManager, const char* relativePath);
+
+
+    //! Get the number of lookups that found their key
+    inline unsigned int GetHitCount() const { return mHitCount; }
+
+    //! Get the number of lookups that found their key in the loaded cache file (included in GetHitCount())
+    inline unsigned int GetFileHitCount() const { return mFileHitCount; }
+
+    //! Get the number of lookups that did not find their key
+    inline unsigned int GetMissCount() const { return mMissCount; }
+
+    //! Get the number of entries removed to stay in the memory budget
+    inline unsigned int GetEvictionCount() const { return mEvictionCount; }
+
+    //! Get the number of cached entries
+    inline unsigned int GetEntryCount() const { return mEntryIndices.GetSize(); }
+
+    //! Get the number of entries of the loaded cache file
+    inline unsigned int GetFileEntryCount() const { return mFileEntries.GetSize(); }
+
+    //! Get the size of the cached data
+    //! \return Sum of the sizes of the cached entries in bytes
+    inline unsigned int GetMemorySize() const { return mMemorySize; }
+
+    //! Reset the hit, file hit, miss and eviction counters
+    void ResetStatistics();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The cache owns its entries
+    PG_DISABLE_COPY(NodeDataCache)
+
+    //! Cached data, linked in the order of use
+    struct Entry
+    {
+        Key mKey;                   //!< Content key of the node that generated the data
+        NodeDataRef mData;          //!< Copy of the generated data, null for free entries
+        unsigned int mSize;         //!< Size of the data in bytes
+        unsigned int mPrev;         //!< More recently used entry, INVALID_INDEX for the first one
+        unsigned int mNext;         //!< Less recently used entry (or next free entry), INVALID_INDEX for the last one
+    };
+
+    //! Invalid entry index, ends the lists
+    static const unsigned int INVALID_INDEX = 0xFFFFFFFF;
+
+    //! Header of the cache file, followed by the table of entries then by their content
+    //! \note Native byte order, the file is a local cache and is not meant to be shared between platforms
+    struct FileHeader
+    {
+        char mMagic[4];             //!< FILE_MAGIC
+        unsigned int mVersion;      //!< FILE_VERSION
+        unsigned int mEntryCount;   //!< Number of entries in the table
+        unsigned int mPadding;      //!< Keeps the table 8 bytes aligned
+    };
+
+    //! Entry of the cache file
+    struct FileEntry
+    {
+        Key mKey;                   //!< Content key of the node that generated the data
+        unsigned int mOffset;       //!< Offset of the serialized content from the start of the file
+        unsigned int mSize;         //!< Size of the serialized content in bytes
+    };
+
+    //! Remove an entry from the list of use
+    //! \param index Index of the entry in \a mEntries
+    void Unlink(unsigned int index);
+
+    //! Insert an entry at the front of the list of use, as most recently used
+    //! \param index Index of the entry in \a mEntries
+    void LinkFront(unsigned int index);
+
+    //! Release the data of an entry and put it in the free list
+    //! \param index Index of the entry in \a mEntries
+    void RemoveEntry(unsigned int index);
+
+    //! Remove the least recently used entries until the cached data fits in a size
+    //! \param size Maximum size of the cached data in bytes
+    void EvictUntil(unsigned int size);
+
+    //! Allocator of the internal tables and of the file buffers
+    Alloc::IAllocator* mAlloc;
+
+    //! Entries, used or free
+    Utils::Vector<Entry> mEntries;
+
+    //! Index in \a mEntries of the entry of each key
+    Utils::HashMap<Key, unsigned int> mEntryIndices;
+
+    //! Content of the loaded cache file, empty if none
+    Io::FileBuffer mFileBuffer;
+
+    //! Entries of the loaded cache file, pointing to \a mFileBuffer
+    Utils::HashMap<Key, FileEntry> mFileEntries;
+
+    //! Most recently used entry
+    unsigned int mFirstUsed;
+
+    //! Least recently used entry, first one to be evicted
+    unsigned int mLastUsed;
+
+    //! Number of Find() calls reading \a mFileBuffer outside the lock, checked by Clear() and Load()
+    unsigned int mFileReaderCount;
+
+    //! First free entry, the free entries are linked with \a Entry::mNext
+    unsigned int mFirstFree;
+
+    //! Maximum size of the cached data in bytes
+    unsigned int mMemoryBudget;
+
+    //! Size of the cached data in bytes
+    unsigned int mMemorySize;
+
+    //! Statistics
+    unsigned int mHitCount;
+    unsigned int mFileHitCount;
+    unsigned int mMissCount;
+    unsigned int mEvictionCount;
+
+    //! Lock protecting the tables and the statistics
+    Core::Mutex mMutex;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_NODEDATACACHE_H
@@ -13,6 +13,9 @@
 #define PEGASUS_GRAPH_NODEMANAGER_H
 
 #include "Pegasus/Graph/Node.h"
+#include "Pegasus/Graph/GraphScheduler.h"
+#include "Pegasus/Graph/NodeDataCache.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus {
 namespace Graph {
@@ -45,6 +48,14 @@ public:
     //! \return Reference to the created node, null reference if an error occurred
     NodeReturn CreateNode(const char * className);
 
+    //! Get the scheduler evaluating the graphs before their output nodes are pulled
+    //! \return Graph scheduler shared by all the output nodes
+    inline GraphScheduler* GetScheduler() { return &mScheduler; }
+
+    //! Get the cache of generated data, shared by all the nodes created by the manager
+    //! \return Node data cache, to change its memory budget or read its statistics
+    inline NodeDataCache* GetDataCache() { return &mDataCache; }
+
     //------------------------------------------------------------------------------------
     
 private:
@@ -86,6 +97,16 @@ private:
 
     //! Number of currently registered nodes (<= MAX_NUM_REGISTERED_NODES)
     unsigned int mNumRegisteredNodes;
+
+    //! Index in \a mRegisteredNodes of each registered class name, for constant time lookups.
+    //! The keys point to the class names stored in \a mRegisteredNodes
+    Utils::HashMap<const char *, unsigned int> mRegisteredNodeIndices;
+
+    //! Scheduler evaluating the graphs, shared by all the output nodes
+    GraphScheduler mScheduler;
+
+    //! Cache of generated data, outliving the graphs so rebuilt graphs do not regenerate identical data
+    NodeDataCache mDataCache;
 };
 
 
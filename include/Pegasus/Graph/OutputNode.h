@@ -83,6 +83,11 @@ protected:
     //! Destructor
     virtual ~OutputNode();
 
+    //! Regenerate the dirty nodes of the input graph with the scheduler of the node manager,
+    //! independent nodes being generated in parallel.
+    //! \note To call before GetUpdatedData() by the outputs pulling their data every frame,
+    //!       GetUpdatedData() then returns the data without generating anything
+    void EvaluateInputGraph();
 
     //! Allocate the data associated with the node
     //! \warning This function is overridden here to throw an assertion error.
@@ -13,6 +13,7 @@
 #define PEGASUS_MATH_AXISALIGNEDBOUNDINGBOX_H
 
 #include "Pegasus/Math/Plane.h"
+#include "Pegasus/Math/Matrix.h"
 //#include "SceneGraph/Actor/Camera.h"
 
 namespace Pegasus {
@@ -93,6 +94,11 @@ public:
     //! \param box The other axis-aligned bounding box
     void Union(const AxisAlignedBoundingBox & box);
 
+    //! Transform the bounding box by an affine matrix. The result contains the transformed box,
+    //! and is the exact transformed box for the scales and translations
+    //! \param mat The 4x4 affine transformation matrix
+    void Transform(Mat44In mat);
+
     //------------------------------------------------------------------------------------
 
 public:
@@ -112,6 +118,12 @@ public:
     //! \return true if the current box is strictly behind the plane
     bool IsBehind(const Plane & plane) const;
 
+    //! Is the transformed bounding box outside the clip space, i.e. are all its corners outside
+    //! the same plane of the clip space (-w <= x, y, z <= w) once transformed, typically to cull a mesh
+    //! \param mat Transformation matrix to the clip space, typically the world view projection matrix
+    //! \return true if the box is outside, false if it can be partially or fully visible
+    bool IsOutsideClipSpace(Mat44In mat) const;
+
     //! Is the current bounding box inside the given camera view region
     //! \param camera Camera that has to be used for testing
     //! \return true if current bounding box is partially of fully inside the
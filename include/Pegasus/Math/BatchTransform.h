@@ -0,0 +1,69 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BatchTransform.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Transformation of arrays of vectors by one matrix, and their bounds (SSE2 implementation when available)
+
+#ifndef PEGASUS_MATH_BATCHTRANSFORM_H
+#define PEGASUS_MATH_BATCHTRANSFORM_H
+
+#include "Pegasus/Math/Matrix.h"
+
+namespace Pegasus {
+namespace Math {
+
+
+// The vectors are read and written with byte strides, so they can be members of arrays of structures
+// (such as mesh vertices). The destination and the source are either the same vectors with the same
+// stride (in-place transformation) or do not overlap.
+// The results are the same as the ones of Mult44_41() and Mult33_31() called for each vector.
+
+//! Transform positions by a 4x4 matrix, dst[i] = mat * src[i]
+//! \param dst First transformed position
+//! \param dstStride Number of bytes between two transformed positions
+//! \param src First position to transform
+//! \param srcStride Number of bytes between two positions to transform
+//! \param count Number of positions
+//! \param mat The 4x4 matrix for the multiplications
+void TransformPositions(Vec4 * dst, unsigned int dstStride,
+                        const Vec4 * src, unsigned int srcStride,
+                        unsigned int count, Mat44In mat);
+
+//! Transform normals by a 3x3 matrix, dst[i] = mat * src[i], optionally normalized
+//! \param dst First transformed normal
+//! \param dstStride Number of bytes between two transformed normals
+//! \param src First normal to transform
+//! \param srcStride Number of bytes between two normals to transform
+//! \param count Number of normals
+//! \param mat The 3x3 matrix for the multiplications, typically the inverse transpose of the position matrix
+//! \param normalize True to normalize the transformed normals, the ones shorter than PFLOAT_EPSILON being kept as is
+void TransformNormals(Vec3 * dst, unsigned int dstStride,
+                      const Vec3 * src, unsigned int srcStride,
+                      unsigned int count, Mat33In mat, bool normalize);
+
+//! Compute the bounding box of positions, with a min/max reduction
+//! \param min Receives the minimum coordinates of the positions, (0, 0, 0) without position
+//! \param max Receives the maximum coordinates of the positions, (0, 0, 0) without position
+//! \param src First position, only xyz being read
+//! \param srcStride Number of bytes between two positions
+//! \param count Number of positions
+void ComputeBounds(Vec3 & min, Vec3 & max, const Vec3 * src, unsigned int srcStride, unsigned int count);
+
+//! Compute the largest squared distance between a point and positions, typically the squared radius of a bounding sphere
+//! \param center The point the distances are measured from
+//! \param src First position, only xyz being read
+//! \param srcStride Number of bytes between two positions
+//! \param count Number of positions
+//! \return The largest squared distance, 0 without position
+PFloat32 ComputeMaxSquaredDistance(Point3In center, const Vec3 * src, unsigned int srcStride, unsigned int count);
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MATH_BATCHTRANSFORM_H
@@ -13,6 +13,7 @@
 #define PEGASUS_MATH_BOUNDINGSPHERE_H
 
 #include "Pegasus/Math/Plane.h"
+#include "Pegasus/Math/Matrix.h"
 //#include "SceneGraph/Actor/Camera.h"
 
 namespace Pegasus {
@@ -29,7 +30,7 @@ public:
 
     //! Constructor
     //! \param center Center point of the sphere
-    //! \param radius Radius of the sphere (> 0.0f)
+    //! \param radius Radius of the sphere (>= 0.0f, 0.0f for a single point)
     BoundingSphere(Point3In center, PFloat32 radius);
 
     //! Copy constructor
@@ -43,9 +44,9 @@ public:
     inline void SetCenter(Point3In center) { mCenter = center; }
 
     //! Set the radius of the bounding sphere
-    //! \param radius Radius of the bounding sphere (> 0.0f)
+    //! \param radius Radius of the bounding sphere (>= 0.0f, 0.0f for a single point)
     inline void SetRadius(PFloat32 radius)
-        { PG_ASSERT(radius > 0.0f); mRadius = radius; }
+        { PG_ASSERT(radius >= 0.0f); mRadius = radius; }
 
     //------------------------------------------------------------------------------------
 
@@ -54,11 +55,22 @@ public:
     inline const Point3 & GetCenter() const { return mCenter; }
 
     //! Get the radius of the bounding sphere
-    //! \return Radius of the bounding sphere (> 0.0f)
+    //! \return Radius of the bounding sphere (>= 0.0f)
     inline PFloat32 GetRadius() const { return mRadius; }
 
     //------------------------------------------------------------------------------------
 
+    //! Union with another bounding sphere, the result being the smallest sphere containing both
+    //! \param sphere The other bounding sphere
+    void Union(const BoundingSphere & sphere);
+
+    //! Transform the bounding sphere by an affine matrix. The radius is scaled by the largest scale
+    //! of the matrix, so the result contains the transformed sphere, exactly without a non-uniform scale
+    //! \param mat The 4x4 affine transformation matrix
+    void Transform(Mat44In mat);
+
+    //------------------------------------------------------------------------------------
+
     //! Is the given point inside the bounding sphere
     //! \param point Point to test
     //! \return true if the point is inside the bounding sphere
@@ -111,7 +123,7 @@ private:
     //! Center point of the bounding sphere
     Point3 mCenter;
 
-    //! Radius of the bounding sphere (> 0.0f)
+    //! Radius of the bounding sphere (>= 0.0f)
     PFloat32 mRadius;
 };
 
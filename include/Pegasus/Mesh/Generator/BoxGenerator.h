@@ -48,6 +48,13 @@ public:
 
     virtual ~BoxGenerator();
 
+    //! Computes the exact vertex and index counts of a box, only the enabled faces being generated
+    //! \param faceEnableMask bit i set when face i is enabled
+    //! \param faceSubdivision number of quads per side of a face, clamped to 1
+    //! \param vertexCount receives the vertex count, (subdivision + 1)^2 per face
+    //! \param indexCount receives the index count, 6 * subdivision^2 per face
+    static void ComputeCounts(unsigned int faceEnableMask, int faceSubdivision, int& vertexCount, int& indexCount);
+
 protected:
 
     //! Generate the content of the data associated with the texture generator
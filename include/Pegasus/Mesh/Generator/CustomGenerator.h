@@ -40,6 +40,9 @@ protected:
 
     //! Generate the content of the data associated with the texture generator
     virtual void GenerateData();
+
+    //! The data is edited by user code, it cannot be identified by the content key
+    virtual bool IsDataCacheable() const { return false; }
 };
 }
 
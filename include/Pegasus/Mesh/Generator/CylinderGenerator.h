@@ -43,6 +43,14 @@ public:
 
     virtual ~CylinderGenerator();
 
+    //! Computes the exact vertex and index counts of a cylinder, made of two capped fans
+    //! and of ringCuts + 2 rings bound by quads
+    //! \param faceCount number of faces around the cylinder, clamped to 3
+    //! \param ringCuts number of rings between the caps, clamped to 0
+    //! \param vertexCount receives the vertex count
+    //! \param indexCount receives the index count
+    static void ComputeCounts(int faceCount, int ringCuts, int& vertexCount, int& indexCount);
+
 protected:
 
     //! Generate the content of the data associated with the texture generator
@@ -53,7 +61,7 @@ protected:
         int destinationOffset,
         float zVal,
         int faceCount,
-        unsigned short* indexBuffer,
+        unsigned int* indexBuffer,
         int& nextIndex,
         const Math::Vec2& uvOffset,
         const Math::Vec2& scale,
@@ -13,7 +13,7 @@
 #define PEGASUS_ICOSPHERE_GENERATOR_H
 
 #include "Pegasus/Mesh/MeshGenerator.h"
-#include "Pegasus/Utils/TesselationTable.h"
+#include "Pegasus/Utils/HashMap.h"
 
 namespace Pegasus
 {
@@ -41,22 +41,39 @@ public:
     
     virtual ~IcosphereGenerator();
 
+    //! Computes the exact vertex and index counts of an icosphere, each subdivision
+    //! splitting every triangle into 4 and adding one vertex per edge
+    //! \param degree the tesselation degree, 1 for the icosahedron
+    //! \param vertexCount receives the vertex count, 10 * 4^(degree - 1) + 2
+    //! \param indexCount receives the index count, 60 * 4^(degree - 1)
+    static void ComputeCounts(int degree, int& vertexCount, int& indexCount);
+
 protected:
 
     //! Generate the content of the data associated with the mesh generator
     virtual void GenerateData();
 
     //! generates the midpoint between two vertices (passed by index). Caches the index
-    //! and returns the cached one if is generated.
+    //! per edge and returns the cached one if is generated.
+    //! \param vertices the vertex stream, receiving the new vertex
+    //! \param vertexCount the number of vertices generated so far, incremented for a new vertex
     //! \param p1 the first parent
     //! \param p2 the second parent
     //! \return the new child index
-    unsigned short GenChild(MeshData * meshData, unsigned short p1, unsigned short p2);
-
-    //! recursive function that tesselates the icosphere
-    void Tesselate(MeshData * meshData, int level, unsigned short a, unsigned short b, unsigned short c);
-
-    Utils::TesselationTable mIdxCache;
+    unsigned int GenChild(StdVertex * vertices, unsigned int & vertexCount, unsigned int p1, unsigned int p2);
+
+    //! splits each triangle of a tesselation level into 4 triangles, all the triangles
+    //! of the level being processed in one batch
+    //! \param triangles the indices of the triangles of the level
+    //! \param triangleCount the number of triangles of the level
+    //! \param children receives the indices of the next level, the 4 children of triangle t starting at triangle 4t
+    //! \param vertices the vertex stream, receiving the midpoints
+    //! \param vertexCount the number of vertices generated so far, incremented for each midpoint
+    void Subdivide(const unsigned int * triangles, int triangleCount, unsigned int * children, StdVertex * vertices, unsigned int & vertexCount);
+
+    //! midpoint vertex of each edge of the level being subdivided, the key being
+    //! the smallest vertex index in the high 32 bits and the largest in the low 32 bits
+    Utils::HashMap<unsigned long long, unsigned int> mMidpoints;
        
 };
 
@@ -39,6 +39,24 @@ public:
         PRIMITIVE_COUNT
     };
 
+    //! the format of the indices of this mesh, once finalized
+    enum IndexFormat
+    {
+        INDEX_AUTO,     //!< 16-bit indices when the vertices fit, 32-bit indices otherwise
+        INDEX_16,       //!< always 16-bit indices, the mesh must have 65535 vertices or less
+        INDEX_32,       //!< always 32-bit indices
+        INDEX_FORMAT_COUNT
+    };
+
+    //! the format of the vertices of this mesh, once finalized
+    enum VertexFormat
+    {
+        VERTEX_STANDARD,    //!< vertices kept in the input layout
+        VERTEX_PACKED,      //!< StdVertex meshes packed into PackedVertex (16-bit positions, octahedral normals, half uvs),
+                            //!< requires shaders decoding the vertices (see PackedVertex)
+        VERTEX_FORMAT_COUNT
+    };
+
     //! Default constructor
     //! Creates a default mesh configuration. A default mesh configuration is empty and requires arguments inserted to it.
     MeshConfiguration();
@@ -71,6 +89,12 @@ public:
     //! Gets the primitive type for this mesh
     MeshPrim GetMeshPrimitiveType() const { return mPrimitiveType; }
 
+    //! Gets the format of the indices once the mesh is finalized
+    IndexFormat GetIndexFormat() const { return mIndexFormat; }
+
+    //! Gets the format of the vertices once the mesh is finalized
+    VertexFormat GetVertexFormat() const { return mVertexFormat; }
+
     //! Sets wether this mesh is indexed or not
     void    SetIsIndexed(bool isIndexed) { mIsIndexed = isIndexed; }
 
@@ -84,6 +108,14 @@ public:
     //! Sets the primitive type for this mesh
     void    SetMeshPrimitiveType(MeshPrim primitiveType) { mPrimitiveType = primitiveType; }
 
+    //! Sets the format of the indices once the mesh is finalized.
+    //! The indices are always built in 32-bit, then narrowed to 16-bit by MeshData::FinalizeIndexFormat()
+    void    SetIndexFormat(IndexFormat indexFormat) { mIndexFormat = indexFormat; }
+
+    //! Sets the format of the vertices once the mesh is finalized.
+    //! The vertices are always built in the input layout, then packed by MeshData::FinalizeVertexFormat()
+    void    SetVertexFormat(VertexFormat vertexFormat) { mVertexFormat = vertexFormat; }
+
     //! Compares this with another mesh configuration for equality
     bool operator==(const MeshConfiguration& other) const;
 
@@ -93,6 +125,11 @@ public:
         return !(*this == other);
     }
 
+    //! Adds the configuration to a content key, used by the node data cache
+    //! \param key the content key computed so far
+    //! \return the content key including the flags, the primitive type, the index and vertex formats and the input layout
+    unsigned long long Hash(unsigned long long key) const;
+
 private:
     //! boolean that determines if this mesh is indexed or not
     bool     mIsIndexed;
@@ -106,6 +143,12 @@ private:
     //! the primitive type
     MeshPrim mPrimitiveType;
 
+    //! the format of the indices once finalized
+    IndexFormat mIndexFormat;
+
+    //! the format of the vertices once finalized
+    VertexFormat mVertexFormat;
+
     //! the input layout
     MeshInputLayout mInputLayout;
     
@@ -17,10 +17,15 @@
 #include "Pegasus/Graph/Node.h"
 #include "Pegasus/Mesh/MeshConfiguration.h"
 #include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/AxisAlignedBoundingBox.h"
+#include "Pegasus/Math/BoundingSphere.h"
 
 namespace Pegasus {
 namespace Mesh {
 
+//! Maximum number of levels of detail stored in the indices of a mesh
+static const int MESH_MAX_LODS = 8;
+
 
 //Standard default vertex definition, for editor meshes.
 struct StdVertex {
@@ -29,6 +34,16 @@ struct StdVertex {
     Math::Vec2 uv; 
 };
 
+//! Packed version of StdVertex, for the meshes finalized with MeshConfiguration::VERTEX_PACKED.
+//! See MeshInputLayout::GeneratePackedEditorLayout() for the matching input layout. The vertex shaders decode
+//! the positions and the normals with RenderSystems/Mesh/PackedVertex.h, the scripts giving them the decode
+//! parameters with Mesh.GetPositionDecodeScale() and Mesh.GetPositionDecodeOffset()
+struct PackedVertex {
+    unsigned short position[4]; //!< xyz normalized over the bounding box of the mesh, w = 1 (see MeshData::GetPositionDecodeScale())
+    short          normal[2];   //!< octahedral encoding of the unit normal
+    unsigned short uv[2];       //!< half floats
+};
+
 //! Mesh node data, used by all mesh nodes, including generators and operators
 class MeshData : public Graph::NodeData
 {
@@ -63,11 +78,27 @@ public:
     //! \param streamId the target stream to set this vertex element to
     //! \return the new index
     template<class T>
-    unsigned short PushVertex(const T& vertex, int streamId);
+    unsigned int PushVertex(const T& vertex, int streamId);
+
+    //! Pushes (and does respective allocations) an array of vertex elements
+    //! \param vertices the vertex structures to push
+    //! \param count the number of vertices to push
+    //! \param streamId the target stream to set these vertex elements to
+    //! \return the index of the first new vertex
+    template<class T>
+    unsigned int PushVertexes(const T* vertices, int count, int streamId);
 
     //! Pushes (and does respective allocations) an index element
     //! \param index the index to push
-    void PushIndex(unsigned short index);
+    //! \note Widens the indices back to 32-bit if they have been narrowed by FinalizeIndexFormat()
+    void PushIndex(unsigned int index);
+
+    //! Pushes (and does respective allocations) an array of index elements
+    //! \param indices the indices to push
+    //! \param count the number of indices to push
+    //! \param vertexOffset value added to each index, typically the result of PushVertexes()
+    //! \note Widens the indices back to 32-bit if they have been narrowed by FinalizeIndexFormat()
+    void PushIndexes(const unsigned int* indices, int count, unsigned int vertexOffset);
 
     //! Gets the stride size count of the stream
     //! \param i the stream index
@@ -78,9 +109,112 @@ public:
     //! \return the byte size
     int GetStreamByteSize(int i) const { return mVertexStreams[i].GetByteSize(); }
 
-    //! Gets the index buffer reference
+    //! Gets the index buffer reference, to build the indices.
+    //! The indices are 32-bit until FinalizeIndexFormat() narrows them, use GetIndex() or GetIndexes() to read indices of any format
     //! \return  the index buffer pointer
-    unsigned short * GetIndexBuffer() { PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode."); return static_cast<unsigned short*>(mIndexBuffer.GetBuffer()); }
+    unsigned int * GetIndexBuffer()
+    {
+        PG_ASSERTSTR(mMode == Graph::Node::STANDARD, "Function only available in mesh STANDARD mode.");
+        PG_ASSERTSTR(mIndexBuffer.GetStride() == sizeof(unsigned int), "The indices have been narrowed to 16-bit, call AllocateIndexes() to rebuild them.");
+        return static_cast<unsigned int*>(mIndexBuffer.GetBuffer());
+    }
+
+    //! Gets the raw index buffer, in the format given by GetIndexStride(), typically to upload it to the GPU
+    //! \return  the index buffer pointer
+    const void * GetIndexData() const { return mIndexBuffer.GetBuffer(); }
+
+    //! Gets the byte size of one index
+    //! \return sizeof(unsigned short) for 16-bit indices, sizeof(unsigned int) for 32-bit indices
+    int GetIndexStride() const { return mIndexBuffer.GetStride(); }
+
+    //! Reads an index, whatever the format of the index buffer
+    //! \param i the position of the index in the buffer
+    //! \return the index
+    unsigned int GetIndex(int i) const;
+
+    //! Reads a range of indices in 32-bit, whatever the format of the index buffer
+    //! \param dest the buffer receiving count indices
+    //! \param first the position of the first index to read
+    //! \param count the number of indices to read
+    //! \param vertexOffset value added to each index, to append the indices to those of another mesh
+    void GetIndexes(unsigned int * dest, int first, int count, unsigned int vertexOffset) const;
+
+    //! Splits the indices into levels of detail stored one after the other and sharing the vertices,
+    //! the first level being the most detailed one. The levels are reset to a single one when the indices are
+    //! allocated or pushed, so the mesh operators set them again from the levels of their inputs
+    //! \param indexCounts the number of indices of each level, adding up to the index count
+    //! \param lodCount the number of levels, 1 to MESH_MAX_LODS
+    void SetLodIndexCounts(const int * indexCounts, int lodCount);
+
+    //! Gets the number of levels of detail
+    //! \return 1 unless SetLodIndexCounts() split the indices
+    int GetLodCount() const { return mLodCount; }
+
+    //! Gets the position of the first index of a level of detail
+    //! \param lod the level, 0 to GetLodCount() - 1
+    //! \return the position of the first index of the level in the index buffer
+    int GetLodIndexOffset(int lod) const;
+
+    //! Gets the number of indices of a level of detail
+    //! \param lod the level, 0 to GetLodCount() - 1
+    //! \return the number of indices of the level, the index count for a single level
+    int GetLodIndexCount(int lod) const;
+
+    //! Narrows the indices to 16-bit when the configuration allows it (INDEX_AUTO with 65535 vertices or less, or INDEX_16).
+    //! Called by the mesh generators and operators once their data is generated
+    void FinalizeIndexFormat();
+
+    //! Packs the StdVertex stream into PackedVertex when the configuration is VERTEX_PACKED
+    //! and the input layout is the full editor layout, printing the memory saved.
+    //! Called by the mesh generators and operators once their data is generated
+    void FinalizeVertexFormat();
+
+    //! Computes the bounding box and the bounding sphere of the positions with a min/max reduction,
+    //! unless SetBounds() already gave them. Called by the mesh generators and operators once their data is generated.
+    //! The bounds stay invalid for the meshes generated on the GPU and the ones without 32-bit float positions
+    void FinalizeBounds();
+
+    //! Sets the bounds of the positions computed by the caller, typically transformed analytically from the bounds
+    //! of an input mesh, so FinalizeBounds() does not read the vertices again.
+    //! The bounds are reset when the vertices are allocated or pushed
+    //! \param box the bounding box containing all the positions
+    //! \param sphere the bounding sphere containing all the positions
+    void SetBounds(const Math::AxisAlignedBoundingBox & box, const Math::BoundingSphere & sphere);
+
+    //! Gets whether the bounds match the vertices
+    //! \return true once FinalizeBounds() or SetBounds() has been called after the last change of the vertices
+    bool AreBoundsValid() const { return mAreBoundsValid; }
+
+    //! Gets the bounding box of the positions, typically to cull the mesh
+    //! \return the bounding box, valid once the data is finalized, of zero size for meshes without position
+    const Math::AxisAlignedBoundingBox & GetBoundingBox() const { return mBoundingBox; }
+
+    //! Gets the bounding sphere of the positions, typically to cull the mesh
+    //! \return the bounding sphere, valid once the data is finalized, of zero radius for meshes without position
+    const Math::BoundingSphere & GetBoundingSphere() const { return mBoundingSphere; }
+
+    //! Gets whether the vertices have been packed by FinalizeVertexFormat()
+    //! \return true for PackedVertex vertices, false for vertices in the input layout
+    bool IsPacked() const { return mIsPacked; }
+
+    //! Gets the input layout of the vertices as they are stored, typically to bind them on the GPU
+    //! \return the packed editor layout once packed, the input layout of the configuration otherwise
+    const MeshInputLayout & GetInputLayout() const;
+
+    //! Gets the scale decoding the packed positions, position = offset + scale * normalized position
+    //! \return the size of the bounding box of the mesh, valid once packed
+    const Math::Vec3 & GetPositionDecodeScale() const { return mPositionDecodeScale; }
+
+    //! Gets the offset decoding the packed positions, position = offset + scale * normalized position
+    //! \return the minimum corner of the bounding box of the mesh, valid once packed
+    const Math::Vec3 & GetPositionDecodeOffset() const { return mPositionDecodeOffset; }
+
+    //! Reads a range of vertices as StdVertex, unpacking them if needed.
+    //! Used by the mesh operators to read the vertices of their inputs, packed or not
+    //! \param dest the buffer receiving count vertices
+    //! \param first the position of the first vertex to read
+    //! \param count the number of vertices to read
+    void GetStdVertexes(StdVertex * dest, int first, int count) const;
 
     //! Gets the vertex count
     //! \return the count of vertex elements
@@ -90,16 +224,48 @@ public:
     //! \return the count of index buffers elements
     int GetIndexCount() const { return mIndexCount; }
 
-    //! Allocates vertex buffer elements.
+    //! Allocates vertex buffer elements, in the input layout
     //! \param count the number of vertices to allocate
     void AllocateVertexes(int count);
 
-    //! Allocates index buffer elements
+    //! Reserves memory for vertices without changing the vertex count, so the vertices
+    //! pushed afterwards do not reallocate the streams. Use it when the final count is known
+    //! \param count the total number of vertices to reserve, including those already pushed
+    void ReserveVertexes(int count);
+
+    //! Reserves memory for 32-bit indices without changing the index count, so the indices
+    //! pushed afterwards do not reallocate the index buffer. Use it when the final count is known
+    //! \param count the total number of indices to reserve, including those already pushed
+    void ReserveIndexes(int count);
+
+    //! Allocates index buffer elements, in 32-bit
     //! \param count the number of indices to allocate
     void AllocateIndexes(int count);
 
     //! Destroys all internal data and initializes this mesh data as completely new
     void Clear();
+
+    //! Copies the vertex streams and the indices of another mesh data with the same configuration
+    //! The formats of the indices and of the vertices are copied as well
+    //! \param source the mesh data to copy from
+    //! \return true if copied, false for meshes not in STANDARD mode or with different strides
+    virtual bool CopyContent(const Graph::NodeData & source);
+
+    //! Gets the size of the used part of the vertex streams and of the index buffer
+    //! \return the byte size
+    virtual unsigned int GetContentSize() const;
+
+    //! Writes the vertex and index counts, the index stride, the packing of the vertices with its decoding parameters,
+    //! the levels of detail and the bounds, then the used part of the vertex streams and of the index buffer
+    //! \param stream the stream receiving the content
+    //! \return true if written, false for meshes not in STANDARD mode
+    virtual bool WriteContent(Utils::ByteStream & stream) const;
+
+    //! Reads the content written by WriteContent()
+    //! \param buffer the serialized content
+    //! \param size the byte size of the serialized content
+    //! \return true if read, false if the content does not match the input layout
+    virtual bool ReadContent(const void * buffer, unsigned int size);
     
 protected:
 
@@ -119,7 +285,14 @@ private:
     //! \param vertex the vertex structure to push
     //! \param streamId the target stream to set this vertex element to
     //! \return the new index
-    unsigned short InternalPushVertex(const void * vertex, int streamId);
+    unsigned int InternalPushVertex(const void * vertex, int streamId);
+
+    //! Pushes (and does respective allocations) an array of vertex elements
+    //! \param vertices the vertex structures to push
+    //! \param count the number of vertices to push
+    //! \param streamId the target stream to set these vertex elements to
+    //! \return the index of the first new vertex
+    unsigned int InternalPushVertexes(const void * vertices, int count, int streamId);
 
     //! internally allocates vertices if necessary
     //! \param count new count of elements
@@ -133,6 +306,31 @@ private:
     //!        the new buffer
     void InternalAllocateIndexes(int count, bool preserveElements);
 
+    //! Gets the stride of the indices while building them: 32-bit for STANDARD meshes,
+    //! and the format of the configuration for COMPUTE meshes, written by shaders (16-bit unless INDEX_32)
+    int GetBuildIndexStride() const;
+
+    //! Sets the stride of the index buffer, destroying the indices if it changes
+    //! \param stride the new byte size of one index
+    void ResetIndexStride(int stride);
+
+    //! Converts the indices to another stride, preserving their values
+    //! \param stride the new byte size of one index
+    void ConvertIndexStride(int stride);
+
+    //! Gets whether the vertices can be packed, i.e. the input layout is the full editor layout
+    bool IsPackable() const;
+
+    //! Finds the position attribute read by FinalizeBounds(), the POSITION attribute of semantic index 0 in 32-bit floats
+    //! \param streamIndex receives the stream of the positions
+    //! \param byteOffset receives the offset of the positions in the vertices of the stream
+    //! \return true if found, false for meshes without such an attribute
+    bool FindPositionAttribute(int & streamIndex, int & byteOffset) const;
+
+    //! Sets the format of the first vertex stream, destroying the vertices if it changes
+    //! \param isPacked true for PackedVertex vertices, false for vertices in the input layout
+    void ResetVertexFormat(bool isPacked);
+
     //!helper class, encoding a stream buffer of bytes
     class Stream
     {
@@ -149,17 +347,30 @@ private:
         //! returns the actual buffer of this stream
         void* GetBuffer() { return mBuffer; }
 
+        //! returns the actual buffer of this stream (const version)
+        const void* GetBuffer() const { return mBuffer; }
+
         //! sets the stride of this stream
         void SetStride(int stride) { mStride = stride; }
 
+        //! exchanges the content of this stream with another one
+        void Swap(Stream& other);
+
         //! attempts to grow the stream. If the space is half as big then it is deallocated.
         //! if the requested size is different the stream size is grown. 
+        //! When preserving the elements, the stream never shrinks and at least doubles when it grows,
+        //! so pushing elements one by one does not copy the stream each time.
         //! \param  allocator the allocator for memory management
         //! \param  the vertex size to attempt to grow to. count * mStride is the total byte size
         //! \param  preserveElements  copy previous elements or allocate new ones if needed
         //! \note after calling Grow, the memory returned from GetBuffer is uninitialized.
         void Grow(Pegasus::Alloc::IAllocator * allocator, int count, bool preserveElements);
 
+        //! makes sure the stream can hold count elements, preserving the current ones
+        //! \param  allocator the allocator for memory management
+        //! \param  count the number of elements the stream has to be able to hold
+        void Reserve(Pegasus::Alloc::IAllocator * allocator, int count);
+
         //! Destroys whatever dynamic memory is inside this stream.
         //! call this before deleting the class. Failing to do so will cause an assert and a leak
         //! on the streams destructor
@@ -189,6 +400,30 @@ private:
     //! total count of indices
     int mIndexCount;
 
+    //! true once the vertices are packed into PackedVertex
+    bool mIsPacked;
+
+    //! scale decoding the packed positions
+    Math::Vec3 mPositionDecodeScale;
+
+    //! offset decoding the packed positions
+    Math::Vec3 mPositionDecodeOffset;
+
+    //! number of levels of detail, 1 when the indices are not split
+    int mLodCount;
+
+    //! position of the first index of each level of detail
+    int mLodIndexOffsets[MESH_MAX_LODS];
+
+    //! true once the bounds match the vertices
+    bool mAreBoundsValid;
+
+    //! bounding box of the positions
+    Math::AxisAlignedBoundingBox mBoundingBox;
+
+    //! bounding sphere of the positions
+    Math::BoundingSphere mBoundingSphere;
+
     // mode of mesh data.
     Graph::Node::Mode mMode;
 };
@@ -208,12 +443,19 @@ void * MeshData::GetStream(int stream)
 }
 
 template<class T>
-unsigned short MeshData::PushVertex(const T& vertex, int streamId)
+unsigned int MeshData::PushVertex(const T& vertex, int streamId)
 {
     PG_ASSERTSTR(sizeof(T) == mVertexStreams[streamId].GetStride(), "stream strides must match!");
     return InternalPushVertex(static_cast<const void *>(&vertex), streamId);
 }
 
+template<class T>
+unsigned int MeshData::PushVertexes(const T* vertices, int count, int streamId)
+{
+    PG_ASSERTSTR(sizeof(T) == mVertexStreams[streamId].GetStride(), "stream strides must match!");
+    return InternalPushVertexes(static_cast<const void *>(vertices), count, streamId);
+}
+
 //----------------------------------------------------------------------------------------
 
 //! Reference to a MeshData, typically used when declaring a variable of reference type
@@ -94,6 +94,16 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Narrow the indices of the data to 16-bit when the configuration and the vertex count allow it,
+    //! and pack the vertices when the configuration asks for it
+    //! \note Called by \a RegenerateData() after GenerateData()
+    virtual void FinalizeData();
+
+    //! Add the configuration of the generator to the content key of its data
+    //! \param key Content key computed so far
+    //! \return Content key including the configuration
+    virtual unsigned long long HashConfiguration(unsigned long long key) const { return mConfiguration.Hash(key); }
+
     //! Configuration of the generator
     MeshConfiguration mConfiguration;
 
@@ -95,6 +95,12 @@ public:
     //!        float4 for position, ushort3(normalized) for normals and float2 for UVs
     void GenerateEditorLayout(LayoutUsageBitMask mask);
 
+    //! Set layout to the packed version of the full editor layout, the layout of the meshes
+    //! finalized with MeshConfiguration::VERTEX_PACKED (see PackedVertex):
+    //! ushort4(normalized) for positions relative to the bounding box of the mesh,
+    //! short2(normalized) for octahedral normals and half2 for UVs
+    void GeneratePackedEditorLayout();
+
     //! Copy constructor
     //! \param other Other configuration to copy from
     explicit MeshInputLayout(const MeshInputLayout & other);
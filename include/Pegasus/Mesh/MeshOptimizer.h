@@ -0,0 +1,96 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshOptimizer.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Reordering of the triangles and vertices of meshes for the GPU caches, vertex welding and simplification
+
+#ifndef PEGASUS_MESH_MESHOPTIMIZER_H
+#define PEGASUS_MESH_MESHOPTIMIZER_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Mesh/MeshData.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Maximum size of the vertex cache modelled by the optimizer, in vertices
+static const int MESH_OPTIMIZER_MAX_CACHE_SIZE = 64;
+
+// The functions work on triangle lists of 32-bit indices, every index being smaller than the vertex count.
+
+//! Compute the average cache miss ratio (ACMR) of a triangle list, i.e. the number of vertices
+//! transformed per triangle, with a FIFO vertex cache. It ranges from 0.5 (ideal grid) to 3 (no reuse)
+//! \param indexes Indices of the triangle list
+//! \param indexCount Number of indices, multiple of 3
+//! \param vertexCount Number of vertices referenced by the indices
+//! \param cacheSize Number of entries of the simulated cache, 3 to MESH_OPTIMIZER_MAX_CACHE_SIZE
+//! \param allocator Allocator of the temporary buffers
+//! \return Number of cache misses per triangle, 0 for an empty list
+float ComputeACMR(const unsigned int * indexes, int indexCount, int vertexCount, int cacheSize, Alloc::IAllocator * allocator);
+
+//! Reorder the triangles of a triangle list for the post-transform vertex cache, using the greedy
+//! algorithm of Tom Forsyth (Linear-Speed Vertex Cache Optimisation). The triangles keep their winding
+//! \param dest Receives the reordered indices, indexCount elements, must not overlap indexes
+//! \param indexes Indices of the triangle list
+//! \param indexCount Number of indices, multiple of 3
+//! \param vertexCount Number of vertices referenced by the indices
+//! \param cacheSize Number of entries of the LRU cache used to score the vertices, 4 to MESH_OPTIMIZER_MAX_CACHE_SIZE
+//! \param allocator Allocator of the temporary buffers
+void OptimizeVertexCache(unsigned int * dest, const unsigned int * indexes, int indexCount, int vertexCount, int cacheSize, Alloc::IAllocator * allocator);
+
+//! Renumber the vertices in the order of their first use by a triangle list, for the locality of the vertex fetches.
+//! The vertices that are not referenced are moved after the used ones
+//! \param remap Receives the new position of each vertex, vertexCount elements
+//! \param indexes Indices of the triangle list, rewritten with the new vertex positions
+//! \param indexCount Number of indices
+//! \param vertexCount Number of vertices referenced by the indices
+//! \return Number of vertices referenced by the indices, which are the first ones after the remapping
+int OptimizeVertexFetch(unsigned int * remap, unsigned int * indexes, int indexCount, int vertexCount);
+
+//! Weld the vertices whose position, normal and uv are equal once quantized to a grid of the tolerances,
+//! using an open addressing hash table on the quantized attributes (linear time).
+//! Each group of welded vertices is represented by its first vertex, unchanged.
+//! \note Vertices closer than the tolerance but on both sides of a grid cell boundary are not welded
+//! \param remap Receives the index of the welded vertex of each vertex, vertexCount elements.
+//!              The welded vertices are numbered in the order of their first vertex
+//! \param vertices Vertices to weld
+//! \param vertexCount Number of vertices
+//! \param positionTolerance Size of the quantization grid of the positions, > 0
+//! \param normalTolerance Size of the quantization grid of the normals, > 0
+//! \param uvTolerance Size of the quantization grid of the uvs, > 0
+//! \param allocator Allocator of the hash table
+//! \return Number of welded vertices
+int WeldVertexes(unsigned int * remap, const StdVertex * vertices, int vertexCount,
+                 float positionTolerance, float normalTolerance, float uvTolerance, Alloc::IAllocator * allocator);
+
+//! Simplify a triangle list by collapsing edges into one of their vertices, in the order of the quadric error
+//! of Garland and Heckbert extended to the normals and uvs (Simplifying Surfaces with Color and Texture using Quadric Error Metrics).
+//! The vertices are not modified, only the indices, so the simplified lists of several levels of detail can share the vertices.
+//! The vertices on the borders of the mesh, including the seams where the vertices are duplicated with other attributes,
+//! are not collapsed, so weld the vertices first. The errors are measured on the positions normalized by the size of the mesh.
+//! \param dest Receives the simplified indices, indexCount elements at most, can be indexes
+//! \param indexes Indices of the triangle list
+//! \param indexCount Number of indices, multiple of 3
+//! \param vertices Vertices referenced by the indices
+//! \param vertexCount Number of vertices
+//! \param targetIndexCount Number of indices to reach, the simplification stopping before when the error becomes too large
+//! \param maxError Largest error allowed, relative to the size of the mesh (0.01 for 1%), 0 or less for no limit
+//! \param normalWeight Weight of the normals in the error, 0 to ignore them
+//! \param uvWeight Weight of the uvs in the error, 0 to ignore them
+//! \param resultError Receives the largest error of the collapsed edges, relative to the size of the mesh
+//! \param allocator Allocator of the temporary buffers
+//! \return Number of simplified indices
+int SimplifyMesh(unsigned int * dest, const unsigned int * indexes, int indexCount, const StdVertex * vertices, int vertexCount,
+                 int targetIndexCount, float maxError, float normalWeight, float uvWeight, float * resultError, Alloc::IAllocator * allocator);
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHOPTIMIZER_H
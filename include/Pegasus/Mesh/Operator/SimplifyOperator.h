@@ -0,0 +1,84 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimplifyOperator.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  SimplifyOperator
+
+#ifndef PEGASUS_SIMPLIFY_OPERATOR_H
+#define PEGASUS_SIMPLIFY_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh operator building levels of detail of its input with the quadric error simplification.
+//! The levels share the vertices of the input and are stored one after the other in the index buffer,
+//! level 0 being the input triangles, see MeshData::GetLodIndexOffset(). Each level has LodTriangleRatio times
+//! the triangles of the previous one, unless the error relative to the size of the mesh would exceed LodMaxError.
+//! Meant to follow a VertexWeldOperator. The following operators keep the levels, the levels of the input are replaced
+class SimplifyOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(SimplifyOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(SimplifyOperator, MeshOperator)
+        DECLARE_PROPERTY(int, LodCount, 4)
+        DECLARE_PROPERTY(float, LodTriangleRatio, 0.5f)
+        DECLARE_PROPERTY(float, LodMaxError, 0.01f)
+        DECLARE_PROPERTY(float, LodNormalWeight, 0.5f)
+        DECLARE_PROPERTY(float, LodUvWeight, 0.5f)
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! constructor
+    SimplifyOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                     Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~SimplifyOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+    //! Get the number of levels built at the last generation, can be below LodCount when the error bound is reached
+    int GetBuiltLodCount() const { return mLodCount; }
+
+    //! Get the number of triangles of a level, at the last generation
+    //! \param lod the level, 0 to GetBuiltLodCount() - 1
+    int GetLodTriangleCount(int lod) const { return (lod >= 0 && lod < mLodCount) ? mLodTriangleCounts[lod] : 0; }
+
+    //! Get the error of a level compared to the input mesh, relative to the size of the mesh, at the last generation
+    //! \param lod the level, 0 to GetBuiltLodCount() - 1
+    float GetLodError(int lod) const { return (lod >= 0 && lod < mLodCount) ? mLodErrors[lod] : 0.0f; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+private:
+
+    //! Number of levels of the output mesh
+    int mLodCount;
+
+    //! Number of triangles of each level
+    int mLodTriangleCounts[MESH_MAX_LODS];
+
+    //! Error of each level
+    float mLodErrors[MESH_MAX_LODS];
+};
+}
+
+}
+
+#endif//PEGASUS_SIMPLIFY_OPERATOR_H
@@ -0,0 +1,72 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VertexCacheOperator.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  VertexCacheOperator
+
+#ifndef PEGASUS_VERTEX_CACHE_OPERATOR_H
+#define PEGASUS_VERTEX_CACHE_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh operator reordering the triangles of its input for the post-transform vertex cache,
+//! then the vertices in their order of use for the vertex fetches. Meant to be the last operator of a mesh graph.
+//! Each level of detail is reordered on its own. The unused vertices are removed, the triangles and their winding are unchanged
+class VertexCacheOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(VertexCacheOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(VertexCacheOperator, MeshOperator)
+        DECLARE_PROPERTY(int, VertexCacheSize, 32)
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! constructor
+    VertexCacheOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                        Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~VertexCacheOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+    //! Get the average cache miss ratio of the input mesh, measured at the last generation
+    //! \return Vertices transformed per triangle with a FIFO cache of VertexCacheSize entries
+    float GetInputACMR() const { return mInputACMR; }
+
+    //! Get the average cache miss ratio of the output mesh, measured at the last generation
+    //! \return Vertices transformed per triangle with a FIFO cache of VertexCacheSize entries
+    float GetOutputACMR() const { return mOutputACMR; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+private:
+
+    //! Average cache miss ratio of the input mesh
+    float mInputACMR;
+
+    //! Average cache miss ratio of the output mesh
+    float mOutputACMR;
+};
+}
+
+}
+
+#endif//PEGASUS_VERTEX_CACHE_OPERATOR_H
@@ -0,0 +1,72 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VertexWeldOperator.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  VertexWeldOperator
+
+#ifndef PEGASUS_VERTEX_WELD_OPERATOR_H
+#define PEGASUS_VERTEX_WELD_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh operator merging the duplicate vertices of its input, the vertices being equal when their
+//! position, normal and uv quantized to the tolerances are equal. The indices are rebuilt,
+//! and the triangles collapsed by the welding are removed
+class VertexWeldOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(VertexWeldOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(VertexWeldOperator, MeshOperator)
+        DECLARE_PROPERTY(float, WeldPositionTolerance, 0.0001f)
+        DECLARE_PROPERTY(float, WeldNormalTolerance, 0.001f)
+        DECLARE_PROPERTY(float, WeldUvTolerance, 0.0001f)
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! constructor
+    VertexWeldOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                       Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~VertexWeldOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+    //! Get the number of vertices of the input mesh, at the last generation
+    int GetInputVertexCount() const { return mInputVertexCount; }
+
+    //! Get the number of vertices left after the welding, at the last generation
+    int GetOutputVertexCount() const { return mOutputVertexCount; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+private:
+
+    //! Number of vertices of the input mesh
+    int mInputVertexCount;
+
+    //! Number of vertices of the output mesh
+    int mOutputVertexCount;
+};
+}
+
+}
+
+#endif//PEGASUS_VERTEX_WELD_OPERATOR_H
@@ -304,6 +304,10 @@
 // See the implementation of the functions living in the Pegasus::Io namespace for more details
 #define PEGASUS_USE_NATIVE_IO_CALLS                     1
 
+// Map asset files in memory (copy-on-write) instead of reading them into an allocated buffer,
+// so loading does not copy the file content. Requires the native IO calls
+#define PEGASUS_USE_MAPPED_FILE_IO                      (PEGASUS_USE_NATIVE_IO_CALLS)
+
 //Enable events only if dev mode. In rel mode the boiler plate code gets removed
 //Events are used to communicate information to an editor app.
 #define PEGASUS_USE_EVENTS                        (PEGASUS_DEV)
@@ -313,9 +317,22 @@
 //Enable asset category tracking for editor purposes.
 #define PEGASUS_ASSETLIB_ENABLE_CATEGORIES (PEGASUS_DEV)
 
+//Load the child assets referenced by a structured asset on IO worker threads, ahead of their parsing.
+#define PEGASUS_ASSETLIB_ENABLE_PREFETCH 1
+
 //Enables error checkin on functions in blockscript that are called out of context
 #define PEGASUS_ENABLE_SCRIPT_PERMISSIONS (PEGASUS_DEV)
 
+// Use atomic operations for the reference counters (Core::RefCounted, Graph::NodeData),
+// so references to nodes and node data can be shared across worker threads.
+// Disable to get plain integer counters when the engine runs on a single thread
+#define PEGASUS_ENABLE_ATOMIC_REFCOUNT                  1
+
+// Generate the independent nodes of a graph in parallel on the worker pool (see Graph::GraphScheduler).
+// Requires the atomic reference counters. With the events, the generation events of the worker threads
+// are recorded and dispatched on the main thread, where the editor listeners expect them
+#define PEGASUS_GRAPH_PARALLEL_EVALUATION               (PEGASUS_ENABLE_ATOMIC_REFCOUNT)
+
 // Enable GPU data RunTime Type Information, for safe casting (asserts thrown if wrong type being casted)
 #define PEGASUS_GRAPH_GPUDATA_RTTI                      (PEGASUS_DEBUG)
 
@@ -330,6 +347,14 @@
 //! Enable size checks in the property grid accessors
 #define PEGASUS_ENABLE_PROPERTYGRID_SAFE_ACCESSOR       (PEGASUS_DEBUG)
 
+// Use SSE2 intrinsics in the CPU kernels (texture generation), a scalar path is used otherwise.
+// Always available on x64, and on x86 when compiling with /arch:SSE2 or -msse2
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(__SSE2__)
+#define PEGASUS_ENABLE_SSE2                             1
+#else
+#define PEGASUS_ENABLE_SSE2                             0
+#endif
+
 #if PEGASUS_FINAL
 #define PEGASUS_GPU_DEBUG 0
 #else
@@ -455,6 +455,12 @@ namespace Render
     //!                 -Mesh to be dispatched
     void Draw();
 
+    //! Draws a level of detail of the geometry, for the meshes storing several of them (see Mesh::MeshData::SetLodIndexCounts()).
+    //! \param lod - level to draw, 0 being the most detailed one. The last level of the mesh is drawn when it has fewer levels.
+    //! \note Requires: -Shader to be dispatched
+    //!                 -Mesh to be dispatched
+    void DrawLod(unsigned int lod);
+
     //! Draws geometry utilizing hardware instancing.
     //! \param instanceCount - instance count to use. If instance count is 0 this will be skipped.
     //! \note Requires: -Shader to be dispatched
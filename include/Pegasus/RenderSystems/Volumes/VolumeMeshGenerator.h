@@ -0,0 +1,90 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VolumeMeshGenerator.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  CPU marching cubes generator of the terrain volume meshes.
+
+#ifndef PEGASUS_VOLUME_MESH_GENERATOR_H
+#define PEGASUS_VOLUME_MESH_GENERATOR_H
+
+#include "Pegasus/RenderSystems/Config.h"
+#if RENDER_SYSTEM_CONFIG_ENABLE_VOLUMES
+
+#include "Pegasus/Mesh/MeshGenerator.h"
+#include "Pegasus/Math/Vector.h"
+
+namespace Pegasus
+{
+namespace RenderSystems
+{
+
+class CaseTable;
+
+//! Mesh generator polygonizing the terrain density of the volumes system on the CPU with the marching cubes,
+//! for the machines without compute shaders, the tools and the collision meshes.
+//! The density is evaluated over the grid with SIMD, then the cells are processed by slabs of planes
+//! on the worker threads. Each grid point owns the vertices of its 3 positive edges, so the vertices are
+//! shared by the neighbor cells without any lookup, and the mesh is indexed and watertight inside the grid
+class VolumeMeshGenerator : public Mesh::MeshGenerator
+{
+    DECLARE_MESH_GENERATOR_NODE(VolumeMeshGenerator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(VolumeMeshGenerator, MeshGenerator)
+        DECLARE_PROPERTY(int, GridSize, 64)
+        DECLARE_PROPERTY(float, CellSize, 1.0f)
+        DECLARE_PROPERTY(Math::Vec3, GridOffset, Math::Vec3(0.0f, 0.0f, 0.0f))
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! Maximum number of cells of the grid per dimension
+    static const int MAX_GRID_SIZE = 256;
+
+    //! Volume mesh generator constructor
+    //!\param nodeAllocator the allocator for the node properties (if any)
+    //!\param nodeDataAllocator the allocator of the node data
+    VolumeMeshGenerator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                        Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~VolumeMeshGenerator();
+
+    //! Evaluates the terrain density for a range of points of a grid row, density3d.cs on the GPU.
+    //! The points are inside the terrain when the density is above the iso level
+    //! \param densities receives the density of each point
+    //! \param count the number of points
+    //! \param x the x coordinate of the first point, the next ones being spaced by step
+    //! \param step the distance between the points
+    //! \param y the y coordinate of the points
+    //! \param z the z coordinate of the points
+    //! \param scale the factor applied to the densities
+    static void EvaluateDensityRow(float * densities, int count, float x, float step, float y, float z, float scale);
+
+    //! Polygonizes a density grid
+    //! \param meshData receives the vertices and the indices, the cross product of the triangle edges pointing inside
+    //! \param caseTable the triangles of the 256 cases of cells
+    //! \param densities the densities of the (gridSize + 3)^3 points, from -1 to gridSize + 1 in x, y then z,
+    //!                  the outer layer being only used for the normals
+    //! \param gridSize the number of cells per dimension
+    //! \param cellSize the size of the cells
+    //! \param gridOffset the position of the first grid point
+    //! \param allocator the allocator of the temporary buffers
+    static void Polygonize(Mesh::MeshData * meshData, const CaseTable * caseTable, const float * densities,
+                           int gridSize, float cellSize, const Math::Vec3 & gridOffset, Alloc::IAllocator * allocator);
+
+protected:
+
+    //! Generate the content of the data associated with the mesh generator
+    virtual void GenerateData();
+};
+
+}
+}
+
+#endif
+#endif
@@ -0,0 +1,50 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimplexNoiseGenerator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture generator that renders simplex noise
+
+#ifndef PEGASUS_TEXTURE_GENERATOR_SIMPLEXNOISEGENERATOR_H
+#define PEGASUS_TEXTURE_GENERATOR_SIMPLEXNOISEGENERATOR_H
+
+#include "Pegasus/Texture/TextureGenerator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture generator that renders simplex noise.
+//! Simplex gradient noise, smoother and cheaper than Perlin noise for the same frequency, summed over octaves as a fractal (fBm) when NumOctaves > 1.
+//! The same seed always gives the same texture
+class SimplexNoiseGenerator : public TextureGenerator
+{
+    DECLARE_TEXTURE_GENERATOR_NODE(SimplexNoiseGenerator)
+
+    BEGIN_DECLARE_PROPERTIES(SimplexNoiseGenerator, TextureGenerator)
+        DECLARE_PROPERTY(unsigned int, Seed, 123456789)
+        DECLARE_PROPERTY(float, Frequency, 8.0f)
+        DECLARE_PROPERTY(unsigned int, NumOctaves, 1)
+        DECLARE_PROPERTY(float, Lacunarity, 2.0f)
+        DECLARE_PROPERTY(float, Gain, 0.5f)
+        DECLARE_PROPERTY(Math::Color8RGBA, Color0, Math::Color8RGBA(0, 0, 0, 255))
+        DECLARE_PROPERTY(Math::Color8RGBA, Color1, Math::Color8RGBA(255, 255, 255, 255))
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture generator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_GENERATOR_SIMPLEXNOISEGENERATOR_H
@@ -0,0 +1,50 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WorleyNoiseGenerator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture generator that renders Worley (cellular) noise
+
+#ifndef PEGASUS_TEXTURE_GENERATOR_WORLEYNOISEGENERATOR_H
+#define PEGASUS_TEXTURE_GENERATOR_WORLEYNOISEGENERATOR_H
+
+#include "Pegasus/Texture/TextureGenerator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture generator that renders Worley (cellular) noise.
+//! Worley noise, the distance to the closest of randomly placed feature points (one per lattice cell), summed over octaves as a fractal (fBm) when NumOctaves > 1.
+//! The same seed always gives the same texture
+class WorleyNoiseGenerator : public TextureGenerator
+{
+    DECLARE_TEXTURE_GENERATOR_NODE(WorleyNoiseGenerator)
+
+    BEGIN_DECLARE_PROPERTIES(WorleyNoiseGenerator, TextureGenerator)
+        DECLARE_PROPERTY(unsigned int, Seed, 123456789)
+        DECLARE_PROPERTY(float, Frequency, 8.0f)
+        DECLARE_PROPERTY(unsigned int, NumOctaves, 1)
+        DECLARE_PROPERTY(float, Lacunarity, 2.0f)
+        DECLARE_PROPERTY(float, Gain, 0.5f)
+        DECLARE_PROPERTY(Math::Color8RGBA, Color0, Math::Color8RGBA(0, 0, 0, 255))
+        DECLARE_PROPERTY(Math::Color8RGBA, Color1, Math::Color8RGBA(255, 255, 255, 255))
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture generator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_GENERATOR_WORLEYNOISEGENERATOR_H
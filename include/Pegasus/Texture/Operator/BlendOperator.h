@@ -0,0 +1,80 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlendOperator.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Base class of the texture operators combining an arbitrary number of textures with a blend mode
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_BLENDOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_BLENDOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+#include "Pegasus/Texture/TextureKernels.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Base class of the texture operators combining an arbitrary number of textures with a blend mode,
+//! ((input0 op input1) op input2) and so on.
+//! The derived classes only give their mode, using DECLARE_TEXTURE_BLEND_OPERATOR_NODE()
+class BlendOperator : public TextureOperator
+{
+public:
+
+    //! Constructor, uses the default texture configuration
+    //! \param blendMode Operation combining the input textures
+    //! \param nodeAllocator Allocator used for node internal data (except the attached NodeData)
+    //! \param nodeDataAllocator Allocator used for NodeData
+    BlendOperator(BlendMode blendMode, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator);
+
+    //! Constructor
+    //! \param blendMode Operation combining the input textures
+    //! \param configuration Configuration of the operator, such as the resolution and pixel format
+    //! \param nodeAllocator Allocator used for node internal data (except the attached NodeData)
+    //! \param nodeDataAllocator Allocator used for NodeData
+    BlendOperator(BlendMode blendMode, const TextureConfiguration & configuration,
+                  Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator);
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return MAX_NUM_INPUTS
+    virtual unsigned int GetMaxNumInputNodes() const { return MAX_NUM_INPUTS; }
+
+    //! Get the operation combining the input textures
+    //! \return Blend mode of the operator
+    inline BlendMode GetBlendMode() const { return mBlendMode; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Destructor
+    virtual ~BlendOperator();
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // Nodes cannot be copied, only references to them
+    PG_DISABLE_COPY(BlendOperator)
+
+    //! Operation combining the input textures
+    const BlendMode mBlendMode;
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_BLENDOPERATOR_H
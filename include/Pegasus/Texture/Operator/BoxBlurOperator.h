@@ -0,0 +1,55 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BoxBlurOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that blurs a texture with a box filter
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_BOXBLUROPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_BOXBLUROPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that blurs a texture with a box filter on the CPU.
+//! The cost does not depend on the radius, several operators in a row approximate a Gaussian blur
+class BoxBlurOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(BoxBlurOperator)
+
+    BEGIN_DECLARE_PROPERTIES(BoxBlurOperator, TextureOperator)
+        DECLARE_PROPERTY(unsigned int, Radius, 4)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_BOXBLUROPERATOR_H
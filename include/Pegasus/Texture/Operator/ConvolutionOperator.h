@@ -0,0 +1,74 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ConvolutionOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that convolves a texture with a 3x3 or 5x5 kernel
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_CONVOLUTIONOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_CONVOLUTIONOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Kernels of ConvolutionOperator, values of its Kernel property
+enum ConvolutionKernel
+{
+    CONVOLUTION_CUSTOM_3X3,         //!< Kernel defined by the Row0 to Row2 properties
+    CONVOLUTION_SHARPEN_3X3,        //!< Sharpening, 5 times the center minus its 4 neighbors
+    CONVOLUTION_EDGES_3X3,          //!< Laplacian edge detection, a bias of 0.5 shows the negative edges
+    CONVOLUTION_EMBOSS_3X3,         //!< Emboss, lit from the top left
+    CONVOLUTION_GAUSSIAN_5X5,       //!< Binomial approximation of a Gaussian blur
+    CONVOLUTION_UNSHARP_5X5,        //!< Unsharp masking, twice the image minus its Gaussian blur
+
+    NUM_CONVOLUTION_KERNELS
+};
+
+//! Texture operator that convolves a texture with a 3x3 or 5x5 kernel on the CPU.
+//! The kernel is either one of the presets or the custom 3x3 kernel defined by Row0 to Row2.
+//! The result is Scale * (kernel * input) + Bias, clamped to [0, 1]
+class ConvolutionOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(ConvolutionOperator)
+
+    BEGIN_DECLARE_PROPERTIES(ConvolutionOperator, TextureOperator)
+        DECLARE_PROPERTY(unsigned int, Kernel, 0)
+        DECLARE_PROPERTY(Math::Vec3, Row0, Math::Vec3(0.0f, 0.0f, 0.0f))
+        DECLARE_PROPERTY(Math::Vec3, Row1, Math::Vec3(0.0f, 1.0f, 0.0f))
+        DECLARE_PROPERTY(Math::Vec3, Row2, Math::Vec3(0.0f, 0.0f, 0.0f))
+        DECLARE_PROPERTY(float, Scale, 1.0f)
+        DECLARE_PROPERTY(float, Bias, 0.0f)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_CONVOLUTIONOPERATOR_H
@@ -0,0 +1,55 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GaussianBlurOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that blurs a texture with a Gaussian filter
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_GAUSSIANBLUROPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_GAUSSIANBLUROPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that blurs a texture with a separable Gaussian filter on the CPU,
+//! so static post-processed textures are generated once at load time
+class GaussianBlurOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(GaussianBlurOperator)
+
+    BEGIN_DECLARE_PROPERTIES(GaussianBlurOperator, TextureOperator)
+        DECLARE_PROPERTY(float, Sigma, 2.0f)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_GAUSSIANBLUROPERATOR_H
@@ -0,0 +1,50 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LerpOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that interpolates between two textures using a mask texture
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_LERPOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_LERPOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that interpolates between two textures using a mask texture.
+//! Input 0 is used where the mask is 0, input 1 where the mask is 255, input 2 is the mask.
+//! Each component of the mask applies to the same component of the inputs
+class LerpOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(LerpOperator)
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 3 (the two textures to interpolate and the mask)
+    virtual unsigned int GetMinNumInputNodes() const { return 3; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 3
+    virtual unsigned int GetMaxNumInputNodes() const { return 3; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_LERPOPERATOR_H
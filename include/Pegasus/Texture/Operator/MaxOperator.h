@@ -0,0 +1,32 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MaxOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that keeps the maximum of an arbitrary number of textures
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_MAXOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_MAXOPERATOR_H
+
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that keeps the maximum of an arbitrary number of textures.
+//! Keep the maximum of the input textures, component per component
+class MaxOperator : public BlendOperator
+{
+    DECLARE_TEXTURE_BLEND_OPERATOR_NODE(MaxOperator, BLEND_MAX)
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_MAXOPERATOR_H
@@ -0,0 +1,32 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MinOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that keeps the minimum of an arbitrary number of textures
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_MINOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_MINOPERATOR_H
+
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that keeps the minimum of an arbitrary number of textures.
+//! Keep the minimum of the input textures, component per component
+class MinOperator : public BlendOperator
+{
+    DECLARE_TEXTURE_BLEND_OPERATOR_NODE(MinOperator, BLEND_MIN)
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_MINOPERATOR_H
@@ -0,0 +1,76 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MipChainOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that builds the mip chain of its input texture
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_MIPCHAINOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_MIPCHAINOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that builds the mip chain of its input texture.
+//! Level 0 is copied from the input, the other levels are filtered on the CPU.
+//! When the configuration of the operator has a single mip level, the full chain down to 1x1 is built
+class MipChainOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(MipChainOperator)
+
+    BEGIN_DECLARE_PROPERTIES(MipChainOperator, TextureOperator)
+        DECLARE_PROPERTY(bool, KaiserFilter, true)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Allocate the data associated with the operator, with the configuration of the mip chain
+    //! \return Pointer to the data being allocated
+    virtual Graph::NodeData * AllocateData() const;
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+
+    //! The mip levels are built by GenerateData() with the selected filter
+    virtual void FinalizeData() { }
+
+    //! Add the configuration of the mip chain to the content key of the data
+    //! \param key Content key computed so far
+    //! \return Content key including the configuration
+    virtual unsigned long long HashConfiguration(unsigned long long key) const;
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    //! Get the configuration of the data of the operator
+    //! \param configuration Receives the configuration of the operator, with the full mip chain when it has a single level
+    void GetMipChainConfiguration(TextureConfiguration & configuration) const;
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_MIPCHAINOPERATOR_H
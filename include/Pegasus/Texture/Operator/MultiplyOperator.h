@@ -0,0 +1,32 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MultiplyOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that multiplies an arbitrary number of textures together
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_MULTIPLYOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_MULTIPLYOPERATOR_H
+
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that multiplies an arbitrary number of textures together.
+//! Multiply the input textures, each component being normalized to [0, 1] (a * b / 255)
+class MultiplyOperator : public BlendOperator
+{
+    DECLARE_TEXTURE_BLEND_OPERATOR_NODE(MultiplyOperator, BLEND_MULTIPLY)
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_MULTIPLYOPERATOR_H
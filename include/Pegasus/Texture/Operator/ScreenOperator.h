@@ -0,0 +1,32 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ScreenOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that screens an arbitrary number of textures together
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_SCREENOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_SCREENOPERATOR_H
+
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that screens an arbitrary number of textures together.
+//! Screen the input textures, the inverse of the multiplication of the inverted inputs (brightens the image)
+class ScreenOperator : public BlendOperator
+{
+    DECLARE_TEXTURE_BLEND_OPERATOR_NODE(ScreenOperator, BLEND_SCREEN)
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_SCREENOPERATOR_H
@@ -0,0 +1,32 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SubtractOperator.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Texture operator that subtracts textures from the first input texture
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_SUBTRACTOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_SUBTRACTOPERATOR_H
+
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator that subtracts textures from the first input texture.
+//! Subtract the other input textures from the first one, clamping each component to 0
+class SubtractOperator : public BlendOperator
+{
+    DECLARE_TEXTURE_BLEND_OPERATOR_NODE(SubtractOperator, BLEND_SUBTRACT)
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_SUBTRACTOPERATOR_H
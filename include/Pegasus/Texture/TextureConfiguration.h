@@ -49,12 +49,14 @@ public:
     //! \param height Vertical resolution of the texture in pixels (>= 1)
     //! \param depth Depth of the texture in pixels (>= 1)
     //! \param numLayers Number of layers for array textures, 6 for cube maps, 1 otherwise
+    //! \param numMipLevels Number of mip levels, 0 for the full chain down to 1x1
     TextureConfiguration(Type type,
                          Core::Format pixelFormat,
                          unsigned int width,
                          unsigned int height,
                          unsigned int depth,
-                         unsigned int numLayers);
+                         unsigned int numLayers,
+                         unsigned int numMipLevels = 1);
 
     //! Copy constructor
     //! \param other Other configuration to copy from
@@ -89,16 +91,58 @@ public:
     //! \return Number of layers of the texture (>= 1)
     inline unsigned int GetNumLayers() const { return mNumLayers; }
 
+    //! Get the number of mip levels of each layer, level 0 being the full resolution
+    //! \return Number of mip levels of the texture (>= 1)
+    inline unsigned int GetNumMipLevels() const { return mNumMipLevels; }
+
+    //! Get the width of a mip level in pixels
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Horizontal resolution of the mip level in pixels (>= 1)
+    inline unsigned int GetMipWidth(unsigned int level) const { return ((mWidth >> level) > 1) ? (mWidth >> level) : 1; }
+
+    //! Get the height of a mip level in pixels
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Vertical resolution of the mip level in pixels (>= 1)
+    inline unsigned int GetMipHeight(unsigned int level) const { return ((mHeight >> level) > 1) ? (mHeight >> level) : 1; }
+
+    //! Get the depth of a mip level in pixels
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Depth of the mip level in pixels (>= 1)
+    inline unsigned int GetMipDepth(unsigned int level) const { return ((mDepth >> level) > 1) ? (mDepth >> level) : 1; }
+
+    //! Get the number of mip levels of a full chain, down to 1x1
+    //! \param width Horizontal resolution in pixels (>= 1)
+    //! \param height Vertical resolution in pixels (>= 1)
+    //! \param depth Depth in pixels (>= 1)
+    //! \return Number of mip levels (>= 1)
+    static unsigned int GetMaxNumMipLevels(unsigned int width, unsigned int height, unsigned int depth);
+
 
     //! Get the number of bytes per pixel of the texture, computed from the pixel format
     //! \return Number of bytes per pixel of the texture (>= 1)
     unsigned int GetNumBytesPerPixel() const;
 
-    //! Get the number of pixels per layer
+    //! Get the number of pixels of a mip level
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Number of pixels of one layer of the mip level (>= 1)
+    inline unsigned int GetNumPixelsPerMip(unsigned int level) const { return GetMipWidth(level) * GetMipHeight(level) * GetMipDepth(level); }
+
+    //! Get the number of bytes of a mip level
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Number of bytes of one layer of the mip level (>= 1)
+    inline unsigned int GetNumBytesPerMip(unsigned int level) const { return GetNumPixelsPerMip(level) * GetNumBytesPerPixel(); }
+
+    //! Get the offset of a mip level in the data of a layer.
+    //! The mip levels of a layer are stored contiguously, from level 0
+    //! \param level Index of the mip level (<= GetNumMipLevels())
+    //! \return Offset of the first pixel of the mip level from the start of the layer, in bytes
+    unsigned int GetMipOffset(unsigned int level) const;
+
+    //! Get the number of pixels per layer, including all the mip levels
     //! \return Number of pixels per layer (>= 1)
-    inline unsigned int GetNumPixelsPerLayer() const { return mWidth * mHeight * mDepth; }
+    inline unsigned int GetNumPixelsPerLayer() const { return GetMipOffset(mNumMipLevels) / GetNumBytesPerPixel(); }
 
-    //! Get the number of bytes of the texture for one layer,
+    //! Get the number of bytes of the texture for one layer, including all the mip levels,
     //! computed from the resolution and the pixel format
     //! \return Number of bytes of the texture for one layer (>= 1)
     inline unsigned int GetNumBytesPerLayer() const { return GetNumPixelsPerLayer() * GetNumBytesPerPixel(); }
@@ -108,12 +152,18 @@ public:
     inline unsigned int GetNumBytes() const { return mNumLayers * GetNumBytesPerLayer(); }
 
 
-    //! Test if an input texture configuration is considered as compatible with the current one
+    //! Test if an input texture configuration is considered as compatible with the current one.
+    //! The number of mip levels is ignored, the nodes combine level 0 and build their own mip levels
     //! \warning This is important to test when linking Texture, TextureGenerator and TextureOperator together
     //! \param configuration Configuration to test with
     //! \return True if the configurations are compatible
     bool IsCompatible(const TextureConfiguration & configuration) const;
 
+    //! Add the configuration to a content key, used by the node data cache
+    //! \param key Content key computed so far
+    //! \return Content key including the type, pixel format, resolution and number of mip levels
+    unsigned long long Hash(unsigned long long key) const;
+
 
 #if PEGASUS_ENABLE_PROXIES
 
@@ -153,6 +203,9 @@ private:
 
     // Number of layers for array textures, 6 for cube maps, 1 otherwise
     unsigned int mNumLayers;
+
+    //! Number of mip levels of each layer (>= 1)
+    unsigned int mNumMipLevels;
 };
 
 
@@ -50,6 +50,26 @@ public:
             return mImageData[layer];
         }
 
+    //! Copy the image data of another texture data with the same configuration
+    //! \param source Texture data to copy the layers from
+    //! \return True if copied, false if the configurations do not match
+    virtual bool CopyContent(const Graph::NodeData & source);
+
+    //! Get the size of the image data
+    //! \return Size of all the layers in bytes
+    virtual unsigned int GetContentSize() const { return mConfiguration.GetNumBytes(); }
+
+    //! Write the image data, the layers one after the other
+    //! \param stream Stream receiving the layers
+    //! \return True
+    virtual bool WriteContent(Utils::ByteStream & stream) const;
+
+    //! Read the image data written by WriteContent()
+    //! \param buffer Layers, one after the other
+    //! \param size Size of the buffer in bytes
+    //! \return True if the size matches the configuration
+    virtual bool ReadContent(const void * buffer, unsigned int size);
+
     //------------------------------------------------------------------------------------
     
 protected:
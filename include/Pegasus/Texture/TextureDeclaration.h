@@ -31,12 +31,53 @@
 
 //----------------------------------------------------------------------------------------
 
+//! Macro to use just after the braces when declaring a blend operator node class.
+//! It declares the constructors, giving the blend mode to Pegasus::Texture::BlendOperator,
+//! the destructor and the functions for the texture manager
+//! \warning The InitProperties() function must be implemented in the source file
+//! \param className Name of the class of the declared node
+//! \param blendMode Blend mode of the operator (BlendMode)
+#define DECLARE_TEXTURE_BLEND_OPERATOR_NODE(className, blendMode)                               \
+    DECLARE_TEXTURE_NODE_FUNCTIONS(className)                                                   \
+        className(Pegasus::Alloc::IAllocator* nodeAllocator,                                    \
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator)                                \
+        :   Pegasus::Texture::BlendOperator(blendMode, nodeAllocator, nodeDataAllocator)        \
+            { InitProperties(); }                                                               \
+                                                                                                \
+        className(const Pegasus::Texture::TextureConfiguration & configuration,                 \
+                  Pegasus::Alloc::IAllocator* nodeAllocator,                                    \
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator)                                \
+        :   Pegasus::Texture::BlendOperator(blendMode, configuration,                           \
+                                            nodeAllocator, nodeDataAllocator)                   \
+            { InitProperties(); }                                                               \
+                                                                                                \
+    DECLARE_TEXTURE_NODE_DESTRUCTOR(className)                                                  \
+
+//----------------------------------------------------------------------------------------
+
 //! Macro to declares the constructors, destructor and the functions for the texture manager
 //! of a texture node class
 //! \warning Do not use directly, it is used only for the macros above and the main texture class
 //! \param className Name of the class of the declared node
 //! \param baseClassName Name of the base class of the declared node
 #define DECLARE_TEXTURE_NODE(className, baseClassName)                                          \
+    DECLARE_TEXTURE_NODE_FUNCTIONS(className)                                                   \
+        className(Pegasus::Alloc::IAllocator* nodeAllocator,                                    \
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator)                                \
+        :   baseClassName(nodeAllocator, nodeDataAllocator) { InitProperties(); }               \
+                                                                                                \
+        className(const Pegasus::Texture::TextureConfiguration & configuration,                 \
+                  Pegasus::Alloc::IAllocator* nodeAllocator,                                    \
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator)                                \
+        :   baseClassName(configuration, nodeAllocator, nodeDataAllocator) { InitProperties(); }\
+                                                                                                \
+    DECLARE_TEXTURE_NODE_DESTRUCTOR(className)                                                  \
+
+//! Macro declaring the functions for the texture manager of a texture node class,
+//! followed by the constructors in the public section
+//! \warning Do not use directly, it is used only for the macros above
+//! \param className Name of the class of the declared node
+#define DECLARE_TEXTURE_NODE_FUNCTIONS(className)                                               \
     public:                                                                                     \
         inline static const char * GetClassName() { return #className; }                        \
                                                                                                 \
@@ -51,15 +92,11 @@
                                                                                                 \
         void InitProperties();                                                                  \
                                                                                                 \
-        className(Pegasus::Alloc::IAllocator* nodeAllocator,                                    \
-                  Pegasus::Alloc::IAllocator* nodeDataAllocator)                                \
-        :   baseClassName(nodeAllocator, nodeDataAllocator) { InitProperties(); }               \
-                                                                                                \
-        className(const Pegasus::Texture::TextureConfiguration & configuration,                 \
-                  Pegasus::Alloc::IAllocator* nodeAllocator,                                    \
-                  Pegasus::Alloc::IAllocator* nodeDataAllocator)                                \
-        :   baseClassName(configuration, nodeAllocator, nodeDataAllocator) { InitProperties(); }\
-                                                                                                \
+
+//! Macro declaring the destructor of a texture node class, after its constructors
+//! \warning Do not use directly, it is used only for the macros above
+//! \param className Name of the class of the declared node
+#define DECLARE_TEXTURE_NODE_DESTRUCTOR(className)                                              \
     protected:                                                                                  \
         virtual ~className() { }                                                                \
                                                                                                 \
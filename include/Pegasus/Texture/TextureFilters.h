@@ -0,0 +1,60 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureFilters.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU image filters (blurs and convolutions) shared by the texture operators
+
+#ifndef PEGASUS_TEXTURE_TEXTUREFILTERS_H
+#define PEGASUS_TEXTURE_TEXTUREFILTERS_H
+
+#include "Pegasus/Texture/TextureData.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Maximum radius of the blurs, in pixels
+static const unsigned int FILTER_MAX_RADIUS = 32;
+
+//! Maximum size of the convolution kernels, in pixels
+static const unsigned int FILTER_MAX_KERNEL_SIZE = 5;
+
+// The filters apply to level 0 of each layer of RGBA8 textures. The slices of 3D textures
+// are filtered independently, and the pixels outside of the texture are clamped to the edges.
+// The output and the input must have the same resolution and number of layers, and must be different textures.
+// The SSE2 and scalar paths give the same bytes
+
+//! Blur a texture with a separable Gaussian filter, one horizontal and one vertical pass on the worker pool
+//! \param output Texture receiving the blurred image
+//! \param input Texture to blur
+//! \param sigma Standard deviation of the Gaussian in pixels, the radius of the filter being 3 sigma
+//!              (up to FILTER_MAX_RADIUS), the input is copied when sigma is too small to blur
+//! \param allocator Allocator of the intermediate image
+void GaussianBlurTexture(TextureData * output, const TextureData * input, float sigma, Alloc::IAllocator * allocator);
+
+//! Blur a texture with a box filter of (2 * radius + 1)^2 pixels, one horizontal and one vertical pass on the worker pool.
+//! The passes keep running sums, so the cost per pixel does not depend on the radius
+//! \param output Texture receiving the blurred image
+//! \param input Texture to blur
+//! \param radius Radius of the box in pixels (<= FILTER_MAX_RADIUS), the input is copied when 0
+//! \param allocator Allocator of the intermediate image
+void BoxBlurTexture(TextureData * output, const TextureData * input, unsigned int radius, Alloc::IAllocator * allocator);
+
+//! Convolve a texture with a square kernel on the worker pool: output = sum(kernel * input) + bias, clamped to [0, 1]
+//! \param output Texture receiving the convolved image
+//! \param input Texture to convolve
+//! \param kernel Weights of the kernel, size * size floats, row by row, the center weight applying to the output pixel
+//! \param size Width and height of the kernel, 3 or 5
+//! \param bias Value added to each component, 1 being the maximum intensity
+void ConvolveTexture(TextureData * output, const TextureData * input, const float * kernel, unsigned int size, float bias);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_TEXTUREFILTERS_H
@@ -102,6 +102,16 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Build the mip levels of the data from level 0 with a box filter,
+    //! when the configuration has more than one mip level
+    //! \note Called by \a RegenerateData() after GenerateData()
+    virtual void FinalizeData();
+
+    //! Add the configuration of the generator to the content key of its data
+    //! \param key Content key computed so far
+    //! \return Content key including the configuration
+    virtual unsigned long long HashConfiguration(unsigned long long key) const { return mConfiguration.Hash(key); }
+
     //------------------------------------------------------------------------------------
 
 private:
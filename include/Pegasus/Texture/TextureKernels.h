@@ -0,0 +1,96 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureKernels.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU kernels shared by the texture generators and operators
+
+#ifndef PEGASUS_TEXTURE_TEXTUREKERNELS_H
+#define PEGASUS_TEXTURE_TEXTUREKERNELS_H
+
+#include "Pegasus/Texture/TextureConfiguration.h"
+#include "Pegasus/Texture/TextureData.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Minimum number of bytes written by a task of ParallelForRows(),
+//! smaller textures are processed on the calling thread
+static const unsigned int KERNEL_MIN_BYTES_PER_TASK = 64 * 1024;
+
+//! Function processing a range of rows of one layer of a texture
+//! \param userData Pointer given to ParallelForRows()
+//! \param layer Index of the layer
+//! \param beginRow First row to process, the rows of a 3D texture are indexed by (z * height + y)
+//! \param endRow Row after the last one to process
+typedef void (*RowKernelFunc)(void * userData, unsigned int layer, unsigned int beginRow, unsigned int endRow);
+
+//! Run a kernel over all the rows of all the layers of a texture, split across the worker pool.
+//! Each row is processed exactly once, so a kernel writing only the rows it is given is race free
+//! \param configuration Configuration of the texture
+//! \param func Kernel to run, can be called concurrently on distinct ranges
+//! \param userData Pointer given to the kernel
+void ParallelForRows(const TextureConfiguration & configuration, RowKernelFunc func, void * userData);
+
+//! Fill pixels with a 32-bit value
+//! \param destination First pixel to fill
+//! \param value Value of the pixels, in memory order (Math::Color8RGBA::rgba32)
+//! \param numPixels Number of pixels to fill
+//! \note The pixels are stored as 32-bit integers, Math::PUInt32 is wider on LP64 platforms
+void FillPixels32(unsigned char * destination, unsigned int value, unsigned int numPixels);
+
+//! Operation combining two textures component per component, a being the current value and b the new one.
+//! The results are exact, the SSE2 and scalar paths give the same bytes
+enum BlendMode
+{
+    BLEND_ADD,              //!< a + b, wrapping around
+    BLEND_ADD_SATURATE,     //!< min(a + b, 255)
+    BLEND_SUBTRACT,         //!< max(a - b, 0)
+    BLEND_MULTIPLY,         //!< a * b / 255, rounded to the nearest
+    BLEND_SCREEN,           //!< 255 - (255 - a) * (255 - b) / 255, rounded to the nearest
+    BLEND_MIN,              //!< min(a, b)
+    BLEND_MAX,              //!< max(a, b)
+
+    NUM_BLEND_MODES
+};
+
+//! Combine bytes with other bytes, component per component
+//! \param destination Bytes a, receiving the results
+//! \param source Bytes b
+//! \param numBytes Number of bytes to combine
+//! \param mode Operation to apply
+void BlendBytes(unsigned char * destination, const unsigned char * source, unsigned int numBytes, BlendMode mode);
+
+//! Interpolate bytes towards other bytes, component per component:
+//! (a * (255 - mask) + b * mask) / 255, rounded to the nearest
+//! \param destination Bytes a, receiving the results
+//! \param source Bytes b
+//! \param mask Interpolation factors, 0 keeps a and 255 gives b
+//! \param numBytes Number of bytes to interpolate
+void LerpBytes(unsigned char * destination, const unsigned char * source, const unsigned char * mask, unsigned int numBytes);
+
+//! Combine textures of the same configuration, ((input0 op input1) op input2) op ...,
+//! on the worker pool. Each chunk of rows is combined with all the inputs while in the cache
+//! \param output Texture receiving the result
+//! \param inputs Textures to combine, with at least one texture, can include the output texture
+//! \param numInputs Number of textures to combine
+//! \param mode Operation to apply
+void BlendTextures(TextureData * output, const TextureData * const * inputs, unsigned int numInputs, BlendMode mode);
+
+//! Interpolate between two textures with a mask texture, all of the same configuration, on the worker pool
+//! \param output Texture receiving the result
+//! \param input0 Texture used where the mask is 0
+//! \param input1 Texture used where the mask is 255
+//! \param mask Interpolation factors, each component of the mask applies to the same component of the inputs
+void LerpTextures(TextureData * output, const TextureData * input0, const TextureData * input1, const TextureData * mask);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_TEXTUREKERNELS_H
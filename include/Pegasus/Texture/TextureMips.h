@@ -0,0 +1,42 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureMips.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU generation of the mip levels of textures
+
+#ifndef PEGASUS_TEXTURE_TEXTUREMIPS_H
+#define PEGASUS_TEXTURE_TEXTUREMIPS_H
+
+#include "Pegasus/Texture/TextureData.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Filter used to reduce a mip level into the next one
+enum MipFilter
+{
+    MIP_FILTER_BOX,         //!< Average of the 2x2 (2x2x2 for 3D textures) source pixels, the fastest
+    MIP_FILTER_KAISER,      //!< Kaiser-windowed sinc over 6 source pixels per axis, sharper and with less aliasing
+
+    NUM_MIP_FILTERS
+};
+
+//! Build the mip levels 1 and above of all the layers of a texture from its level 0, on the worker pool.
+//! Each level is computed from the previous one, the rows of a level being split across the workers.
+//! The axes of size 1 are not filtered, and the source pixels outside of the level are clamped to the edges.
+//! The box filter of 2D RGBA8 textures uses an exact SSE2 path, giving the same bytes as the scalar path
+//! \param data Texture whose level 0 is up-to-date, does nothing when its configuration has only one level
+//! \param filter Filter reducing each level into the next one
+void GenerateMipChain(TextureData * data, MipFilter filter);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_TEXTUREMIPS_H
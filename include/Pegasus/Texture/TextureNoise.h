@@ -0,0 +1,63 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureNoise.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  CPU procedural noise kernels shared by the noise texture generators
+
+#ifndef PEGASUS_TEXTURE_TEXTURENOISE_H
+#define PEGASUS_TEXTURE_TEXTURENOISE_H
+
+#include "Pegasus/Texture/TextureConfiguration.h"
+#include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Math/Color.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Maximum number of octaves summed by GenerateNoise()
+static const unsigned int NOISE_MAX_NUM_OCTAVES = 16;
+
+//! Basis function of the noise
+enum NoiseType
+{
+    NOISE_PERLIN,       //!< Improved Perlin gradient noise on a cubic lattice
+    NOISE_SIMPLEX,      //!< Simplex gradient noise, fewer corners per sample than Perlin noise
+    NOISE_WORLEY,       //!< Cellular noise, distance to the closest feature point (F1)
+
+    NUM_NOISE_TYPES
+};
+
+//! Parameters of a noise texture
+struct NoiseParameters
+{
+    NoiseType mType;                    //!< Basis function
+    unsigned int mSeed;                 //!< Seed of the lattice hash, the same seed always gives the same texture
+    float mFrequency;                   //!< Number of lattice cells across the texture for the first octave
+    unsigned int mNumOctaves;           //!< Number of octaves of the fractal sum (fBm), 1 for the basis function alone
+    float mLacunarity;                  //!< Frequency multiplier between two octaves
+    float mGain;                        //!< Amplitude multiplier between two octaves
+    Math::Color8RGBA mColor0;           //!< Color of the lowest noise values
+    Math::Color8RGBA mColor1;           //!< Color of the highest noise values
+};
+
+//! Render noise into a texture on the worker pool, as a fractal sum of octaves
+//! of the basis function normalized to [0, 1], mapped from color0 to color1.
+//! Each layer uses a different seed, and the Z coordinate of 3D textures goes through the noise volume.
+//! The SSE2 path evaluates 4 pixels at once with the same operations as the scalar path,
+//! so the result only depends on the parameters and the configuration
+//! \param data Texture receiving the noise, with 4 bytes per pixel
+//! \param configuration Configuration of the texture
+//! \param parameters Parameters of the noise
+void GenerateNoise(TextureData * data, const TextureConfiguration & configuration, const NoiseParameters & parameters);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_TEXTURENOISE_H
@@ -119,7 +119,7 @@ protected:
 
     //! Allocate the data associated with the texture operator
     //! \warning Do not override in derived classes since all operators
-    //!          use the same texture data class
+    //!          use the same texture data class, except to change its configuration (MipChainOperator)
     //! \warning Do not update mData internally, just return the pointer to the data
     //! \note Called by CreateData()
     //! \return Pointer to the data being allocated
@@ -131,6 +131,22 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Build the mip levels of the data from level 0 with a box filter,
+    //! when the configuration has more than one mip level
+    //! \note Called by \a RegenerateData() after GenerateData()
+    virtual void FinalizeData();
+
+    //! Get the up-to-date data of all the input nodes, before running a kernel reading them
+    //! \param inputData Array receiving the data of the input nodes, in the order of the inputs
+    //! \return Number of input nodes
+    //! \note The input nodes keep a reference to their data, so the pointers stay valid during GenerateData()
+    unsigned int GetUpdatedInputData(const TextureData * inputData[MAX_NUM_INPUTS]);
+
+    //! Add the configuration of the operator to the content key of its data
+    //! \param key Content key computed so far
+    //! \return Content key including the configuration
+    virtual unsigned long long HashConfiguration(unsigned long long key) const { return mConfiguration.Hash(key); }
+
     //------------------------------------------------------------------------------------
 
 private:
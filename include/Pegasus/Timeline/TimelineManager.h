@@ -15,6 +15,7 @@
 #include "Pegasus/Timeline/Shared/TimelineDefs.h"
 #include "Pegasus/Timeline/Proxy/TimelineManagerProxy.h"
 #include "Pegasus/Utils/Vector.h"
+#include "Pegasus/Utils/HashMap.h"
 #include "Pegasus/Timeline/Timeline.h"
 #include "Pegasus/Timeline/TimelineScript.h"
 #include "Pegasus/AssetLib/AssetRuntimeFactory.h"
@@ -281,6 +282,10 @@ private:
     //! Number of currently registered blocks (<= MAX_NUM_REGISTERED_BLOCKS)
     unsigned int mNumRegisteredBlocks;
 
+    //! Index in \a mRegisteredBlocks of each registered class name, for constant time lookups.
+    //! The keys point to the class names stored in \a mRegisteredBlocks
+    Utils::HashMap<const char *, unsigned int> mRegisteredBlockIndices;
+
     //! TODO: temporary timeline singleton
     TimelineRef mCurrentTimeline;
 
@@ -0,0 +1,28 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CoreTests.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Core package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_CORE_TESTS_H
+#define PEGASUS_CORE_TESTS_H
+
+bool UNIT_TEST_WorkerPool1();
+
+bool UNIT_TEST_WorkerPool2();
+
+bool UNIT_TEST_AsyncLoader1();
+
+bool UNIT_TEST_AsyncLoader2();
+
+bool UNIT_TEST_AsyncLoader3();
+
+#endif
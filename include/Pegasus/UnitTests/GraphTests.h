@@ -0,0 +1,36 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphTests.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Graph package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_GRAPH_TESTS_H
+#define PEGASUS_GRAPH_TESTS_H
+
+bool UNIT_TEST_GraphScheduler1();
+
+bool UNIT_TEST_GraphScheduler2();
+
+bool UNIT_TEST_EvaluationPass1();
+
+bool UNIT_TEST_NodeDataCache1();
+
+bool UNIT_TEST_NodeDataCache2();
+
+bool UNIT_TEST_NodeDataCache3();
+
+bool UNIT_TEST_NodeDataCache4();
+
+bool UNIT_TEST_NodeDataCache5();
+
+bool UNIT_TEST_NodeDataCache6();
+
+#endif
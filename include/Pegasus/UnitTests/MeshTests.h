@@ -0,0 +1,40 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshTests.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Mesh package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_MESH_TESTS_H
+#define PEGASUS_MESH_TESTS_H
+
+bool UNIT_TEST_MeshData1();
+
+bool UNIT_TEST_MeshData2();
+
+bool UNIT_TEST_MeshData3();
+
+bool UNIT_TEST_MeshData4();
+
+bool UNIT_TEST_MeshData5();
+
+bool UNIT_TEST_MeshData6();
+
+bool UNIT_TEST_MeshData7();
+
+bool UNIT_TEST_MeshData8();
+
+bool UNIT_TEST_MeshOptimizer1();
+
+bool UNIT_TEST_MeshOptimizer2();
+
+bool UNIT_TEST_MeshOptimizer3();
+
+#endif
@@ -0,0 +1,30 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TestFiles.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Location of the files written by the unit tests
+
+#ifndef PEGASUS_TEST_FILES_H
+#define PEGASUS_TEST_FILES_H
+
+#include "Pegasus/Core/Io.h"
+
+//! Get the temporary directory of the system, where the unit tests write their files
+//! \param path Buffer of Io::IOManager::MAX_FILEPATH_LENGTH characters receiving the directory,
+//!             ending with a separator so it can be used as the root of an IO manager
+void GetTestFileDirectory(char * path);
+
+//! Write a file in the temporary directory of the tests
+//! \param ioManager IO manager whose root is the directory given by GetTestFileDirectory()
+//! \param relativePath Name of the file
+//! \param content Content of the file
+//! \param size Size of the content in bytes
+//! \return True if written
+bool WriteTestFile(Pegasus::Io::IOManager * ioManager, const char * relativePath, const void * content, unsigned int size);
+
+#endif
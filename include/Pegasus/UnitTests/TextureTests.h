@@ -0,0 +1,36 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureTests.h
+//! \author Pegasus Team
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the Texture package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_TEXTURE_TESTS_H
+#define PEGASUS_TEXTURE_TESTS_H
+
+bool UNIT_TEST_TextureKernels1();
+
+bool UNIT_TEST_TextureKernels2();
+
+bool UNIT_TEST_TextureKernels3();
+
+bool UNIT_TEST_TextureKernels4();
+
+bool UNIT_TEST_TextureData1();
+
+bool UNIT_TEST_PixelsGenerator1();
+
+bool UNIT_TEST_PerlinNoiseGenerator1();
+
+bool UNIT_TEST_SimplexNoiseGenerator1();
+
+bool UNIT_TEST_WorleyNoiseGenerator1();
+
+#endif
@@ -97,6 +97,14 @@ bool UNIT_TEST_Vector1();
 
 bool UNIT_TEST_Vector2();
 
+bool UNIT_TEST_Vector3();
+
+bool UNIT_TEST_Vector4();
+
+bool UNIT_TEST_Vector5();
+
+bool UNIT_TEST_Vector6();
+
 bool UNIT_TEST_ByteStream1();
 
 bool UNIT_TEST_ByteStream2();
@@ -105,4 +113,20 @@ bool UNIT_TEST_ByteStream3();
 
 bool UNIT_TEST_HashStr();
 
+bool UNIT_TEST_HashFnv1a();
+
+bool UNIT_TEST_HashMap1();
+
+bool UNIT_TEST_HashMap2();
+
+bool UNIT_TEST_HashMap3();
+
+bool UNIT_TEST_HashMap4();
+
+bool UNIT_TEST_Random1();
+
+bool UNIT_TEST_Random2();
+
+bool UNIT_TEST_Random3();
+
 #endif
@@ -0,0 +1,102 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Hash.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Hashing functions for strings, memory blocks and integers.
+//!         String hashes are FNV-1a (32 bits), also available at compile time
+//!         so literals can be hashed with no runtime cost.
+
+#ifndef PEGASUS_UTILS_HASH_H
+#define PEGASUS_UTILS_HASH_H
+
+namespace Pegasus
+{
+namespace Utils
+{
+    //! FNV-1a 32 bits offset basis
+    const unsigned int FNV1A_OFFSET_BASIS = 2166136261u;
+
+    //! FNV-1a 32 bits prime
+    const unsigned int FNV1A_PRIME = 16777619u;
+
+    //! FNV-1a 64 bits offset basis
+    const unsigned long long FNV1A64_OFFSET_BASIS = 14695981039346656037ull;
+
+    //! FNV-1a 64 bits prime
+    const unsigned long long FNV1A64_PRIME = 1099511628211ull;
+
+    //! Compile time FNV-1a hash of a null terminated string.
+    //! Produces the same value as HashFnv1a(const char*), so a literal hashed at compile time
+    //! can be compared against a string hashed at runtime
+    //! \param str the string to hash
+    //! \param hash the hash of the characters before str (leave the default value)
+    //! \return the hash of the string
+    constexpr unsigned int HashFnv1aConst(const char * str, unsigned int hash = FNV1A_OFFSET_BASIS)
+    {
+        return (*str == '\0') ? hash : HashFnv1aConst(str + 1, (hash ^ static_cast<unsigned char>(*str)) * FNV1A_PRIME);
+    }
+
+    //! FNV-1a hash of a null terminated string
+    //! \param str the string to hash, cannot be null
+    //! \return the hash of the string
+    unsigned int HashFnv1a(const char * str);
+
+    //! FNV-1a hash of a memory block
+    //! \param data pointer to the first byte to hash
+    //! \param size number of bytes to hash
+    //! \param hash hash to continue from, to combine several blocks (leave the default value to start a new hash)
+    //! \return the hash of the block
+    unsigned int HashFnv1a(const void * data, unsigned int size, unsigned int hash = FNV1A_OFFSET_BASIS);
+
+    //! FNV-1a 64 bits hash of a memory block, for keys identifying content
+    //! where 32 bits collisions would not be acceptable
+    //! \param data pointer to the first byte to hash
+    //! \param size number of bytes to hash
+    //! \param hash hash to continue from, to combine several blocks (leave the default value to start a new hash)
+    //! \return the hash of the block
+    unsigned long long HashFnv1a64(const void * data, unsigned int size, unsigned long long hash = FNV1A64_OFFSET_BASIS);
+
+    //! Mixes the bits of an integer, so close integers produce well distributed hashes
+    //! (MurmurHash3 finalizer)
+    //! \param value the integer to hash
+    //! \return the hash of the integer
+    inline unsigned int HashUInt32(unsigned int value)
+    {
+        value ^= value >> 16;
+        value *= 0x85ebca6bu;
+        value ^= value >> 13;
+        value *= 0xc2b2ae35u;
+        value ^= value >> 16;
+        return value;
+    }
+
+    //! Mixes the bits of a 64 bits integer into a 32 bits hash
+    //! \param value the integer to hash
+    //! \return the hash of the integer
+    inline unsigned int HashUInt64(unsigned long long value)
+    {
+        value ^= value >> 33;
+        value *= 0xff51afd7ed558ccdull;
+        value ^= value >> 33;
+        value *= 0xc4ceb9fe1a85ec53ull;
+        value ^= value >> 33;
+        return static_cast<unsigned int>(value);
+    }
+
+    //! Combines a hash with another one, to hash structures field by field
+    //! \param seed the hash accumulated so far
+    //! \param hash the hash to add
+    //! \return the combined hash
+    inline unsigned int HashCombine(unsigned int seed, unsigned int hash)
+    {
+        return seed ^ (hash + 0x9e3779b9u + (seed << 6) + (seed >> 2));
+    }
+}
+}
+
+#endif  // PEGASUS_UTILS_HASH_H
@@ -0,0 +1,354 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   HashMap.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Open addressing hash map (linear probing), for O(1) lookups by key.
+//!         Hashes are stored in their own array, so probing touches a compact block of
+//!         memory and keys are only compared when the full hashes match.
+
+#ifndef PEGASUS_UTILS_HASHMAP_H
+#define PEGASUS_UTILS_HASHMAP_H
+
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Utils/Hash.h"
+#include "Pegasus/Utils/String.h"
+
+namespace Pegasus
+{
+
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace Utils
+{
+
+//! Hashing and comparison of the keys of a HashMap.
+//! The default implementation is for integer and enum keys
+template<class K>
+struct HashMapKeyTraits
+{
+    static unsigned int Hash(const K& key) { return HashUInt64(static_cast<unsigned long long>(key)); }
+    static bool Equal(const K& a, const K& b) { return a == b; }
+};
+
+//! Pointer keys are hashed by address
+template<class T>
+struct HashMapKeyTraits<T*>
+{
+    static unsigned int Hash(T* key) { return HashUInt64(reinterpret_cast<unsigned long long>(key)); }
+    static bool Equal(T* a, T* b) { return a == b; }
+};
+
+//! String keys are hashed and compared by content.
+//! \warning The map does not copy the strings, they have to outlive their entries
+template<>
+struct HashMapKeyTraits<const char*>
+{
+    static unsigned int Hash(const char* key) { return HashFnv1a(key); }
+    static bool Equal(const char* a, const char* b) { return a == b || Strcmp(a, b) == 0; }
+};
+
+//! Open addressing hash map.
+//! \param K type of the keys, see HashMapKeyTraits
+//! \param V type of the values
+//! \param Traits hashing and comparison functions of the keys
+//! \warning Pointers to values are invalidated when an insertion grows the table or when
+//!          an element is removed
+template<class K, class V, class Traits = HashMapKeyTraits<K> >
+class HashMap
+{
+public:
+    //! Constructor
+    explicit HashMap(Alloc::IAllocator* alloc)
+    :   mHashes(nullptr), mEntries(nullptr), mSlotCount(0), mSize(0), mAlloc(alloc) {}
+
+    HashMap()
+    :   mHashes(nullptr), mEntries(nullptr), mSlotCount(0), mSize(0), mAlloc(Memory::GetGlobalAllocator()) {}
+
+    //! Destructor
+    ~HashMap()
+    {
+        Clear();
+    }
+
+    //! \return number of elements in the map
+    inline unsigned int GetSize() const { return mSize; }
+
+    //! \return number of slots of the table, to iterate with IsSlotUsed()
+    inline unsigned int GetSlotCount() const { return mSlotCount; }
+
+    //! \return true if the slot contains an element
+    inline bool IsSlotUsed(unsigned int slot) const { PG_ASSERT(slot < mSlotCount); return mHashes[slot] != EMPTY_HASH; }
+
+    //! \return the key stored in a used slot
+    inline const K& GetSlotKey(unsigned int slot) const { PG_ASSERT(IsSlotUsed(slot)); return mEntries[slot].mKey; }
+
+    //! \return the value stored in a used slot
+    inline V& GetSlotValue(unsigned int slot) { PG_ASSERT(IsSlotUsed(slot)); return mEntries[slot].mValue; }
+
+    //! \return the value stored in a used slot
+    inline const V& GetSlotValue(unsigned int slot) const { PG_ASSERT(IsSlotUsed(slot)); return mEntries[slot].mValue; }
+
+    //! Makes sure the map can hold count elements without growing
+    //! \param count the minimum number of elements to hold
+    void Reserve(unsigned int count)
+    {
+        unsigned int slotCount = mSlotCount > 0 ? mSlotCount : MIN_SLOT_COUNT;
+        while (!FitsLoadFactor(count, slotCount))
+        {
+            slotCount <<= 1;
+        }
+        if (slotCount > mSlotCount)
+        {
+            Rehash(slotCount);
+        }
+    }
+
+    //! Inserts an element, or replaces the value if the key is already present
+    //! \param key the key of the element
+    //! \param value the value to store
+    //! \return the stored value
+    V& Insert(const K& key, const V& value)
+    {
+        const unsigned int hash = ComputeHash(key);
+        const unsigned int existing = FindSlot(key, hash);
+        if (existing != INVALID_SLOT)
+        {
+            mEntries[existing].mValue = value;
+            return mEntries[existing].mValue;
+        }
+
+        if (!FitsLoadFactor(mSize + 1, mSlotCount))
+        {
+            Rehash(mSlotCount > 0 ? (mSlotCount << 1) : MIN_SLOT_COUNT);
+        }
+
+        const unsigned int slot = FindEmptySlot(hash);
+        mHashes[slot] = hash;
+        new (mEntries + slot) Entry(key, value);
+        ++mSize;
+        return mEntries[slot].mValue;
+    }
+
+    //! Finds the value of a key
+    //! \param key the key to look for
+    //! \return pointer to the value, null if the key is not in the map
+    V* Find(const K& key)
+    {
+        const unsigned int slot = FindSlot(key, ComputeHash(key));
+        return slot != INVALID_SLOT ? &mEntries[slot].mValue : nullptr;
+    }
+
+    //! Finds the value of a key
+    //! \param key the key to look for
+    //! \return pointer to the value, null if the key is not in the map
+    const V* Find(const K& key) const
+    {
+        const unsigned int slot = FindSlot(key, ComputeHash(key));
+        return slot != INVALID_SLOT ? &mEntries[slot].mValue : nullptr;
+    }
+
+    //! \return true if the key is in the map
+    bool Contains(const K& key) const
+    {
+        return FindSlot(key, ComputeHash(key)) != INVALID_SLOT;
+    }
+
+    //! Removes an element
+    //! \param key the key of the element to remove
+    //! \return true if the element was found and removed
+    bool Remove(const K& key)
+    {
+        unsigned int slot = FindSlot(key, ComputeHash(key));
+        if (slot == INVALID_SLOT)
+        {
+            return false;
+        }
+
+        // Backward shift deletion (Knuth's algorithm R): move back the following elements
+        // of the cluster whose probe sequence crosses the hole, so no tombstone is needed
+        mEntries[slot].~Entry();
+        const unsigned int mask = mSlotCount - 1;
+        for (unsigned int next = (slot + 1) & mask; mHashes[next] != EMPTY_HASH; next = (next + 1) & mask)
+        {
+            // Distances from the home slot of the element, to the hole and to its current slot
+            const unsigned int home = mHashes[next] & mask;
+            if (((slot - home) & mask) < ((next - home) & mask))
+            {
+                new (mEntries + slot) Entry(static_cast<Entry&&>(mEntries[next]));
+                mEntries[next].~Entry();
+                mHashes[slot] = mHashes[next];
+                slot = next;
+            }
+        }
+        mHashes[slot] = EMPTY_HASH;
+        --mSize;
+        return true;
+    }
+
+    //! Removes all the elements and keeps the memory, for maps refilled repeatedly
+    void Reset()
+    {
+        for (unsigned int slot = 0; slot < mSlotCount; ++slot)
+        {
+            if (mHashes[slot] != EMPTY_HASH)
+            {
+                mEntries[slot].~Entry();
+                mHashes[slot] = EMPTY_HASH;
+            }
+        }
+        mSize = 0;
+    }
+
+    //! Removes all the elements and frees the memory
+    void Clear()
+    {
+        for (unsigned int slot = 0; slot < mSlotCount; ++slot)
+        {
+            if (mHashes[slot] != EMPTY_HASH)
+            {
+                mEntries[slot].~Entry();
+            }
+        }
+        if (mHashes != nullptr)
+        {
+            PG_DELETE_ARRAY(mAlloc, mHashes);
+            PG_DELETE_ARRAY(mAlloc, reinterpret_cast<char*>(mEntries));
+        }
+        mHashes = nullptr;
+        mEntries = nullptr;
+        mSlotCount = 0;
+        mSize = 0;
+    }
+
+private:
+
+    // Hash maps are containers of unique ownership
+    PG_DISABLE_COPY(HashMap)
+
+    //! Element of the table
+    struct Entry
+    {
+        Entry(const K& key, const V& value) : mKey(key), mValue(value) {}
+        K mKey;
+        V mValue;
+    };
+
+    //! Hash value marking an empty slot, never returned by ComputeHash()
+    static const unsigned int EMPTY_HASH = 0;
+
+    //! Slot index returned when a key is not found
+    static const unsigned int INVALID_SLOT = 0xFFFFFFFF;
+
+    //! Number of slots allocated for the first insertion (power of 2)
+    static const unsigned int MIN_SLOT_COUNT = 16;
+
+    //! \return the hash of a key, never EMPTY_HASH
+    static unsigned int ComputeHash(const K& key)
+    {
+        const unsigned int hash = Traits::Hash(key);
+        return hash != EMPTY_HASH ? hash : 1;
+    }
+
+    //! \return true if count elements fit in slotCount slots with a load factor <= 3/4
+    static bool FitsLoadFactor(unsigned int count, unsigned int slotCount)
+    {
+        return count * 4 <= slotCount * 3;
+    }
+
+    //! Finds the slot of a key
+    //! \return the slot index, INVALID_SLOT if the key is not in the map
+    unsigned int FindSlot(const K& key, unsigned int hash) const
+    {
+        if (mSize == 0)
+        {
+            return INVALID_SLOT;
+        }
+        const unsigned int mask = mSlotCount - 1;
+        for (unsigned int slot = hash & mask; mHashes[slot] != EMPTY_HASH; slot = (slot + 1) & mask)
+        {
+            if (mHashes[slot] == hash && Traits::Equal(mEntries[slot].mKey, key))
+            {
+                return slot;
+            }
+        }
+        return INVALID_SLOT;
+    }
+
+    //! \return the first empty slot in the probe sequence of a hash
+    unsigned int FindEmptySlot(unsigned int hash) const
+    {
+        const unsigned int mask = mSlotCount - 1;
+        unsigned int slot = hash & mask;
+        while (mHashes[slot] != EMPTY_HASH)
+        {
+            slot = (slot + 1) & mask;
+        }
+        return slot;
+    }
+
+    //! Moves all the elements into a table of a new size
+    //! \param newSlotCount new number of slots, power of 2
+    void Rehash(unsigned int newSlotCount)
+    {
+        PG_ASSERTSTR((newSlotCount & (newSlotCount - 1)) == 0, "The number of slots of a hash map must be a power of 2");
+        unsigned int* oldHashes = mHashes;
+        Entry* oldEntries = mEntries;
+        const unsigned int oldSlotCount = mSlotCount;
+
+        mHashes = PG_NEW_ARRAY(mAlloc, -1, "HashMap Hashes", Alloc::PG_MEM_PERM, unsigned int, newSlotCount);
+        mEntries = reinterpret_cast<Entry*>(PG_NEW_ARRAY(mAlloc, -1, "HashMap Entries", Alloc::PG_MEM_PERM, char, newSlotCount * sizeof(Entry)));
+        mSlotCount = newSlotCount;
+        for (unsigned int slot = 0; slot < newSlotCount; ++slot)
+        {
+            mHashes[slot] = EMPTY_HASH;
+        }
+
+        for (unsigned int oldSlot = 0; oldSlot < oldSlotCount; ++oldSlot)
+        {
+            if (oldHashes[oldSlot] != EMPTY_HASH)
+            {
+                const unsigned int slot = FindEmptySlot(oldHashes[oldSlot]);
+                mHashes[slot] = oldHashes[oldSlot];
+                new (mEntries + slot) Entry(static_cast<Entry&&>(oldEntries[oldSlot]));
+                oldEntries[oldSlot].~Entry();
+            }
+        }
+
+        if (oldHashes != nullptr)
+        {
+            PG_DELETE_ARRAY(mAlloc, oldHashes);
+            PG_DELETE_ARRAY(mAlloc, reinterpret_cast<char*>(oldEntries));
+        }
+    }
+
+    //! hash of each slot, EMPTY_HASH for an empty slot
+    unsigned int* mHashes;
+
+    //! key and value of each slot, constructed only for used slots
+    Entry* mEntries;
+
+    //! number of slots of the table (power of 2, or 0 before the first insertion)
+    unsigned int mSlotCount;
+
+    //! number of elements in the map
+    unsigned int mSize;
+
+    //! the allocator
+    Alloc::IAllocator* mAlloc;
+};
+
+
+}
+}
+
+#endif  // PEGASUS_UTILS_HASHMAP_H
@@ -0,0 +1,82 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Random.h
+//! \author Pegasus Team
+//! \date   18th October 2026
+//! \brief  Deterministic pseudo-random number generator (xoshiro128**).
+//!         Same sequence on every platform, no global state, and independent
+//!         streams for parallel generation through Jump()
+
+#ifndef PEGASUS_UTILS_RANDOM_H
+#define PEGASUS_UTILS_RANDOM_H
+
+namespace Pegasus
+{
+namespace Utils
+{
+    //! Pseudo-random number generator with 128 bits of state and a period of 2^128 - 1.
+    //! Each generator is independent, so generators can be used concurrently on different threads.
+    //! To split a sequence between tasks, copy a seeded generator and call Jump() on the copies:
+    //! each jump skips 2^64 numbers, so the streams never overlap
+    class Random
+    {
+    public:
+        //! Constructor, seeds the generator
+        //! \param seed the seed of the sequence, the same seed always gives the same sequence
+        explicit Random(unsigned int seed = 0) { Seed(seed); }
+
+        //! Restarts the sequence from a seed
+        //! \param seed the seed of the sequence, the same seed always gives the same sequence
+        void Seed(unsigned int seed);
+
+        //! Gets the next number of the sequence
+        //! \return uniformly distributed 32 bits integer
+        inline unsigned int NextUInt32()
+        {
+            const unsigned int result = RotateLeft(mState[1] * 5, 7) * 9;
+            const unsigned int t = mState[1] << 9;
+            mState[2] ^= mState[0];
+            mState[3] ^= mState[1];
+            mState[1] ^= mState[2];
+            mState[0] ^= mState[3];
+            mState[2] ^= t;
+            mState[3] = RotateLeft(mState[3], 11);
+            return result;
+        }
+
+        //! Gets the next number of the sequence in a range
+        //! \param range number of possible values (> 0)
+        //! \return integer in [0, range), the bias is below range / 2^32
+        inline unsigned int NextUInt32(unsigned int range)
+        {
+            return static_cast<unsigned int>((static_cast<unsigned long long>(NextUInt32()) * range) >> 32);
+        }
+
+        //! Gets the next number of the sequence as a floating point number
+        //! \return float in [0, 1), with 24 bits of precision
+        inline float NextFloat()
+        {
+            return static_cast<float>(NextUInt32() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        //! Advances the sequence by 2^64 numbers, to start a stream that never overlaps the current one
+        void Jump();
+
+    private:
+        //! Rotates the bits of an integer to the left
+        static inline unsigned int RotateLeft(unsigned int value, int shift)
+        {
+            return (value << shift) | (value >> (32 - shift));
+        }
+
+        //! State of the generator, never all zeros
+        unsigned int mState[4];
+    };
+}
+}
+
+#endif  // PEGASUS_UTILS_RANDOM_H
@@ -15,8 +15,11 @@
 #include "Pegasus/Allocator/Alloc.h"
 #include "Pegasus/Core/Assertion.h"
 #include "Pegasus/Utils/TypeTraits.h"
+#include "Pegasus/Utils/Memcpy.h"
 #include "Pegasus/Memory/MemoryManager.h"
 
+#include <type_traits>
+
 
 namespace Pegasus
 {
@@ -29,7 +32,8 @@ namespace Alloc
 namespace Utils
 {
 
-//!The vector container class
+//! Type erased vector container, for elements whose size is only known at runtime.
+//! Prefer the typed Vector<T> below, which indexes without a multiplication by a runtime size.
 class BaseVector
 {
 public:
@@ -63,6 +67,10 @@ public:
     //! Pushes an empty object and returns its pointer
     void* PushEmpty();
 
+    //! Makes sure the vector can hold at least count elements without reallocating
+    //! \param count the minimum number of elements to hold
+    void Reserve(unsigned int count);
+
     //! Deletes all data
     void Clear();
 
@@ -92,17 +100,57 @@ private:
     Alloc::IAllocator* mAlloc;
 };
 
-//! The vector convenience template class
+//! Inline storage of a vector, used for the small buffer optimization.
+//! Short lists (listeners, property names) live inside the vector object itself
+//! and only spill to the heap once they outgrow the inline capacity.
+template<class T, unsigned int Capacity>
+struct VectorInlineStorage
+{
+    //! \return the inline buffer
+    T* GetBuffer() { return reinterpret_cast<T*>(mBuffer); }
+
+    //! \return the inline buffer
+    const T* GetBuffer() const { return reinterpret_cast<const T*>(mBuffer); }
+
+    //! raw memory for the inline elements, constructed in place by the vector
+    alignas(T) char mBuffer[Capacity * sizeof(T)];
+};
+
+//! Specialization with no inline storage, the vector is always heap allocated
 template<class T>
+struct VectorInlineStorage<T, 0>
+{
+    //! \return null, there is no inline buffer
+    T* GetBuffer() { return nullptr; }
+
+    //! \return null, there is no inline buffer
+    const T* GetBuffer() const { return nullptr; }
+};
+
+//! The vector convenience template class.
+//! Elements are stored contiguously and typed, so indexing compiles down to a pointer offset.
+//! Growth is geometric (x1.5) and non-POD elements are moved (not bitwise copied) when relocated,
+//! except the ones that cannot be moved.
+//! \param T type of the elements
+//! \param InlineCapacity number of elements stored inside the vector before allocating
+//!                       from the heap (0 to always use the allocator)
+template<class T, unsigned int InlineCapacity = 0>
 class Vector
 {
 public:
     //! Constructor
-    explicit Vector(Alloc::IAllocator* alloc) : mBase(alloc, sizeof(T)) {}
+    explicit Vector(Alloc::IAllocator* alloc)
+    :   mData(mInlineStorage.GetBuffer()), mSize(0), mCapacity(InlineCapacity), mAlloc(alloc) {}
+
+    Vector()
+    :   mData(mInlineStorage.GetBuffer()), mSize(0), mCapacity(InlineCapacity), mAlloc(Memory::GetGlobalAllocator()) {}
 
-    Vector() : mBase(Memory::GetGlobalAllocator(), sizeof(T)) {}
+    Vector(const Vector<T, InlineCapacity>& other)
+    :   mData(mInlineStorage.GetBuffer()), mSize(0), mCapacity(InlineCapacity), mAlloc(other.mAlloc) { *this = other; }
 
-    Vector(const Vector<T>& other) : mBase(nullptr, sizeof(T)) { *this = other; }
+    //! Move constructor, steals the heap buffer of the other vector when it has one
+    Vector(Vector<T, InlineCapacity>&& other)
+    :   mData(mInlineStorage.GetBuffer()), mSize(0), mCapacity(InlineCapacity), mAlloc(other.mAlloc) { TakeFrom(other); }
 
     //! Destructor
     ~Vector()
@@ -112,26 +160,47 @@ public:
     }
 
     //! Gets the size
-    inline unsigned int GetSize() const { return mBase.GetSize(); }
+    inline unsigned int GetSize() const { return mSize; }
+
+    //! \return number of elements that can be stored before the next reallocation
+    inline unsigned int GetCapacity() const { return mCapacity; }
+
+    //! \return the allocator
+    inline Alloc::IAllocator* GetAlloc() const { return mAlloc; }
 
     //! [] operator, just like an array
     inline T& operator[](unsigned int index) 
     {
-        T* t = reinterpret_cast<T*>(mBase.GetElement(index));
-        return *t;
+        PG_ASSERT(index < mSize);
+        return mData[index];
     }
 
     //! [] operator, just like an array
     inline const T& operator[](unsigned int index) const
     {
-        const T* t = reinterpret_cast<const T*>(mBase.GetElement(index));
-        return *t;
+        PG_ASSERT(index < mSize);
+        return mData[index];
+    }
+
+    //! Makes sure the vector can hold at least capacity elements without reallocating.
+    //! Use this before pushing a known number of elements.
+    //! \param capacity the minimum number of elements to hold
+    void Reserve(unsigned int capacity)
+    {
+        if (capacity > mCapacity)
+        {
+            Reallocate(capacity);
+        }
     }
 
     //! creates and pushes a new element
     T& PushEmpty()
     {
-        T* v = static_cast<T*>(mBase.PushEmpty());
+        if (mSize == mCapacity)
+        {
+            Grow(mSize + 1);
+        }
+        T* v = mData + mSize;
         if (TypeTraits<T>::IsPOD)
         {
             // If the type T is plain old data, just call the standard initialization
@@ -146,13 +215,49 @@ public:
             new (v) T();
 #pragma warning(pop)
         }
+        ++mSize;
+        return *v;
+    }
+
+    //! Pushes a copy of an element, the element can be part of this vector
+    //! \param value the element to copy
+    //! \return the new element
+    T& PushBack(const T& value)
+    {
+        if (mSize == mCapacity)
+        {
+            if (&value >= mData && &value < mData + mSize)
+            {
+                // The source lives in the buffer about to be relocated
+                const unsigned int index = static_cast<unsigned int>(&value - mData);
+                Grow(mSize + 1);
+                return EmplaceBack(mData[index]);
+            }
+            Grow(mSize + 1);
+        }
+        return EmplaceBack(value);
+    }
+
+    //! Constructs a new element in place at the end of the vector
+    //! \param args arguments forwarded to the constructor of T. They must not refer
+    //!             to elements of this vector, since a reallocation can invalidate them
+    //! \return the new element
+    template<class... Args>
+    T& EmplaceBack(Args&&... args)
+    {
+        if (mSize == mCapacity)
+        {
+            Grow(mSize + 1);
+        }
+        T* v = new (mData + mSize) T(static_cast<Args&&>(args)...);
+        ++mSize;
         return *v;
     }
 
     T Pop()
     {
-        // Use a reference to avoid creating a local copy, which then gets copied again when returned.
-        T& val = (*this)[GetSize() - 1];
+        // Move the value out before destroying the last element
+        T val(static_cast<T&&>((*this)[GetSize() - 1]));
         Delete(GetSize() - 1);
         return val;
     }
@@ -160,53 +265,209 @@ public:
     //! deletes element at specified index
     void Delete(unsigned int i)
     {
-        if (!TypeTraits<T>::IsPOD)
-        {
-            // Call the destructor only for complex types
-            ((*this)[i]).~T();
-        }
-        mBase.Delete(i);
+        PG_ASSERT(i < mSize);
+        DeleteElement(i, typename RelocationTraits::IsMoved());
+        --mSize;
+    }
+
+    //! Removes all the elements and keeps the memory, for vectors refilled repeatedly
+    void Reset()
+    {
+        DestroyRange(mData, mSize);
+        mSize = 0;
     }
 
     void Clear()
     {
-        if (!TypeTraits<T>::IsPOD)
+        DestroyRange(mData, mSize);
+        if (!IsInline())
         {
-            // Call the destructor of each element for complex types
-            const unsigned int size = GetSize();
-            for (unsigned int i = 0; i < size; ++i)
-            {
-                ((*this)[i]).~T();
-            }
+            PG_DELETE_ARRAY(mAlloc, reinterpret_cast<char*>(mData));
         }
-        mBase.Clear();
+        mData = mInlineStorage.GetBuffer();
+        mSize = 0;
+        mCapacity = InlineCapacity;
     }
 
     T* Data()
     {
-        return static_cast<T*>(mBase.Data());
+        return mData;
     }
 
     const T* Data() const
     {
-        return static_cast<const T*>(mBase.Data());
+        return mData;
     }
 
-    Vector<T>& operator=(const Vector<T>& other)
+    Vector<T, InlineCapacity>& operator=(const Vector<T, InlineCapacity>& other)
     {
-        Clear();
-        mBase.SetAlloc(other.mBase.GetAlloc());
-        for (unsigned i = 0; i < other.GetSize(); ++i)
+        if (this != &other)
+        {
+            Clear();
+            mAlloc = other.mAlloc;
+            Reserve(other.GetSize());
+            for (unsigned i = 0; i < other.GetSize(); ++i)
+            {
+                new (mData + i) T(other[i]);
+            }
+            mSize = other.GetSize();
+        }
+        return *this;
+    }
+
+    Vector<T, InlineCapacity>& operator=(Vector<T, InlineCapacity>&& other)
+    {
+        if (this != &other)
         {
-            PushEmpty() = other[i];
+            Clear();
+            mAlloc = other.mAlloc;
+            TakeFrom(other);
         }
         return *this;
     }
 
 private:
-    BaseVector mBase;
+    //! Minimum number of elements allocated when growing from an empty heap buffer
+    static const unsigned int MIN_HEAP_CAPACITY = 16;
+
+    //! \return true if the elements are in the inline buffer (or there is no buffer at all)
+    bool IsInline() const { return mData == mInlineStorage.GetBuffer(); }
+
+    //! Grows the capacity geometrically
+    //! \param minCapacity minimum number of elements required after the growth
+    void Grow(unsigned int minCapacity)
+    {
+        unsigned int newCapacity = mCapacity + (mCapacity >> 1);
+        if (newCapacity < MIN_HEAP_CAPACITY)
+        {
+            newCapacity = MIN_HEAP_CAPACITY;
+        }
+        if (newCapacity < minCapacity)
+        {
+            newCapacity = minCapacity;
+        }
+        Reallocate(newCapacity);
+    }
+
+    //! Moves the elements to a new heap buffer
+    //! \param newCapacity number of elements of the new buffer, >= mSize
+    void Reallocate(unsigned int newCapacity)
+    {
+        PG_ASSERT(newCapacity >= mSize);
+        T* newData = reinterpret_cast<T*>(PG_NEW_ARRAY(mAlloc, -1, "Vector Page", Alloc::PG_MEM_PERM, char, newCapacity * sizeof(T)));
+        Relocate(newData, mData, mSize);
+        if (!IsInline())
+        {
+            PG_DELETE_ARRAY(mAlloc, reinterpret_cast<char*>(mData));
+        }
+        mData = newData;
+        mCapacity = newCapacity;
+    }
+
+    //! Moves the content of another vector into this empty vector, leaving the other one empty
+    //! \param other the vector to take the elements from
+    void TakeFrom(Vector<T, InlineCapacity>& other)
+    {
+        PG_ASSERT(mSize == 0 && IsInline());
+        if (other.IsInline())
+        {
+            // Inline elements cannot be stolen, move them one by one
+            Relocate(mData, other.mData, other.mSize);
+            mSize = other.mSize;
+        }
+        else
+        {
+            mData = other.mData;
+            mSize = other.mSize;
+            mCapacity = other.mCapacity;
+            other.mData = other.mInlineStorage.GetBuffer();
+            other.mCapacity = InlineCapacity;
+        }
+        other.mSize = 0;
+    }
+
+    //! Selects how the elements are relocated. Complex types are moved, POD types and the types
+    //! that cannot be moved (such as the ones using PG_DISABLE_COPY) are copied bitwise,
+    //! as the type erased vector does
+    struct RelocationTraits
+    {
+        typedef std::integral_constant<bool, !TypeTraits<T>::IsPOD && std::is_move_constructible<T>::value> IsMoved;
+    };
+
+    //! Moves count elements from src to uninitialized memory in dst, and destroys the sources
+    static void Relocate(T* dst, T* src, unsigned int count)
+    {
+        RelocateElements(dst, src, count, typename RelocationTraits::IsMoved());
+    }
+
+    //! Relocate() for the types moved element by element
+    static void RelocateElements(T* dst, T* src, unsigned int count, std::true_type)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            new (dst + i) T(static_cast<T&&>(src[i]));
+            src[i].~T();
+        }
+    }
+
+    //! Relocate() for the types copied bitwise, the sources are not destroyed
+    static void RelocateElements(T* dst, T* src, unsigned int count, std::false_type)
+    {
+        if (count > 0)
+        {
+            Utils::Memcpy(dst, src, count * sizeof(T));
+        }
+    }
+
+    //! Delete() for the types moved element by element
+    void DeleteElement(unsigned int i, std::true_type)
+    {
+        // Shift the tail down, then call the destructor only on the last (moved from) element
+        for (unsigned int j = i; j + 1 < mSize; ++j)
+        {
+            mData[j] = static_cast<T&&>(mData[j + 1]);
+        }
+        mData[mSize - 1].~T();
+    }
+
+    //! Delete() for the types copied bitwise
+    void DeleteElement(unsigned int i, std::false_type)
+    {
+        DestroyRange(mData + i, 1);
+        if (i < mSize - 1)
+        {
+            Utils::Memcpy(mData + i, mData + i + 1, (mSize - i - 1) * sizeof(T));
+        }
+    }
+
+    //! Calls the destructors of count elements for complex types
+    static void DestroyRange(T* data, unsigned int count)
+    {
+        if (!TypeTraits<T>::IsPOD)
+        {
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                data[i].~T();
+            }
+        }
+    }
+
+    //! small buffer, used while the size is at most InlineCapacity,
+    //! declared before mData so it is constructed when mData points to it
+    VectorInlineStorage<T, InlineCapacity> mInlineStorage;
+
+    //! pointer to the first element, either the inline buffer or a heap buffer
+    T* mData;
+
+    //! the current size of the vector
+    unsigned int mSize;
+
+    //! capacity of the current buffer
+    unsigned int mCapacity;
+
+    //! the allocator
+    Alloc::IAllocator* mAlloc;
 
-    
 };
 
 